@@ -0,0 +1,22 @@
+#pragma once
+
+#ifndef MATHLIB_GEOMETRY
+#define MATHLIB_GEOMETRY
+
+/**
+*	\file Geometry.hpp
+*
+*	\brief Collection including all bounding volumes and geometric primitives headers.
+*/
+
+#include <Geometry/AABB.hpp>
+#include <Geometry/OBB.hpp>
+#include <Geometry/Plane.hpp>
+#include <Geometry/Sphere.hpp>
+#include <Geometry/Frustum.hpp>
+#include <Geometry/Ray.hpp>
+#include <Geometry/Triangle.hpp>
+#include <Geometry/Intersection.hpp>
+#include <Geometry/Fit.hpp>
+
+#endif
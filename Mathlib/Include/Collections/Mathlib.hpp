@@ -14,16 +14,57 @@
 #include <Misc/Trigonometry.hpp>
 #include <Misc/Constants.hpp>
 #include <Misc/Common.hpp>
+#include <Misc/Parallel.hpp>
+#include <Misc/Unroll.hpp>
+#include <Misc/Fixed.hpp>
+#include <Misc/Half.hpp>
+#include <Misc/AlignedAllocator.hpp>
 
 #include <Space/Vec2.hpp>
 #include <Space/Vec3.hpp>
 #include <Space/Vec4.hpp>
 #include <Space/Quaternion.hpp>
+#include <Space/Vec.hpp>
+#include <Space/FixedQuat.hpp>
+#include <Space/HalfVec.hpp>
+#include <Space/IntVec.hpp>
+#include <Space/VecExpression.hpp>
 
 #include <Matrix/Mat2.hpp>
 #include <Matrix/Mat3.hpp>
 #include <Matrix/Mat4.hpp>
+#include <Matrix/Mat.hpp>
+#include <Matrix/DenseMat.hpp>
+#include <Matrix/SparseMat.hpp>
+#include <Matrix/BlockSparseMat3.hpp>
+#include <Matrix/ConjugateGradient.hpp>
+#include <Matrix/LinearSolve.hpp>
+#include <Matrix/LeastSquares.hpp>
+#include <Matrix/Decomposition.hpp>
 
 #include <Transform/Transform.hpp>
+#include <Transform/Transformd.hpp>
+#include <Transform/LargeWorld.hpp>
+#include <Transform/FixedTransform.hpp>
+
+#include <Geometry/AABB.hpp>
+#include <Geometry/OBB.hpp>
+#include <Geometry/Plane.hpp>
+#include <Geometry/Sphere.hpp>
+#include <Geometry/Frustum.hpp>
+#include <Geometry/Ray.hpp>
+#include <Geometry/Triangle.hpp>
+#include <Geometry/Intersection.hpp>
+#include <Geometry/Fit.hpp>
+
+#include <Spatial/BVH.hpp>
+#include <Spatial/SpatialHash.hpp>
+#include <Spatial/LooseOctree.hpp>
+#include <Spatial/KDTree.hpp>
+#include <Spatial/SweepAndPrune.hpp>
+
+#include <Physics/ConvexShape.hpp>
+#include <Physics/GJK.hpp>
+#include <Physics/RigidBodyStore.hpp>
 
 #endif
\ No newline at end of file
@@ -12,5 +12,13 @@
 #include <Matrix/Mat2.hpp>
 #include <Matrix/Mat3.hpp>
 #include <Matrix/Mat4.hpp>
+#include <Matrix/Mat.hpp>
+#include <Matrix/DenseMat.hpp>
+#include <Matrix/SparseMat.hpp>
+#include <Matrix/BlockSparseMat3.hpp>
+#include <Matrix/ConjugateGradient.hpp>
+#include <Matrix/LinearSolve.hpp>
+#include <Matrix/LeastSquares.hpp>
+#include <Matrix/Decomposition.hpp>
 
 #endif
\ No newline at end of file
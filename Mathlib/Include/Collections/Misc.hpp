@@ -14,5 +14,10 @@
 #include <Misc/Trigonometry.hpp>
 #include <Misc/Constants.hpp>
 #include <Misc/Common.hpp>
+#include <Misc/Parallel.hpp>
+#include <Misc/Unroll.hpp>
+#include <Misc/Fixed.hpp>
+#include <Misc/Half.hpp>
+#include <Misc/AlignedAllocator.hpp>
 
 #endif
\ No newline at end of file
@@ -0,0 +1,16 @@
+#pragma once
+
+#ifndef MATHLIB_PHYSICS
+#define MATHLIB_PHYSICS
+
+/**
+*	\file Physics.hpp
+*
+*	\brief Collection including all physics headers.
+*/
+
+#include <Physics/ConvexShape.hpp>
+#include <Physics/GJK.hpp>
+#include <Physics/RigidBodyStore.hpp>
+
+#endif
@@ -13,5 +13,10 @@
 #include <Space/Vec3.hpp>
 #include <Space/Vec4.hpp>
 #include <Space/Quaternion.hpp>
+#include <Space/Vec.hpp>
+#include <Space/FixedQuat.hpp>
+#include <Space/HalfVec.hpp>
+#include <Space/IntVec.hpp>
+#include <Space/VecExpression.hpp>
 
 #endif
\ No newline at end of file
@@ -0,0 +1,18 @@
+#pragma once
+
+#ifndef MATHLIB_SPATIAL
+#define MATHLIB_SPATIAL
+
+/**
+*	\file Spatial.hpp
+*
+*	\brief Collection including all spatial acceleration structures headers.
+*/
+
+#include <Spatial/BVH.hpp>
+#include <Spatial/SpatialHash.hpp>
+#include <Spatial/LooseOctree.hpp>
+#include <Spatial/KDTree.hpp>
+#include <Spatial/SweepAndPrune.hpp>
+
+#endif
@@ -0,0 +1,305 @@
+#pragma once
+
+#ifndef MATHLIB_AABB
+#define MATHLIB_AABB
+
+#include <cstddef>
+#include <string>
+
+#include "Misc/DllExport.hpp"
+#include "Misc/Constants.hpp"
+#include <Space/Vec3.hpp>
+
+/**
+*	\file AABB.hpp
+*
+*	\brief Axis aligned bounding box type implementation.
+*/
+
+namespace Mathlib
+{
+	struct Mat4;
+	struct Transform;
+
+	/**
+	*	\brief Axis aligned bounding box struct defined by its minimum and maximum corners.
+	*/
+	struct MATHLIBRARY_API AABB
+	{
+		/// Box minimum corner.
+		Vec3 min;
+
+		/// Box maximum corner.
+		Vec3 max;
+
+		//Constants
+
+		/**
+		*	\brief Empty box constant, min set to +max float and max set to -max float.
+		*	Union of any box with Empty returns that box.
+		*/
+		static const AABB Empty;
+
+		//Constructors
+
+		/**
+		*	\brief Default constructor
+		*/
+		AABB() = default;
+
+		/**
+		*	\brief Value constructor
+		*
+		*	\param[in] _min box minimum corner.
+		*	\param[in] _max box maximum corner.
+		*/
+		AABB(const Vec3& _min, const Vec3& _max) noexcept;
+
+		/**
+		*	\brief Default copy constructor
+		*/
+		AABB(const AABB& _aabb) = default;
+
+		/**
+		*	\brief Default move constructor
+		*/
+		AABB(AABB&& _aabb) = default;
+
+		//Static Methods
+
+		/**
+		*	\brief Create a box from its center and half extents.
+		*
+		*	\param[in] _center box center.
+		*	\param[in] _extents box half size on each axis.
+		*
+		*	\return box centered on _center.
+		*/
+		static AABB FromCenterExtents(const Vec3& _center, const Vec3& _extents) noexcept;
+
+		/**
+		*	\brief Compute the smallest box enclosing a set of points.
+		*
+		*	\param[in] _points points to enclose.
+		*	\param[in] _count number of points.
+		*
+		*	\return box enclosing all points, Empty if _count is 0.
+		*/
+		static AABB FromPoints(const Vec3* _points, size_t _count) noexcept;
+
+		/**
+		*	\brief Compute the smallest box enclosing two boxes.
+		*
+		* 	\param[in] _lhs left hand side operand to compute union with.
+		* 	\param[in] _rhs right hand side operand to compute union with.
+		*
+		*	\return union of _lhs and _rhs.
+		*/
+		static AABB Union(const AABB& _lhs, const AABB& _rhs) noexcept;
+
+		/**
+		*	\brief Compute the overlapping box between two boxes.
+		*	Result is not valid (see IsValid()) if boxes do not overlap.
+		*
+		* 	\param[in] _lhs left hand side operand to compute intersection with.
+		* 	\param[in] _rhs right hand side operand to compute intersection with.
+		*
+		*	\return intersection of _lhs and _rhs.
+		*/
+		static AABB Intersection(const AABB& _lhs, const AABB& _rhs) noexcept;
+
+		//Batch
+
+		/**
+		*	\brief Compute the box enclosing an array of boxes.
+		*
+		*	\param[in] _boxes boxes to merge.
+		*	\param[in] _count number of boxes.
+		*
+		*	\return union of all boxes, Empty if _count is 0.
+		*/
+		static AABB UnionBatch(const AABB* _boxes, size_t _count) noexcept;
+
+		/**
+		*	\brief Transform an array of boxes, each one by its own matrix.
+		*	_in and _out may point to the same array.
+		*
+		*	\param[in] _in boxes to transform.
+		*	\param[in] _matrices affine matrices, one per box.
+		*	\param[out] _out transformed boxes.
+		*	\param[in] _count number of boxes.
+		*/
+		static void TransformBatch(const AABB* _in, const Mat4* _matrices, AABB* _out, size_t _count) noexcept;
+
+		/**
+		*	\brief Transform an array of boxes by the same matrix.
+		*	_in and _out may point to the same array.
+		*
+		*	\param[in] _in boxes to transform.
+		*	\param[in] _matrix affine matrix applied on all boxes.
+		*	\param[out] _out transformed boxes.
+		*	\param[in] _count number of boxes.
+		*/
+		static void TransformBatch(const AABB* _in, const Mat4& _matrix, AABB* _out, size_t _count) noexcept;
+
+		/**
+		*	\brief Transform an array of boxes, each one by its own transform.
+		*	_in and _out may point to the same array.
+		*
+		*	\param[in] _in boxes to transform.
+		*	\param[in] _transforms transforms, one per box.
+		*	\param[out] _out transformed boxes.
+		*	\param[in] _count number of boxes.
+		*/
+		static void TransformBatch(const AABB* _in, const Transform* _transforms, AABB* _out, size_t _count) noexcept;
+
+		//Equality
+
+		/**
+		*	\brief Check if min is lower or equal to max on all axis.
+		*/
+		bool IsValid() const noexcept;
+
+		/**
+		*	\brief Compare this box with with _other
+		*
+		*	\param[in] _other other box to do the comparison with.
+		* 	\param[in] _epsilon threshold to accept equality.
+		*
+		*	\return if this and _other are equal.
+		*/
+		bool Equals(const AABB& _other, float _epsilon = Math::FloatEpsilon) const noexcept;
+
+		/**
+		*	\brief Operator to compare this box with with _rhs
+		*
+		*	\param[in] _rhs right hand side operand to do the comparison with.
+		*
+		*	\return if this and _rhs are equal.
+		*/
+		bool operator==(const AABB& _rhs) const noexcept;
+
+		/**
+		*	\brief Operator to compare this box with with _rhs.
+		*
+		*	\param[in] _rhs right hand side operand to do the comparison with.
+		*
+		*	\return if this and _rhs are different.
+		*/
+		bool operator!=(const AABB& _rhs) const noexcept;
+
+		//Accessors
+
+		/**
+		*	\brief return the center of this box.
+		*/
+		Vec3 GetCenter() const noexcept;
+
+		/**
+		*	\brief return the half size of this box on each axis.
+		*/
+		Vec3 GetExtents() const noexcept;
+
+		/**
+		*	\brief return the size of this box on each axis.
+		*/
+		Vec3 GetSize() const noexcept;
+
+		/**
+		*	\brief return the surface area of this box.
+		*/
+		float GetSurfaceArea() const noexcept;
+
+		/**
+		*	\brief return the volume of this box.
+		*/
+		float GetVolume() const noexcept;
+
+		//Methods
+
+		/**
+		*	\brief Check if a point is inside this box, bounds included.
+		*
+		*	\param[in] _point point to test.
+		*/
+		bool Contains(const Vec3& _point) const noexcept;
+
+		/**
+		*	\brief Check if a box is fully inside this box, bounds included.
+		*
+		*	\param[in] _other box to test.
+		*/
+		bool Contains(const AABB& _other) const noexcept;
+
+		/**
+		*	\brief Check if this box overlaps with _other, touching boxes overlap.
+		*
+		*	\param[in] _other box to test.
+		*/
+		bool Intersects(const AABB& _other) const noexcept;
+
+		/**
+		*	\brief Grow this box to enclose _point and return it.
+		*
+		*	\param[in] _point point to enclose.
+		*/
+		AABB& Encapsulate(const Vec3& _point) noexcept;
+
+		/**
+		*	\brief Grow this box to enclose _other and return it.
+		*
+		*	\param[in] _other box to enclose.
+		*/
+		AABB& Encapsulate(const AABB& _other) noexcept;
+
+		/**
+		*	\brief Return the closest point of this box to _point.
+		*
+		*	\param[in] _point point to clamp in this box.
+		*/
+		Vec3 ClosestPoint(const Vec3& _point) const noexcept;
+
+		/**
+		*	\brief Compute the box enclosing this box transformed by an affine matrix (Arvo's method). Inverted boxes such as Empty are returned unchanged.
+		*
+		*	\param[in] _matrix affine matrix to apply.
+		*
+		*	\return transformed box.
+		*/
+		AABB GetTransformed(const Mat4& _matrix) const noexcept;
+
+		/**
+		*	\brief Compute the box enclosing this box transformed by _transform (Arvo's method). Inverted boxes such as Empty are returned unchanged.
+		*
+		*	\param[in] _transform transform to apply, scale included.
+		*
+		*	\return transformed box.
+		*/
+		AABB GetTransformed(const Transform& _transform) const noexcept;
+
+		//Operator
+
+		/**
+		*	\brief Default move assignement.
+		*
+		*	\return self box assigned.
+		*/
+		AABB& operator=(AABB&&) = default;
+
+		/**
+		*	\brief Default copy assignement.
+		*
+		*	\return self box assigned.
+		*/
+		AABB& operator=(const AABB&) = default;
+
+		//Debug
+
+		/**
+		*	\brief return box values as string.
+		*/
+		std::string ToString() const noexcept;
+	};
+}
+
+#endif
@@ -0,0 +1,96 @@
+#pragma once
+
+#ifndef MATHLIB_FIT
+#define MATHLIB_FIT
+
+#include <cstddef>
+
+#include "Misc/DllExport.hpp"
+#include <Space/Vec2.hpp>
+#include <Space/Vec3.hpp>
+
+/**
+*	\file Fit.hpp
+*
+*	\brief Least squares fitting of planes, spheres, lines and polynomial curves to point sets.
+*
+*	Points are accumulated block by block into a StreamingLeastSquares problem relative to the first point,
+*	so memory does not grow with the number of points. Blocks have a fixed size and are merged in order,
+*	results do not depend on the number of threads.
+*/
+
+namespace Mathlib
+{
+	struct Plane;
+	struct Sphere;
+	struct Ray;
+
+	namespace Fit
+	{
+		/**
+		*	\brief Compute the plane minimizing the squared distances to points.
+		*
+		*	\param[in] _points points to fit.
+		*	\param[in] _count number of points.
+		*	\param[out] _result plane through the points centroid, only written on success.
+		*	\param[in] _multithreaded split points across threads.
+		*
+		*	\return false when there are less than 3 points or they are collinear.
+		*/
+		MATHLIBRARY_API bool BestPlane(const Vec3* _points, size_t _count, Plane& _result, bool _multithreaded = false);
+
+		/**
+		*	\brief Compute the sphere minimizing the algebraic distances |p - center|^2 - radius^2 to points.
+		*
+		*	\param[in] _points points to fit.
+		*	\param[in] _count number of points.
+		*	\param[out] _result fitted sphere, only written on success.
+		*	\param[in] _multithreaded split points across threads.
+		*
+		*	\return false when there are less than 4 points or they are coplanar.
+		*/
+		MATHLIBRARY_API bool BestSphere(const Vec3* _points, size_t _count, Sphere& _result, bool _multithreaded = false);
+
+		/**
+		*	\brief Compute the line minimizing the squared distances to points.
+		*
+		*	\param[in] _points points to fit.
+		*	\param[in] _count number of points.
+		*	\param[out] _result line with the points centroid as origin and a normalized direction, only written on success.
+		*	\param[in] _multithreaded split points across threads.
+		*
+		*	\return false when there are less than 2 points or they are all equal.
+		*/
+		MATHLIBRARY_API bool BestLine(const Vec3* _points, size_t _count, Ray& _result, bool _multithreaded = false);
+
+		/**
+		*	\brief Compute the 2D line minimizing the squared distances to points.
+		*
+		*	\param[in] _points points to fit.
+		*	\param[in] _count number of points.
+		*	\param[out] _point centroid of the points, only written on success.
+		*	\param[out] _direction normalized direction of the line, only written on success.
+		*	\param[in] _multithreaded split points across threads.
+		*
+		*	\return false when there are less than 2 points or they are all equal.
+		*/
+		MATHLIBRARY_API bool BestLine(const Vec2* _points, size_t _count, Vec2& _point, Vec2& _direction, bool _multithreaded = false);
+
+		/**
+		*	\brief Compute the polynomial y = c0 + c1 * x + ... + cn * x^n minimizing the squared vertical distances to points.
+		*	Abscissas are mapped to [-1, 1] during the fit to keep the problem well conditioned.
+		*
+		*	\param[in] _points points to fit, (x, y).
+		*	\param[in] _count number of points.
+		*	\param[in] _degree degree n of the polynomial.
+		*	\param[out] _coefficients _degree + 1 coefficients by increasing power, only written on success.
+		*	\param[in] _multithreaded split points across threads.
+		*
+		*	\return false when there are less than _degree + 1 distinct abscissas.
+		*/
+		MATHLIBRARY_API bool BestPolynomial(const Vec2* _points, size_t _count, size_t _degree, float* _coefficients,
+			bool _multithreaded = false);
+	}
+}
+
+#endif
@@ -0,0 +1,180 @@
+#pragma once
+
+#ifndef MATHLIB_FRUSTUM
+#define MATHLIB_FRUSTUM
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Misc/DllExport.hpp"
+#include "Misc/Common.hpp"
+#include <Geometry/Plane.hpp>
+
+/**
+*	\file Frustum.hpp
+*
+*	\brief View frustum type implementation and batched culling.
+*/
+
+namespace Mathlib
+{
+	struct Vec3;
+	struct Mat4;
+	struct AABB;
+	struct Sphere;
+
+	/**
+	*	\brief Index of each plane in Frustum::planes.
+	*/
+	enum class FRUSTUM_PLANE
+	{
+		LEFT,
+		RIGHT,
+		BOTTOM,
+		TOP,
+		NEAR_CLIP,
+		FAR_CLIP
+	};
+
+	/**
+	*	\brief View frustum struct defined by six normalized planes facing inward.
+	*/
+	struct MATHLIBRARY_API Frustum
+	{
+		/// Number of planes in a frustum.
+		static constexpr unsigned int PlaneCount = 6;
+
+		/// Frustum planes ordered as FRUSTUM_PLANE, normals point inside the frustum.
+		Plane planes[PlaneCount];
+
+		//Constructors
+
+		/**
+		*	\brief Default constructor
+		*/
+		Frustum() = default;
+
+		/**
+		*	\brief Extract frustum planes from a view projection matrix (Gribb-Hartmann).
+		*	Matrix is expected to map depth to [0, 1] as Mat4::PerspectiveMatrix does.
+		*
+		*	\param[in] _view_projection projection matrix multiplied by the world to view matrix.
+		*/
+		Frustum(const Mat4& _view_projection) noexcept;
+
+		/**
+		*	\brief Default copy constructor
+		*/
+		Frustum(const Frustum& _frustum) = default;
+
+		/**
+		*	\brief Default move constructor
+		*/
+		Frustum(Frustum&& _frustum) = default;
+
+		//Static Methods
+
+		/**
+		*	\brief Create the frustum of a perspective camera.
+		*	Equivalent to Frustum(Mat4::PerspectiveMatrix(...) * Mat4::InvViewMatrix(...)).
+		*
+		*	\param[in] _coordinate_system coordinate system used by the camera.
+		*	\param[in] _eye camera position.
+		*	\param[in] _forward camera look at direction.
+		*	\param[in] _up camera up vector.
+		*	\param[in] _fovy Y axis field of view in radian.
+		*	\param[in] _aspect aspect ratio of the render window.
+		*	\param[in] _near near depth clipping plane.
+		*	\param[in] _far far depth clipping plane.
+		*/
+		static Frustum FromCamera(COORDINATE_SYSTEM _coordinate_system, const Vec3& _eye, const Vec3& _forward, const Vec3& _up,
+			float _fovy, float _aspect, float _near, float _far);
+
+		//Accessors
+
+		/**
+		*	\brief Get a frustum plane.
+		*
+		*	\param[in] _plane plane to get.
+		*/
+		const Plane& GetPlane(FRUSTUM_PLANE _plane) const noexcept;
+
+		//Methods
+
+		/**
+		*	\brief Check if a point is inside the frustum.
+		*
+		*	\param[in] _point point to test.
+		*/
+		bool Contains(const Vec3& _point) const noexcept;
+
+		/**
+		*	\brief Check if a sphere is at least partially inside the frustum.
+		*	Conservative: spheres near frustum corners can be reported visible.
+		*
+		*	\param[in] _sphere sphere to test.
+		*/
+		bool Intersects(const Sphere& _sphere) const noexcept;
+
+		/**
+		*	\brief Check if a box is at least partially inside the frustum.
+		*	Conservative: boxes near frustum corners can be reported visible.
+		*
+		*	\param[in] _aabb box to test.
+		*/
+		bool Intersects(const AABB& _aabb) const noexcept;
+
+		//Batch
+
+		/**
+		*	\brief Test an array of spheres against the frustum.
+		*	Bit i % 32 of _visibility[i / 32] is set if sphere i is visible.
+		*
+		*	\param[in] _spheres spheres to test.
+		*	\param[in] _count number of spheres.
+		*	\param[out] _visibility bitmask of (_count + 31) / 32 words, fully overwritten.
+		*/
+		void CullSpheres(const Sphere* _spheres, size_t _count, uint32_t* _visibility) const noexcept;
+
+		/**
+		*	\brief Test spheres stored as separate component streams against the frustum.
+		*	Bit i % 32 of _visibility[i / 32] is set if sphere i is visible.
+		*
+		*	\param[in] _x spheres center X components.
+		*	\param[in] _y spheres center Y components.
+		*	\param[in] _z spheres center Z components.
+		*	\param[in] _radius spheres radius.
+		*	\param[in] _count number of spheres.
+		*	\param[out] _visibility bitmask of (_count + 31) / 32 words, fully overwritten.
+		*/
+		void CullSpheres(const float* _x, const float* _y, const float* _z, const float* _radius, size_t _count, uint32_t* _visibility) const noexcept;
+
+		/**
+		*	\brief Test an array of boxes against the frustum.
+		*	Bit i % 32 of _visibility[i / 32] is set if box i is visible.
+		*
+		*	\param[in] _boxes boxes to test.
+		*	\param[in] _count number of boxes.
+		*	\param[out] _visibility bitmask of (_count + 31) / 32 words, fully overwritten.
+		*/
+		void CullAABBs(const AABB* _boxes, size_t _count, uint32_t* _visibility) const noexcept;
+
+		//Operator
+
+		/**
+		*	\brief Default move assignement.
+		*
+		*	\return self frustum assigned.
+		*/
+		Frustum& operator=(Frustum&&) = default;
+
+		/**
+		*	\brief Default copy assignement.
+		*
+		*	\return self frustum assigned.
+		*/
+		Frustum& operator=(const Frustum&) = default;
+	};
+}
+
+#endif
@@ -0,0 +1,140 @@
+#pragma once
+
+#ifndef MATHLIB_INTERSECTION
+#define MATHLIB_INTERSECTION
+
+#include <cstdint>
+
+#include "Misc/DllExport.hpp"
+#include <Geometry/Ray.hpp>
+
+/**
+*	\file Intersection.hpp
+*
+*	\brief Ray intersection queries against geometric primitives, for single rays and ray packets.
+*
+*	Packet functions test every lane of a RayPacket against the same primitive.
+*	Their _distance array is read and written: on input it holds the maximum accepted
+*	distance of each lane, on output hit lanes receive their hit distance and missed lanes are left untouched,
+*	so successive calls naturally keep the closest hit. They return a mask with bit i set if lane i hit.
+*/
+
+namespace Mathlib
+{
+	struct Plane;
+	struct Sphere;
+	struct AABB;
+	struct Triangle;
+
+	namespace Intersection
+	{
+		/**
+		*	\brief Compute the intersection of a ray with a plane, both plane sides are hit.
+		*
+		*	\param[in] _ray ray to cast.
+		*	\param[in] _plane plane to test.
+		*	\param[out] _distance distance along the ray of the hit, only written on hit.
+		*
+		*	\return if the ray hits the plane in front of its origin.
+		*/
+		MATHLIBRARY_API bool RayPlane(const Ray& _ray, const Plane& _plane, float& _distance) noexcept;
+
+		/**
+		*	\brief Compute the intersection of a ray with a sphere.
+		*
+		*	\param[in] _ray ray to cast.
+		*	\param[in] _sphere sphere to test.
+		*	\param[out] _distance distance along the ray of the entry point, 0 if the origin is inside, only written on hit.
+		*
+		*	\return if the ray hits the sphere.
+		*/
+		MATHLIBRARY_API bool RaySphere(const Ray& _ray, const Sphere& _sphere, float& _distance) noexcept;
+
+		/**
+		*	\brief Compute the intersection of a ray with a box using the slab method.
+		*
+		*	\param[in] _ray ray to cast.
+		*	\param[in] _aabb box to test.
+		*	\param[out] _distance distance along the ray of the entry point, 0 if the origin is inside, only written on hit.
+		*
+		*	\return if the ray hits the box.
+		*/
+		MATHLIBRARY_API bool RayAABB(const Ray& _ray, const AABB& _aabb, float& _distance) noexcept;
+
+		/**
+		*	\brief Compute the intersection of a ray with a triangle (Moller-Trumbore), both faces are hit.
+		*
+		*	\param[in] _ray ray to cast.
+		*	\param[in] _triangle triangle to test.
+		*	\param[out] _distance distance along the ray of the hit, only written on hit.
+		*
+		*	\return if the ray hits the triangle.
+		*/
+		MATHLIBRARY_API bool RayTriangle(const Ray& _ray, const Triangle& _triangle, float& _distance) noexcept;
+
+		/**
+		*	\brief Compute the intersection of a ray with a triangle (Moller-Trumbore), both faces are hit.
+		*
+		*	\param[in] _ray ray to cast.
+		*	\param[in] _triangle triangle to test.
+		*	\param[out] _distance distance along the ray of the hit, only written on hit.
+		*	\param[out] _u barycentric weight of the triangle second vertex, only written on hit.
+		*	\param[out] _v barycentric weight of the triangle third vertex, only written on hit.
+		*
+		*	\return if the ray hits the triangle.
+		*/
+		MATHLIBRARY_API bool RayTriangle(const Ray& _ray, const Triangle& _triangle, float& _distance, float& _u, float& _v) noexcept;
+
+		//Packets
+
+		/**
+		*	\brief Intersect every ray of a packet with a plane.
+		*
+		*	\param[in] _packet rays to cast.
+		*	\param[in] _plane plane to test.
+		*	\param[in,out] _distance N maximum distances, receive hit distances.
+		*
+		*	\return mask of lanes hitting the plane.
+		*/
+		template<unsigned int N>
+		MATHLIBRARY_API uint32_t RayPlane(const RayPacket<N>& _packet, const Plane& _plane, float* _distance) noexcept;
+
+		/**
+		*	\brief Intersect every ray of a packet with a sphere.
+		*
+		*	\param[in] _packet rays to cast.
+		*	\param[in] _sphere sphere to test.
+		*	\param[in,out] _distance N maximum distances, receive hit distances.
+		*
+		*	\return mask of lanes hitting the sphere.
+		*/
+		template<unsigned int N>
+		MATHLIBRARY_API uint32_t RaySphere(const RayPacket<N>& _packet, const Sphere& _sphere, float* _distance) noexcept;
+
+		/**
+		*	\brief Intersect every ray of a packet with a box using the slab method.
+		*
+		*	\param[in] _packet rays to cast.
+		*	\param[in] _aabb box to test.
+		*	\param[in,out] _distance N maximum distances, receive hit distances.
+		*
+		*	\return mask of lanes hitting the box.
+		*/
+		template<unsigned int N>
+		MATHLIBRARY_API uint32_t RayAABB(const RayPacket<N>& _packet, const AABB& _aabb, float* _distance) noexcept;
+
+		/**
+		*	\brief Intersect every ray of a packet with a triangle (Moller-Trumbore).
+		*
+		*	\param[in] _packet rays to cast.
+		*	\param[in] _triangle triangle to test.
+		*	\param[in,out] _distance N maximum distances, receive hit distances.
+		*
+		*	\return mask of lanes hitting the triangle.
+		*/
+		template<unsigned int N>
+		MATHLIBRARY_API uint32_t RayTriangle(const RayPacket<N>& _packet, const Triangle& _triangle, float* _distance) noexcept;
+	}
+}
+
+#endif
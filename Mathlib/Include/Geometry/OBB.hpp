@@ -0,0 +1,228 @@
+#pragma once
+
+#ifndef MATHLIB_OBB
+#define MATHLIB_OBB
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "Misc/DllExport.hpp"
+#include "Misc/Constants.hpp"
+#include <Space/Vec3.hpp>
+#include <Matrix/Mat3.hpp>
+
+/**
+*	\file OBB.hpp
+*
+*	\brief Oriented bounding box type implementation.
+*/
+
+namespace Mathlib
+{
+	struct Quat;
+	struct AABB;
+	struct Sphere;
+	struct Transform;
+
+	/**
+	*	\brief Oriented bounding box struct defined by its center, orientation and half extents.
+	*/
+	struct MATHLIBRARY_API OBB
+	{
+		/// Box center.
+		Vec3 center;
+
+		/// Box rotation, column i is the world direction of the box local axis i.
+		Mat3 orientation = Mat3::Identity;
+
+		/// Box half size along each local axis.
+		Vec3 halfExtents;
+
+		//Constructors
+
+		/**
+		*	\brief Default constructor
+		*/
+		OBB() = default;
+
+		/**
+		*	\brief Value constructor
+		*
+		*	\param[in] _center box center.
+		*	\param[in] _orientation rotation matrix of the box.
+		*	\param[in] _half_extents box half size along each local axis.
+		*/
+		OBB(const Vec3& _center, const Mat3& _orientation, const Vec3& _half_extents) noexcept;
+
+		/**
+		*	\brief Value constructor
+		*
+		*	\param[in] _center box center.
+		*	\param[in] _orientation normalized rotation of the box.
+		*	\param[in] _half_extents box half size along each local axis.
+		*/
+		OBB(const Vec3& _center, const Quat& _orientation, const Vec3& _half_extents) noexcept;
+
+		/**
+		*	\brief Default copy constructor
+		*/
+		OBB(const OBB& _obb) = default;
+
+		/**
+		*	\brief Default move constructor
+		*/
+		OBB(OBB&& _obb) = default;
+
+		//Static Methods
+
+		/**
+		*	\brief Create an oriented box from an axis aligned box.
+		*
+		*	\param[in] _aabb box to convert.
+		*
+		*	\return box with identity orientation enclosing the same volume as _aabb.
+		*/
+		static OBB FromAABB(const AABB& _aabb) noexcept;
+
+		/**
+		*	\brief Place a local space box in world space.
+		*
+		*	\param[in] _local box in local space of _transform.
+		*	\param[in] _transform transform to apply.
+		*
+		*	\return oriented box enclosing the same volume as _local transformed by _transform.
+		*/
+		static OBB FromTransform(const AABB& _local, const Transform& _transform) noexcept;
+
+		//Equality
+
+		/**
+		*	\brief Compare this box with with _other
+		*
+		*	\param[in] _other other box to do the comparison with.
+		* 	\param[in] _epsilon threshold to accept equality.
+		*
+		*	\return if this and _other are equal.
+		*/
+		bool Equals(const OBB& _other, float _epsilon = Math::FloatEpsilon) const noexcept;
+
+		/**
+		*	\brief Operator to compare this box with with _rhs
+		*
+		*	\param[in] _rhs right hand side operand to do the comparison with.
+		*
+		*	\return if this and _rhs are equal.
+		*/
+		bool operator==(const OBB& _rhs) const noexcept;
+
+		/**
+		*	\brief Operator to compare this box with with _rhs.
+		*
+		*	\param[in] _rhs right hand side operand to do the comparison with.
+		*
+		*	\return if this and _rhs are different.
+		*/
+		bool operator!=(const OBB& _rhs) const noexcept;
+
+		//Accessors
+
+		/**
+		*	\brief return the world direction of local axis _index.
+		*
+		*	\param[in] _index axis index, 0 for X, 1 for Y and 2 for Z.
+		*/
+		Vec3 GetAxis(unsigned int _index) const noexcept;
+
+		/**
+		*	\brief return the 8 corners of this box.
+		*
+		*	\param[out] _corners array receiving the corners.
+		*/
+		void GetCorners(Vec3 _corners[8]) const noexcept;
+
+		/**
+		*	\brief return the axis aligned box enclosing this box.
+		*/
+		AABB GetAABB() const noexcept;
+
+		/**
+		*	\brief return the volume of this box.
+		*/
+		float GetVolume() const noexcept;
+
+		//Methods
+
+		/**
+		*	\brief Check if a point is inside this box, bounds included.
+		*
+		*	\param[in] _point point to test.
+		*/
+		bool Contains(const Vec3& _point) const noexcept;
+
+		/**
+		*	\brief Return the closest point of this box to _point.
+		*
+		*	\param[in] _point point to clamp in this box.
+		*/
+		Vec3 ClosestPoint(const Vec3& _point) const noexcept;
+
+		/**
+		*	\brief Check if this box overlaps with _other using the separating axis test, touching boxes overlap.
+		*
+		*	\param[in] _other box to test.
+		*/
+		bool Intersects(const OBB& _other) const noexcept;
+
+		/**
+		*	\brief Check if this box overlaps with an axis aligned box.
+		*
+		*	\param[in] _aabb box to test.
+		*/
+		bool Intersects(const AABB& _aabb) const noexcept;
+
+		/**
+		*	\brief Check if this box overlaps with a sphere.
+		*
+		*	\param[in] _sphere sphere to test.
+		*/
+		bool Intersects(const Sphere& _sphere) const noexcept;
+
+		//Batch
+
+		/**
+		*	\brief Test an array of boxes against this box with the separating axis test.
+		*	Bit i % 32 of _overlaps[i / 32] is set if box i overlaps this box.
+		*
+		*	\param[in] _boxes boxes to test.
+		*	\param[in] _count number of boxes.
+		*	\param[out] _overlaps bitmask of (_count + 31) / 32 words, fully overwritten.
+		*/
+		void IntersectsBatch(const OBB* _boxes, size_t _count, uint32_t* _overlaps) const noexcept;
+
+		//Operator
+
+		/**
+		*	\brief Default move assignement.
+		*
+		*	\return self box assigned.
+		*/
+		OBB& operator=(OBB&&) = default;
+
+		/**
+		*	\brief Default copy assignement.
+		*
+		*	\return self box assigned.
+		*/
+		OBB& operator=(const OBB&) = default;
+
+		//Debug
+
+		/**
+		*	\brief return box values as string.
+		*/
+		std::string ToString() const noexcept;
+	};
+}
+
+#endif
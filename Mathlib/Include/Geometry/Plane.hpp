@@ -0,0 +1,176 @@
+#pragma once
+
+#ifndef MATHLIB_PLANE
+#define MATHLIB_PLANE
+
+#include <string>
+
+#include "Misc/DllExport.hpp"
+#include "Misc/Constants.hpp"
+#include <Space/Vec3.hpp>
+
+/**
+*	\file Plane.hpp
+*
+*	\brief Plane type implementation.
+*/
+
+namespace Mathlib
+{
+	struct Vec4;
+
+	/**
+	*	\brief Plane struct defined by the equation dot(normal, p) + distance = 0.
+	*/
+	struct MATHLIBRARY_API Plane
+	{
+		/// Plane normal, pointing toward the positive half space.
+		Vec3 normal = Vec3::Up;
+
+		/// Plane signed distance term, opposite of the distance from origin along the normal.
+		float distance = 0.f;
+
+		//Constructors
+
+		/**
+		*	\brief Default constructor, XZ plane facing up.
+		*/
+		Plane() = default;
+
+		/**
+		*	\brief Value constructor
+		*
+		*	\param[in] _normal plane normal.
+		*	\param[in] _distance plane signed distance term.
+		*/
+		Plane(const Vec3& _normal, float _distance) noexcept;
+
+		/**
+		*	\brief Constructor from a normal and a point on the plane.
+		*
+		*	\param[in] _normal plane normal.
+		*	\param[in] _point point on the plane.
+		*/
+		Plane(const Vec3& _normal, const Vec3& _point) noexcept;
+
+		/**
+		*	\brief Constructor from plane equation coefficients (X, Y, Z, W) = (a, b, c, d).
+		*
+		*	\param[in] _equation plane equation coefficients.
+		*/
+		Plane(const Vec4& _equation) noexcept;
+
+		/**
+		*	\brief Default copy constructor
+		*/
+		Plane(const Plane& _plane) = default;
+
+		/**
+		*	\brief Default move constructor
+		*/
+		Plane(Plane&& _plane) = default;
+
+		//Static Methods
+
+		/**
+		*	\brief Create a plane passing through three points.
+		*	Normal follows the counter-clockwise winding of _a, _b, _c.
+		*
+		*	\param[in] _a first point.
+		*	\param[in] _b second point.
+		*	\param[in] _c third point.
+		*
+		*	\return plane passing through the three points.
+		*/
+		static Plane FromPoints(const Vec3& _a, const Vec3& _b, const Vec3& _c) noexcept;
+
+		//Equality
+
+		/**
+		*	\brief Compare this plane with with _other
+		*
+		*	\param[in] _other other plane to do the comparison with.
+		* 	\param[in] _epsilon threshold to accept equality.
+		*
+		*	\return if this and _other are equal.
+		*/
+		bool Equals(const Plane& _other, float _epsilon = Math::FloatEpsilon) const noexcept;
+
+		/**
+		*	\brief Operator to compare this plane with with _rhs
+		*
+		*	\param[in] _rhs right hand side operand to do the comparison with.
+		*
+		*	\return if this and _rhs are equal.
+		*/
+		bool operator==(const Plane& _rhs) const noexcept;
+
+		/**
+		*	\brief Operator to compare this plane with with _rhs.
+		*
+		*	\param[in] _rhs right hand side operand to do the comparison with.
+		*
+		*	\return if this and _rhs are different.
+		*/
+		bool operator!=(const Plane& _rhs) const noexcept;
+
+		//Methods
+
+		/**
+		*	\brief Normalize this plane equation so normal has unit length and return it.
+		*/
+		Plane& Normalize() noexcept;
+
+		/**
+		*	\brief Return this plane with a normalized equation.
+		*/
+		Plane GetNormalized() const noexcept;
+
+		/**
+		*	\brief Compute signed distance from the plane to _point.
+		*	Result is only a true distance when the plane is normalized.
+		*
+		*	\param[in] _point point to compute distance to.
+		*/
+		float GetSignedDistance(const Vec3& _point) const noexcept;
+
+		/**
+		*	\brief Project _point on this normalized plane.
+		*
+		*	\param[in] _point point to project.
+		*/
+		Vec3 ClosestPoint(const Vec3& _point) const noexcept;
+
+		//Operator
+
+		/**
+		*	\brief Default move assignement.
+		*
+		*	\return self plane assigned.
+		*/
+		Plane& operator=(Plane&&) = default;
+
+		/**
+		*	\brief Default copy assignement.
+		*
+		*	\return self plane assigned.
+		*/
+		Plane& operator=(const Plane&) = default;
+
+		/**
+		*	\brief \e Getter of the plane facing the opposite direction.
+		*
+		*	\return new flipped plane.
+		*/
+		Plane operator-() const noexcept;
+
+		//Debug
+
+		/**
+		*	\brief return plane values as string.
+		*/
+		std::string ToString() const noexcept;
+	};
+}
+
+#endif
@@ -0,0 +1,226 @@
+#pragma once
+
+#ifndef MATHLIB_RAY
+#define MATHLIB_RAY
+
+#include <string>
+
+#include "Misc/DllExport.hpp"
+#include "Misc/Constants.hpp"
+#include <Space/Vec3.hpp>
+
+/**
+*	\file Ray.hpp
+*
+*	\brief Ray and ray packet types implementation.
+*/
+
+namespace Mathlib
+{
+	/**
+	*	\brief Ray struct defined by an origin and a direction.
+	*	Direction does not need to be normalized, hit distances are then expressed in direction length units.
+	*/
+	struct MATHLIBRARY_API Ray
+	{
+		/// Ray origin.
+		Vec3 origin;
+
+		/// Ray direction.
+		Vec3 direction = Vec3::Forward;
+
+		//Constructors
+
+		/**
+		*	\brief Default constructor, ray starting at origin toward Forward.
+		*/
+		Ray() = default;
+
+		/**
+		*	\brief Value constructor
+		*
+		*	\param[in] _origin ray origin.
+		*	\param[in] _direction ray direction.
+		*/
+		Ray(const Vec3& _origin, const Vec3& _direction) noexcept;
+
+		/**
+		*	\brief Default copy constructor
+		*/
+		Ray(const Ray& _ray) = default;
+
+		/**
+		*	\brief Default move constructor
+		*/
+		Ray(Ray&& _ray) = default;
+
+		//Static Methods
+
+		/**
+		*	\brief Create a ray going from _start to _end, direction is normalized.
+		*
+		*	\param[in] _start ray origin.
+		*	\param[in] _end point toward which the ray is cast.
+		*/
+		static Ray FromPoints(const Vec3& _start, const Vec3& _end) noexcept;
+
+		//Equality
+
+		/**
+		*	\brief Compare this ray with with _other
+		*
+		*	\param[in] _other other ray to do the comparison with.
+		* 	\param[in] _epsilon threshold to accept equality.
+		*
+		*	\return if this and _other are equal.
+		*/
+		bool Equals(const Ray& _other, float _epsilon = Math::FloatEpsilon) const noexcept;
+
+		/**
+		*	\brief Operator to compare this ray with with _rhs
+		*
+		*	\param[in] _rhs right hand side operand to do the comparison with.
+		*
+		*	\return if this and _rhs are equal.
+		*/
+		bool operator==(const Ray& _rhs) const noexcept;
+
+		/**
+		*	\brief Operator to compare this ray with with _rhs.
+		*
+		*	\param[in] _rhs right hand side operand to do the comparison with.
+		*
+		*	\return if this and _rhs are different.
+		*/
+		bool operator!=(const Ray& _rhs) const noexcept;
+
+		//Methods
+
+		/**
+		*	\brief Return the point at _distance along the ray.
+		*
+		*	\param[in] _distance distance along the ray in direction length units.
+		*/
+		Vec3 GetPoint(float _distance) const noexcept;
+
+		//Operator
+
+		/**
+		*	\brief Default move assignement.
+		*
+		*	\return self ray assigned.
+		*/
+		Ray& operator=(Ray&&) = default;
+
+		/**
+		*	\brief Default copy assignement.
+		*
+		*	\return self ray assigned.
+		*/
+		Ray& operator=(const Ray&) = default;
+
+		//Debug
+
+		/**
+		*	\brief return ray values as string.
+		*/
+		std::string ToString() const noexcept;
+	};
+
+	/**
+	*	\brief Packet of N rays stored as component streams, tested together by the Intersection functions.
+	*	Supported sizes are 4, 8 and 16.
+	*/
+	template<unsigned int N>
+	struct RayPacket
+	{
+		static_assert(N == 4 || N == 8 || N == 16, "RayPacket size must be 4, 8 or 16");
+
+		/// Number of rays in the packet.
+		static constexpr unsigned int Size = N;
+
+		/// Rays origin X components.
+		float originX[N];
+		/// Rays origin Y components.
+		float originY[N];
+		/// Rays origin Z components.
+		float originZ[N];
+
+		/// Rays direction X components.
+		float directionX[N];
+		/// Rays direction Y components.
+		float directionY[N];
+		/// Rays direction Z components.
+		float directionZ[N];
+
+		/// Rays inverse direction X components, used by slab tests.
+		float inverseDirectionX[N];
+		/// Rays inverse direction Y components, used by slab tests.
+		float inverseDirectionY[N];
+		/// Rays inverse direction Z components, used by slab tests.
+		float inverseDirectionZ[N];
+
+		//Constructors
+
+		/**
+		*	\brief Default constructor, components are left uninitialized.
+		*/
+		RayPacket() = default;
+
+		/**
+		*	\brief Load N rays into the packet.
+		*
+		*	\param[in] _rays array of at least N rays.
+		*/
+		RayPacket(const Ray* _rays) noexcept
+		{
+			for (unsigned int lane = 0; lane < N; ++lane)
+				Set(lane, _rays[lane]);
+		}
+
+		//Accessors
+
+		/**
+		*	\brief Store a ray in a lane of the packet.
+		*
+		*	\param[in] _lane lane to write, lower than N.
+		*	\param[in] _ray ray to store.
+		*/
+		void Set(unsigned int _lane, const Ray& _ray) noexcept
+		{
+			originX[_lane] = _ray.origin.X;
+			originY[_lane] = _ray.origin.Y;
+			originZ[_lane] = _ray.origin.Z;
+
+			directionX[_lane] = _ray.direction.X;
+			directionY[_lane] = _ray.direction.Y;
+			directionZ[_lane] = _ray.direction.Z;
+
+			inverseDirectionX[_lane] = 1.f / _ray.direction.X;
+			inverseDirectionY[_lane] = 1.f / _ray.direction.Y;
+			inverseDirectionZ[_lane] = 1.f / _ray.direction.Z;
+		}
+
+		/**
+		*	\brief Read back the ray stored in a lane.
+		*
+		*	\param[in] _lane lane to read, lower than N.
+		*/
+		Ray Get(unsigned int _lane) const noexcept
+		{
+			return Ray(Vec3(originX[_lane], originY[_lane], originZ[_lane]),
+				Vec3(directionX[_lane], directionY[_lane], directionZ[_lane]));
+		}
+	};
+
+	/// Packet of 4 rays.
+	using RayPacket4 = RayPacket<4>;
+
+	/// Packet of 8 rays.
+	using RayPacket8 = RayPacket<8>;
+
+	/// Packet of 16 rays.
+	using RayPacket16 = RayPacket<16>;
+}
+
+#endif
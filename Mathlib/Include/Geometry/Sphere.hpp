@@ -0,0 +1,184 @@
+#pragma once
+
+#ifndef MATHLIB_SPHERE
+#define MATHLIB_SPHERE
+
+#include <cstddef>
+#include <string>
+
+#include "Misc/DllExport.hpp"
+#include "Misc/Constants.hpp"
+#include <Space/Vec3.hpp>
+
+/**
+*	\file Sphere.hpp
+*
+*	\brief Bounding sphere type implementation.
+*/
+
+namespace Mathlib
+{
+	struct AABB;
+	struct Transform;
+
+	/**
+	*	\brief Sphere struct defined by its center and radius.
+	*/
+	struct MATHLIBRARY_API Sphere
+	{
+		/// Sphere center.
+		Vec3 center;
+
+		/// Sphere radius.
+		float radius = 0.f;
+
+		//Constructors
+
+		/**
+		*	\brief Default constructor
+		*/
+		Sphere() = default;
+
+		/**
+		*	\brief Value constructor
+		*
+		*	\param[in] _center sphere center.
+		*	\param[in] _radius sphere radius.
+		*/
+		Sphere(const Vec3& _center, float _radius) noexcept;
+
+		/**
+		*	\brief Default copy constructor
+		*/
+		Sphere(const Sphere& _sphere) = default;
+
+		/**
+		*	\brief Default move constructor
+		*/
+		Sphere(Sphere&& _sphere) = default;
+
+		//Static Methods
+
+		/**
+		*	\brief Compute the sphere enclosing a box.
+		*
+		*	\param[in] _aabb box to enclose.
+		*
+		*	\return sphere centered on _aabb with its half diagonal as radius.
+		*/
+		static Sphere FromAABB(const AABB& _aabb) noexcept;
+
+		/**
+		*	\brief Compute a sphere enclosing a set of points (Ritter's approximation).
+		*
+		*	\param[in] _points points to enclose.
+		*	\param[in] _count number of points.
+		*
+		*	\return sphere enclosing all points.
+		*/
+		static Sphere FromPoints(const Vec3* _points, size_t _count) noexcept;
+
+		/**
+		*	\brief Compute the smallest sphere enclosing two spheres.
+		*
+		* 	\param[in] _lhs left hand side operand to compute union with.
+		* 	\param[in] _rhs right hand side operand to compute union with.
+		*
+		*	\return union of _lhs and _rhs.
+		*/
+		static Sphere Union(const Sphere& _lhs, const Sphere& _rhs) noexcept;
+
+		//Equality
+
+		/**
+		*	\brief Compare this sphere with with _other
+		*
+		*	\param[in] _other other sphere to do the comparison with.
+		* 	\param[in] _epsilon threshold to accept equality.
+		*
+		*	\return if this and _other are equal.
+		*/
+		bool Equals(const Sphere& _other, float _epsilon = Math::FloatEpsilon) const noexcept;
+
+		/**
+		*	\brief Operator to compare this sphere with with _rhs
+		*
+		*	\param[in] _rhs right hand side operand to do the comparison with.
+		*
+		*	\return if this and _rhs are equal.
+		*/
+		bool operator==(const Sphere& _rhs) const noexcept;
+
+		/**
+		*	\brief Operator to compare this sphere with with _rhs.
+		*
+		*	\param[in] _rhs right hand side operand to do the comparison with.
+		*
+		*	\return if this and _rhs are different.
+		*/
+		bool operator!=(const Sphere& _rhs) const noexcept;
+
+		//Methods
+
+		/**
+		*	\brief Check if a point is inside this sphere, surface included.
+		*
+		*	\param[in] _point point to test.
+		*/
+		bool Contains(const Vec3& _point) const noexcept;
+
+		/**
+		*	\brief Check if this sphere overlaps with _other.
+		*
+		*	\param[in] _other sphere to test.
+		*/
+		bool Intersects(const Sphere& _other) const noexcept;
+
+		/**
+		*	\brief Check if this sphere overlaps with a box.
+		*
+		*	\param[in] _aabb box to test.
+		*/
+		bool Intersects(const AABB& _aabb) const noexcept;
+
+		/**
+		*	\brief Return the box enclosing this sphere.
+		*/
+		AABB GetAABB() const noexcept;
+
+		/**
+		*	\brief Compute the sphere enclosing this sphere transformed by _transform.
+		*	Radius is scaled by the largest absolute scale axis.
+		*
+		*	\param[in] _transform transform to apply.
+		*
+		*	\return transformed sphere.
+		*/
+		Sphere GetTransformed(const Transform& _transform) const noexcept;
+
+		//Operator
+
+		/**
+		*	\brief Default move assignement.
+		*
+		*	\return self sphere assigned.
+		*/
+		Sphere& operator=(Sphere&&) = default;
+
+		/**
+		*	\brief Default copy assignement.
+		*
+		*	\return self sphere assigned.
+		*/
+		Sphere& operator=(const Sphere&) = default;
+
+		//Debug
+
+		/**
+		*	\brief return sphere values as string.
+		*/
+		std::string ToString() const noexcept;
+	};
+}
+
+#endif
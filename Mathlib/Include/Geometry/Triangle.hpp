@@ -0,0 +1,163 @@
+#pragma once
+
+#ifndef MATHLIB_TRIANGLE
+#define MATHLIB_TRIANGLE
+
+#include <string>
+
+#include "Misc/DllExport.hpp"
+#include "Misc/Constants.hpp"
+#include <Space/Vec3.hpp>
+
+/**
+*	\file Triangle.hpp
+*
+*	\brief Triangle type implementation.
+*/
+
+namespace Mathlib
+{
+	struct AABB;
+	struct Plane;
+
+	/**
+	*	\brief Triangle struct defined by three vertices in counter-clockwise order.
+	*/
+	struct MATHLIBRARY_API Triangle
+	{
+		/// First vertex.
+		Vec3 a;
+
+		/// Second vertex.
+		Vec3 b;
+
+		/// Third vertex.
+		Vec3 c;
+
+		//Constructors
+
+		/**
+		*	\brief Default constructor
+		*/
+		Triangle() = default;
+
+		/**
+		*	\brief Value constructor
+		*
+		*	\param[in] _a first vertex.
+		*	\param[in] _b second vertex.
+		*	\param[in] _c third vertex.
+		*/
+		Triangle(const Vec3& _a, const Vec3& _b, const Vec3& _c) noexcept;
+
+		/**
+		*	\brief Default copy constructor
+		*/
+		Triangle(const Triangle& _triangle) = default;
+
+		/**
+		*	\brief Default move constructor
+		*/
+		Triangle(Triangle&& _triangle) = default;
+
+		//Equality
+
+		/**
+		*	\brief Compare this triangle with with _other
+		*
+		*	\param[in] _other other triangle to do the comparison with.
+		* 	\param[in] _epsilon threshold to accept equality.
+		*
+		*	\return if this and _other are equal.
+		*/
+		bool Equals(const Triangle& _other, float _epsilon = Math::FloatEpsilon) const noexcept;
+
+		/**
+		*	\brief Operator to compare this triangle with with _rhs
+		*
+		*	\param[in] _rhs right hand side operand to do the comparison with.
+		*
+		*	\return if this and _rhs are equal.
+		*/
+		bool operator==(const Triangle& _rhs) const noexcept;
+
+		/**
+		*	\brief Operator to compare this triangle with with _rhs.
+		*
+		*	\param[in] _rhs right hand side operand to do the comparison with.
+		*
+		*	\return if this and _rhs are different.
+		*/
+		bool operator!=(const Triangle& _rhs) const noexcept;
+
+		//Accessors
+
+		/**
+		*	\brief Return the normalized normal of this triangle.
+		*/
+		Vec3 GetNormal() const noexcept;
+
+		/**
+		*	\brief Return the area of this triangle.
+		*/
+		float GetArea() const noexcept;
+
+		/**
+		*	\brief Return the center of mass of this triangle.
+		*/
+		Vec3 GetCentroid() const noexcept;
+
+		/**
+		*	\brief Return the box enclosing this triangle.
+		*/
+		AABB GetAABB() const noexcept;
+
+		/**
+		*	\brief Return the plane containing this triangle.
+		*/
+		Plane GetPlane() const noexcept;
+
+		//Methods
+
+		/**
+		*	\brief Compute the barycentric coordinates of _point projected on this triangle plane.
+		*
+		*	\param[in] _point point to compute coordinates of.
+		*
+		*	\return (u, v, w) weights of a, b and c.
+		*/
+		Vec3 GetBarycentric(const Vec3& _point) const noexcept;
+
+		/**
+		*	\brief Return the closest point of this triangle to _point.
+		*
+		*	\param[in] _point point to find the closest triangle point of.
+		*/
+		Vec3 ClosestPoint(const Vec3& _point) const noexcept;
+
+		//Operator
+
+		/**
+		*	\brief Default move assignement.
+		*
+		*	\return self triangle assigned.
+		*/
+		Triangle& operator=(Triangle&&) = default;
+
+		/**
+		*	\brief Default copy assignement.
+		*
+		*	\return self triangle assigned.
+		*/
+		Triangle& operator=(const Triangle&) = default;
+
+		//Debug
+
+		/**
+		*	\brief return triangle values as string.
+		*/
+		std::string ToString() const noexcept;
+	};
+}
+
+#endif
@@ -0,0 +1,165 @@
+#pragma once
+
+#ifndef MATHLIB_BLOCKSPARSEMAT3
+#define MATHLIB_BLOCKSPARSEMAT3
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Misc/DllExport.hpp"
+#include <Space/Vec3.hpp>
+#include <Matrix/Mat3.hpp>
+
+/**
+*	\file BlockSparseMat3.hpp
+*
+*	\brief Sparse matrix of Mat3 blocks implementation, stored in compressed sparse rows.
+*/
+
+namespace Mathlib
+{
+	/**
+	*	\brief Non zero block of a block sparse matrix, used to build it.
+	*/
+	struct BlockSparseEntry3
+	{
+		/// Block row of the block.
+		size_t row = 0;
+
+		/// Block column of the block.
+		size_t column = 0;
+
+		/// Block value.
+		Mat3 block;
+	};
+
+	/**
+	*	\brief Sparse matrix of 3x3 blocks in compressed sparse rows, for systems with one Vec3 unknown per
+	*	particle or body (cloth, soft bodies, implicit springs). Rows and columns are counted in blocks.
+	*/
+	struct MATHLIBRARY_API BlockSparseMat3
+	{
+	private:
+		/// Number of block rows.
+		size_t rows = 0;
+
+		/// Number of block columns.
+		size_t columns = 0;
+
+		/// Index of the first block of each block row, followed by the number of blocks.
+		std::vector<size_t> rowStarts = { 0 };
+
+		/// Block column of each block.
+		std::vector<uint32_t> columnIndices;
+
+		/// Non zero blocks, block row after block row.
+		std::vector<Mat3> blocks;
+
+	public:
+		//Constructors
+
+		/**
+		*	\brief Default constructor, empty matrix.
+		*/
+		BlockSparseMat3() = default;
+
+		/**
+		*	\brief Constructor from non zero blocks in any order, blocks at the same position are summed.
+		*	Call the error callback and skip blocks out of the matrix.
+		*
+		*	\param[in] _rows number of block rows.
+		*	\param[in] _columns number of block columns, must fit in 32 bits.
+		*	\param[in] _entries blocks to store.
+		*	\param[in] _count number of blocks.
+		*/
+		BlockSparseMat3(size_t _rows, size_t _columns, const BlockSparseEntry3* _entries, size_t _count);
+
+		/**
+		*	\brief Default copy constructor
+		*/
+		BlockSparseMat3(const BlockSparseMat3& _mat) = default;
+
+		/**
+		*	\brief Default move constructor
+		*/
+		BlockSparseMat3(BlockSparseMat3&& _mat) noexcept = default;
+
+		//Static methods
+
+		/**
+		*	\brief Compute the block sparse matrix vector product _result = _lhs * _vector.
+		*
+		*	\param[in] _lhs matrix.
+		*	\param[in] _vector _lhs.GetColumns() vectors.
+		*	\param[out] _result _lhs.GetRows() vectors, must not overlap _vector.
+		*	\param[in] _multithreaded split block rows across threads.
+		*/
+		static void Multiply(const BlockSparseMat3& _lhs, const Vec3* _vector, Vec3* _result, bool _multithreaded = false);
+
+		//Accessors
+
+		/**
+		*	\brief Return the number of block rows.
+		*/
+		size_t GetRows() const noexcept;
+
+		/**
+		*	\brief Return the number of block columns.
+		*/
+		size_t GetColumns() const noexcept;
+
+		/**
+		*	\brief Return the number of stored blocks.
+		*/
+		size_t GetNonZeroCount() const noexcept;
+
+		/**
+		*	\brief Return the index of the first block of each block row, GetRows() + 1 elements.
+		*/
+		const size_t* GetRowStarts() const noexcept;
+
+		/**
+		*	\brief Return the block column of each stored block.
+		*/
+		const uint32_t* GetColumnIndices() const noexcept;
+
+		/**
+		*	\brief Return the stored blocks, block row after block row.
+		*/
+		const Mat3* GetBlocks() const noexcept;
+
+		/**
+		*	\brief Return the stored blocks, block row after block row, to update them without changing the pattern.
+		*/
+		Mat3* GetBlocks() noexcept;
+
+		/**
+		*	\brief Return the block at _row, _column, zero matrix when not stored.
+		*/
+		Mat3 Get(size_t _row, size_t _column) const noexcept;
+
+		/**
+		*	\brief Write the diagonal blocks in _result, min(GetRows(), GetColumns()) blocks.
+		*/
+		void GetDiagonal(Mat3* _result) const noexcept;
+
+		//Operators
+
+		/**
+		*	\brief Default move assignement.
+		*
+		*	\return self matrix assigned.
+		*/
+		BlockSparseMat3& operator=(BlockSparseMat3&&) noexcept = default;
+
+		/**
+		*	\brief Default copy assignement.
+		*
+		*	\return self matrix assigned.
+		*/
+		BlockSparseMat3& operator=(const BlockSparseMat3&) = default;
+	};
+}
+
+#endif
@@ -0,0 +1,87 @@
+#pragma once
+
+#ifndef MATHLIB_CONJUGATEGRADIENT
+#define MATHLIB_CONJUGATEGRADIENT
+
+#include <cstddef>
+
+#include "Misc/DllExport.hpp"
+#include <Space/Vec3.hpp>
+#include <Matrix/SparseMat.hpp>
+#include <Matrix/BlockSparseMat3.hpp>
+
+/**
+*	\file ConjugateGradient.hpp
+*
+*	\brief Preconditioned conjugate gradient solvers for sparse symmetric positive definite systems.
+*/
+
+namespace Mathlib
+{
+	/**
+	*	\brief Settings of a conjugate gradient solve.
+	*/
+	struct ConjugateGradientSettings
+	{
+		/// Maximum number of iterations.
+		size_t maxIterations = 200;
+
+		/// Stop when the residual length is below tolerance times the right hand side length.
+		double tolerance = 1e-6;
+
+		/// Precondition with the inverse of the diagonal, or of the diagonal blocks for block matrices.
+		bool preconditioned = true;
+
+		/// Split products and vector operations across threads.
+		bool multithreaded = false;
+	};
+
+	/**
+	*	\brief Outcome of a conjugate gradient solve.
+	*/
+	struct ConjugateGradientResult
+	{
+		/// Number of iterations done.
+		size_t iterations = 0;
+
+		/// Final residual length divided by the right hand side length.
+		double residual = 0.0;
+
+		/// Whether the residual reached the tolerance.
+		bool converged = false;
+	};
+
+	namespace Solver
+	{
+		/**
+		*	\brief Solve _matrix * _solution = _rhs with the preconditioned conjugate gradient method.
+		*	Results do not depend on the number of threads.
+		*
+		*	\param[in] _matrix symmetric positive definite square matrix.
+		*	\param[in] _rhs right hand side, _matrix.GetRows() components.
+		*	\param[in,out] _solution initial guess, replaced by the solution.
+		*	\param[in] _settings iterations, tolerance and preconditioning.
+		*
+		*	\return number of iterations and final relative residual.
+		*/
+		template<typename T>
+		MATHLIBRARY_API ConjugateGradientResult ConjugateGradient(const SparseMat<T>& _matrix, const T* _rhs, T* _solution,
+			const ConjugateGradientSettings& _settings = ConjugateGradientSettings());
+
+		/**
+		*	\brief Solve _matrix * _solution = _rhs with the conjugate gradient method, preconditioned by the inverse
+		*	of the diagonal blocks. Results do not depend on the number of threads.
+		*
+		*	\param[in] _matrix symmetric positive definite square block matrix.
+		*	\param[in] _rhs right hand side, _matrix.GetRows() vectors.
+		*	\param[in,out] _solution initial guess, replaced by the solution.
+		*	\param[in] _settings iterations, tolerance and preconditioning.
+		*
+		*	\return number of iterations and final relative residual.
+		*/
+		MATHLIBRARY_API ConjugateGradientResult ConjugateGradient(const BlockSparseMat3& _matrix, const Vec3* _rhs, Vec3* _solution,
+			const ConjugateGradientSettings& _settings = ConjugateGradientSettings());
+	}
+}
+
+#endif
@@ -0,0 +1,135 @@
+#pragma once
+
+#ifndef MATHLIB_DECOMPOSITION
+#define MATHLIB_DECOMPOSITION
+
+#include <cstddef>
+
+#include "Misc/DllExport.hpp"
+#include <Space/Vec3.hpp>
+#include <Space/Quaternion.hpp>
+#include <Matrix/Mat3.hpp>
+
+/**
+*	\file Decomposition.hpp
+*
+*	\brief Matrix factorizations, single and batched.
+*/
+
+namespace Mathlib
+{
+	/**
+	*	\brief Eigen decomposition of a symmetric matrix: matrix = vectors * diag(values) * vectors^T.
+	*/
+	struct SymmetricEigen
+	{
+		/// Eigenvalues, sorted from largest to smallest.
+		Vec3 values;
+
+		/// Orthonormal eigenvectors stored as columns, in the order of values, with a determinant of 1.
+		Mat3 vectors = Mat3::Identity;
+	};
+
+	/**
+	*	\brief Singular value decomposition of a matrix: matrix = u * diag(values) * v^T.
+	*/
+	struct SVD
+	{
+		/// Left singular vectors stored as columns, rotation with a determinant of 1.
+		Mat3 u = Mat3::Identity;
+
+		/// Singular values sorted by decreasing magnitude, the last one negative when the matrix determinant is.
+		Vec3 values;
+
+		/// Right singular vectors stored as columns, rotation with a determinant of 1.
+		Mat3 v = Mat3::Identity;
+	};
+
+	/**
+	*	\brief Polar decomposition of a matrix: matrix = rotation * stretch.
+	*/
+	struct PolarDecomposition
+	{
+		/// Closest rotation to the matrix, determinant of 1.
+		Mat3 rotation = Mat3::Identity;
+
+		/// Symmetric stretch, with a negative eigenvalue when the matrix is a reflection.
+		Mat3 stretch = Mat3::Identity;
+	};
+
+	namespace Decomposition
+	{
+		/**
+		*	\brief Compute eigenvalues and eigenvectors of a symmetric matrix with cyclic Jacobi rotations.
+		*	Only the upper triangle of _matrix is read.
+		*
+		*	\param[in] _matrix symmetric matrix to decompose.
+		*
+		*	\return eigenvalues and eigenvectors of _matrix.
+		*/
+		MATHLIBRARY_API SymmetricEigen ComputeSymmetricEigen(const Mat3& _matrix) noexcept;
+
+		/**
+		*	\brief Compute eigenvalues of a symmetric matrix and the rotation taking its eigenbasis to world axes.
+		*	Only the upper triangle of _matrix is read.
+		*
+		*	\param[in] _matrix symmetric matrix to decompose.
+		*	\param[out] _values eigenvalues, sorted from largest to smallest.
+		*	\param[out] _rotation rotation whose local X, Y and Z axes are the eigenvectors of _values.
+		*/
+		MATHLIBRARY_API void ComputeSymmetricEigen(const Mat3& _matrix, Vec3& _values, Quat& _rotation) noexcept;
+
+		/**
+		*	\brief Decompose many symmetric matrices, several at once in component streams.
+		*	Only the upper triangle of each matrix is read.
+		*
+		*	\param[in] _matrices symmetric matrices to decompose.
+		*	\param[in] _count number of matrices.
+		*	\param[out] _results decomposition of each matrix.
+		*	\param[in] _multithreaded split matrices across threads.
+		*/
+		MATHLIBRARY_API void ComputeSymmetricEigenBatch(const Mat3* _matrices, size_t _count, SymmetricEigen* _results, bool _multithreaded = false);
+
+		/**
+		*	\brief Compute the singular value decomposition of a matrix from the eigen decomposition of its normal matrix,
+		*	followed by a Givens QR of matrix * v. Both bases are kept rotations, a negative determinant is carried by
+		*	the sign of the last singular value.
+		*
+		*	\param[in] _matrix matrix to decompose.
+		*
+		*	\return singular value decomposition of _matrix.
+		*/
+		MATHLIBRARY_API SVD ComputeSVD(const Mat3& _matrix) noexcept;
+
+		/**
+		*	\brief Compute the singular value decomposition of many matrices, several at once in component streams.
+		*
+		*	\param[in] _matrices matrices to decompose.
+		*	\param[in] _count number of matrices.
+		*	\param[out] _results decomposition of each matrix.
+		*	\param[in] _multithreaded split matrices across threads.
+		*/
+		MATHLIBRARY_API void ComputeSVDBatch(const Mat3* _matrices, size_t _count, SVD* _results, bool _multithreaded = false);
+
+		/**
+		*	\brief Split a matrix into a rotation and a symmetric stretch, computed from its singular value decomposition.
+		*
+		*	\param[in] _matrix matrix to decompose.
+		*
+		*	\return polar decomposition of _matrix.
+		*/
+		MATHLIBRARY_API PolarDecomposition ComputePolar(const Mat3& _matrix) noexcept;
+
+		/**
+		*	\brief Compute the polar decomposition of many matrices, several at once in component streams.
+		*
+		*	\param[in] _matrices matrices to decompose.
+		*	\param[in] _count number of matrices.
+		*	\param[out] _results decomposition of each matrix.
+		*	\param[in] _multithreaded split matrices across threads.
+		*/
+		MATHLIBRARY_API void ComputePolarBatch(const Mat3* _matrices, size_t _count, PolarDecomposition* _results, bool _multithreaded = false);
+	}
+}
+
+#endif
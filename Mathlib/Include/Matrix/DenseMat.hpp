@@ -0,0 +1,273 @@
+#pragma once
+
+#ifndef MATHLIB_DENSEMAT
+#define MATHLIB_DENSEMAT
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "Misc/DllExport.hpp"
+#include <Misc/AlignedAllocator.hpp>
+#include <Misc/Constants.hpp>
+
+/**
+*	\file DenseMat.hpp
+*
+*	\brief Dense matrix type of runtime size implementation, with blocked and multithreaded products.
+*/
+
+namespace Mathlib
+{
+	/**
+	*	\brief Dense row major matrix of runtime size with components of type T, stored on 64 bytes aligned memory.
+	*	Only float and double are instantiated.
+	*/
+	template<typename T>
+	struct DenseMat
+	{
+	private:
+		/// Number of rows.
+		size_t rows = 0;
+
+		/// Number of columns.
+		size_t columns = 0;
+
+		/// Matrix components, row after row.
+		std::vector<T, AlignedAllocator<T>> values;
+
+	public:
+		//Constructors
+
+		/**
+		*	\brief Default constructor, empty matrix.
+		*/
+		DenseMat() = default;
+
+		/**
+		*	\brief Size constructor.
+		*
+		*	\param[in] _rows number of rows.
+		*	\param[in] _columns number of columns.
+		*	\param[in] _value value of every component.
+		*/
+		MATHLIBRARY_API DenseMat(size_t _rows, size_t _columns, T _value = T(0));
+
+		/**
+		*	\brief Value constructor.
+		*
+		*	\param[in] _rows number of rows.
+		*	\param[in] _columns number of columns.
+		*	\param[in] _values _rows * _columns components, row after row.
+		*/
+		MATHLIBRARY_API DenseMat(size_t _rows, size_t _columns, const T* _values);
+
+		/**
+		*	\brief Default copy constructor
+		*/
+		DenseMat(const DenseMat& _mat) = default;
+
+		/**
+		*	\brief Default move constructor
+		*/
+		DenseMat(DenseMat&& _mat) noexcept = default;
+
+		//Static methods
+
+		/**
+		*	\brief Return the identity matrix of _size rows and columns.
+		*/
+		MATHLIBRARY_API static DenseMat Identity(size_t _size);
+
+		/**
+		*	\brief Compute the matrix product _result = _lhs * _rhs with a cache blocked kernel.
+		*	Call the error callback and clear _result when _lhs columns and _rhs rows differ.
+		*
+		*	\param[in] _lhs left matrix.
+		*	\param[in] _rhs right matrix, _lhs.GetColumns() rows.
+		*	\param[out] _result product, resized to _lhs.GetRows() x _rhs.GetColumns(). Must not be _lhs or _rhs.
+		*	\param[in] _multithreaded split rows of the result across threads, worth it for large products only.
+		*/
+		MATHLIBRARY_API static void Multiply(const DenseMat& _lhs, const DenseMat& _rhs, DenseMat& _result, bool _multithreaded = false);
+
+		/**
+		*	\brief Compute the matrix vector product _result = _lhs * _vector.
+		*
+		*	\param[in] _lhs matrix.
+		*	\param[in] _vector _lhs.GetColumns() components.
+		*	\param[out] _result _lhs.GetRows() components, must not overlap _vector.
+		*	\param[in] _multithreaded split rows across threads, worth it for large matrices only.
+		*/
+		MATHLIBRARY_API static void Multiply(const DenseMat& _lhs, const T* _vector, T* _result, bool _multithreaded = false);
+
+		//Accessors
+
+		/**
+		*	\brief Return the number of rows.
+		*/
+		MATHLIBRARY_API size_t GetRows() const noexcept;
+
+		/**
+		*	\brief Return the number of columns.
+		*/
+		MATHLIBRARY_API size_t GetColumns() const noexcept;
+
+		/**
+		*	\brief Return the components, row after row.
+		*/
+		MATHLIBRARY_API const T* Data() const noexcept;
+
+		/**
+		*	\brief Return the components, row after row.
+		*/
+		MATHLIBRARY_API T* Data() noexcept;
+
+		/**
+		*	\brief Access component at _row, _column, no bound check.
+		*/
+		T& operator()(size_t _row, size_t _column) noexcept
+		{
+			return values[_row * columns + _column];
+		}
+
+		/**
+		*	\brief Access component at _row, _column, no bound check.
+		*/
+		const T& operator()(size_t _row, size_t _column) const noexcept
+		{
+			return values[_row * columns + _column];
+		}
+
+		/**
+		*	\brief Change the size of the matrix, every component is set to 0.
+		*/
+		MATHLIBRARY_API void Resize(size_t _rows, size_t _columns);
+
+		//Equality
+
+		/**
+		*	\brief Check if all matrix values are equal to 0.
+		*/
+		MATHLIBRARY_API bool IsZero() const noexcept;
+
+		/**
+		*	\brief Check if the matrix is square and an identity matrix.
+		*/
+		MATHLIBRARY_API bool IsIdentity() const noexcept;
+
+		/**
+		*	\brief Compare this matrix with with _other
+		*
+		*	\param[in] _other other matrix to do the comparison with.
+		* 	\param[in] _epsilon threshold to accept equality.
+		*
+		*	\return if this and _other have the same size and equal values.
+		*/
+		MATHLIBRARY_API bool Equals(const DenseMat& _other, T _epsilon = static_cast<T>(Math::FloatEpsilon)) const noexcept;
+
+		/**
+		*	\brief Operator to compare this matrix with with _rhs, exact comparison.
+		*/
+		MATHLIBRARY_API bool operator==(const DenseMat& _rhs) const noexcept;
+
+		/**
+		*	\brief Operator to compare this matrix with with _rhs.
+		*/
+		MATHLIBRARY_API bool operator!=(const DenseMat& _rhs) const noexcept;
+
+		//Methods
+
+		/**
+		*	\brief Transpose this matrix.
+		*
+		*	\return self matrix transposed.
+		*/
+		MATHLIBRARY_API DenseMat& Transpose();
+
+		/**
+		*	\brief Return the transpose of this matrix.
+		*/
+		MATHLIBRARY_API DenseMat GetTranspose() const;
+
+		//Operators
+
+		/**
+		*	\brief Default move assignement.
+		*
+		*	\return self matrix assigned.
+		*/
+		DenseMat& operator=(DenseMat&&) noexcept = default;
+
+		/**
+		*	\brief Default copy assignement.
+		*
+		*	\return self matrix assigned.
+		*/
+		DenseMat& operator=(const DenseMat&) = default;
+
+		/**
+		*	\brief \e Getter of the opposite signed matrix.
+		*/
+		MATHLIBRARY_API DenseMat operator-() const;
+
+		/**
+		*	\brief Add term by term matrix values. Call the error callback when sizes differ.
+		*/
+		MATHLIBRARY_API DenseMat operator+(const DenseMat& _rhs) const;
+
+		/**
+		*	\brief Substract term by term matrix values. Call the error callback when sizes differ.
+		*/
+		MATHLIBRARY_API DenseMat operator-(const DenseMat& _rhs) const;
+
+		/**
+		*	\brief Add term by term matrix values. Call the error callback and leave this matrix unchanged when sizes differ.
+		*/
+		MATHLIBRARY_API DenseMat& operator+=(const DenseMat& _rhs);
+
+		/**
+		*	\brief Substract term by term matrix values. Call the error callback and leave this matrix unchanged when sizes differ.
+		*/
+		MATHLIBRARY_API DenseMat& operator-=(const DenseMat& _rhs);
+
+		/**
+		*	\brief Scale each matrix value by _scale.
+		*/
+		MATHLIBRARY_API DenseMat operator*(T _scale) const;
+
+		/**
+		*	\brief Scale each matrix value by _scale.
+		*/
+		MATHLIBRARY_API DenseMat& operator*=(T _scale) noexcept;
+
+		/**
+		*	\brief Divide each matrix value by _scale.
+		*/
+		MATHLIBRARY_API DenseMat operator/(T _scale) const;
+
+		/**
+		*	\brief Divide each matrix value by _scale. Call the error callback when _scale is 0.
+		*/
+		MATHLIBRARY_API DenseMat& operator/=(T _scale);
+
+		/**
+		*	\brief Multiply this matrix by _rhs on the calling thread, see Multiply.
+		*/
+		MATHLIBRARY_API DenseMat operator*(const DenseMat& _rhs) const;
+
+		//Debug
+
+		/**
+		*	\brief Return the matrix as a string, rows separated by new lines.
+		*/
+		MATHLIBRARY_API std::string ToString() const;
+	};
+
+	/// Dense float matrix of runtime size.
+	using MatXf = DenseMat<float>;
+
+	/// Dense double matrix of runtime size.
+	using MatXd = DenseMat<double>;
+}
+
+#endif
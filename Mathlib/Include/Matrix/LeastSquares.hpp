@@ -0,0 +1,185 @@
+#pragma once
+
+#ifndef MATHLIB_LEASTSQUARES
+#define MATHLIB_LEASTSQUARES
+
+#include <cstddef>
+#include <vector>
+
+#include "Misc/DllExport.hpp"
+#include <Matrix/DenseMat.hpp>
+
+/**
+*	\file LeastSquares.hpp
+*
+*	\brief Householder QR factorization and least squares solvers, dense and streamed row by row.
+*/
+
+namespace Mathlib
+{
+	/**
+	*	\brief Thin QR factorization of a matrix with at least as many rows as columns: matrix = q * r.
+	*/
+	template<typename T>
+	struct QRDecomposition
+	{
+		/// Orthonormal columns, same size as the matrix.
+		DenseMat<T> q;
+
+		/// Upper triangular square matrix, size of the matrix columns.
+		DenseMat<T> r;
+	};
+
+	namespace Decomposition
+	{
+		/**
+		*	\brief Compute the thin QR factorization of a matrix with Householder reflections.
+		*	Call the error callback and return empty matrices when _matrix has less rows than columns.
+		*	Only float and double are instantiated.
+		*
+		*	\param[in] _matrix matrix to decompose.
+		*
+		*	\return thin QR factorization of _matrix.
+		*/
+		template<typename T>
+		MATHLIBRARY_API QRDecomposition<T> ComputeQR(const DenseMat<T>& _matrix);
+	}
+
+	namespace Solver
+	{
+		/**
+		*	\brief Find _result minimizing the length of _matrix * _result - _rhs with a Householder QR factorization.
+		*	Only float and double are instantiated.
+		*
+		*	\param[in] _matrix matrix with at least as many rows as columns.
+		*	\param[in] _rhs right hand side, _matrix.GetRows() components.
+		*	\param[out] _result solution, _matrix.GetColumns() components, 0 when _matrix is rank deficient.
+		*
+		*	\return false when _matrix has less rows than columns or is rank deficient.
+		*/
+		template<typename T>
+		MATHLIBRARY_API bool SolveLeastSquares(const DenseMat<T>& _matrix, const T* _rhs, T* _result);
+	}
+
+	/**
+	*	\brief Least squares problem accumulated one row at a time in double precision.
+	*	Each row is folded into an upper triangular factor with Givens rotations, so memory does not grow with
+	*	the number of rows and the normal equations are never formed.
+	*/
+	struct StreamingLeastSquares
+	{
+	private:
+		/// Number of unknowns.
+		size_t unknowns = 0;
+
+		/// Number of rows added.
+		size_t rowCount = 0;
+
+		/// Squared length of the residual of the rows added.
+		double squaredResidual = 0.0;
+
+		/// Upper triangular factor r augmented with q^T * rhs, row major with unknowns + 1 columns.
+		std::vector<double> factors;
+
+		/// Row being folded in.
+		std::vector<double> scratch;
+
+	public:
+		//Constructors
+
+		/**
+		*	\brief Default constructor, no unknowns.
+		*/
+		StreamingLeastSquares() = default;
+
+		/**
+		*	\brief Constructor of an empty problem.
+		*
+		*	\param[in] _unknowns number of unknowns.
+		*/
+		MATHLIBRARY_API StreamingLeastSquares(size_t _unknowns);
+
+		/**
+		*	\brief Default copy constructor
+		*/
+		StreamingLeastSquares(const StreamingLeastSquares& _other) = default;
+
+		/**
+		*	\brief Default move constructor
+		*/
+		StreamingLeastSquares(StreamingLeastSquares&& _other) noexcept = default;
+
+		//Accessors
+
+		/**
+		*	\brief Return the number of unknowns.
+		*/
+		MATHLIBRARY_API size_t GetUnknownCount() const noexcept;
+
+		/**
+		*	\brief Return the number of rows added, merged problems included.
+		*/
+		MATHLIBRARY_API size_t GetRowCount() const noexcept;
+
+		/**
+		*	\brief Return the squared length of the residual of the least squares solution.
+		*/
+		MATHLIBRARY_API double GetSquaredResidual() const noexcept;
+
+		/**
+		*	\brief Return the upper triangular factor r, augmented with q^T * rhs as last column.
+		*	Row major with GetUnknownCount() + 1 columns, the diagonal is positive or 0.
+		*/
+		MATHLIBRARY_API const double* GetFactors() const noexcept;
+
+		//Methods
+
+		/**
+		*	\brief Add the equation _row . x = _rhs.
+		*
+		*	\param[in] _row GetUnknownCount() coefficients.
+		*	\param[in] _rhs right hand side.
+		*	\param[in] _weight weight of the squared residual of this equation, positive.
+		*/
+		MATHLIBRARY_API void AddRow(const double* _row, double _rhs, double _weight = 1.0) noexcept;
+
+		/**
+		*	\brief Add the rows of another problem, as if they were added to this one.
+		*	Call the error callback when the numbers of unknowns differ.
+		*/
+		MATHLIBRARY_API void Merge(const StreamingLeastSquares& _other) noexcept;
+
+		/**
+		*	\brief Remove every row.
+		*/
+		MATHLIBRARY_API void Clear() noexcept;
+
+		/**
+		*	\brief Compute the least squares solution of the rows added.
+		*
+		*	\param[out] _result GetUnknownCount() components, 0 when the problem is rank deficient.
+		*	\param[in] _tolerance rank deficient when a diagonal element of r is below _tolerance times the largest one.
+		*
+		*	\return false when the problem is rank deficient.
+		*/
+		MATHLIBRARY_API bool Solve(double* _result, double _tolerance = 1e-10) const noexcept;
+
+		//Operators
+
+		/**
+		*	\brief Default move assignement.
+		*
+		*	\return self problem assigned.
+		*/
+		StreamingLeastSquares& operator=(StreamingLeastSquares&&) noexcept = default;
+
+		/**
+		*	\brief Default copy assignement.
+		*
+		*	\return self problem assigned.
+		*/
+		StreamingLeastSquares& operator=(const StreamingLeastSquares&) = default;
+	};
+}
+
+#endif
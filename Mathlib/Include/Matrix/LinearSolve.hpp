@@ -0,0 +1,234 @@
+#pragma once
+
+#ifndef MATHLIB_LINEARSOLVE
+#define MATHLIB_LINEARSOLVE
+
+#include <cstddef>
+
+#include "Misc/DllExport.hpp"
+#include <Space/Vec2.hpp>
+#include <Space/Vec3.hpp>
+#include <Space/Vec4.hpp>
+#include <Space/Vec.hpp>
+#include <Matrix/Mat2.hpp>
+#include <Matrix/Mat3.hpp>
+#include <Matrix/Mat4.hpp>
+#include <Matrix/Mat.hpp>
+
+/**
+*	\file LinearSolve.hpp
+*
+*	\brief LU and Cholesky solvers for small dense systems, single and batched.
+*/
+
+namespace Mathlib
+{
+	namespace Solver
+	{
+		/**
+		*	\brief Solve _matrix * _result = _rhs by LU factorization with partial pivoting.
+		*
+		*	\param[in] _matrix square matrix.
+		*	\param[in] _rhs right hand side.
+		*	\param[out] _result solution, 0 when _matrix is singular.
+		*
+		*	\return false when _matrix is singular.
+		*/
+		MATHLIBRARY_API bool SolveLU(const Mat2& _matrix, const Vec2& _rhs, Vec2& _result) noexcept;
+
+		/**
+		*	\brief Solve _matrix * _result = _rhs by Cholesky factorization. Only the lower triangle of _matrix is read.
+		*
+		*	\param[in] _matrix symmetric positive definite matrix.
+		*	\param[in] _rhs right hand side.
+		*	\param[out] _result solution, 0 when _matrix is not positive definite.
+		*
+		*	\return false when _matrix is not positive definite.
+		*/
+		MATHLIBRARY_API bool SolveCholesky(const Mat2& _matrix, const Vec2& _rhs, Vec2& _result) noexcept;
+
+		/**
+		*	\brief Solve many systems by LU factorization with partial pivoting, several at once in component streams.
+		*	Runs the same algorithm as SolveLU.
+		*
+		*	\param[in] _matrices square matrices.
+		*	\param[in] _rhs right hand sides.
+		*	\param[in] _count number of systems.
+		*	\param[out] _results solutions, 0 for singular systems.
+		*	\param[out] _solved whether each system was solved, can be nullptr.
+		*	\param[in] _multithreaded split systems across threads.
+		*/
+		MATHLIBRARY_API void SolveLUBatch(const Mat2* _matrices, const Vec2* _rhs, size_t _count, Vec2* _results,
+			bool* _solved = nullptr, bool _multithreaded = false);
+
+		/**
+		*	\brief Solve many symmetric positive definite systems by Cholesky factorization, several at once in component
+		*	streams. Only the lower triangle of each matrix is read. Runs the same algorithm as SolveCholesky.
+		*
+		*	\param[in] _matrices symmetric positive definite matrices.
+		*	\param[in] _rhs right hand sides.
+		*	\param[in] _count number of systems.
+		*	\param[out] _results solutions, 0 for systems that are not positive definite.
+		*	\param[out] _solved whether each system was solved, can be nullptr.
+		*	\param[in] _multithreaded split systems across threads.
+		*/
+		MATHLIBRARY_API void SolveCholeskyBatch(const Mat2* _matrices, const Vec2* _rhs, size_t _count, Vec2* _results,
+			bool* _solved = nullptr, bool _multithreaded = false);
+
+		/**
+		*	\brief Solve _matrix * _result = _rhs by LU factorization with partial pivoting.
+		*
+		*	\param[in] _matrix square matrix.
+		*	\param[in] _rhs right hand side.
+		*	\param[out] _result solution, 0 when _matrix is singular.
+		*
+		*	\return false when _matrix is singular.
+		*/
+		MATHLIBRARY_API bool SolveLU(const Mat3& _matrix, const Vec3& _rhs, Vec3& _result) noexcept;
+
+		/**
+		*	\brief Solve _matrix * _result = _rhs by Cholesky factorization. Only the lower triangle of _matrix is read.
+		*
+		*	\param[in] _matrix symmetric positive definite matrix.
+		*	\param[in] _rhs right hand side.
+		*	\param[out] _result solution, 0 when _matrix is not positive definite.
+		*
+		*	\return false when _matrix is not positive definite.
+		*/
+		MATHLIBRARY_API bool SolveCholesky(const Mat3& _matrix, const Vec3& _rhs, Vec3& _result) noexcept;
+
+		/**
+		*	\brief Solve many systems by LU factorization with partial pivoting, several at once in component streams.
+		*	Runs the same algorithm as SolveLU.
+		*
+		*	\param[in] _matrices square matrices.
+		*	\param[in] _rhs right hand sides.
+		*	\param[in] _count number of systems.
+		*	\param[out] _results solutions, 0 for singular systems.
+		*	\param[out] _solved whether each system was solved, can be nullptr.
+		*	\param[in] _multithreaded split systems across threads.
+		*/
+		MATHLIBRARY_API void SolveLUBatch(const Mat3* _matrices, const Vec3* _rhs, size_t _count, Vec3* _results,
+			bool* _solved = nullptr, bool _multithreaded = false);
+
+		/**
+		*	\brief Solve many symmetric positive definite systems by Cholesky factorization, several at once in component
+		*	streams. Only the lower triangle of each matrix is read. Runs the same algorithm as SolveCholesky.
+		*
+		*	\param[in] _matrices symmetric positive definite matrices.
+		*	\param[in] _rhs right hand sides.
+		*	\param[in] _count number of systems.
+		*	\param[out] _results solutions, 0 for systems that are not positive definite.
+		*	\param[out] _solved whether each system was solved, can be nullptr.
+		*	\param[in] _multithreaded split systems across threads.
+		*/
+		MATHLIBRARY_API void SolveCholeskyBatch(const Mat3* _matrices, const Vec3* _rhs, size_t _count, Vec3* _results,
+			bool* _solved = nullptr, bool _multithreaded = false);
+
+		/**
+		*	\brief Solve _matrix * _result = _rhs by LU factorization with partial pivoting.
+		*
+		*	\param[in] _matrix square matrix.
+		*	\param[in] _rhs right hand side.
+		*	\param[out] _result solution, 0 when _matrix is singular.
+		*
+		*	\return false when _matrix is singular.
+		*/
+		MATHLIBRARY_API bool SolveLU(const Mat4& _matrix, const Vec4& _rhs, Vec4& _result) noexcept;
+
+		/**
+		*	\brief Solve _matrix * _result = _rhs by Cholesky factorization. Only the lower triangle of _matrix is read.
+		*
+		*	\param[in] _matrix symmetric positive definite matrix.
+		*	\param[in] _rhs right hand side.
+		*	\param[out] _result solution, 0 when _matrix is not positive definite.
+		*
+		*	\return false when _matrix is not positive definite.
+		*/
+		MATHLIBRARY_API bool SolveCholesky(const Mat4& _matrix, const Vec4& _rhs, Vec4& _result) noexcept;
+
+		/**
+		*	\brief Solve many systems by LU factorization with partial pivoting, several at once in component streams.
+		*	Runs the same algorithm as SolveLU.
+		*
+		*	\param[in] _matrices square matrices.
+		*	\param[in] _rhs right hand sides.
+		*	\param[in] _count number of systems.
+		*	\param[out] _results solutions, 0 for singular systems.
+		*	\param[out] _solved whether each system was solved, can be nullptr.
+		*	\param[in] _multithreaded split systems across threads.
+		*/
+		MATHLIBRARY_API void SolveLUBatch(const Mat4* _matrices, const Vec4* _rhs, size_t _count, Vec4* _results,
+			bool* _solved = nullptr, bool _multithreaded = false);
+
+		/**
+		*	\brief Solve many symmetric positive definite systems by Cholesky factorization, several at once in component
+		*	streams. Only the lower triangle of each matrix is read. Runs the same algorithm as SolveCholesky.
+		*
+		*	\param[in] _matrices symmetric positive definite matrices.
+		*	\param[in] _rhs right hand sides.
+		*	\param[in] _count number of systems.
+		*	\param[out] _results solutions, 0 for systems that are not positive definite.
+		*	\param[out] _solved whether each system was solved, can be nullptr.
+		*	\param[in] _multithreaded split systems across threads.
+		*/
+		MATHLIBRARY_API void SolveCholeskyBatch(const Mat4* _matrices, const Vec4* _rhs, size_t _count, Vec4* _results,
+			bool* _solved = nullptr, bool _multithreaded = false);
+
+		/**
+		*	\brief Solve _matrix * _result = _rhs by LU factorization with partial pivoting, N from 2 to 8.
+		*
+		*	\param[in] _matrix square matrix.
+		*	\param[in] _rhs right hand side.
+		*	\param[out] _result solution, 0 when _matrix is singular.
+		*
+		*	\return false when _matrix is singular.
+		*/
+		template<size_t N>
+		MATHLIBRARY_API bool SolveLU(const Mat<float, N, N>& _matrix, const Vec<float, N>& _rhs, Vec<float, N>& _result) noexcept;
+
+		/**
+		*	\brief Solve _matrix * _result = _rhs by Cholesky factorization, N from 2 to 8. Only the lower triangle of _matrix is read.
+		*
+		*	\param[in] _matrix symmetric positive definite matrix.
+		*	\param[in] _rhs right hand side.
+		*	\param[out] _result solution, 0 when _matrix is not positive definite.
+		*
+		*	\return false when _matrix is not positive definite.
+		*/
+		template<size_t N>
+		MATHLIBRARY_API bool SolveCholesky(const Mat<float, N, N>& _matrix, const Vec<float, N>& _rhs, Vec<float, N>& _result) noexcept;
+
+		/**
+		*	\brief Solve many systems by LU factorization with partial pivoting, several at once in component streams.
+		*	Runs the same algorithm as SolveLU.
+		*
+		*	\param[in] _matrices square matrices.
+		*	\param[in] _rhs right hand sides.
+		*	\param[in] _count number of systems.
+		*	\param[out] _results solutions, 0 for singular systems.
+		*	\param[out] _solved whether each system was solved, can be nullptr.
+		*	\param[in] _multithreaded split systems across threads.
+		*/
+		template<size_t N>
+		MATHLIBRARY_API void SolveLUBatch(const Mat<float, N, N>* _matrices, const Vec<float, N>* _rhs, size_t _count, Vec<float, N>* _results,
+			bool* _solved = nullptr, bool _multithreaded = false);
+
+		/**
+		*	\brief Solve many symmetric positive definite systems by Cholesky factorization, several at once in component
+		*	streams. Only the lower triangle of each matrix is read. Runs the same algorithm as SolveCholesky.
+		*
+		*	\param[in] _matrices symmetric positive definite matrices.
+		*	\param[in] _rhs right hand sides.
+		*	\param[in] _count number of systems.
+		*	\param[out] _results solutions, 0 for systems that are not positive definite.
+		*	\param[out] _solved whether each system was solved, can be nullptr.
+		*	\param[in] _multithreaded split systems across threads.
+		*/
+		template<size_t N>
+		MATHLIBRARY_API void SolveCholeskyBatch(const Mat<float, N, N>* _matrices, const Vec<float, N>* _rhs, size_t _count, Vec<float, N>* _results,
+			bool* _solved = nullptr, bool _multithreaded = false);
+	}
+}
+
+#endif
@@ -0,0 +1,526 @@
+#pragma once
+
+#ifndef MATHLIB_MAT
+#define MATHLIB_MAT
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
+#include <Misc/Unroll.hpp>
+#include <Space/Vec.hpp>
+
+/**
+*	\file Mat.hpp
+*
+*	\brief Generic matrix type implementation, parameterized on scalar type and dimensions.
+*
+*	Mat2, Mat3 and Mat4 derive from the float instances and forward their arithmetic to them.
+*/
+
+namespace Mathlib
+{
+	/**
+	*	\brief Name of a matrix type given to the error callback, specialized by the named float matrices.
+	*/
+	template<typename T, size_t R, size_t C>
+	struct MatName
+	{
+		static constexpr const char* Value = "Mat";
+	};
+
+	/**
+	*	\brief Components of a generic matrix row after row, named eRC for square matrices of 2 to 4 rows.
+	*/
+	template<typename T, size_t R, size_t C>
+	struct MatStorage
+	{
+		/// Matrix components, row after row.
+		T values[R * C] = {};
+
+		T* Data() noexcept { return values; }
+		const T* Data() const noexcept { return values; }
+	};
+
+	template<typename T>
+	struct MatStorage<T, 2, 2>
+	{
+		// Matrix components.
+		T e00{ T(0) }; T e01{ T(0) };
+		T e10{ T(0) }; T e11{ T(0) };
+
+		T* Data() noexcept { return &e00; }
+		const T* Data() const noexcept { return &e00; }
+	};
+
+	template<typename T>
+	struct MatStorage<T, 3, 3>
+	{
+		// Matrix components.
+		T e00{ T(0) }; T e01{ T(0) }; T e02{ T(0) };
+		T e10{ T(0) }; T e11{ T(0) }; T e12{ T(0) };
+		T e20{ T(0) }; T e21{ T(0) }; T e22{ T(0) };
+
+		T* Data() noexcept { return &e00; }
+		const T* Data() const noexcept { return &e00; }
+	};
+
+	template<typename T>
+	struct MatStorage<T, 4, 4>
+	{
+		// Matrix components.
+		T e00{ T(0) }; T e01{ T(0) }; T e02{ T(0) }; T e03{ T(0) };
+		T e10{ T(0) }; T e11{ T(0) }; T e12{ T(0) }; T e13{ T(0) };
+		T e20{ T(0) }; T e21{ T(0) }; T e22{ T(0) }; T e23{ T(0) };
+		T e30{ T(0) }; T e31{ T(0) }; T e32{ T(0) }; T e33{ T(0) };
+
+		T* Data() noexcept { return &e00; }
+		const T* Data() const noexcept { return &e00; }
+	};
+
+	/**
+	*	\brief Generic row major matrix struct of R rows and C columns of type T.
+	*	Every operation is inline and unrolled over the components.
+	*/
+	template<typename T, size_t R, size_t C>
+	struct Mat : public MatStorage<T, R, C>
+	{
+		static_assert(R > 0 && C > 0, "Mat needs at least one row and one column");
+		static_assert(std::is_arithmetic<T>::value || IsFixedPoint<T>::value, "Mat components must be arithmetic or fixed point");
+
+		/// Type of the components.
+		using ValueType = T;
+
+		/// Number of rows.
+		static constexpr size_t Rows = R;
+
+		/// Number of columns.
+		static constexpr size_t Columns = C;
+
+		using MatStorage<T, R, C>::Data;
+
+		//Constructors
+
+		/**
+		*	\brief Default constructor, all components are 0.
+		*/
+		Mat() = default;
+
+		/**
+		*	\brief Value constructor, one value per component row after row.
+		*
+		*	\param[in] _values components values, converted to T.
+		*/
+		template<typename... Args, typename = std::enable_if_t<(R * C > 1) && sizeof...(Args) == R * C>>
+		Mat(Args... _values) noexcept
+		{
+			const T components[R * C] = { static_cast<T>(_values)... };
+			Math::Unroll<R * C>([&](size_t i) { Data()[i] = components[i]; });
+		}
+
+		/**
+		*	\brief Value constructor
+		*
+		*	\param[in] _value Value applied on all matrix components.
+		*/
+		explicit Mat(T _value) noexcept
+		{
+			Math::Unroll<R * C>([&](size_t i) { Data()[i] = _value; });
+		}
+
+		/**
+		*	\brief Conversion constructor from a matrix of an other component type.
+		*
+		*	\param[in] _other matrix to convert, each component is cast to T.
+		*/
+		template<typename U>
+		explicit Mat(const Mat<U, R, C>& _other) noexcept
+		{
+			Math::Unroll<R * C>([&](size_t i) { Data()[i] = static_cast<T>(_other.Data()[i]); });
+		}
+
+		/**
+		*	\brief Default copy constructor
+		*/
+		Mat(const Mat& _mat) = default;
+
+		/**
+		*	\brief Default move constructor
+		*/
+		Mat(Mat&& _mat) = default;
+
+		//Static Methods
+
+		/**
+		*	\brief Return the identity matrix, square matrices only.
+		*/
+		static Mat Identity() noexcept
+		{
+			static_assert(R == C, "Only square matrices have an identity");
+
+			Mat result;
+			Math::Unroll<R>([&](size_t i) { result(i, i) = T(1); });
+
+			return result;
+		}
+
+		//Equality
+
+		/**
+		*	\brief Compare this matrix with with _other
+		*
+		*	\param[in] _other other matrix to do the comparison with.
+		* 	\param[in] _epsilon threshold to accept equality, exact comparison for integral types.
+		*
+		*	\return if this and _other are equal.
+		*/
+		bool Equals(const Mat& _other, T _epsilon = static_cast<T>(Math::FloatEpsilon)) const noexcept
+		{
+			bool equals = true;
+			Math::Unroll<R * C>([&](size_t i)
+			{
+				T difference = Data()[i] < _other.Data()[i] ? _other.Data()[i] - Data()[i] : Data()[i] - _other.Data()[i];
+				equals &= difference <= _epsilon;
+			});
+
+			return equals;
+		}
+
+		/**
+		*	\brief Operator to compare this matrix with with _rhs, component wise exact comparison.
+		*/
+		bool operator==(const Mat& _rhs) const noexcept
+		{
+			bool equals = true;
+			Math::Unroll<R * C>([&](size_t i) { equals &= Data()[i] == _rhs.Data()[i]; });
+
+			return equals;
+		}
+
+		/**
+		*	\brief Operator to compare this matrix with with _rhs.
+		*/
+		bool operator!=(const Mat& _rhs) const noexcept
+		{
+			return !(*this == _rhs);
+		}
+
+		//Accessors
+
+		/**
+		*	\brief Access component at _row, _column, no bound check.
+		*/
+		T& operator()(size_t _row, size_t _column) noexcept
+		{
+			return Data()[_row * C + _column];
+		}
+
+		/**
+		*	\brief Access component at _row, _column, no bound check.
+		*/
+		const T& operator()(size_t _row, size_t _column) const noexcept
+		{
+			return Data()[_row * C + _column];
+		}
+
+		/**
+		*	\brief Return row _row as a vector.
+		*/
+		Vec<T, C> GetRow(size_t _row) const noexcept
+		{
+			Vec<T, C> result;
+			Math::Unroll<C>([&](size_t j) { result[j] = (*this)(_row, j); });
+
+			return result;
+		}
+
+		/**
+		*	\brief Return column _column as a vector.
+		*/
+		Vec<T, R> GetColumn(size_t _column) const noexcept
+		{
+			Vec<T, R> result;
+			Math::Unroll<R>([&](size_t i) { result[i] = (*this)(i, _column); });
+
+			return result;
+		}
+
+		//Methods
+
+		/**
+		*	\brief Return the transpose of this matrix.
+		*/
+		Mat<T, C, R> GetTranspose() const noexcept
+		{
+			Mat<T, C, R> result;
+			Math::Unroll<R>([&](size_t i)
+			{
+				Math::Unroll<C>([&](size_t j) { result(j, i) = (*this)(i, j); });
+			});
+
+			return result;
+		}
+
+		/**
+		*	\brief Return this matrix without row _row and column _column.
+		*/
+		Mat<T, R - 1, C - 1> GetMinor(size_t _row, size_t _column) const noexcept
+		{
+			Mat<T, R - 1, C - 1> result;
+			Math::Unroll<R - 1>([&](size_t i)
+			{
+				Math::Unroll<C - 1>([&](size_t j)
+				{
+					result(i, j) = (*this)(i < _row ? i : i + 1, j < _column ? j : j + 1);
+				});
+			});
+
+			return result;
+		}
+
+		/**
+		*	\brief Return the determinant of this matrix. Square matrices only, closed forms up to 4 rows and
+		*	expansion along the first row above, meant for small sizes.
+		*/
+		T Determinant() const noexcept
+		{
+			static_assert(R == C, "Only square matrices have a determinant");
+
+			const T* m = Data();
+
+			if constexpr (R == 1)
+				return m[0];
+			else if constexpr (R == 2)
+				return m[0] * m[3] - m[1] * m[2];
+			else if constexpr (R == 3)
+				return m[0] * (m[4] * m[8] - m[5] * m[7]) - m[1] * (m[3] * m[8] - m[5] * m[6]) + m[2] * (m[3] * m[7] - m[4] * m[6]);
+			else if constexpr (R == 4)
+			{
+				// 2x2 determinants of the two lower rows, shared by the cofactors of the first row.
+				const T det_22_23_32_33 = m[10] * m[15] - m[11] * m[14];
+				const T det_21_22_31_32 = m[9] * m[14] - m[10] * m[13];
+				const T det_21_23_31_33 = m[9] * m[15] - m[11] * m[13];
+				const T det_20_23_30_33 = m[8] * m[15] - m[11] * m[12];
+				const T det_20_22_30_32 = m[8] * m[14] - m[10] * m[12];
+				const T det_20_21_30_31 = m[8] * m[13] - m[9] * m[12];
+
+				return m[0] * (m[5] * det_22_23_32_33 - m[6] * det_21_23_31_33 + m[7] * det_21_22_31_32) -
+					m[1] * (m[4] * det_22_23_32_33 - m[6] * det_20_23_30_33 + m[7] * det_20_22_30_32) +
+					m[2] * (m[4] * det_21_23_31_33 - m[5] * det_20_23_30_33 + m[7] * det_20_21_30_31) -
+					m[3] * (m[4] * det_21_22_31_32 - m[5] * det_20_22_30_32 + m[6] * det_20_21_30_31);
+			}
+			else
+			{
+				T result = T(0);
+				Math::Unroll<C>([&](size_t j)
+				{
+					T cofactor = m[j] * GetMinor(0, j).Determinant();
+					result += (j % 2 == 0) ? cofactor : -cofactor;
+				});
+
+				return result;
+			}
+		}
+
+		//Operator
+
+		/**
+		*	\brief Default move assignement.
+		*
+		*	\return self matrix assigned.
+		*/
+		Mat& operator=(Mat&&) = default;
+
+		/**
+		*	\brief Default copy assignement.
+		*
+		*	\return self matrix assigned.
+		*/
+		Mat& operator=(const Mat&) = default;
+
+		/**
+		*	\brief \e Getter of the opposite signed matrix.
+		*/
+		Mat operator-() const noexcept
+		{
+			Mat result;
+			Math::Unroll<R * C>([&](size_t i) { result.Data()[i] = -Data()[i]; });
+
+			return result;
+		}
+
+		/**
+		*	\brief Add term by term matrix values.
+		*/
+		Mat operator+(const Mat& _rhs) const noexcept
+		{
+			Mat result = *this;
+			return result += _rhs;
+		}
+
+		/**
+		*	\brief Substract term by term matrix values.
+		*/
+		Mat operator-(const Mat& _rhs) const noexcept
+		{
+			Mat result = *this;
+			return result -= _rhs;
+		}
+
+		/**
+		*	\brief Add term by term matrix values.
+		*/
+		Mat& operator+=(const Mat& _rhs) noexcept
+		{
+			Math::Unroll<R * C>([&](size_t i) { Data()[i] += _rhs.Data()[i]; });
+			return *this;
+		}
+
+		/**
+		*	\brief Substract term by term matrix values.
+		*/
+		Mat& operator-=(const Mat& _rhs) noexcept
+		{
+			Math::Unroll<R * C>([&](size_t i) { Data()[i] -= _rhs.Data()[i]; });
+			return *this;
+		}
+
+		/**
+		*	\brief Add _scale to each matrix value.
+		*/
+		Mat operator+(T _scale) const noexcept
+		{
+			Mat result = *this;
+			return result += _scale;
+		}
+
+		/**
+		*	\brief Substract _scale to each matrix value.
+		*/
+		Mat operator-(T _scale) const noexcept
+		{
+			Mat result = *this;
+			return result -= _scale;
+		}
+
+		/**
+		*	\brief Add _scale to each matrix value.
+		*/
+		Mat& operator+=(T _scale) noexcept
+		{
+			Math::Unroll<R * C>([&](size_t i) { Data()[i] += _scale; });
+			return *this;
+		}
+
+		/**
+		*	\brief Substract _scale to each matrix value.
+		*/
+		Mat& operator-=(T _scale) noexcept
+		{
+			Math::Unroll<R * C>([&](size_t i) { Data()[i] -= _scale; });
+			return *this;
+		}
+
+		/**
+		*	\brief Scale each matrix value by _scale.
+		*/
+		Mat operator*(T _scale) const noexcept
+		{
+			Mat result = *this;
+			return result *= _scale;
+		}
+
+		/**
+		*	\brief Scale each matrix value by _scale.
+		*/
+		Mat& operator*=(T _scale) noexcept
+		{
+			Math::Unroll<R * C>([&](size_t i) { Data()[i] *= _scale; });
+			return *this;
+		}
+
+		/**
+		*	\brief Divide each matrix value by _scale.
+		*/
+		Mat operator/(T _scale) const
+		{
+			Mat result = *this;
+			return result /= _scale;
+		}
+
+		/**
+		*	\brief Divide each matrix value by _scale. Integral and fixed point matrices divided by 0 are set to 0.
+		*/
+		Mat& operator/=(T _scale)
+		{
+			if (_scale == T(0))
+			{
+				Callback::CallErrorCallback(MatName<T, R, C>::Value, "operator/", "Division by 0");
+
+				if constexpr (!std::is_floating_point<T>::value)
+					return *this = Mat();
+			}
+
+			Math::Unroll<R * C>([&](size_t i) { Data()[i] /= _scale; });
+			return *this;
+		}
+
+		/**
+		*	\brief Multiply this matrix by _rhs.
+		*
+		*	\param[in] _rhs matrix of C rows to multiply with.
+		*
+		*	\return new R x K matrix.
+		*/
+		template<size_t K>
+		Mat<T, R, K> operator*(const Mat<T, C, K>& _rhs) const noexcept
+		{
+			Mat<T, R, K> result;
+			Math::Unroll<R>([&](size_t i)
+			{
+				Math::Unroll<C>([&](size_t k)
+				{
+					const T lhs = (*this)(i, k);
+					Math::Unroll<K>([&](size_t j) { result(i, j) += lhs * _rhs(k, j); });
+				});
+			});
+
+			return result;
+		}
+
+		/**
+		*	\brief Multiply this matrix by the column vector _rhs.
+		*/
+		Vec<T, R> operator*(const Vec<T, C>& _rhs) const noexcept
+		{
+			Vec<T, R> result;
+			Math::Unroll<R>([&](size_t i)
+			{
+				Math::Unroll<C>([&](size_t j) { result[i] += (*this)(i, j) * _rhs[j]; });
+			});
+
+			return result;
+		}
+
+		//Debug
+
+		/**
+		*	\brief Return the matrix as a string, rows separated by new lines.
+		*/
+		std::string ToString() const noexcept
+		{
+			std::string result;
+			Math::Unroll<R>([&](size_t i) { result += GetRow(i).ToString() + (i + 1 < R ? "\n" : ""); });
+
+			return result;
+		}
+	};
+
+	/// Double precision matrix 3X3.
+	using Mat3d = Mat<double, 3, 3>;
+
+	/// Double precision matrix 4X4, for transforms beyond float accuracy.
+	using Mat4d = Mat<double, 4, 4>;
+}
+
+#endif
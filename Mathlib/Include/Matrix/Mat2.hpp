@@ -4,6 +4,7 @@
 #define MATHLIB_MAT2
 
 #include "Misc/DllExport.hpp"
+#include "Matrix/Mat.hpp"
 
 /**
 *	\file Mat2.hpp
@@ -17,14 +18,19 @@ namespace Mathlib
 	struct Mat3;
 	struct Mat4;
 
+	template<>
+	struct MatName<float, 2, 2>
+	{
+		static constexpr const char* Value = "Mat2";
+	};
+
 	/**
-	*	\brief Matrix 2X2 struct.
+	*	\brief Matrix 2X2 struct, thin wrapper over Mat<float, 2, 2>.
 	*/
-	struct MATHLIBRARY_API Mat2
+	struct MATHLIBRARY_API Mat2 : public Mat<float, 2, 2>
 	{
-		// Matrix components.
-		float e00{ 0.f }; float e01{ 0.f }; 
-		float e10{ 0.f }; float e11{ 0.f };
+		/// Generic matrix implementing the arithmetic, Mat2 forwards to it.
+		using Base = Mat<float, 2, 2>;
 
 		//Constants
 		/**
@@ -98,6 +104,24 @@ namespace Mathlib
 		*/
 		Mat2(Mat2&& _mat2) noexcept  = default;
 
+		/**
+		*	\brief Constructor from the generic matrix.
+		*
+		*	\param[in] _mat matrix to copy values from.
+		*/
+		Mat2(const Base& _mat) noexcept;
+
+		/**
+		*	\brief Conversion constructor from a generic matrix of an other component type.
+		*
+		*	\param[in] _other matrix to convert, each component is cast to float.
+		*/
+		template<typename U>
+		explicit Mat2(const Mat<U, 2, 2>& _other) noexcept :
+			Base(_other)
+		{
+		}
+
 		//Static methods
 
 		/**
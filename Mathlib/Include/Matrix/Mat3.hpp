@@ -4,6 +4,7 @@
 #define MATHLIB_MAT3
 
 #include "Misc/DllExport.hpp"
+#include "Matrix/Mat.hpp"
 
 /**
 *	\file Mat3.hpp
@@ -17,16 +18,21 @@ namespace Mathlib
 	struct Vec3;
 	struct Mat2;
 	struct Mat4;
+	struct Quat;
+
+	template<>
+	struct MatName<float, 3, 3>
+	{
+		static constexpr const char* Value = "Mat3";
+	};
 
 	/**
-	*	\brief Matrix 3X3 struct.
+	*	\brief Matrix 3X3 struct, thin wrapper over Mat<float, 3, 3>.
 	*/
-	struct MATHLIBRARY_API Mat3
+	struct MATHLIBRARY_API Mat3 : public Mat<float, 3, 3>
 	{
-		// Matrix components.
-		float e00{ 0.f }; float e01{ 0.f }; float e02{ 0.f };
-		float e10{ 0.f }; float e11{ 0.f }; float e12{ 0.f };
-		float e20{ 0.f }; float e21{ 0.f }; float e22{ 0.f };
+		/// Generic matrix implementing the arithmetic, Mat3 forwards to it.
+		using Base = Mat<float, 3, 3>;
 
 		//Constants
 		/**
@@ -110,6 +116,24 @@ namespace Mathlib
 		*/
 		Mat3(Mat3&& _mat) noexcept = default;
 
+		/**
+		*	\brief Constructor from the generic matrix.
+		*
+		*	\param[in] _mat matrix to copy values from.
+		*/
+		Mat3(const Base& _mat) noexcept;
+
+		/**
+		*	\brief Conversion constructor from a generic matrix of an other component type.
+		*
+		*	\param[in] _other matrix to convert, each component is cast to float.
+		*/
+		template<typename U>
+		explicit Mat3(const Mat<U, 3, 3>& _other) noexcept :
+			Base(_other)
+		{
+		}
+
 		//Static methods
 
 		/**
@@ -130,6 +154,14 @@ namespace Mathlib
 		*/
 		static Mat3 RotationMatrix(const Vec3& _rotation) noexcept;
 
+		/**
+		*	\brief Create rotation matrix from quaternion.
+		*
+		*	\param[in] _rotation normalized quaternion to create matrix from.
+		*
+		*/
+		static Mat3 RotationMatrix(const Quat& _rotation) noexcept;
+
 		/**
 		*	\brief Create rotation matrix from specified angle.
 		*
@@ -3,7 +3,10 @@
 #ifndef MATHLIB_MAT4
 #define MATHLIB_MAT4
 
+#include <cstddef>
+
 #include "Misc/DllExport.hpp"
+#include "Matrix/Mat.hpp"
 #include "Misc//Constants.hpp"
 #include "Misc/Common.hpp"
 
@@ -21,11 +24,20 @@ namespace Mathlib
 	struct Mat3;
 	struct Quat;
 
+	template<>
+	struct MatName<float, 4, 4>
+	{
+		static constexpr const char* Value = "Mat4";
+	};
+
 	/**
-	*	\brief Matrix 4X4 struct.
+	*	\brief Matrix 4X4 struct, thin wrapper over Mat<float, 4, 4>.
 	*/
-	struct MATHLIBRARY_API Mat4
+	struct MATHLIBRARY_API Mat4 : public Mat<float, 4, 4>
 	{
+		/// Generic matrix implementing the arithmetic, Mat4 forwards to it.
+		using Base = Mat<float, 4, 4>;
+
 	private:
 		/**
 		*	\brief left handed world to inverse view matrix.
@@ -74,12 +86,6 @@ namespace Mathlib
 
 	public:
 
-		// Matrix components.
-		float e00{ 0.f }; float e01{ 0.f }; float e02{ 0.f }; float e03{ 0.f };
-		float e10{ 0.f }; float e11{ 0.f }; float e12{ 0.f }; float e13{ 0.f };
-		float e20{ 0.f }; float e21{ 0.f }; float e22{ 0.f }; float e23{ 0.f };
-		float e30{ 0.f }; float e31{ 0.f }; float e32{ 0.f }; float e33{ 0.f };
-
 		//Constants
 		/**
 		*	\brief zero matrix
@@ -173,6 +179,24 @@ namespace Mathlib
 		*/
 		Mat4(Mat4&& _mat) noexcept = default;
 
+		/**
+		*	\brief Constructor from the generic matrix.
+		*
+		*	\param[in] _mat matrix to copy values from.
+		*/
+		Mat4(const Base& _mat) noexcept;
+
+		/**
+		*	\brief Conversion constructor from a generic matrix of an other component type.
+		*
+		*	\param[in] _other matrix to convert, each component is cast to float.
+		*/
+		template<typename U>
+		explicit Mat4(const Mat<U, 4, 4>& _other) noexcept :
+			Base(_other)
+		{
+		}
+
 		//Static methods
 
 		/**
@@ -327,6 +351,43 @@ namespace Mathlib
 		**/
 		Mat4 GetInverse() const noexcept;
 
+		/**
+		*	\brief Invert many matrices, several at once in component streams.
+		*	Singular matrices are reported in _invertible instead of calling the error callback.
+		*
+		*	\param[in] _matrices matrices to invert.
+		*	\param[in] _count number of matrices.
+		*	\param[out] _result inverse of each matrix, singular ones copied unchanged as GetInverse does. May be _matrices.
+		*	\param[out] _invertible whether each matrix has a non null determinant, nullptr to ignore.
+		*	\param[in] _multithreaded split matrices across threads.
+		**/
+		static void InverseBatch(const Mat4* _matrices, size_t _count, Mat4* _result, bool* _invertible = nullptr,
+			bool _multithreaded = false);
+
+		/**
+		*	\brief Invert many affine matrices, whose last row is (0, 0, 0, 1), several at once in component streams.
+		*	Only the upper 3x3 block is inverted, the last row is not read.
+		*
+		*	\param[in] _matrices affine matrices to invert.
+		*	\param[in] _count number of matrices.
+		*	\param[out] _result inverse of each matrix, singular ones copied unchanged. May be _matrices.
+		*	\param[out] _invertible whether each upper 3x3 block has a non null determinant, nullptr to ignore.
+		*	\param[in] _multithreaded split matrices across threads.
+		**/
+		static void InverseAffineBatch(const Mat4* _matrices, size_t _count, Mat4* _result, bool* _invertible = nullptr,
+			bool _multithreaded = false);
+
+		/**
+		*	\brief Invert many rigid matrices, rotation and translation without scale, several at once in component streams.
+		*	The rotation is transposed and the translation rotated back, the last row is not read.
+		*
+		*	\param[in] _matrices rigid matrices to invert.
+		*	\param[in] _count number of matrices.
+		*	\param[out] _result inverse of each matrix. May be _matrices.
+		*	\param[in] _multithreaded split matrices across threads.
+		**/
+		static void InverseRigidBatch(const Mat4* _matrices, size_t _count, Mat4* _result, bool _multithreaded = false);
+
 		/**
 		*	\brief Compute matrix determinant.
 		**/
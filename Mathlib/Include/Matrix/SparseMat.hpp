@@ -0,0 +1,184 @@
+#pragma once
+
+#ifndef MATHLIB_SPARSEMAT
+#define MATHLIB_SPARSEMAT
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Misc/DllExport.hpp"
+#include <Matrix/DenseMat.hpp>
+
+/**
+*	\file SparseMat.hpp
+*
+*	\brief Sparse matrix type implementation, stored in compressed sparse rows.
+*/
+
+namespace Mathlib
+{
+	/**
+	*	\brief Non zero value of a sparse matrix, used to build it.
+	*/
+	template<typename T>
+	struct SparseEntry
+	{
+		/// Row of the value.
+		size_t row = 0;
+
+		/// Column of the value.
+		size_t column = 0;
+
+		/// Value.
+		T value = T(0);
+	};
+
+	/**
+	*	\brief Sparse matrix in compressed sparse rows: the non zero values of each row are stored contiguously,
+	*	sorted by column. Only float and double are instantiated.
+	*/
+	template<typename T>
+	struct SparseMat
+	{
+	private:
+		/// Number of rows.
+		size_t rows = 0;
+
+		/// Number of columns.
+		size_t columns = 0;
+
+		/// Index of the first value of each row, followed by the number of values.
+		std::vector<size_t> rowStarts = { 0 };
+
+		/// Column of each value.
+		std::vector<uint32_t> columnIndices;
+
+		/// Non zero values, row after row.
+		std::vector<T> values;
+
+	public:
+		//Constructors
+
+		/**
+		*	\brief Default constructor, empty matrix.
+		*/
+		SparseMat() = default;
+
+		/**
+		*	\brief Constructor from non zero entries in any order, entries at the same position are summed.
+		*	Call the error callback and skip entries out of the matrix.
+		*
+		*	\param[in] _rows number of rows.
+		*	\param[in] _columns number of columns, must fit in 32 bits.
+		*	\param[in] _entries entries to store.
+		*	\param[in] _count number of entries.
+		*/
+		MATHLIBRARY_API SparseMat(size_t _rows, size_t _columns, const SparseEntry<T>* _entries, size_t _count);
+
+		/**
+		*	\brief Default copy constructor
+		*/
+		SparseMat(const SparseMat& _mat) = default;
+
+		/**
+		*	\brief Default move constructor
+		*/
+		SparseMat(SparseMat&& _mat) noexcept = default;
+
+		//Static methods
+
+		/**
+		*	\brief Create a sparse matrix from the values of _mat whose magnitude is greater than _threshold.
+		*/
+		MATHLIBRARY_API static SparseMat FromDense(const DenseMat<T>& _mat, T _threshold = T(0));
+
+		/**
+		*	\brief Compute the sparse matrix vector product _result = _lhs * _vector.
+		*
+		*	\param[in] _lhs matrix.
+		*	\param[in] _vector _lhs.GetColumns() components.
+		*	\param[out] _result _lhs.GetRows() components, must not overlap _vector.
+		*	\param[in] _multithreaded split rows across threads.
+		*/
+		MATHLIBRARY_API static void Multiply(const SparseMat& _lhs, const T* _vector, T* _result, bool _multithreaded = false);
+
+		//Accessors
+
+		/**
+		*	\brief Return the number of rows.
+		*/
+		MATHLIBRARY_API size_t GetRows() const noexcept;
+
+		/**
+		*	\brief Return the number of columns.
+		*/
+		MATHLIBRARY_API size_t GetColumns() const noexcept;
+
+		/**
+		*	\brief Return the number of stored values.
+		*/
+		MATHLIBRARY_API size_t GetNonZeroCount() const noexcept;
+
+		/**
+		*	\brief Return the index of the first value of each row, GetRows() + 1 elements.
+		*/
+		MATHLIBRARY_API const size_t* GetRowStarts() const noexcept;
+
+		/**
+		*	\brief Return the column of each stored value.
+		*/
+		MATHLIBRARY_API const uint32_t* GetColumnIndices() const noexcept;
+
+		/**
+		*	\brief Return the stored values, row after row.
+		*/
+		MATHLIBRARY_API const T* GetValues() const noexcept;
+
+		/**
+		*	\brief Return the stored values, row after row, to update them without changing the pattern.
+		*/
+		MATHLIBRARY_API T* GetValues() noexcept;
+
+		/**
+		*	\brief Return the value at _row, _column, 0 when not stored.
+		*/
+		MATHLIBRARY_API T Get(size_t _row, size_t _column) const noexcept;
+
+		/**
+		*	\brief Write the diagonal values in _result, min(GetRows(), GetColumns()) components.
+		*/
+		MATHLIBRARY_API void GetDiagonal(T* _result) const noexcept;
+
+		//Methods
+
+		/**
+		*	\brief Return this matrix as a dense matrix.
+		*/
+		MATHLIBRARY_API DenseMat<T> ToDense() const;
+
+		//Operators
+
+		/**
+		*	\brief Default move assignement.
+		*
+		*	\return self matrix assigned.
+		*/
+		SparseMat& operator=(SparseMat&&) noexcept = default;
+
+		/**
+		*	\brief Default copy assignement.
+		*
+		*	\return self matrix assigned.
+		*/
+		SparseMat& operator=(const SparseMat&) = default;
+	};
+
+	/// Sparse float matrix.
+	using SparseMatf = SparseMat<float>;
+
+	/// Sparse double matrix.
+	using SparseMatd = SparseMat<double>;
+}
+
+#endif
@@ -0,0 +1,76 @@
+#pragma once
+
+#ifndef MATHLIB_ALIGNEDALLOCATOR
+#define MATHLIB_ALIGNEDALLOCATOR
+
+#include <cstddef>
+#include <new>
+
+/**
+*	\file AlignedAllocator.hpp
+*
+*	\brief Standard allocator returning memory aligned for SIMD loads.
+*/
+
+namespace Mathlib
+{
+	/**
+	*	\brief Allocator for standard containers aligning every allocation on Alignment bytes.
+	*/
+	template<typename T, size_t Alignment = 64>
+	struct AlignedAllocator
+	{
+		static_assert(Alignment >= alignof(T) && (Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+
+		using value_type = T;
+
+		template<typename U>
+		struct rebind
+		{
+			using other = AlignedAllocator<U, Alignment>;
+		};
+
+		//Constructors
+
+		AlignedAllocator() noexcept = default;
+
+		template<typename U>
+		AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept
+		{
+		}
+
+		//Methods
+
+		/**
+		*	\brief Allocate memory for _count elements, aligned on Alignment bytes.
+		*/
+		T* allocate(size_t _count)
+		{
+			return static_cast<T*>(::operator new(_count * sizeof(T), std::align_val_t(Alignment)));
+		}
+
+		/**
+		*	\brief Release memory returned by allocate.
+		*/
+		void deallocate(T* _pointer, size_t) noexcept
+		{
+			::operator delete(_pointer, std::align_val_t(Alignment));
+		}
+
+		//Equality
+
+		template<typename U>
+		bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept
+		{
+			return true;
+		}
+
+		template<typename U>
+		bool operator!=(const AlignedAllocator<U, Alignment>&) const noexcept
+		{
+			return false;
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,300 @@
+#pragma once
+
+#ifndef MATHLIB_FIXED
+#define MATHLIB_FIXED
+
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+#include "Misc/DllExport.hpp"
+#include <Space/Vec.hpp>
+
+/**
+*	\file Fixed.hpp
+*
+*	\brief Fixed point scalar type implementation, giving bitwise identical results on every platform.
+*/
+
+namespace Mathlib
+{
+	/**
+	*	\brief Signed fixed point number stored in Storage with FractionBits bits of fraction.
+	*	Every operation is done in integers: additions wrap, products round to nearest, divisions truncate toward 0.
+	*	Sqrt, Sin and Cos only use integer arithmetic and are deterministic.
+	*	Only Q16.16 (int32_t, 16) and Q32.32 (int64_t, 32) are instantiated.
+	*/
+	template<typename Storage, unsigned int FractionBits>
+	struct Fixed
+	{
+		static_assert(std::is_signed<Storage>::value && std::is_integral<Storage>::value, "Fixed storage must be a signed integer");
+		static_assert(FractionBits * 2 == sizeof(Storage) * 8, "Fixed needs as many fraction bits as integer bits");
+
+		/// Type of the raw value.
+		using StorageType = Storage;
+
+		/// Unsigned type of the raw value, used for wrapping arithmetic.
+		using UnsignedType = std::make_unsigned_t<Storage>;
+
+		/// Raw value of 1.
+		static constexpr Storage OneRaw = Storage(1) << FractionBits;
+
+		/// Raw value, value * 2^FractionBits.
+		Storage raw = 0;
+
+		//Constructors
+
+		/**
+		*	\brief Default constructor, value is 0.
+		*/
+		constexpr Fixed() noexcept = default;
+
+		/**
+		*	\brief Constructor from an integer.
+		*
+		*	\param[in] _value integer value, must fit in the integer part.
+		*/
+		constexpr explicit Fixed(int _value) noexcept :
+			raw{ static_cast<Storage>(static_cast<Storage>(_value) * OneRaw) }
+		{
+		}
+
+		/**
+		*	\brief Constructor from a float, rounded to the nearest fixed point value.
+		*
+		*	\param[in] _value float value, must fit in the integer part.
+		*/
+		explicit Fixed(float _value) noexcept :
+			Fixed(static_cast<double>(_value))
+		{
+		}
+
+		/**
+		*	\brief Constructor from a double, rounded to the nearest fixed point value.
+		*
+		*	\param[in] _value double value, must fit in the integer part.
+		*/
+		explicit Fixed(double _value) noexcept :
+			raw{ static_cast<Storage>(std::llround(_value * static_cast<double>(OneRaw))) }
+		{
+		}
+
+		//Static Methods
+
+		/**
+		*	\brief Create a fixed point number from its raw value.
+		*/
+		static constexpr Fixed FromRaw(Storage _raw) noexcept
+		{
+			Fixed result;
+			result.raw = _raw;
+
+			return result;
+		}
+
+		/**
+		*	\brief Return Pi, rounded to the nearest fixed point value.
+		*/
+		static constexpr Fixed Pi() noexcept
+		{
+			return FromRaw(static_cast<Storage>(3.14159265358979323846 * OneRaw + 0.5));
+		}
+
+		/**
+		*	\brief Return the absolute value of _value.
+		*/
+		static constexpr Fixed Abs(Fixed _value) noexcept
+		{
+			return _value.raw < 0 ? -_value : _value;
+		}
+
+		/**
+		*	\brief Return the smallest of _lhs and _rhs.
+		*/
+		static constexpr Fixed Min(Fixed _lhs, Fixed _rhs) noexcept
+		{
+			return _rhs.raw < _lhs.raw ? _rhs : _lhs;
+		}
+
+		/**
+		*	\brief Return the largest of _lhs and _rhs.
+		*/
+		static constexpr Fixed Max(Fixed _lhs, Fixed _rhs) noexcept
+		{
+			return _lhs.raw < _rhs.raw ? _rhs : _lhs;
+		}
+
+		/**
+		*	\brief Return the largest integer value not greater than _value.
+		*/
+		static constexpr Fixed Floor(Fixed _value) noexcept
+		{
+			return FromRaw(static_cast<Storage>(static_cast<UnsignedType>(_value.raw) & ~static_cast<UnsignedType>(OneRaw - 1)));
+		}
+
+		/**
+		*	\brief Compute the square root of _value, correctly rounded. Call the error callback and return 0 if negative.
+		*/
+		MATHLIBRARY_API static Fixed Sqrt(Fixed _value) noexcept;
+
+		/**
+		*	\brief Compute the sine of _angle in radians with a degree 15 polynomial after range reduction.
+		*/
+		MATHLIBRARY_API static Fixed Sin(Fixed _angle) noexcept;
+
+		/**
+		*	\brief Compute the cosine of _angle in radians.
+		*/
+		MATHLIBRARY_API static Fixed Cos(Fixed _angle) noexcept;
+
+		//Accessors
+
+		/**
+		*	\brief Return this value as a float.
+		*/
+		float ToFloat() const noexcept
+		{
+			return static_cast<float>(ToDouble());
+		}
+
+		/**
+		*	\brief Return this value as a double.
+		*/
+		double ToDouble() const noexcept
+		{
+			return static_cast<double>(raw) / static_cast<double>(OneRaw);
+		}
+
+		/**
+		*	\brief Return the integer part of this value, rounded toward negative infinity.
+		*/
+		constexpr Storage ToInt() const noexcept
+		{
+			return raw >> FractionBits;
+		}
+
+		//Operator
+
+		constexpr Fixed operator-() const noexcept
+		{
+			return FromRaw(static_cast<Storage>(UnsignedType(0) - static_cast<UnsignedType>(raw)));
+		}
+
+		constexpr Fixed operator+(Fixed _rhs) const noexcept
+		{
+			return FromRaw(static_cast<Storage>(static_cast<UnsignedType>(raw) + static_cast<UnsignedType>(_rhs.raw)));
+		}
+
+		constexpr Fixed operator-(Fixed _rhs) const noexcept
+		{
+			return FromRaw(static_cast<Storage>(static_cast<UnsignedType>(raw) - static_cast<UnsignedType>(_rhs.raw)));
+		}
+
+		/**
+		*	\brief Multiply, rounding the result to nearest (halves rounded up).
+		*/
+		Fixed operator*(Fixed _rhs) const noexcept;
+
+		/**
+		*	\brief Divide, truncating toward 0. Call the error callback and return 0 when _rhs is 0.
+		*/
+		MATHLIBRARY_API Fixed operator/(Fixed _rhs) const noexcept;
+
+		Fixed& operator+=(Fixed _rhs) noexcept
+		{
+			return *this = *this + _rhs;
+		}
+
+		Fixed& operator-=(Fixed _rhs) noexcept
+		{
+			return *this = *this - _rhs;
+		}
+
+		Fixed& operator*=(Fixed _rhs) noexcept
+		{
+			return *this = *this * _rhs;
+		}
+
+		Fixed& operator/=(Fixed _rhs) noexcept
+		{
+			return *this = *this / _rhs;
+		}
+
+		constexpr bool operator==(Fixed _rhs) const noexcept { return raw == _rhs.raw; }
+		constexpr bool operator!=(Fixed _rhs) const noexcept { return raw != _rhs.raw; }
+		constexpr bool operator<(Fixed _rhs) const noexcept { return raw < _rhs.raw; }
+		constexpr bool operator<=(Fixed _rhs) const noexcept { return raw <= _rhs.raw; }
+		constexpr bool operator>(Fixed _rhs) const noexcept { return raw > _rhs.raw; }
+		constexpr bool operator>=(Fixed _rhs) const noexcept { return raw >= _rhs.raw; }
+
+		//Debug
+
+		/**
+		*	\brief Return the value as a string.
+		*/
+		std::string ToString() const noexcept
+		{
+			return std::to_string(ToDouble());
+		}
+	};
+
+	template<>
+	inline Fixed<int32_t, 16> Fixed<int32_t, 16>::operator*(Fixed _rhs) const noexcept
+	{
+		const int64_t product = static_cast<int64_t>(raw) * static_cast<int64_t>(_rhs.raw);
+
+		return FromRaw(static_cast<int32_t>((product + (int64_t(1) << 15)) >> 16));
+	}
+
+	template<>
+	inline Fixed<int64_t, 32> Fixed<int64_t, 32>::operator*(Fixed _rhs) const noexcept
+	{
+		// 128 bits product from 32 bits halves, kept in two's complement in (high, low).
+		const bool negative = (raw < 0) != (_rhs.raw < 0);
+		const uint64_t lhs = raw < 0 ? 0 - static_cast<uint64_t>(raw) : static_cast<uint64_t>(raw);
+		const uint64_t rhs = _rhs.raw < 0 ? 0 - static_cast<uint64_t>(_rhs.raw) : static_cast<uint64_t>(_rhs.raw);
+
+		const uint64_t lhs_low = lhs & 0xFFFFFFFFu, lhs_high = lhs >> 32;
+		const uint64_t rhs_low = rhs & 0xFFFFFFFFu, rhs_high = rhs >> 32;
+
+		const uint64_t low_low = lhs_low * rhs_low;
+		const uint64_t low_high = lhs_low * rhs_high;
+		const uint64_t high_low = lhs_high * rhs_low;
+		const uint64_t high_high = lhs_high * rhs_high;
+
+		const uint64_t middle = (low_low >> 32) + (low_high & 0xFFFFFFFFu) + (high_low & 0xFFFFFFFFu);
+		uint64_t low = (middle << 32) | (low_low & 0xFFFFFFFFu);
+		uint64_t high = high_high + (low_high >> 32) + (high_low >> 32) + (middle >> 32);
+
+		if (negative)
+		{
+			low = ~low + 1;
+			high = ~high + (low == 0 ? 1 : 0);
+		}
+
+		const uint64_t rounded = low + (uint64_t(1) << 31);
+		high += rounded < low ? 1 : 0;
+
+		return FromRaw(static_cast<int64_t>((high << 32) | (rounded >> 32)));
+	}
+
+	template<typename Storage, unsigned int FractionBits>
+	struct IsFixedPoint<Fixed<Storage, FractionBits>> : std::true_type
+	{
+	};
+
+	/// Fixed point number with 16 integer and 16 fraction bits, range [-32768, 32768[, step 1.5e-5.
+	using Q16_16 = Fixed<int32_t, 16>;
+
+	/// Fixed point number with 32 integer and 32 fraction bits, range [-2^31, 2^31[, step 2.3e-10.
+	using Q32_32 = Fixed<int64_t, 32>;
+
+	/// Q16.16 vector 3, squared length overflows beyond 181.
+	using Vec3Q16 = Vec<Q16_16, 3>;
+
+	/// Q32.32 vector 3, squared length overflows beyond 46340.
+	using Vec3Q32 = Vec<Q32_32, 3>;
+}
+
+#endif
@@ -0,0 +1,145 @@
+#pragma once
+
+#ifndef MATHLIB_HALF
+#define MATHLIB_HALF
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "Misc/DllExport.hpp"
+
+/**
+*	\file Half.hpp
+*
+*	\brief IEEE 754 half precision storage type and bulk conversions.
+*/
+
+namespace Mathlib
+{
+	/**
+	*	\brief 16 bits IEEE 754 half precision float, for storage only: convert to float to do arithmetic.
+	*	Conversions round to nearest even, values beyond 65504 become infinity.
+	*	Bulk conversions use F16C instructions when the running x86 CPU has them, the software path gives the same bits.
+	*/
+	struct MATHLIBRARY_API Half
+	{
+		/// Raw IEEE 754 binary16 bits.
+		uint16_t bits = 0;
+
+		//Constructors
+
+		/**
+		*	\brief Default constructor, value is +0.
+		*/
+		Half() = default;
+
+		/**
+		*	\brief Constructor from a float, rounded to the nearest half.
+		*
+		*	\param[in] _value float value to convert.
+		*/
+		explicit Half(float _value) noexcept;
+
+		/**
+		*	\brief Default copy constructor
+		*/
+		Half(const Half& _half) = default;
+
+		/**
+		*	\brief Default move constructor
+		*/
+		Half(Half&& _half) = default;
+
+		//Static Methods
+
+		/**
+		*	\brief Create a half from its raw bits.
+		*/
+		static Half FromBits(uint16_t _bits) noexcept;
+
+		/**
+		*	\brief Convert _count halves to floats.
+		*
+		*	\param[in] _values halves to convert.
+		*	\param[in] _count number of values.
+		*	\param[out] _results converted floats, conversion is exact.
+		*	\param[in] _multithreaded split values across threads.
+		*/
+		static void ToFloat(const Half* _values, size_t _count, float* _results, bool _multithreaded = false);
+
+		/**
+		*	\brief Convert _count floats to halves, rounded to nearest even.
+		*
+		*	\param[in] _values floats to convert.
+		*	\param[in] _count number of values.
+		*	\param[out] _results converted halves.
+		*	\param[in] _multithreaded split values across threads.
+		*/
+		static void FromFloat(const float* _values, size_t _count, Half* _results, bool _multithreaded = false);
+
+		/**
+		*	\brief Return whether bulk conversions run on F16C instructions, checked once on the running CPU.
+		*/
+		static bool HasHardwareConversion() noexcept;
+
+		//Equality
+
+		/**
+		*	\brief Operator to compare the bits of this half with _rhs. +0 and -0 are different, NaN equals itself.
+		*/
+		bool operator==(const Half& _rhs) const noexcept;
+
+		/**
+		*	\brief Operator to compare the bits of this half with _rhs.
+		*/
+		bool operator!=(const Half& _rhs) const noexcept;
+
+		//Accessors
+
+		/**
+		*	\brief Return this value as a float, conversion is exact.
+		*/
+		float ToFloat() const noexcept;
+
+		/**
+		*	\brief Check if this value is a NaN.
+		*/
+		bool IsNaN() const noexcept;
+
+		/**
+		*	\brief Check if this value is positive or negative infinity.
+		*/
+		bool IsInfinity() const noexcept;
+
+		//Operator
+
+		/**
+		*	\brief Convert this value to a float, conversion is exact.
+		*/
+		explicit operator float() const noexcept;
+
+		/**
+		*	\brief Default move assignement.
+		*
+		*	\return self half assigned.
+		*/
+		Half& operator=(Half&&) = default;
+
+		/**
+		*	\brief Default copy assignement.
+		*
+		*	\return self half assigned.
+		*/
+		Half& operator=(const Half&) = default;
+
+		//Debug
+
+		/**
+		*	\brief Return the value as a string.
+		*/
+		std::string ToString() const noexcept;
+	};
+}
+
+#endif
@@ -3,6 +3,8 @@
 #ifndef MATHLIB_MATH
 #define MATHLIB_MATH
 
+#include <cstddef>
+
 #include <Misc/DllExport.hpp>
 #include<Misc/Constants.hpp>
 
@@ -152,6 +154,39 @@ namespace Mathlib
 		*/
 		MATHLIBRARY_API float Sqrt(float _value) noexcept;
 
+		/**
+		*	\brief Compute an approximate inverse square root: hardware estimate when available, refined by Newton steps.
+		*	Relative error is below 1e-6 for positive normal values. Does not check its input,
+		*	the result is undefined for 0, negative, denormal, infinite and NaN values.
+		*
+		* 	\param[in] _value value to compute inverse square root from.
+		*
+		*	\return approximation of 1 / sqrt(_value).
+		*/
+		MATHLIBRARY_API float FastInverseSqrt(float _value) noexcept;
+
+		/**
+		*	\brief Compute FastInverseSqrt of many values, several at once.
+		*
+		* 	\param[in] _values values to compute inverse square root from.
+		* 	\param[in] _count number of values.
+		* 	\param[out] _result inverse square roots, may be _values.
+		*/
+		MATHLIBRARY_API void FastInverseSqrt(const float* _values, size_t _count, float* _result) noexcept;
+
+		/**
+		*	\brief Normalize many vectors of _dimension packed floats with FastInverseSqrt.
+		*	Null vectors stay null, without error callback, vectors with a denormal squared length are rescaled first.
+		*
+		* 	\param[in] _vectors components of the vectors, one vector after the other.
+		* 	\param[in] _count number of vectors.
+		* 	\param[in] _dimension number of components of each vector, from 2 to 4.
+		* 	\param[out] _result normalized vectors, may be _vectors.
+		* 	\param[in] _multithreaded split vectors across threads.
+		*/
+		MATHLIBRARY_API void NormalizeFast(const float* _vectors, size_t _count, size_t _dimension, float* _result,
+			bool _multithreaded = false);
+
 		/**
 		*	\brief Compare two values.
 		*
@@ -0,0 +1,107 @@
+#pragma once
+
+#ifndef MATHLIB_PARALLEL
+#define MATHLIB_PARALLEL
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+#include <Misc/DllExport.hpp>
+
+/**
+*	\file Parallel.hpp
+*
+*	\brief implementation of helpers splitting batch work across threads.
+*/
+
+namespace Mathlib
+{
+	namespace Math
+	{
+		/**
+		*	\brief Return the number of hardware threads, at least 1.
+		*/
+		MATHLIBRARY_API unsigned int GetThreadCount() noexcept;
+
+		/**
+		*	\brief Return the number of chunks ParallelFor splits a range into.
+		*
+		* 	\param[in] _count number of elements to process.
+		* 	\param[in] _min_batch minimum number of elements processed by one chunk.
+		*/
+		inline size_t GetChunkCount(size_t _count, size_t _min_batch) noexcept
+		{
+			size_t min_batch = std::max<size_t>(_min_batch, 1);
+			size_t max_chunks = (_count + min_batch - 1) / min_batch;
+
+			return std::max<size_t>(std::min<size_t>(GetThreadCount(), max_chunks), 1);
+		}
+
+		/**
+		*	\brief Split [_begin, _end) in GetChunkCount() contiguous chunks and call _function(begin, end) on each one,
+		*	chunks running on separate threads. Small ranges run on the calling thread.
+		*
+		* 	\param[in] _begin first element to process.
+		* 	\param[in] _end element past the last one to process.
+		* 	\param[in] _min_batch minimum number of elements processed by one chunk.
+		* 	\param[in] _function function called with each chunk bounds, must be safe to call concurrently.
+		*/
+		template<typename Function>
+		void ParallelFor(size_t _begin, size_t _end, size_t _min_batch, Function&& _function)
+		{
+			if (_end <= _begin)
+				return;
+
+			const size_t count = _end - _begin;
+			const size_t chunk_count = GetChunkCount(count, _min_batch);
+
+			if (chunk_count == 1)
+			{
+				_function(_begin, _end);
+				return;
+			}
+
+			const size_t chunk_size = (count + chunk_count - 1) / chunk_count;
+
+			std::vector<std::thread> threads;
+			threads.reserve(chunk_count - 1);
+
+			for (size_t chunk = 1; chunk < chunk_count; ++chunk)
+			{
+				size_t chunk_begin = _begin + chunk * chunk_size;
+				size_t chunk_end = std::min(chunk_begin + chunk_size, _end);
+
+				if (chunk_begin < chunk_end)
+					threads.emplace_back([&_function, chunk_begin, chunk_end]() { _function(chunk_begin, chunk_end); });
+			}
+
+			_function(_begin, std::min(_begin + chunk_size, _end));
+
+			for (std::thread& thread : threads)
+				thread.join();
+		}
+
+		/**
+		*	\brief Call ParallelFor(_begin, _end, _min_batch, _function) when _multithreaded is set,
+		*	else _function(_begin, _end) once on the calling thread.
+		*
+		* 	\param[in] _begin first element to process.
+		* 	\param[in] _end element past the last one to process.
+		* 	\param[in] _min_batch minimum number of elements processed by one chunk.
+		* 	\param[in] _multithreaded split the range across threads.
+		* 	\param[in] _function function called with each chunk bounds, must be safe to call concurrently.
+		*/
+		template<typename Function>
+		void ParallelFor(size_t _begin, size_t _end, size_t _min_batch, bool _multithreaded, Function&& _function)
+		{
+			if (_multithreaded)
+				ParallelFor(_begin, _end, _min_batch, _function);
+			else if (_begin < _end)
+				_function(_begin, _end);
+		}
+	}
+}
+
+#endif
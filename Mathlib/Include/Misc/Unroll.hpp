@@ -0,0 +1,41 @@
+#pragma once
+
+#ifndef MATHLIB_UNROLL
+#define MATHLIB_UNROLL
+
+#include <cstddef>
+#include <utility>
+
+/**
+*	\file Unroll.hpp
+*
+*	\brief implementation of compile time loop unrolling helpers.
+*/
+
+namespace Mathlib
+{
+	namespace Math
+	{
+		/**
+		*	\brief Call _function with every index of _sequence, one call per index without loop.
+		*/
+		template<typename Function, size_t... Indices>
+		constexpr void UnrollSequence(Function&& _function, std::index_sequence<Indices...>)
+		{
+			(_function(Indices), ...);
+		}
+
+		/**
+		*	\brief Call _function(i) for i in [0, N), fully unrolled at compile time.
+		*
+		* 	\param[in] _function function called with each index.
+		*/
+		template<size_t N, typename Function>
+		constexpr void Unroll(Function&& _function)
+		{
+			UnrollSequence(_function, std::make_index_sequence<N>{});
+		}
+	}
+}
+
+#endif
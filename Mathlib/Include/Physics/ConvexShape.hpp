@@ -0,0 +1,203 @@
+#pragma once
+
+#ifndef MATHLIB_CONVEX_SHAPE
+#define MATHLIB_CONVEX_SHAPE
+
+#include <cstddef>
+
+#include "Misc/DllExport.hpp"
+#include <Space/Vec3.hpp>
+#include <Matrix/Mat3.hpp>
+
+/**
+*	\file ConvexShape.hpp
+*
+*	\brief Convex shape described by its support function implementation.
+*/
+
+namespace Mathlib
+{
+	struct Transform;
+
+	/**
+	*	\brief Function returning the point of a custom convex shape furthest along _direction, in shape local space.
+	*/
+	typedef Vec3 (*ConvexSupportFunction)(const Vec3& _direction, const void* _user_data);
+
+	/**
+	*	\brief Kind of convex shape.
+	*/
+	enum class CONVEX_SHAPE
+	{
+		SPHERE,
+		BOX,
+		CAPSULE,
+		HULL,
+		CUSTOM
+	};
+
+	/**
+	*	\brief Convex shape placed in world space, queried through its support function.
+	*	Spheres and capsules are split into a core (point, segment) and a margin radius,
+	*	letting GJK run on the core and add the radius afterward.
+	*/
+	struct MATHLIBRARY_API ConvexShape
+	{
+		/// Kind of shape.
+		CONVEX_SHAPE type = CONVEX_SHAPE::SPHERE;
+
+		/// World position of the shape origin.
+		Vec3 position;
+
+		/// World rotation and scale of the shape.
+		Mat3 basis = Mat3::Identity;
+
+		/// Box half extents, local space.
+		Vec3 halfExtents;
+
+		/// Capsule segment half length along local Y, local space.
+		float halfHeight = 0.f;
+
+		/// Sphere and capsule radius, local space.
+		float radius = 0.f;
+
+		/// Factor applied to radius by the transform scale.
+		float radiusScale = 1.f;
+
+		/// Hull points, local space, not owned.
+		const Vec3* points = nullptr;
+
+		/// Number of hull points.
+		size_t pointCount = 0;
+
+		/// Custom shape support function.
+		ConvexSupportFunction function = nullptr;
+
+		/// Pointer forwarded to function.
+		const void* userData = nullptr;
+
+		//Constructors
+
+		/**
+		*	\brief Default constructor, point at origin.
+		*/
+		ConvexShape() = default;
+
+		/**
+		*	\brief Default copy constructor
+		*/
+		ConvexShape(const ConvexShape& _shape) = default;
+
+		/**
+		*	\brief Default move constructor
+		*/
+		ConvexShape(ConvexShape&& _shape) = default;
+
+		//Static Methods
+
+		/**
+		*	\brief Create a sphere centered on the transform position.
+		*
+		*	\param[in] _radius radius of the sphere.
+		*	\param[in] _transform world transform of the shape.
+		*
+		*	\return sphere shape.
+		*/
+		static ConvexShape CreateSphere(float _radius, const Transform& _transform);
+
+		/**
+		*	\brief Create a box centered on the transform position.
+		*
+		*	\param[in] _half_extents half size of the box on each local axis.
+		*	\param[in] _transform world transform of the shape.
+		*
+		*	\return box shape.
+		*/
+		static ConvexShape CreateBox(const Vec3& _half_extents, const Transform& _transform);
+
+		/**
+		*	\brief Create a capsule around a segment along local Y.
+		*
+		*	\param[in] _half_height half length of the capsule segment.
+		*	\param[in] _radius radius of the capsule.
+		*	\param[in] _transform world transform of the shape.
+		*
+		*	\return capsule shape.
+		*/
+		static ConvexShape CreateCapsule(float _half_height, float _radius, const Transform& _transform);
+
+		/**
+		*	\brief Create the convex hull of a point set, points must outlive the shape.
+		*
+		*	\param[in] _points local space hull points.
+		*	\param[in] _count number of points.
+		*	\param[in] _transform world transform of the shape.
+		*
+		*	\return hull shape.
+		*/
+		static ConvexShape CreateHull(const Vec3* _points, size_t _count, const Transform& _transform);
+
+		/**
+		*	\brief Create a shape from a custom support function.
+		*
+		*	\param[in] _function local space support function.
+		*	\param[in] _user_data pointer forwarded to _function.
+		*	\param[in] _transform world transform of the shape.
+		*
+		*	\return custom shape.
+		*/
+		static ConvexShape CreateCustom(ConvexSupportFunction _function, const void* _user_data, const Transform& _transform);
+
+		//Accessors
+
+		/**
+		*	\brief Place the shape in world space.
+		*
+		*	\param[in] _transform world transform of the shape, non uniform scale stretches spheres and capsules radius by its largest factor.
+		*/
+		void SetTransform(const Transform& _transform);
+
+		/**
+		*	\brief return the world radius added around the core of spheres and capsules, 0 for other shapes.
+		*/
+		float GetMargin() const noexcept;
+
+		//Methods
+
+		/**
+		*	\brief Compute the world point of the shape furthest along a direction.
+		*
+		*	\param[in] _direction world search direction, not necessarily normalized.
+		*
+		*	\return world support point.
+		*/
+		Vec3 GetSupport(const Vec3& _direction) const noexcept;
+
+		/**
+		*	\brief Compute the world point of the shape core furthest along a direction, margin excluded.
+		*
+		*	\param[in] _direction world search direction, not necessarily normalized.
+		*
+		*	\return world core support point.
+		*/
+		Vec3 GetCoreSupport(const Vec3& _direction) const noexcept;
+
+		//Operator
+
+		/**
+		*	\brief Default move assignement.
+		*
+		*	\return self shape assigned.
+		*/
+		ConvexShape& operator=(ConvexShape&&) = default;
+
+		/**
+		*	\brief Default copy assignement.
+		*
+		*	\return self shape assigned.
+		*/
+		ConvexShape& operator=(const ConvexShape&) = default;
+	};
+}
+
+#endif
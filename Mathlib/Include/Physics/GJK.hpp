@@ -0,0 +1,99 @@
+#pragma once
+
+#ifndef MATHLIB_GJK
+#define MATHLIB_GJK
+
+#include <cstddef>
+
+#include "Misc/DllExport.hpp"
+#include <Space/Vec3.hpp>
+
+/**
+*	\file GJK.hpp
+*
+*	\brief Convex shapes narrow phase with GJK distance and EPA penetration depth.
+*/
+
+namespace Mathlib
+{
+	struct ConvexShape;
+
+	/**
+	*	\brief Result of a narrow phase query between two convex shapes.
+	*/
+	struct GJKResult
+	{
+		/// If the shapes overlap or touch.
+		bool intersecting = false;
+
+		/// Signed distance between the shapes, negative penetration depth when intersecting.
+		float distance = 0.f;
+
+		/// Unit direction from the first shape to the second, moving the second shape along it by -distance separates them.
+		Vec3 normal;
+
+		/// Closest or deepest point on the first shape.
+		Vec3 pointA;
+
+		/// Closest or deepest point on the second shape.
+		Vec3 pointB;
+	};
+
+	/**
+	*	\brief Data kept between frames for a shape pair to warm start GJK.
+	*	The last search direction summarizes the previous simplex: started along it,
+	*	GJK usually converges in one or two iterations for shapes that barely moved.
+	*/
+	struct GJKCache
+	{
+		/// Last separating direction, pointing from the second shape to the first.
+		Vec3 direction;
+
+		/// If direction holds a previous result.
+		bool valid = false;
+	};
+
+	namespace GJK
+	{
+		/**
+		*	\brief Check if two convex shapes overlap, stopping as soon as a separating direction is found.
+		*
+		*	\param[in] _a first shape.
+		*	\param[in] _b second shape.
+		*	\param[in,out] _cache optional warm start data of the pair, can be nullptr.
+		*
+		*	\return if the shapes overlap or touch.
+		*/
+		MATHLIBRARY_API bool Intersects(const ConvexShape& _a, const ConvexShape& _b, GJKCache* _cache = nullptr) noexcept;
+
+		/**
+		*	\brief Compute the distance and closest points of two convex shapes with GJK,
+		*	or their penetration depth and contact points with EPA when they overlap.
+		*
+		*	\param[in] _a first shape.
+		*	\param[in] _b second shape.
+		*	\param[out] _result distance, normal and witness points.
+		*	\param[in,out] _cache optional warm start data of the pair, can be nullptr.
+		*
+		*	\return if the shapes overlap or touch.
+		*/
+		MATHLIBRARY_API bool Collide(const ConvexShape& _a, const ConvexShape& _b, GJKResult& _result, GJKCache* _cache = nullptr) noexcept;
+
+		/**
+		*	\brief Run Collide on many shape pairs.
+		*
+		*	\param[in] _a first shape of each pair.
+		*	\param[in] _b second shape of each pair.
+		*	\param[in] _count number of pairs.
+		*	\param[out] _results result of each pair.
+		*	\param[in,out] _caches optional warm start data of each pair, can be nullptr.
+		*	\param[in] _multithreaded split pairs across threads.
+		*
+		*	\return number of intersecting pairs.
+		*/
+		MATHLIBRARY_API size_t CollideBatch(const ConvexShape* _a, const ConvexShape* _b, size_t _count, GJKResult* _results,
+			GJKCache* _caches = nullptr, bool _multithreaded = false);
+	}
+}
+
+#endif
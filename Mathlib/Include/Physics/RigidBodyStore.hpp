@@ -0,0 +1,302 @@
+#pragma once
+
+#ifndef MATHLIB_RIGID_BODY_STORE
+#define MATHLIB_RIGID_BODY_STORE
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Misc/DllExport.hpp"
+#include <Space/Vec3.hpp>
+#include <Space/Quaternion.hpp>
+
+/**
+*	\file RigidBodyStore.hpp
+*
+*	\brief Rigid bodies state stored as structure of arrays with its integrator.
+*/
+
+namespace Mathlib
+{
+	struct Transform;
+
+	/**
+	*	\brief State of many rigid bodies, each component stored in its own contiguous array
+	*	so integration runs as plain loops over floats the compiler can vectorize.
+	*	Bodies are dense: removing one moves the last body into its index.
+	*/
+	struct MATHLIBRARY_API RigidBodyStore
+	{
+	private:
+		/// World position of each body center of mass.
+		std::vector<float> positionX;
+		std::vector<float> positionY;
+		std::vector<float> positionZ;
+
+		/// World rotation of each body.
+		std::vector<float> rotationW;
+		std::vector<float> rotationX;
+		std::vector<float> rotationY;
+		std::vector<float> rotationZ;
+
+		/// World linear velocity of each body.
+		std::vector<float> linearVelocityX;
+		std::vector<float> linearVelocityY;
+		std::vector<float> linearVelocityZ;
+
+		/// World angular velocity of each body, radians per second.
+		std::vector<float> angularVelocityX;
+		std::vector<float> angularVelocityY;
+		std::vector<float> angularVelocityZ;
+
+		/// Force accumulated since the last integration.
+		std::vector<float> forceX;
+		std::vector<float> forceY;
+		std::vector<float> forceZ;
+
+		/// Torque accumulated since the last integration.
+		std::vector<float> torqueX;
+		std::vector<float> torqueY;
+		std::vector<float> torqueZ;
+
+		/// Inverse mass of each body, 0 for static bodies.
+		std::vector<float> inverseMass;
+
+		/// Inverse inertia tensor of each body in its principal axes, local space diagonal.
+		std::vector<float> inverseInertiaX;
+		std::vector<float> inverseInertiaY;
+		std::vector<float> inverseInertiaZ;
+
+		/**
+		*	\brief Call _function on every component array.
+		*/
+		template<typename Function>
+		void ForEachComponent(Function&& _function);
+
+		/**
+		*	\brief Check if an index refers to a body.
+		*/
+		bool IsValidIndex(uint32_t _index) const noexcept;
+
+		/**
+		*	\brief Integrate bodies [_begin, _end).
+		*/
+		void IntegrateRange(size_t _begin, size_t _end, float _delta_time, const Vec3& _gravity) noexcept;
+
+	public:
+		//Constructors
+
+		/**
+		*	\brief Default constructor, no body.
+		*/
+		RigidBodyStore() = default;
+
+		/**
+		*	\brief Default copy constructor
+		*/
+		RigidBodyStore(const RigidBodyStore& _store) = default;
+
+		/**
+		*	\brief Default move constructor
+		*/
+		RigidBodyStore(RigidBodyStore&& _store) = default;
+
+		//Bodies
+
+		/**
+		*	\brief Add a body at rest.
+		*
+		*	\param[in] _position world position of the center of mass.
+		*	\param[in] _rotation normalized world rotation.
+		*	\param[in] _mass mass of the body, 0 for a static body.
+		*	\param[in] _inertia diagonal of the inertia tensor in the body principal axes.
+		*
+		*	\return index of the body.
+		*/
+		uint32_t Add(const Vec3& _position, const Quat& _rotation, float _mass, const Vec3& _inertia);
+
+		/**
+		*	\brief Remove a body, the last body takes its index.
+		*
+		*	\param[in] _index index of the body.
+		*/
+		void Remove(uint32_t _index) noexcept;
+
+		/**
+		*	\brief Reserve memory for _count bodies.
+		*
+		*	\param[in] _count number of bodies.
+		*/
+		void Reserve(size_t _count);
+
+		/**
+		*	\brief Remove every body.
+		*/
+		void Clear() noexcept;
+
+		//Accessors
+
+		/**
+		*	\brief return the number of bodies.
+		*/
+		size_t GetBodyCount() const noexcept;
+
+		/**
+		*	\brief return the world position of a body.
+		*
+		*	\param[in] _index index of the body.
+		*/
+		Vec3 GetPosition(uint32_t _index) const noexcept;
+
+		/**
+		*	\brief Set the world position of a body.
+		*
+		*	\param[in] _index index of the body.
+		*	\param[in] _position new position.
+		*/
+		void SetPosition(uint32_t _index, const Vec3& _position) noexcept;
+
+		/**
+		*	\brief return the world rotation of a body.
+		*
+		*	\param[in] _index index of the body.
+		*/
+		Quat GetRotation(uint32_t _index) const noexcept;
+
+		/**
+		*	\brief Set the world rotation of a body.
+		*
+		*	\param[in] _index index of the body.
+		*	\param[in] _rotation new normalized rotation.
+		*/
+		void SetRotation(uint32_t _index, const Quat& _rotation) noexcept;
+
+		/**
+		*	\brief return the world linear velocity of a body.
+		*
+		*	\param[in] _index index of the body.
+		*/
+		Vec3 GetLinearVelocity(uint32_t _index) const noexcept;
+
+		/**
+		*	\brief Set the world linear velocity of a body.
+		*
+		*	\param[in] _index index of the body.
+		*	\param[in] _velocity new velocity.
+		*/
+		void SetLinearVelocity(uint32_t _index, const Vec3& _velocity) noexcept;
+
+		/**
+		*	\brief return the world angular velocity of a body, radians per second.
+		*
+		*	\param[in] _index index of the body.
+		*/
+		Vec3 GetAngularVelocity(uint32_t _index) const noexcept;
+
+		/**
+		*	\brief Set the world angular velocity of a body.
+		*
+		*	\param[in] _index index of the body.
+		*	\param[in] _velocity new velocity, radians per second.
+		*/
+		void SetAngularVelocity(uint32_t _index, const Vec3& _velocity) noexcept;
+
+		/**
+		*	\brief return the inverse mass of a body, 0 for static bodies.
+		*
+		*	\param[in] _index index of the body.
+		*/
+		float GetInverseMass(uint32_t _index) const noexcept;
+
+		/**
+		*	\brief Change the mass properties of a body.
+		*
+		*	\param[in] _index index of the body.
+		*	\param[in] _mass mass of the body, 0 for a static body.
+		*	\param[in] _inertia diagonal of the inertia tensor in the body principal axes.
+		*/
+		void SetMass(uint32_t _index, float _mass, const Vec3& _inertia) noexcept;
+
+		/**
+		*	\brief return the world transform of a body, unit scale.
+		*
+		*	\param[in] _index index of the body.
+		*/
+		Transform GetTransform(uint32_t _index) const noexcept;
+
+		/**
+		*	\brief Copy the world transform of every body.
+		*
+		*	\param[out] _transforms array of GetBodyCount() transforms.
+		*/
+		void GetTransforms(Transform* _transforms) const noexcept;
+
+		//Forces
+
+		/**
+		*	\brief Apply a force at the center of mass until the next integration.
+		*
+		*	\param[in] _index index of the body.
+		*	\param[in] _force world force.
+		*/
+		void ApplyForce(uint32_t _index, const Vec3& _force) noexcept;
+
+		/**
+		*	\brief Apply a force at a world point until the next integration, adding the resulting torque.
+		*
+		*	\param[in] _index index of the body.
+		*	\param[in] _force world force.
+		*	\param[in] _point world application point.
+		*/
+		void ApplyForce(uint32_t _index, const Vec3& _force, const Vec3& _point) noexcept;
+
+		/**
+		*	\brief Apply a torque until the next integration.
+		*
+		*	\param[in] _index index of the body.
+		*	\param[in] _torque world torque.
+		*/
+		void ApplyTorque(uint32_t _index, const Vec3& _torque) noexcept;
+
+		/**
+		*	\brief Apply an instant change of momentum at a world point.
+		*
+		*	\param[in] _index index of the body.
+		*	\param[in] _impulse world impulse.
+		*	\param[in] _point world application point.
+		*/
+		void ApplyImpulse(uint32_t _index, const Vec3& _impulse, const Vec3& _point) noexcept;
+
+		//Methods
+
+		/**
+		*	\brief Step every body with semi implicit Euler: velocities first from forces and gravity,
+		*	then positions and rotations from the new velocities. Rotations are renormalized and
+		*	accumulated forces cleared.
+		*
+		*	\param[in] _delta_time step duration in seconds.
+		*	\param[in] _gravity acceleration applied to dynamic bodies.
+		*	\param[in] _multithreaded split bodies across threads.
+		*/
+		void Integrate(float _delta_time, const Vec3& _gravity, bool _multithreaded = false);
+
+		//Operator
+
+		/**
+		*	\brief Default move assignement.
+		*
+		*	\return self store assigned.
+		*/
+		RigidBodyStore& operator=(RigidBodyStore&&) = default;
+
+		/**
+		*	\brief Default copy assignement.
+		*
+		*	\return self store assigned.
+		*/
+		RigidBodyStore& operator=(const RigidBodyStore&) = default;
+	};
+}
+
+#endif
@@ -0,0 +1,245 @@
+#pragma once
+
+#ifndef MATHLIB_FIXEDQUAT
+#define MATHLIB_FIXEDQUAT
+
+#include <string>
+
+#include <Misc/Fixed.hpp>
+#include <Space/Vec.hpp>
+#include <Space/Quaternion.hpp>
+
+/**
+*	\file FixedQuat.hpp
+*
+*	\brief Fixed point quaternion type implementation.
+*/
+
+namespace Mathlib
+{
+	/**
+	*	\brief quaternion struct with fixed point components, for deterministic simulation.
+	*/
+	template<typename T>
+	struct FixedQuat
+	{
+		static_assert(IsFixedPoint<T>::value, "FixedQuat components must be fixed point");
+
+		/// Quaternion's rotation component
+		T W = T(1);
+		/// Quaternion's X axis component
+		T X;
+		/// Quaternion's Y axis component
+		T Y;
+		/// Quaternion's Z axis component
+		T Z;
+
+		//Constructors
+
+		/**
+		*	\brief Default constructor, identity rotation.
+		*/
+		FixedQuat() = default;
+
+		/**
+		*	\brief Value constructor
+		*
+		*	\param[in] _w W value.
+		*	\param[in] _x X value.
+		* 	\param[in] _y Y value.
+		*	\param[in] _z Z value.
+		*/
+		FixedQuat(T _w, T _x, T _y, T _z) noexcept :
+			W{ _w }, X{ _x }, Y{ _y }, Z{ _z }
+		{
+		}
+
+		/**
+		*	\brief Value constructor
+		*
+		* 	\param[in] _angle rotation in radians.
+		*	\param[in] _axis normalized rotation axis.
+		*/
+		FixedQuat(T _angle, const Vec<T, 3>& _axis) noexcept
+		{
+			const T half_angle = _angle / T(2);
+			const T sin = T::Sin(half_angle);
+
+			W = T::Cos(half_angle);
+			X = _axis.X * sin;
+			Y = _axis.Y * sin;
+			Z = _axis.Z * sin;
+		}
+
+		/**
+		*	\brief Constructor from a float quaternion, each component rounded to the nearest fixed point value.
+		*
+		*	\param[in] _quat quaternion to copy values from.
+		*/
+		explicit FixedQuat(const Quat& _quat) noexcept :
+			W{ _quat.W }, X{ _quat.X }, Y{ _quat.Y }, Z{ _quat.Z }
+		{
+		}
+
+		/**
+		*	\brief Default copy constructor
+		*/
+		FixedQuat(const FixedQuat& _quat) = default;
+
+		/**
+		*	\brief Default move constructor
+		*/
+		FixedQuat(FixedQuat&& _quat) = default;
+
+		//Length & Normalization
+
+		/**
+		*	\brief Return the squared length of this quaternion.
+		*/
+		T SquaredLength() const noexcept
+		{
+			return W * W + X * X + Y * Y + Z * Z;
+		}
+
+		/**
+		*	\brief Return the length of this quaternion.
+		*/
+		T Length() const noexcept
+		{
+			return T::Sqrt(SquaredLength());
+		}
+
+		/**
+		*	\brief Normalize this quaternion and return it. Call the error callback if its length is 0.
+		*/
+		FixedQuat& Normalize() noexcept
+		{
+			const T length = Length();
+
+			if (length == T(0))
+			{
+				Callback::CallErrorCallback("FixedQuat", "Normalize", "Division by O due to quaternion length being equal to 0");
+				return *this;
+			}
+
+			W /= length;
+			X /= length;
+			Y /= length;
+			Z /= length;
+
+			return *this;
+		}
+
+		/**
+		*	\brief Return this quaternion normalized.
+		*/
+		FixedQuat GetNormalized() const noexcept
+		{
+			FixedQuat result = *this;
+			return result.Normalize();
+		}
+
+		/**
+		*	\brief Return the inverse rotation of this normalized quaternion.
+		*/
+		FixedQuat GetConjugate() const noexcept
+		{
+			return FixedQuat(W, -X, -Y, -Z);
+		}
+
+		//Equality
+
+		/**
+		*	\brief Compare this quaternion with with _other
+		*
+		*	\param[in] _other other quaternion to do the comparison with.
+		* 	\param[in] _epsilon threshold to accept equality.
+		*
+		*	\return if this and _other are equal.
+		*/
+		bool Equals(const FixedQuat& _other, T _epsilon = T()) const noexcept
+		{
+			return T::Abs(W - _other.W) <= _epsilon && T::Abs(X - _other.X) <= _epsilon &&
+				T::Abs(Y - _other.Y) <= _epsilon && T::Abs(Z - _other.Z) <= _epsilon;
+		}
+
+		bool operator==(const FixedQuat& _rhs) const noexcept
+		{
+			return W == _rhs.W && X == _rhs.X && Y == _rhs.Y && Z == _rhs.Z;
+		}
+
+		bool operator!=(const FixedQuat& _rhs) const noexcept
+		{
+			return !(*this == _rhs);
+		}
+
+		//Accessors
+
+		/**
+		*	\brief Return this quaternion as a float quaternion.
+		*/
+		Quat ToQuat() const noexcept
+		{
+			return Quat(W.ToFloat(), X.ToFloat(), Y.ToFloat(), Z.ToFloat());
+		}
+
+		//Rotate
+
+		/**
+		*	\brief Rotate _vec by this normalized quaternion.
+		*/
+		Vec<T, 3> Rotate(const Vec<T, 3>& _vec) const noexcept
+		{
+			const Vec<T, 3> axis(X, Y, Z);
+			const Vec<T, 3> uv = Vec<T, 3>::CrossProduct(axis, _vec);
+			const Vec<T, 3> uuv = Vec<T, 3>::CrossProduct(axis, uv);
+
+			return _vec + (uv * W + uuv) * T(2);
+		}
+
+		//Operator
+
+		/**
+		*	\brief Default move assignement.
+		*
+		*	\return self quaternion assigned.
+		*/
+		FixedQuat& operator=(FixedQuat&&) = default;
+
+		/**
+		*	\brief Default copy assignement.
+		*
+		*	\return self quaternion assigned.
+		*/
+		FixedQuat& operator=(const FixedQuat&) = default;
+
+		/**
+		*	\brief Compose rotations: _rhs is applied first, then this.
+		*/
+		FixedQuat operator*(const FixedQuat& _rhs) const noexcept
+		{
+			return FixedQuat(W * _rhs.W - X * _rhs.X - Y * _rhs.Y - Z * _rhs.Z,
+				W * _rhs.X + X * _rhs.W + Y * _rhs.Z - Z * _rhs.Y,
+				W * _rhs.Y - X * _rhs.Z + Y * _rhs.W + Z * _rhs.X,
+				W * _rhs.Z + X * _rhs.Y - Y * _rhs.X + Z * _rhs.W);
+		}
+
+		//Debug
+
+		/**
+		*	\brief Return the quaternion as a string.
+		*/
+		std::string ToString() const noexcept
+		{
+			return W.ToString() + ", " + X.ToString() + ", " + Y.ToString() + ", " + Z.ToString();
+		}
+	};
+
+	/// Q16.16 quaternion.
+	using QuatQ16 = FixedQuat<Q16_16>;
+
+	/// Q32.32 quaternion.
+	using QuatQ32 = FixedQuat<Q32_32>;
+}
+
+#endif
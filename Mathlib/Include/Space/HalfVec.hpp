@@ -0,0 +1,170 @@
+#pragma once
+
+#ifndef MATHLIB_HALFVEC
+#define MATHLIB_HALFVEC
+
+#include <cstddef>
+#include <string>
+
+#include "Misc/DllExport.hpp"
+#include <Misc/Half.hpp>
+#include <Space/Vec.hpp>
+#include <Space/Vec2.hpp>
+#include <Space/Vec3.hpp>
+#include <Space/Vec4.hpp>
+#include <Space/Quaternion.hpp>
+
+/**
+*	\file HalfVec.hpp
+*
+*	\brief Half precision storage types for vectors and quaternions, half the size of the float types.
+*
+*	The half vectors are Vec<Half, N>: they convert from and to the float vectors and compare bits, arithmetic is done in float.
+*	Quath keeps the W, X, Y, Z layout of Quat.
+*/
+
+namespace Mathlib
+{
+	/**
+	*	\brief Half only stores values, Vec<Half, N> gets the constructors, comparisons and conversions but no arithmetic.
+	*/
+	template<>
+	struct IsStorageOnly<Half> : std::true_type
+	{
+	};
+
+	/// Half precision vector 2 for storage (normals in octahedral encoding, UVs), convert to Vec2 to do arithmetic.
+	using Vec2h = Vec<Half, 2>;
+
+	/// Half precision vector 3 for storage (normals, colors), convert to Vec3 to do arithmetic.
+	using Vec3h = Vec<Half, 3>;
+
+	/// Half precision vector 4 for storage (colors, tangents), convert to Vec4 to do arithmetic.
+	using Vec4h = Vec<Half, 4>;
+
+	/**
+	*	\brief Half precision quaternion for storage (animation rotations), convert with ToQuat to do arithmetic.
+	*	Components are laid out like Quat so spans convert in bulk.
+	*/
+	struct MATHLIBRARY_API Quath
+	{
+		/// Quaternion's W component
+		Half W;
+		/// Quaternion's X component
+		Half X;
+		/// Quaternion's Y component
+		Half Y;
+		/// Quaternion's Z component
+		Half Z;
+
+		//Constructors
+
+		/**
+		*	\brief Default constructor, all components are 0.
+		*/
+		Quath() = default;
+
+		/**
+		*	\brief Value constructor
+		*
+		*	\param[in] _w W value.
+		*	\param[in] _x X value.
+		*	\param[in] _y Y value.
+		*	\param[in] _z Z value.
+		*/
+		Quath(Half _w, Half _x, Half _y, Half _z) noexcept;
+
+		//Equality
+
+		/**
+		*	\brief Operator to compare the bits of this quaternion with _rhs.
+		*/
+		bool operator==(const Quath& _rhs) const noexcept;
+
+		/**
+		*	\brief Operator to compare the bits of this quaternion with _rhs.
+		*/
+		bool operator!=(const Quath& _rhs) const noexcept;
+
+		//Debug
+
+		/**
+		*	\brief Return the quaternion as a string.
+		*/
+		std::string ToString() const noexcept;
+	};
+
+	/**
+	*	\brief Convert _count half precision vectors to float vectors.
+	*
+	*	\param[in] _values values to convert.
+	*	\param[in] _count number of values.
+	*	\param[out] _results converted values, conversion is exact.
+	*	\param[in] _multithreaded split values across threads.
+	*/
+	template<size_t N>
+	void ToFloat(const Vec<Half, N>* _values, size_t _count, Vec<float, N>* _results, bool _multithreaded = false)
+	{
+		static_assert(sizeof(Vec<Half, N>) == N * sizeof(Half) && sizeof(Vec<float, N>) == N * sizeof(float),
+			"Vectors must be tightly packed for bulk conversions");
+
+		Half::ToFloat(_values->Data(), _count * N, _results->Data(), _multithreaded);
+	}
+
+	/**
+	*	\brief Convert _count float vectors to half precision, each component rounded to nearest even.
+	*
+	*	\param[in] _values values to convert.
+	*	\param[in] _count number of values.
+	*	\param[out] _results converted values.
+	*	\param[in] _multithreaded split values across threads.
+	*/
+	template<size_t N>
+	void ToHalf(const Vec<float, N>* _values, size_t _count, Vec<Half, N>* _results, bool _multithreaded = false)
+	{
+		static_assert(sizeof(Vec<Half, N>) == N * sizeof(Half) && sizeof(Vec<float, N>) == N * sizeof(float),
+			"Vectors must be tightly packed for bulk conversions");
+
+		Half::FromFloat(_values->Data(), _count * N, _results->Data(), _multithreaded);
+	}
+
+	/**
+	*	\brief Convert _quat to half precision, each component rounded to nearest even.
+	*
+	*	\param[in] _quat quaternion to convert.
+	*
+	*	\return half precision quaternion.
+	*/
+	MATHLIBRARY_API Quath ToHalf(const Quat& _quat) noexcept;
+
+	/**
+	*	\brief Convert _quat to a Quat, conversion is exact.
+	*
+	*	\param[in] _quat half precision quaternion to convert.
+	*
+	*	\return float quaternion.
+	*/
+	MATHLIBRARY_API Quat ToQuat(const Quath& _quat) noexcept;
+
+	/**
+	*	\brief Convert _count quaternions to half precision, each component rounded to nearest even.
+	*
+	*	\param[in] _values values to convert.
+	*	\param[in] _count number of values.
+	*	\param[out] _results converted values.
+	*	\param[in] _multithreaded split values across threads.
+	*/
+	MATHLIBRARY_API void ToHalf(const Quat* _values, size_t _count, Quath* _results, bool _multithreaded = false);
+
+	/**
+	*	\brief Convert _count half precision quaternions to Quat.
+	*
+	*	\param[in] _values values to convert.
+	*	\param[in] _count number of values.
+	*	\param[out] _results converted values, conversion is exact.
+	*	\param[in] _multithreaded split values across threads.
+	*/
+	MATHLIBRARY_API void ToQuat(const Quath* _values, size_t _count, Quat* _results, bool _multithreaded = false);
+}
+
+#endif
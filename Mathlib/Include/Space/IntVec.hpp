@@ -0,0 +1,109 @@
+#pragma once
+
+#ifndef MATHLIB_INTVEC
+#define MATHLIB_INTVEC
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Misc/DllExport.hpp"
+#include <Space/Vec2.hpp>
+#include <Space/Vec3.hpp>
+#include <Space/Vec4.hpp>
+#include <Space/Vec.hpp>
+
+/**
+*	\file IntVec.hpp
+*
+*	\brief Batched conversions between float and integer vectors, for grid, voxel and tile indexing.
+*/
+
+namespace Mathlib
+{
+	namespace Math
+	{
+		/**
+		*	\brief Compute floor(_values[i] * _scale) for _count floats. Scaled values must fit in an int32_t.
+		*
+		*	\param[in] _values floats to convert.
+		*	\param[in] _count number of values.
+		*	\param[in] _scale factor applied before flooring, the inverse cell size.
+		*	\param[out] _results floored integers.
+		*	\param[in] _multithreaded split values across threads.
+		*/
+		MATHLIBRARY_API void FloorToInt(const float* _values, size_t _count, float _scale, int32_t* _results, bool _multithreaded = false);
+
+		/**
+		*	\brief Compute _values[i] * _scale as floats for _count integers.
+		*
+		*	\param[in] _values integers to convert.
+		*	\param[in] _count number of values.
+		*	\param[in] _scale factor applied after conversion, the cell size.
+		*	\param[out] _results converted floats.
+		*	\param[in] _multithreaded split values across threads.
+		*/
+		MATHLIBRARY_API void ToFloat(const int32_t* _values, size_t _count, float _scale, float* _results, bool _multithreaded = false);
+
+		/**
+		*	\brief Return the cell of _value: floor of each component of _value * _scale.
+		*/
+		MATHLIBRARY_API Vec2i FloorToInt(const Vec2& _value, float _scale = 1.f) noexcept;
+
+		/**
+		*	\brief Compute the cells of _count vectors: floor of each component of _values[i] * _scale.
+		*/
+		MATHLIBRARY_API void FloorToInt(const Vec2* _values, size_t _count, float _scale, Vec2i* _results, bool _multithreaded = false);
+
+		/**
+		*	\brief Return the position of cell _value: each component of _value * _scale.
+		*/
+		MATHLIBRARY_API Vec2 ToFloat(const Vec2i& _value, float _scale = 1.f) noexcept;
+
+		/**
+		*	\brief Compute the positions of _count cells: each component of _values[i] * _scale.
+		*/
+		MATHLIBRARY_API void ToFloat(const Vec2i* _values, size_t _count, float _scale, Vec2* _results, bool _multithreaded = false);
+
+		/**
+		*	\brief Return the cell of _value: floor of each component of _value * _scale.
+		*/
+		MATHLIBRARY_API Vec3i FloorToInt(const Vec3& _value, float _scale = 1.f) noexcept;
+
+		/**
+		*	\brief Compute the cells of _count vectors: floor of each component of _values[i] * _scale.
+		*/
+		MATHLIBRARY_API void FloorToInt(const Vec3* _values, size_t _count, float _scale, Vec3i* _results, bool _multithreaded = false);
+
+		/**
+		*	\brief Return the position of cell _value: each component of _value * _scale.
+		*/
+		MATHLIBRARY_API Vec3 ToFloat(const Vec3i& _value, float _scale = 1.f) noexcept;
+
+		/**
+		*	\brief Compute the positions of _count cells: each component of _values[i] * _scale.
+		*/
+		MATHLIBRARY_API void ToFloat(const Vec3i* _values, size_t _count, float _scale, Vec3* _results, bool _multithreaded = false);
+
+		/**
+		*	\brief Return the cell of _value: floor of each component of _value * _scale.
+		*/
+		MATHLIBRARY_API Vec4i FloorToInt(const Vec4& _value, float _scale = 1.f) noexcept;
+
+		/**
+		*	\brief Compute the cells of _count vectors: floor of each component of _values[i] * _scale.
+		*/
+		MATHLIBRARY_API void FloorToInt(const Vec4* _values, size_t _count, float _scale, Vec4i* _results, bool _multithreaded = false);
+
+		/**
+		*	\brief Return the position of cell _value: each component of _value * _scale.
+		*/
+		MATHLIBRARY_API Vec4 ToFloat(const Vec4i& _value, float _scale = 1.f) noexcept;
+
+		/**
+		*	\brief Compute the positions of _count cells: each component of _values[i] * _scale.
+		*/
+		MATHLIBRARY_API void ToFloat(const Vec4i* _values, size_t _count, float _scale, Vec4* _results, bool _multithreaded = false);
+	}
+}
+
+#endif
@@ -5,6 +5,7 @@
 
 #include "Misc/DllExport.hpp"
 #include "Misc/Constants.hpp"
+#include <cstddef>
 #include <string>
 
 /**
@@ -16,6 +17,7 @@
 namespace Mathlib
 {
 	struct Vec3;
+	struct Mat3;
 	struct Mat4;
 
 	/**
@@ -97,6 +99,27 @@ namespace Mathlib
 		*/
 		Quat GetNormalized() const noexcept;
 
+		/**
+		*	\brief Normalize this quaternion with Math::FastInverseSqrt and return it.
+		*	Length of the result is within 1e-6 of 1. A null quaternion stays null, without error callback, tiny ones are rescaled first.
+		*/
+		Quat& NormalizeFast() noexcept;
+
+		/**
+		*	\brief Return this quaternion normalized with NormalizeFast.
+		*/
+		Quat GetNormalizedFast() const noexcept;
+
+		/**
+		*	\brief Normalize many quaternions with NormalizeFast, inverse square roots computed several at once.
+		*
+		* 	\param[in] _quaternions quaternions to normalize.
+		* 	\param[in] _count number of quaternions.
+		* 	\param[out] _result normalized quaternions, may be _quaternions.
+		* 	\param[in] _multithreaded split quaternions across threads.
+		*/
+		static void NormalizeFast(const Quat* _quaternions, size_t _count, Quat* _result, bool _multithreaded = false);
+
 		/**
 		*	\brief Check if the quaternion is normalized.
 		*/
@@ -118,6 +141,17 @@ namespace Mathlib
 		*/
 		Vec3 Euler() const noexcept;
 
+		//Matrix
+
+		/**
+		*	\brief Create quaternion from a rotation matrix.
+		*
+		*	\param[in] _rotation orthonormal matrix with a determinant of 1.
+		*
+		*	\return new normalized quaternion rotating like _rotation.
+		*/
+		static Quat FromMatrix(const Mat3& _rotation) noexcept;
+
 		//Invert
 
 		/**
@@ -0,0 +1,700 @@
+#pragma once
+
+#ifndef MATHLIB_VEC
+#define MATHLIB_VEC
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <type_traits>
+
+#include "Misc/Constants.hpp"
+#include <Misc/Callback.hpp>
+#include <Misc/Unroll.hpp>
+
+/**
+*	\file Vec.hpp
+*
+*	\brief Generic vector type implementation, parameterized on scalar type and dimension.
+*
+*	Vec2, Vec3 and Vec4 derive from the float instances and forward their arithmetic to them,
+*	the half precision vectors of HalfVec.hpp are Half instances.
+*/
+
+namespace Mathlib
+{
+	/**
+	*	\brief Whether T is a fixed point scalar, specialized by fixed point types to be used as Vec and Mat components.
+	*/
+	template<typename T>
+	struct IsFixedPoint : std::false_type
+	{
+	};
+
+	/**
+	*	\brief Whether T is a storage only scalar such as Half, specialized by types that Vec may hold and convert but not compute with.
+	*/
+	template<typename T>
+	struct IsStorageOnly : std::false_type
+	{
+	};
+
+	/**
+	*	\brief Components of a generic vector, named X, Y, Z and W up to 4 dimensions.
+	*/
+	template<typename T, size_t N>
+	struct VecStorage
+	{
+		/// Vector's components
+		T values[N] = {};
+
+		T* Data() noexcept { return values; }
+		const T* Data() const noexcept { return values; }
+	};
+
+	template<typename T>
+	struct VecStorage<T, 2>
+	{
+		/// Vector's X component
+		T X = T(0);
+		/// Vector's Y component
+		T Y = T(0);
+
+		T* Data() noexcept { return &X; }
+		const T* Data() const noexcept { return &X; }
+	};
+
+	template<typename T>
+	struct VecStorage<T, 3>
+	{
+		/// Vector's X component
+		T X = T(0);
+		/// Vector's Y component
+		T Y = T(0);
+		/// Vector's Z component
+		T Z = T(0);
+
+		T* Data() noexcept { return &X; }
+		const T* Data() const noexcept { return &X; }
+	};
+
+	template<typename T>
+	struct VecStorage<T, 4>
+	{
+		/// Vector's X component
+		T X = T(0);
+		/// Vector's Y component
+		T Y = T(0);
+		/// Vector's Z component
+		T Z = T(0);
+		/// Vector's W component
+		T W = T(0);
+
+		T* Data() noexcept { return &X; }
+		const T* Data() const noexcept { return &X; }
+	};
+
+	/**
+	*	\brief Name of a vector type given to the error callback, specialized by the named float vectors.
+	*/
+	template<typename T, size_t N>
+	struct VecName
+	{
+		static constexpr const char* Value = "Vec";
+	};
+
+	/**
+	*	\brief Generic vector struct of N components of type T.
+	*	Every operation is inline and unrolled over the components.
+	*/
+	template<typename T, size_t N>
+	struct Vec : public VecStorage<T, N>
+	{
+		static_assert(N > 0, "Vec needs at least one component");
+		static_assert(std::is_arithmetic<T>::value || IsFixedPoint<T>::value || IsStorageOnly<T>::value,
+			"Vec components must be arithmetic, fixed point or storage only");
+
+		/// Type of the components.
+		using ValueType = T;
+
+		/// Number of components.
+		static constexpr size_t Size = N;
+
+		using VecStorage<T, N>::Data;
+
+		//Constructors
+
+		/**
+		*	\brief Default constructor, all components are 0.
+		*/
+		Vec() = default;
+
+		/**
+		*	\brief Value constructor
+		*
+		*	\param[in] _value Value applied on all vector axis.
+		*/
+		explicit Vec(T _value) noexcept
+		{
+			Math::Unroll<N>([&](size_t i) { Data()[i] = _value; });
+		}
+
+		/**
+		*	\brief Value constructor, one value per component.
+		*
+		*	\param[in] _values components values, converted to T.
+		*/
+		template<typename... Args, typename = std::enable_if_t<(N > 1) && sizeof...(Args) == N>>
+		Vec(Args... _values) noexcept
+		{
+			const T components[N] = { static_cast<T>(_values)... };
+			Math::Unroll<N>([&](size_t i) { Data()[i] = components[i]; });
+		}
+
+		/**
+		*	\brief Conversion constructor from a vector of an other component type.
+		*
+		*	\param[in] _other vector to convert, each component is cast to T.
+		*/
+		template<typename U>
+		explicit Vec(const Vec<U, N>& _other) noexcept
+		{
+			Math::Unroll<N>([&](size_t i) { Data()[i] = static_cast<T>(_other[i]); });
+		}
+
+		/**
+		*	\brief Default copy constructor
+		*/
+		Vec(const Vec& _vec) = default;
+
+		/**
+		*	\brief Default move constructor
+		*/
+		Vec(Vec&& _vec) = default;
+
+		//Static Methods
+
+		/**
+		*	\brief Compute dot product between two vectors
+		*
+		* 	\param[in] _lhs left hand side operand to compute dot product with.
+		* 	\param[in] _rhs right hand side operand to compute dot product with.
+		*
+		*	\return dot product between _lhs and _rhs
+		*/
+		static T DotProduct(const Vec& _lhs, const Vec& _rhs) noexcept
+		{
+			T result = T(0);
+			Math::Unroll<N>([&](size_t i) { result += _lhs[i] * _rhs[i]; });
+
+			return result;
+		}
+
+		/**
+		*	\brief Compute cross product between two 3 components vectors
+		*
+		* 	\param[in] _lhs left hand side operand to compute cross product with.
+		* 	\param[in] _rhs right hand side operand to compute cross product with.
+		*
+		* 	\return cross product between _lhs and _rhs
+		*/
+		template<size_t M = N, typename = std::enable_if_t<M == 3>>
+		static Vec CrossProduct(const Vec& _lhs, const Vec& _rhs) noexcept
+		{
+			return Vec(_lhs.Y * _rhs.Z - _lhs.Z * _rhs.Y,
+				_lhs.Z * _rhs.X - _lhs.X * _rhs.Z,
+				_lhs.X * _rhs.Y - _lhs.Y * _rhs.X);
+		}
+
+		/**
+		*	\brief Compute squared distance between two vectors
+		*
+		* 	\param[in] _start left hand side operand to compute squared distance with.
+		* 	\param[in] _end right hand side operand to compute squared distance with.
+		*
+		* 	\return squared distance between _start and _end
+		*/
+		static T SqrDistance(const Vec& _start, const Vec& _end) noexcept
+		{
+			return (_end - _start).SquaredLength();
+		}
+
+		/**
+		*	\brief Compute distance between two vectors
+		*
+		* 	\param[in] _start left hand side operand to compute distance with.
+		* 	\param[in] _end right hand side operand to compute distance with.
+		*
+		* 	\return distance between _start and _end
+		*/
+		static T Distance(const Vec& _start, const Vec& _end) noexcept
+		{
+			return (_end - _start).Length();
+		}
+
+		/**
+		*	\brief Compute lerped vector between two vectors
+		*
+		* 	\param[in] _start left hand side operand to compute lerped vector with.
+		* 	\param[in] _end right hand side operand to compute lerped vector with.
+		*	\param[in] _alpha Alpha of the lerp.
+		*
+		* 	\return lerped vector between _start and _end
+		*/
+		static Vec Lerp(const Vec& _start, const Vec& _end, T _alpha) noexcept
+		{
+			Vec result;
+			Math::Unroll<N>([&](size_t i) { result[i] = _start[i] + (_end[i] - _start[i]) * _alpha; });
+
+			return result;
+		}
+
+		/**
+		*	\brief Compute the component wise minimum of two vectors
+		*/
+		static Vec Min(const Vec& _lhs, const Vec& _rhs) noexcept
+		{
+			Vec result;
+			Math::Unroll<N>([&](size_t i) { result[i] = _rhs[i] < _lhs[i] ? _rhs[i] : _lhs[i]; });
+
+			return result;
+		}
+
+		/**
+		*	\brief Compute the component wise maximum of two vectors
+		*/
+		static Vec Max(const Vec& _lhs, const Vec& _rhs) noexcept
+		{
+			Vec result;
+			Math::Unroll<N>([&](size_t i) { result[i] = _lhs[i] < _rhs[i] ? _rhs[i] : _lhs[i]; });
+
+			return result;
+		}
+
+		//Equality
+
+		/**
+		*	\brief Check if all components are 0
+		*/
+		bool IsZero() const noexcept
+		{
+			return *this == Vec();
+		}
+
+		/**
+		*	\brief Compare this vector with with _other
+		*
+		*	\param[in] _other other vector to do the comparison with.
+		* 	\param[in] _epsilon threshold to accept equality, exact comparison for integral types.
+		*
+		*	\return if this and _other are equal.
+		*/
+		bool Equals(const Vec& _other, T _epsilon = static_cast<T>(Math::FloatEpsilon)) const noexcept
+		{
+			bool equals = true;
+			Math::Unroll<N>([&](size_t i)
+			{
+				T difference = Data()[i] < _other[i] ? _other[i] - Data()[i] : Data()[i] - _other[i];
+				equals &= difference <= _epsilon;
+			});
+
+			return equals;
+		}
+
+		/**
+		*	\brief Operator to compare this vector with with _rhs, component wise exact comparison.
+		*
+		*	\param[in] _rhs right hand side operand to do the comparison with.
+		*
+		*	\return if this and _rhs are equal.
+		*/
+		bool operator==(const Vec& _rhs) const noexcept
+		{
+			bool equals = true;
+			Math::Unroll<N>([&](size_t i) { equals &= Data()[i] == _rhs[i]; });
+
+			return equals;
+		}
+
+		/**
+		*	\brief Operator to compare this vector with with _rhs.
+		*
+		*	\param[in] _rhs right hand side operand to do the comparison with.
+		*
+		*	\return if this and _rhs are different.
+		*/
+		bool operator!=(const Vec& _rhs) const noexcept
+		{
+			return !(*this == _rhs);
+		}
+
+		//Accessors
+
+		/**
+		*	\brief Access component _index, no bound check.
+		*/
+		T& operator[](size_t _index) noexcept
+		{
+			return Data()[_index];
+		}
+
+		/**
+		*	\brief Access component _index, no bound check.
+		*/
+		const T& operator[](size_t _index) const noexcept
+		{
+			return Data()[_index];
+		}
+
+		/**
+		*	\brief Return a hash of the components, integral vectors only. Neighbour cells get well spread hashes.
+		*/
+		size_t GetHash() const noexcept
+		{
+			static_assert(std::is_integral<T>::value, "Only integral vectors can be hashed");
+
+			// Golden ratio multiply per component followed by the murmur 64 bits finalizer.
+			uint64_t hash = 0;
+			Math::Unroll<N>([&](size_t i)
+			{
+				hash = (hash + static_cast<uint64_t>(Data()[i])) * 0x9E3779B97F4A7C15ull;
+				hash ^= hash >> 32;
+			});
+
+			hash ^= hash >> 33;
+			hash *= 0xFF51AFD7ED558CCDull;
+			hash ^= hash >> 33;
+			hash *= 0xC4CEB9FE1A85EC53ull;
+			hash ^= hash >> 33;
+
+			return static_cast<size_t>(hash);
+		}
+
+		//Methods
+
+		/**
+		*	\brief Return the squared length of this vector.
+		*/
+		T SquaredLength() const noexcept
+		{
+			return DotProduct(*this, *this);
+		}
+
+		/**
+		*	\brief Return the length of this vector, computed in T for floating and fixed point types and in double otherwise.
+		*/
+		T Length() const noexcept
+		{
+			if constexpr (std::is_floating_point<T>::value)
+				return std::sqrt(SquaredLength());
+			else if constexpr (std::is_integral<T>::value)
+				return static_cast<T>(std::sqrt(static_cast<double>(SquaredLength())));
+			else
+				return T::Sqrt(SquaredLength());
+		}
+
+		/**
+		*	\brief Normalize this vector and return it, floating and fixed point types only.
+		*/
+		Vec& Normalize() noexcept
+		{
+			static_assert(!std::is_integral<T>::value, "Integral vectors can not be normalized");
+
+			T length = Length();
+
+			if (length != T(0))
+				Math::Unroll<N>([&](size_t i) { Data()[i] /= length; });
+			else
+				Callback::CallErrorCallback(VecName<T, N>::Value, "Normalize", "Division by O due to vector length being equal to 0");
+
+			return *this;
+		}
+
+		/**
+		*	\brief Return this vector normalized, floating and fixed point types only.
+		*/
+		Vec GetNormalized() const noexcept
+		{
+			Vec tmp = *this;
+			return tmp.Normalize();
+		}
+
+		/**
+		*	\brief Return the vector of the absolute value of each component.
+		*/
+		Vec GetAbs() const noexcept
+		{
+			Vec result;
+			Math::Unroll<N>([&](size_t i) { result[i] = Data()[i] < T(0) ? -Data()[i] : Data()[i]; });
+
+			return result;
+		}
+
+		/**
+		*	\brief Return the smallest component.
+		*/
+		T MinComponent() const noexcept
+		{
+			T result = Data()[0];
+			Math::Unroll<N>([&](size_t i) { result = Data()[i] < result ? Data()[i] : result; });
+
+			return result;
+		}
+
+		/**
+		*	\brief Return the largest component.
+		*/
+		T MaxComponent() const noexcept
+		{
+			T result = Data()[0];
+			Math::Unroll<N>([&](size_t i) { result = result < Data()[i] ? Data()[i] : result; });
+
+			return result;
+		}
+
+		//Operator
+
+		/**
+		*	\brief Default move assignement.
+		*
+		*	\return self vector assigned.
+		*/
+		Vec& operator=(Vec&&) = default;
+
+		/**
+		*	\brief Default copy assignement.
+		*
+		*	\return self vector assigned.
+		*/
+		Vec& operator=(const Vec&) = default;
+
+		/**
+		*	\brief \e Getter of the opposite signed vector.
+		*
+		*	\return new opposite signed vector.
+		*/
+		Vec operator-() const noexcept
+		{
+			Vec result;
+			Math::Unroll<N>([&](size_t i) { result[i] = -Data()[i]; });
+
+			return result;
+		}
+
+		/**
+		*	\brief Add term by term vector values.
+		*/
+		Vec operator+(const Vec& _rhs) const noexcept
+		{
+			Vec result = *this;
+			return result += _rhs;
+		}
+
+		/**
+		*	\brief Substract term by term vector values.
+		*/
+		Vec operator-(const Vec& _rhs) const noexcept
+		{
+			Vec result = *this;
+			return result -= _rhs;
+		}
+
+		/**
+		*	\brief Multiply term by term vector values.
+		*/
+		Vec operator*(const Vec& _rhs) const noexcept
+		{
+			Vec result = *this;
+			return result *= _rhs;
+		}
+
+		/**
+		*	\brief Divide term by term vector values.
+		*/
+		Vec operator/(const Vec& _rhs) const
+		{
+			Vec result = *this;
+			return result /= _rhs;
+		}
+
+		/**
+		*	\brief Add term by term vector values.
+		*/
+		Vec& operator+=(const Vec& _rhs) noexcept
+		{
+			Math::Unroll<N>([&](size_t i) { Data()[i] += _rhs[i]; });
+			return *this;
+		}
+
+		/**
+		*	\brief Substract term by term vector values.
+		*/
+		Vec& operator-=(const Vec& _rhs) noexcept
+		{
+			Math::Unroll<N>([&](size_t i) { Data()[i] -= _rhs[i]; });
+			return *this;
+		}
+
+		/**
+		*	\brief Multiply term by term vector values.
+		*/
+		Vec& operator*=(const Vec& _rhs) noexcept
+		{
+			Math::Unroll<N>([&](size_t i) { Data()[i] *= _rhs[i]; });
+			return *this;
+		}
+
+		/**
+		*	\brief Divide term by term vector values. Components divided by 0 are set to 0 for integral and fixed point types.
+		*/
+		Vec& operator/=(const Vec& _rhs)
+		{
+			bool division_by_zero = false;
+			Math::Unroll<N>([&](size_t i) { division_by_zero |= _rhs[i] == T(0); });
+
+			if (division_by_zero)
+				Callback::CallErrorCallback(VecName<T, N>::Value, "operator/", "Division by 0");
+
+			Math::Unroll<N>([&](size_t i) { Data()[i] = Divide(Data()[i], _rhs[i]); });
+			return *this;
+		}
+
+		/**
+		*	\brief Add _scale to each vector's axis.
+		*/
+		Vec operator+(T _scale) const noexcept
+		{
+			return *this + Vec(_scale);
+		}
+
+		/**
+		*	\brief Substract _scale to each vector's axis.
+		*/
+		Vec operator-(T _scale) const noexcept
+		{
+			return *this - Vec(_scale);
+		}
+
+		/**
+		*	\brief Scale each vector's axis by _scale.
+		*/
+		Vec operator*(T _scale) const noexcept
+		{
+			return *this * Vec(_scale);
+		}
+
+		/**
+		*	\brief Divide each vector's axis by _scale.
+		*/
+		Vec operator/(T _scale) const
+		{
+			return *this / Vec(_scale);
+		}
+
+		/**
+		*	\brief Add _scale to each vector's axis.
+		*/
+		Vec& operator+=(T _scale) noexcept
+		{
+			return *this += Vec(_scale);
+		}
+
+		/**
+		*	\brief Substract _scale to each vector's axis.
+		*/
+		Vec& operator-=(T _scale) noexcept
+		{
+			return *this -= Vec(_scale);
+		}
+
+		/**
+		*	\brief Scale each vector's axis by _scale.
+		*/
+		Vec& operator*=(T _scale) noexcept
+		{
+			return *this *= Vec(_scale);
+		}
+
+		/**
+		*	\brief Divide each vector's axis by _scale.
+		*/
+		Vec& operator/=(T _scale)
+		{
+			return *this /= Vec(_scale);
+		}
+
+		//Debug
+
+		/**
+		*	\brief Return the vector as a string, components separated by ", ".
+		*/
+		std::string ToString() const noexcept
+		{
+			std::string result;
+			Math::Unroll<N>([&](size_t i)
+			{
+				if constexpr (std::is_arithmetic<T>::value)
+					result += (i == 0 ? "" : ", ") + std::to_string(Data()[i]);
+				else
+					result += (i == 0 ? "" : ", ") + Data()[i].ToString();
+			});
+
+			return result;
+		}
+
+	private:
+		static T Divide(T _lhs, T _rhs) noexcept
+		{
+			if constexpr (!std::is_floating_point<T>::value)
+				return _rhs == T(0) ? T(0) : _lhs / _rhs;
+			else
+				return _lhs / _rhs;
+		}
+	};
+
+	/**
+	*	\brief Scale each vector's axis by _scale.
+	*/
+	template<typename T, size_t N>
+	Vec<T, N> operator*(T _scale, const Vec<T, N>& _vec) noexcept
+	{
+		return _vec * _scale;
+	}
+
+	/// Double precision vector 2, for positions beyond float accuracy.
+	using Vec2d = Vec<double, 2>;
+
+	/// Double precision vector 3, for positions beyond float accuracy.
+	using Vec3d = Vec<double, 3>;
+
+	/// Double precision vector 4, for positions beyond float accuracy.
+	using Vec4d = Vec<double, 4>;
+
+	/// Integer vector 2, for tile maps and grid cells.
+	using Vec2i = Vec<int32_t, 2>;
+
+	/// Integer vector 3, for voxel and grid cells.
+	using Vec3i = Vec<int32_t, 3>;
+
+	/// Integer vector 4.
+	using Vec4i = Vec<int32_t, 4>;
+}
+
+namespace std
+{
+	/**
+	*	\brief Hash of integral vectors, to use them as unordered container keys.
+	*/
+	template<typename T, size_t N>
+	struct hash<Mathlib::Vec<T, N>>
+	{
+		size_t operator()(const Mathlib::Vec<T, N>& _vec) const noexcept
+		{
+			return _vec.GetHash();
+		}
+	};
+}
+
+#endif
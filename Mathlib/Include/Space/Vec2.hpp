@@ -5,6 +5,7 @@
 
 #include <string>
 #include "Misc/DllExport.hpp"
+#include "Space/Vec.hpp"
 
 /**
 *	\file Vec2.hpp
@@ -17,15 +18,19 @@ namespace Mathlib
 	struct Vec3;
 	struct Vec4;
 
+	template<>
+	struct VecName<float, 2>
+	{
+		static constexpr const char* Value = "Vec2";
+	};
+
 	/**
-	*	\brief Vector 2 struct.
+	*	\brief Vector 2 struct, thin wrapper over Vec<float, 2>.
 	*/
-	struct MATHLIBRARY_API Vec2
+	struct MATHLIBRARY_API Vec2 : public Vec<float, 2>
 	{
-		/// Vector's X component
-		float X = 0.f;
-		/// Vector's Y component
-		float Y = 0.f;
+		/// Generic vector implementing the arithmetic, Vec2 forwards to it.
+		using Base = Vec<float, 2>;
 
 		//Constants
 
@@ -93,6 +98,24 @@ namespace Mathlib
 		*/
 		Vec2(Vec2&& _vec2) = default;
 
+		/**
+		*	\brief Constructor from the generic vector.
+		*
+		*	\param[in] _vec vector to copy values from.
+		*/
+		Vec2(const Base& _vec) noexcept;
+
+		/**
+		*	\brief Conversion constructor from a generic vector of an other component type.
+		*
+		*	\param[in] _other vector to convert, each component is cast to float.
+		*/
+		template<typename U>
+		explicit Vec2(const Vec<U, 2>& _other) noexcept :
+			Base(_other)
+		{
+		}
+
 		//Static Methods
 
 		/**
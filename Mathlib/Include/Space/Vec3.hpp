@@ -4,7 +4,9 @@
 #define MATHLIB_VEC3
 
 #include "Misc/DllExport.hpp"
+#include "Space/Vec.hpp"
 #include "Misc/Constants.hpp"
+#include <cstddef>
 #include <string>
 
 /**
@@ -18,17 +20,19 @@ namespace Mathlib
 	struct Vec2;
 	struct Vec4;
 
+	template<>
+	struct VecName<float, 3>
+	{
+		static constexpr const char* Value = "Vec3";
+	};
+
 	/**
-	*	\brief Vector 3 struct.
+	*	\brief Vector 3 struct, thin wrapper over Vec<float, 3>.
 	*/
-	struct MATHLIBRARY_API Vec3
+	struct MATHLIBRARY_API Vec3 : public Vec<float, 3>
 	{
-		/// Vector's X component
-		float X = 0.f;
-		/// Vector's Y component
-		float Y = 0.f;
-		/// Vector's Z component
-		float Z = 0.f;
+		/// Generic vector implementing the arithmetic, Vec3 forwards to it.
+		using Base = Vec<float, 3>;
 
 		//Constants
 
@@ -104,6 +108,24 @@ namespace Mathlib
 		*/
 		Vec3(Vec3&& _vec3) = default;
 
+		/**
+		*	\brief Constructor from the generic vector.
+		*
+		*	\param[in] _vec vector to copy values from.
+		*/
+		Vec3(const Base& _vec) noexcept;
+
+		/**
+		*	\brief Conversion constructor from a generic vector of an other component type.
+		*
+		*	\param[in] _other vector to convert, each component is cast to float.
+		*/
+		template<typename U>
+		explicit Vec3(const Vec<U, 3>& _other) noexcept :
+			Base(_other)
+		{
+		}
+
 		//Static Methods
 
 		/**
@@ -243,6 +265,27 @@ namespace Mathlib
 		*/
 		Vec3 GetNormalized() const noexcept;
 
+		/**
+		*	\brief Normalize this vector with Math::FastInverseSqrt and return it.
+		*	Length of the result is within 1e-6 of 1. A null vector stays null, without error callback, tiny ones are rescaled first.
+		*/
+		Vec3& NormalizeFast() noexcept;
+
+		/**
+		*	\brief Return this vector normalized with NormalizeFast.
+		*/
+		Vec3 GetNormalizedFast() const noexcept;
+
+		/**
+		*	\brief Normalize many vectors with NormalizeFast, inverse square roots computed several at once.
+		*
+		* 	\param[in] _vectors vectors to normalize.
+		* 	\param[in] _count number of vectors.
+		* 	\param[out] _result normalized vectors, may be _vectors.
+		* 	\param[in] _multithreaded split vectors across threads.
+		*/
+		static void NormalizeFast(const Vec3* _vectors, size_t _count, Vec3* _result, bool _multithreaded = false);
+
 		/**
 		*	\brief Check if the vector is normalized.
 		*/
@@ -4,6 +4,8 @@
 #define MATHLIB_VEC4
 
 #include "Misc/DllExport.hpp"
+#include "Space/Vec.hpp"
+#include <cstddef>
 #include <string>
 
 /**
@@ -17,19 +19,19 @@ namespace Mathlib
 	struct Vec2;
 	struct Vec3;
 
+	template<>
+	struct VecName<float, 4>
+	{
+		static constexpr const char* Value = "Vec4";
+	};
+
 	/**
-	*	\brief Vector 2 struct.
+	*	\brief Vector 4 struct, thin wrapper over Vec<float, 4>.
 	*/
-	struct MATHLIBRARY_API Vec4
+	struct MATHLIBRARY_API Vec4 : public Vec<float, 4>
 	{
-		/// Vector's X component
-		float X = 0.f;
-		/// Vector's Y component
-		float Y = 0.f;
-		/// Vector's Z component
-		float Z = 0.f;
-		/// Vector's W component
-		float W = 0.f;
+		/// Generic vector implementing the arithmetic, Vec4 forwards to it.
+		using Base = Vec<float, 4>;
 
 		//Constants
 		/// Zero vector constant {0, 0, 0, 0}.
@@ -107,6 +109,24 @@ namespace Mathlib
 		*/
 		Vec4(Vec4&& _vec4) = default;
 
+		/**
+		*	\brief Constructor from the generic vector.
+		*
+		*	\param[in] _vec vector to copy values from.
+		*/
+		Vec4(const Base& _vec) noexcept;
+
+		/**
+		*	\brief Conversion constructor from a generic vector of an other component type.
+		*
+		*	\param[in] _other vector to convert, each component is cast to float.
+		*/
+		template<typename U>
+		explicit Vec4(const Vec<U, 4>& _other) noexcept :
+			Base(_other)
+		{
+		}
+
 		//Static Methods
 
 		/**
@@ -204,6 +224,27 @@ namespace Mathlib
 		*/
 		Vec4 GetNormalized() const noexcept;
 
+		/**
+		*	\brief Normalize this vector with Math::FastInverseSqrt and return it.
+		*	Length of the result is within 1e-6 of 1. A null vector stays null, without error callback, tiny ones are rescaled first.
+		*/
+		Vec4& NormalizeFast() noexcept;
+
+		/**
+		*	\brief Return this vector normalized with NormalizeFast.
+		*/
+		Vec4 GetNormalizedFast() const noexcept;
+
+		/**
+		*	\brief Normalize many vectors with NormalizeFast, inverse square roots computed several at once.
+		*
+		* 	\param[in] _vectors vectors to normalize.
+		* 	\param[in] _count number of vectors.
+		* 	\param[out] _result normalized vectors, may be _vectors.
+		* 	\param[in] _multithreaded split vectors across threads.
+		*/
+		static void NormalizeFast(const Vec4* _vectors, size_t _count, Vec4* _result, bool _multithreaded = false);
+
 		/**
 		*	\brief Check if the vector is normalized.
 		*/
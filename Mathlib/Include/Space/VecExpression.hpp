@@ -0,0 +1,480 @@
+#pragma once
+
+#ifndef MATHLIB_VECEXPRESSION
+#define MATHLIB_VECEXPRESSION
+
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+#include <Space/Vec2.hpp>
+#include <Space/Vec3.hpp>
+#include <Space/Vec4.hpp>
+#include <Misc/Parallel.hpp>
+#include <Misc/Unroll.hpp>
+
+/**
+*	\file VecExpression.hpp
+*
+*	\brief Expression templates over Vec2, Vec3, Vec4 and component streams.
+*
+*	Operators on expressions build a tree of nodes instead of computing temporaries. The whole tree is evaluated
+*	component by component when converted to a vector, or element by element in a single loop when stored to
+*	streams. A product directly added or subtracted is evaluated as one fused multiply add when the target
+*	provides it.
+*
+*	Leaves refer to their operands: an expression must be evaluated within the statement building it.
+*
+*	\code
+*	Vec3 result = Expression::Lazy(_vec) + (Expression::Lazy(uv) * W + uuv) * 2.f;
+*
+*	Expression::Store(Expression::Stream(px, py, pz) + Expression::Stream(vx, vy, vz) * dt, count, { px, py, pz });
+*	\endcode
+*/
+
+namespace Mathlib
+{
+	namespace Expression
+	{
+		/**
+		*	\brief Return _lhs * _rhs + _add, with a single rounding when the target has fused multiply add.
+		*/
+		inline float MultiplyAdd(float _lhs, float _rhs, float _add) noexcept
+		{
+#ifdef FP_FAST_FMAF
+			return std::fma(_lhs, _rhs, _add);
+#else
+			return _lhs * _rhs + _add;
+#endif
+		}
+
+		/**
+		*	\brief Vector type an expression of Size components evaluates to, float for scalar expressions.
+		*/
+		template<size_t Size>
+		struct Result;
+
+		template<>
+		struct Result<0> { using Type = float; };
+
+		template<>
+		struct Result<2> { using Type = Vec2; };
+
+		template<>
+		struct Result<3> { using Type = Vec3; };
+
+		template<>
+		struct Result<4> { using Type = Vec4; };
+
+		template<typename E>
+		typename Result<E::Size>::Type Evaluate(const E& _expression) noexcept;
+
+		/**
+		*	\brief Base of every expression node, converting it to its result.
+		*	A node has a Size, 0 for scalars broadcast to every component,
+		*	and a Get(index, component) returning one component of one element.
+		*/
+		template<typename Derived, size_t N>
+		struct Node
+		{
+			/// Number of components, 0 for scalars.
+			static constexpr size_t Size = N;
+
+			/**
+			*	\brief Evaluate the expression.
+			*/
+			operator typename Result<N>::Type() const noexcept
+			{
+				return Evaluate(static_cast<const Derived&>(*this));
+			}
+		};
+
+		/**
+		*	\brief Components of a vector.
+		*/
+		template<size_t N>
+		struct VecLeaf : Node<VecLeaf<N>, N>
+		{
+			/// First component, the others follow.
+			const float* components;
+
+			explicit VecLeaf(const float* _components) noexcept : components{ _components } {}
+
+			float Get(size_t, size_t _component) const noexcept
+			{
+				return components[_component];
+			}
+		};
+
+		/**
+		*	\brief Scalar value, same for every element and component.
+		*/
+		struct ScalarLeaf : Node<ScalarLeaf, 0>
+		{
+			/// Value.
+			float value;
+
+			explicit ScalarLeaf(float _value) noexcept : value{ _value } {}
+
+			float Get(size_t, size_t) const noexcept
+			{
+				return value;
+			}
+		};
+
+		/**
+		*	\brief Vectors stored as component streams, one array per component.
+		*/
+		template<size_t N>
+		struct StreamLeaf : Node<StreamLeaf<N>, N>
+		{
+			/// Array of each component.
+			const float* components[N];
+
+			float Get(size_t _index, size_t _component) const noexcept
+			{
+				return components[_component][_index];
+			}
+		};
+
+		/**
+		*	\brief Stream of scalars, each value used for every component of its element.
+		*/
+		struct ScalarStreamLeaf : Node<ScalarStreamLeaf, 0>
+		{
+			/// Value of each element.
+			const float* values;
+
+			explicit ScalarStreamLeaf(const float* _values) noexcept : values{ _values } {}
+
+			float Get(size_t _index, size_t) const noexcept
+			{
+				return values[_index];
+			}
+		};
+
+		/**
+		*	\brief Return whether T is an expression node.
+		*/
+		template<typename T, typename = void>
+		struct IsNode : std::false_type {};
+
+		template<typename T>
+		struct IsNode<T, std::void_t<decltype(T::Size)>> : std::is_base_of<Node<T, T::Size>, T> {};
+
+		/**
+		*	\brief Return whether T is a vector or scalar usable as an operand of expressions.
+		*/
+		template<typename T>
+		constexpr bool IsOperand = IsNode<T>::value || std::is_arithmetic_v<T> ||
+			std::is_same_v<T, Vec2> || std::is_same_v<T, Vec3> || std::is_same_v<T, Vec4>;
+
+		/**
+		*	\brief Start an expression from a vector, read when the expression is evaluated.
+		*/
+		inline VecLeaf<2> Lazy(const Vec2& _vec) noexcept
+		{
+			return VecLeaf<2>(&_vec.X);
+		}
+
+		inline VecLeaf<3> Lazy(const Vec3& _vec) noexcept
+		{
+			return VecLeaf<3>(&_vec.X);
+		}
+
+		inline VecLeaf<4> Lazy(const Vec4& _vec) noexcept
+		{
+			return VecLeaf<4>(&_vec.X);
+		}
+
+		inline ScalarLeaf Lazy(float _value) noexcept
+		{
+			return ScalarLeaf(_value);
+		}
+
+		template<typename E, std::enable_if_t<IsNode<E>::value, int> = 0>
+		const E& Lazy(const E& _expression) noexcept
+		{
+			return _expression;
+		}
+
+		template<typename T, std::enable_if_t<std::is_arithmetic_v<T> && !std::is_same_v<T, float>, int> = 0>
+		ScalarLeaf Lazy(T _value) noexcept
+		{
+			return ScalarLeaf(static_cast<float>(_value));
+		}
+
+		/**
+		*	\brief Start an expression from vectors stored as component streams.
+		*/
+		inline StreamLeaf<2> Stream(const float* _x, const float* _y) noexcept
+		{
+			return StreamLeaf<2>{ {}, { _x, _y } };
+		}
+
+		inline StreamLeaf<3> Stream(const float* _x, const float* _y, const float* _z) noexcept
+		{
+			return StreamLeaf<3>{ {}, { _x, _y, _z } };
+		}
+
+		inline StreamLeaf<4> Stream(const float* _x, const float* _y, const float* _z, const float* _w) noexcept
+		{
+			return StreamLeaf<4>{ {}, { _x, _y, _z, _w } };
+		}
+
+		/**
+		*	\brief Start an expression from a stream of scalars, broadcast to every component.
+		*/
+		inline ScalarStreamLeaf Stream(const float* _values) noexcept
+		{
+			return ScalarStreamLeaf(_values);
+		}
+
+		/**
+		*	\brief Return the number of components of an expression combining operands of _lhs and _rhs components.
+		*/
+		constexpr size_t CombinedSize(size_t _lhs, size_t _rhs) noexcept
+		{
+			return _lhs > _rhs ? _lhs : _rhs;
+		}
+
+		template<typename Op, typename L, typename R>
+		struct BinaryNode;
+
+		struct Multiply;
+
+		/**
+		*	\brief Return whether T is a product node, fused with a following addition.
+		*/
+		template<typename T>
+		struct IsProduct : std::false_type {};
+
+		template<typename L, typename R>
+		struct IsProduct<BinaryNode<Multiply, L, R>> : std::true_type {};
+
+		/**
+		*	\brief Component wise addition, fused with products.
+		*/
+		struct Add
+		{
+			template<typename L, typename R>
+			static float Apply(const L& _lhs, const R& _rhs, size_t _index, size_t _component) noexcept
+			{
+				if constexpr (IsProduct<L>::value)
+					return MultiplyAdd(_lhs.lhs.Get(_index, _component), _lhs.rhs.Get(_index, _component), _rhs.Get(_index, _component));
+				else if constexpr (IsProduct<R>::value)
+					return MultiplyAdd(_rhs.lhs.Get(_index, _component), _rhs.rhs.Get(_index, _component), _lhs.Get(_index, _component));
+				else
+					return _lhs.Get(_index, _component) + _rhs.Get(_index, _component);
+			}
+		};
+
+		/**
+		*	\brief Component wise subtraction, fused with products.
+		*/
+		struct Subtract
+		{
+			template<typename L, typename R>
+			static float Apply(const L& _lhs, const R& _rhs, size_t _index, size_t _component) noexcept
+			{
+				if constexpr (IsProduct<L>::value)
+					return MultiplyAdd(_lhs.lhs.Get(_index, _component), _lhs.rhs.Get(_index, _component), -_rhs.Get(_index, _component));
+				else if constexpr (IsProduct<R>::value)
+					return MultiplyAdd(-_rhs.lhs.Get(_index, _component), _rhs.rhs.Get(_index, _component), _lhs.Get(_index, _component));
+				else
+					return _lhs.Get(_index, _component) - _rhs.Get(_index, _component);
+			}
+		};
+
+		/**
+		*	\brief Component wise product.
+		*/
+		struct Multiply
+		{
+			template<typename L, typename R>
+			static float Apply(const L& _lhs, const R& _rhs, size_t _index, size_t _component) noexcept
+			{
+				return _lhs.Get(_index, _component) * _rhs.Get(_index, _component);
+			}
+		};
+
+		/**
+		*	\brief Component wise division.
+		*/
+		struct Divide
+		{
+			template<typename L, typename R>
+			static float Apply(const L& _lhs, const R& _rhs, size_t _index, size_t _component) noexcept
+			{
+				return _lhs.Get(_index, _component) / _rhs.Get(_index, _component);
+			}
+		};
+
+		/**
+		*	\brief Operation of two expressions. Operands of different sizes must be a vector and a scalar.
+		*/
+		template<typename Op, typename L, typename R>
+		struct BinaryNode : Node<BinaryNode<Op, L, R>, CombinedSize(L::Size, R::Size)>
+		{
+			static_assert(L::Size == R::Size || L::Size == 0 || R::Size == 0, "Operands sizes differ");
+
+			/// Left operand.
+			L lhs;
+
+			/// Right operand.
+			R rhs;
+
+			BinaryNode(const L& _lhs, const R& _rhs) noexcept : lhs{ _lhs }, rhs{ _rhs } {}
+
+			float Get(size_t _index, size_t _component) const noexcept
+			{
+				return Op::Apply(lhs, rhs, _index, _component);
+			}
+		};
+
+		/**
+		*	\brief Opposite of an expression.
+		*/
+		template<typename E>
+		struct NegateNode : Node<NegateNode<E>, E::Size>
+		{
+			/// Operand.
+			E operand;
+
+			explicit NegateNode(const E& _operand) noexcept : operand{ _operand } {}
+
+			float Get(size_t _index, size_t _component) const noexcept
+			{
+				return -operand.Get(_index, _component);
+			}
+		};
+
+		/**
+		*	\brief Node type of an operand: itself for nodes, a leaf for vectors and scalars.
+		*/
+		template<typename T>
+		using LeafOf = std::decay_t<decltype(Lazy(std::declval<const T&>()))>;
+
+		/**
+		*	\brief Enable operators when both operands are usable and at least one is already an expression,
+		*	operations on plain vectors keep their eager operators.
+		*/
+		template<typename L, typename R>
+		using EnableOperator = std::enable_if_t<IsOperand<L> && IsOperand<R> && (IsNode<L>::value || IsNode<R>::value), int>;
+
+		template<typename L, typename R, EnableOperator<L, R> = 0>
+		BinaryNode<Add, LeafOf<L>, LeafOf<R>> operator+(const L& _lhs, const R& _rhs) noexcept
+		{
+			return { Lazy(_lhs), Lazy(_rhs) };
+		}
+
+		template<typename L, typename R, EnableOperator<L, R> = 0>
+		BinaryNode<Subtract, LeafOf<L>, LeafOf<R>> operator-(const L& _lhs, const R& _rhs) noexcept
+		{
+			return { Lazy(_lhs), Lazy(_rhs) };
+		}
+
+		template<typename L, typename R, EnableOperator<L, R> = 0>
+		BinaryNode<Multiply, LeafOf<L>, LeafOf<R>> operator*(const L& _lhs, const R& _rhs) noexcept
+		{
+			return { Lazy(_lhs), Lazy(_rhs) };
+		}
+
+		template<typename L, typename R, EnableOperator<L, R> = 0>
+		BinaryNode<Divide, LeafOf<L>, LeafOf<R>> operator/(const L& _lhs, const R& _rhs) noexcept
+		{
+			return { Lazy(_lhs), Lazy(_rhs) };
+		}
+
+		template<typename E, std::enable_if_t<IsNode<E>::value, int> = 0>
+		NegateNode<E> operator-(const E& _expression) noexcept
+		{
+			return NegateNode<E>(_expression);
+		}
+
+		/**
+		*	\brief Evaluate a vector or scalar expression.
+		*/
+		template<typename E>
+		typename Result<E::Size>::Type Evaluate(const E& _expression) noexcept
+		{
+			if constexpr (E::Size == 0)
+				return _expression.Get(0, 0);
+			else
+			{
+				typename Result<E::Size>::Type result;
+				float* components = &result.X;
+
+				Math::Unroll<E::Size>([&](size_t _component) { components[_component] = _expression.Get(0, _component); });
+
+				return result;
+			}
+		}
+
+		/**
+		*	\brief Return the dot product of two vector expressions, evaluated in one pass.
+		*/
+		template<typename L, typename R, EnableOperator<L, R> = 0>
+		float Dot(const L& _lhs, const R& _rhs) noexcept
+		{
+			const LeafOf<L> lhs = Lazy(_lhs);
+			const LeafOf<R> rhs = Lazy(_rhs);
+			constexpr size_t Size = CombinedSize(LeafOf<L>::Size, LeafOf<R>::Size);
+			static_assert(Size > 0, "Dot product needs a vector operand");
+
+			float result = lhs.Get(0, 0) * rhs.Get(0, 0);
+			Math::Unroll<Size - 1>([&](size_t _component) { result = MultiplyAdd(lhs.Get(0, _component + 1), rhs.Get(0, _component + 1), result); });
+
+			return result;
+		}
+
+		/// Minimum number of elements stored by one thread.
+		constexpr size_t MinStoreBatch = 16384;
+
+		/**
+		*	\brief Evaluate _expression for elements [0, _count) in a single loop and store each component in its stream.
+		*	Output streams may be input streams of the expression, even permuted: each element only reads its own index,
+		*	and all its components are evaluated before the first one is stored.
+		*
+		*	\param[in] _expression expression to evaluate, scalar ones are stored in every stream.
+		*	\param[in] _count number of elements.
+		*	\param[out] _components output array of each component.
+		*	\param[in] _multithreaded split elements across threads.
+		*/
+		template<typename E, size_t N, std::enable_if_t<IsNode<E>::value, int> = 0>
+		void Store(const E& _expression, size_t _count, float* const (&_components)[N], bool _multithreaded = false)
+		{
+			static_assert(E::Size == N || E::Size == 0, "Expression and output sizes differ");
+
+			float* components[N];
+			for (size_t component = 0; component < N; ++component)
+				components[component] = _components[component];
+
+			auto process = [&_expression, &components](size_t _begin, size_t _end)
+			{
+				for (size_t i = _begin; i < _end; ++i)
+				{
+					float values[N];
+					Math::Unroll<N>([&](size_t _component) { values[_component] = _expression.Get(i, _component); });
+					Math::Unroll<N>([&](size_t _component) { components[_component][i] = values[_component]; });
+				}
+			};
+
+			Math::ParallelFor(0, _count, MinStoreBatch, _multithreaded, process);
+		}
+
+		/**
+		*	\brief Evaluate a scalar expression for elements [0, _count) and store it in _values.
+		*/
+		template<typename E, std::enable_if_t<IsNode<E>::value, int> = 0>
+		void Store(const E& _expression, size_t _count, float* _values, bool _multithreaded = false)
+		{
+			static_assert(E::Size == 0, "Vector expressions need one output stream per component");
+
+			float* const components[1] = { _values };
+			Store(_expression, _count, components, _multithreaded);
+		}
+	}
+}
+
+#endif
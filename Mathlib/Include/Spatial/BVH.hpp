@@ -0,0 +1,242 @@
+#pragma once
+
+#ifndef MATHLIB_BVH
+#define MATHLIB_BVH
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Misc/DllExport.hpp"
+#include <Geometry/AABB.hpp>
+
+/**
+*	\file BVH.hpp
+*
+*	\brief Bounding volume hierarchy implementation.
+*/
+
+namespace Mathlib
+{
+	struct Ray;
+	struct Triangle;
+
+	/**
+	*	\brief Function testing a ray against one primitive during BVH::Raycast.
+	*	Must return true and write _distance only when the primitive is hit closer than the current _distance.
+	*/
+	typedef bool (*BVHRaycastFunction)(const Ray& _ray, uint32_t _primitive, float& _distance, void* _user_data);
+
+	/**
+	*	\brief Function computing the closest point of one primitive to a point during BVH::ClosestPoint.
+	*/
+	typedef Vec3 (*BVHClosestPointFunction)(const Vec3& _point, uint32_t _primitive, void* _user_data);
+
+	/**
+	*	\brief BVH node, 32 bytes so two nodes fit in a cache line.
+	*	Nodes are stored depth first: an interior node's left child directly follows it.
+	*/
+	struct BVHNode
+	{
+		/// Bounds of every primitive under this node.
+		AABB bounds;
+
+		/// Interior node: index of the right child. Leaf: index of the first primitive in BVH::GetPrimitiveIndices().
+		uint32_t offset = 0;
+
+		/// Number of primitives of a leaf, 0 for interior nodes.
+		uint32_t count = 0;
+
+		/**
+		*	\brief Check if this node is a leaf.
+		*/
+		bool IsLeaf() const noexcept { return count != 0; }
+	};
+
+	/**
+	*	\brief Bounding volume hierarchy over primitives given by their bounds,
+	*	built with binned surface area heuristic.
+	*/
+	struct MATHLIBRARY_API BVH
+	{
+	private:
+		/// Flattened depth first nodes, root at index 0.
+		std::vector<BVHNode> nodes;
+
+		/// Primitive indices referenced by leaves.
+		std::vector<uint32_t> primitiveIndices;
+
+		/// Primitive bounds stored in leaf order, primitiveBounds[i] belongs to primitiveIndices[i].
+		std::vector<AABB> primitiveBounds;
+
+	public:
+		/// Maximum number of primitives stored in a leaf.
+		static constexpr uint32_t MaxLeafSize = 4;
+
+		/// Number of bins evaluated per axis by the surface area heuristic.
+		static constexpr uint32_t BinCount = 16;
+
+		//Constructors
+
+		/**
+		*	\brief Default constructor, empty hierarchy.
+		*/
+		BVH() = default;
+
+		/**
+		*	\brief Default copy constructor
+		*/
+		BVH(const BVH& _bvh) = default;
+
+		/**
+		*	\brief Default move constructor
+		*/
+		BVH(BVH&& _bvh) = default;
+
+		//Build
+
+		/**
+		*	\brief Build the hierarchy over primitive bounds, primitive i being identified by its index.
+		*
+		*	\param[in] _bounds bounds of each primitive.
+		*	\param[in] _count number of primitives.
+		*	\param[in] _multithreaded build top level subtrees on separate threads.
+		*/
+		void Build(const AABB* _bounds, size_t _count, bool _multithreaded = false);
+
+		/**
+		*	\brief Build the hierarchy over triangles, triangle i being identified by its index.
+		*
+		*	\param[in] _triangles triangles to build the hierarchy on.
+		*	\param[in] _count number of triangles.
+		*	\param[in] _multithreaded build top level subtrees on separate threads.
+		*/
+		void Build(const Triangle* _triangles, size_t _count, bool _multithreaded = false);
+
+		/**
+		*	\brief Update node bounds after primitives moved, keeping the tree topology.
+		*	Quality degrades as primitives drift away from their build positions, rebuild when it matters.
+		*
+		*	\param[in] _bounds new bounds of each primitive, same count and order as the last build.
+		*/
+		void Refit(const AABB* _bounds) noexcept;
+
+		/**
+		*	\brief Update node bounds after triangles moved, keeping the tree topology.
+		*
+		*	\param[in] _triangles new triangles, same count and order as the last build.
+		*/
+		void Refit(const Triangle* _triangles) noexcept;
+
+		/**
+		*	\brief Remove every node.
+		*/
+		void Clear() noexcept;
+
+		//Accessors
+
+		/**
+		*	\brief Check if the hierarchy contains no primitive.
+		*/
+		bool IsEmpty() const noexcept;
+
+		/**
+		*	\brief return bounds of the whole hierarchy.
+		*/
+		AABB GetBounds() const noexcept;
+
+		/**
+		*	\brief return the flattened nodes, root first.
+		*/
+		const std::vector<BVHNode>& GetNodes() const noexcept;
+
+		/**
+		*	\brief return the primitive indices referenced by leaves.
+		*/
+		const std::vector<uint32_t>& GetPrimitiveIndices() const noexcept;
+
+		//Queries
+
+		/**
+		*	\brief Find the closest primitive hit by a ray, visiting nearest children first.
+		*
+		*	\param[in] _ray ray to cast.
+		*	\param[in] _function primitive test function.
+		*	\param[in] _user_data pointer forwarded to _function.
+		*	\param[in,out] _distance maximum ray distance, receives the closest hit distance.
+		*	\param[out] _primitive closest hit primitive, only written on hit.
+		*
+		*	\return if a primitive was hit.
+		*/
+		bool Raycast(const Ray& _ray, BVHRaycastFunction _function, void* _user_data, float& _distance, uint32_t& _primitive) const noexcept;
+
+		/**
+		*	\brief Find the closest triangle hit by a ray.
+		*
+		*	\param[in] _ray ray to cast.
+		*	\param[in] _triangles triangles the hierarchy was built on.
+		*	\param[in,out] _distance maximum ray distance, receives the closest hit distance.
+		*	\param[out] _primitive closest hit triangle, only written on hit.
+		*
+		*	\return if a triangle was hit.
+		*/
+		bool Raycast(const Ray& _ray, const Triangle* _triangles, float& _distance, uint32_t& _primitive) const noexcept;
+
+		/**
+		*	\brief Collect primitives whose bounds overlap a box.
+		*
+		*	\param[in] _aabb box to test.
+		*	\param[out] _results buffer receiving primitive indices.
+		*	\param[in] _capacity size of _results.
+		*
+		*	\return number of overlapping primitives, can exceed _capacity in which case only _capacity were written.
+		*/
+		size_t QueryAABB(const AABB& _aabb, uint32_t* _results, size_t _capacity) const noexcept;
+
+		/**
+		*	\brief Find the closest primitive point to _point, pruning nodes farther than the best point found.
+		*
+		*	\param[in] _point point to search around.
+		*	\param[in] _function primitive closest point function.
+		*	\param[in] _user_data pointer forwarded to _function.
+		*	\param[in,out] _max_distance maximum search distance, receives the distance to the closest point.
+		*	\param[out] _closest closest point found, only written on success.
+		*	\param[out] _primitive primitive owning the closest point, only written on success.
+		*
+		*	\return if a primitive was found within _max_distance.
+		*/
+		bool ClosestPoint(const Vec3& _point, BVHClosestPointFunction _function, void* _user_data,
+			float& _max_distance, Vec3& _closest, uint32_t& _primitive) const noexcept;
+
+		/**
+		*	\brief Find the closest triangle point to _point.
+		*
+		*	\param[in] _point point to search around.
+		*	\param[in] _triangles triangles the hierarchy was built on.
+		*	\param[in,out] _max_distance maximum search distance, receives the distance to the closest point.
+		*	\param[out] _closest closest point found, only written on success.
+		*	\param[out] _primitive triangle owning the closest point, only written on success.
+		*
+		*	\return if a triangle was found within _max_distance.
+		*/
+		bool ClosestPoint(const Vec3& _point, const Triangle* _triangles, float& _max_distance, Vec3& _closest, uint32_t& _primitive) const noexcept;
+
+		//Operator
+
+		/**
+		*	\brief Default move assignement.
+		*
+		*	\return self hierarchy assigned.
+		*/
+		BVH& operator=(BVH&&) = default;
+
+		/**
+		*	\brief Default copy assignement.
+		*
+		*	\return self hierarchy assigned.
+		*/
+		BVH& operator=(const BVH&) = default;
+	};
+}
+
+#endif
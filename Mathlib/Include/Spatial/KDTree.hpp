@@ -0,0 +1,167 @@
+#pragma once
+
+#ifndef MATHLIB_KD_TREE
+#define MATHLIB_KD_TREE
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Misc/DllExport.hpp"
+#include <Space/Vec3.hpp>
+
+/**
+*	\file KDTree.hpp
+*
+*	\brief k-d tree over static point sets implementation.
+*/
+
+namespace Mathlib
+{
+	/**
+	*	\brief k-d tree over a static point set with an implicit layout:
+	*	points are reordered so the node of range [begin, end) is its median point (begin + end) / 2,
+	*	its left subtree being [begin, median) and its right subtree [median + 1, end).
+	*	No child pointer is stored, only the split axis of each node.
+	*/
+	struct MATHLIBRARY_API KDTree
+	{
+	private:
+		/// Points in tree order.
+		std::vector<Vec3> points;
+
+		/// Original index of each point in tree order.
+		std::vector<uint32_t> indices;
+
+		/// Split axis of the node at each position, 0 for X, 1 for Y, 2 for Z.
+		std::vector<uint8_t> axes;
+
+		/**
+		*	\brief Find the k nearest points, _indices and _sqr_distances being used as a max heap during the search.
+		*/
+		size_t KNearest(const Vec3& _point, size_t _k, uint32_t* _indices, float* _sqr_distances) const noexcept;
+
+	public:
+		/// Index written in batched query outputs for missing neighbors.
+		static constexpr uint32_t InvalidIndex = 0xFFFFFFFFu;
+
+		//Constructors
+
+		/**
+		*	\brief Default constructor, empty tree.
+		*/
+		KDTree() = default;
+
+		/**
+		*	\brief Default copy constructor
+		*/
+		KDTree(const KDTree& _tree) = default;
+
+		/**
+		*	\brief Default move constructor
+		*/
+		KDTree(KDTree&& _tree) = default;
+
+		//Build
+
+		/**
+		*	\brief Build the tree over a point set, point i being identified by its index.
+		*
+		*	\param[in] _points points to store.
+		*	\param[in] _count number of points.
+		*	\param[in] _multithreaded build top level subtrees on separate threads.
+		*/
+		void Build(const Vec3* _points, size_t _count, bool _multithreaded = false);
+
+		/**
+		*	\brief Remove every point.
+		*/
+		void Clear() noexcept;
+
+		//Accessors
+
+		/**
+		*	\brief Check if the tree contains no point.
+		*/
+		bool IsEmpty() const noexcept;
+
+		/**
+		*	\brief return the number of stored points.
+		*/
+		size_t GetPointCount() const noexcept;
+
+		//Queries
+
+		/**
+		*	\brief Find the _k points closest to _point.
+		*
+		*	\param[in] _point query point.
+		*	\param[in] _k number of neighbors to find.
+		*	\param[out] _results buffer of _k entries receiving point indices, closest first.
+		*	\param[out] _sqr_distances optional buffer of _k entries receiving squared distances, can be nullptr.
+		*
+		*	\return number of neighbors found, lower than _k if fewer points are stored.
+		*/
+		size_t QueryKNearest(const Vec3& _point, size_t _k, uint32_t* _results, float* _sqr_distances = nullptr) const;
+
+		/**
+		*	\brief Collect points within _radius of _center, bounds included.
+		*
+		*	\param[in] _center query center.
+		*	\param[in] _radius query radius.
+		*	\param[out] _results buffer receiving point indices.
+		*	\param[in] _capacity size of _results.
+		*
+		*	\return number of points in range, can exceed _capacity in which case only _capacity were written.
+		*/
+		size_t QueryRadius(const Vec3& _center, float _radius, uint32_t* _results, size_t _capacity) const noexcept;
+
+		/**
+		*	\brief Find the _k nearest points of many query points.
+		*	Query i writes its neighbors closest first to _results[i * _k] and _sqr_distances[i * _k],
+		*	missing neighbors are filled with InvalidIndex and the maximum float.
+		*
+		*	\param[in] _queries query points.
+		*	\param[in] _query_count number of query points.
+		*	\param[in] _k number of neighbors per query.
+		*	\param[out] _results buffer of _query_count * _k entries receiving point indices.
+		*	\param[out] _sqr_distances buffer of _query_count * _k entries receiving squared distances.
+		*	\param[in] _multithreaded split queries across threads.
+		*/
+		void QueryKNearestBatch(const Vec3* _queries, size_t _query_count, size_t _k, uint32_t* _results, float* _sqr_distances,
+			bool _multithreaded = false) const;
+
+		/**
+		*	\brief Collect points within _radius of many query points.
+		*	Query i writes up to _capacity point indices to _results[i * _capacity] and its total count to _counts[i].
+		*
+		*	\param[in] _queries query centers.
+		*	\param[in] _query_count number of query points.
+		*	\param[in] _radius query radius.
+		*	\param[out] _results buffer of _query_count * _capacity entries receiving point indices.
+		*	\param[in] _capacity number of results stored per query.
+		*	\param[out] _counts buffer of _query_count entries receiving the number of points in range, can exceed _capacity.
+		*	\param[in] _multithreaded split queries across threads.
+		*/
+		void QueryRadiusBatch(const Vec3* _queries, size_t _query_count, float _radius, uint32_t* _results, size_t _capacity, size_t* _counts,
+			bool _multithreaded = false) const;
+
+		//Operator
+
+		/**
+		*	\brief Default move assignement.
+		*
+		*	\return self tree assigned.
+		*/
+		KDTree& operator=(KDTree&&) = default;
+
+		/**
+		*	\brief Default copy assignement.
+		*
+		*	\return self tree assigned.
+		*/
+		KDTree& operator=(const KDTree&) = default;
+	};
+}
+
+#endif
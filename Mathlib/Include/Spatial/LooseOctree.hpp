@@ -0,0 +1,272 @@
+#pragma once
+
+#ifndef MATHLIB_LOOSE_OCTREE
+#define MATHLIB_LOOSE_OCTREE
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Misc/DllExport.hpp"
+#include <Geometry/AABB.hpp>
+
+/**
+*	\file LooseOctree.hpp
+*
+*	\brief Loose octree over dynamic bounded objects implementation.
+*/
+
+namespace Mathlib
+{
+	struct Frustum;
+	struct Sphere;
+	struct Ray;
+
+	/**
+	*	\brief Loose octree storing moving objects by their bounds.
+	*	Node loose bounds are twice their cell size, so an object is stored in the deepest node whose cell
+	*	contains its center and whose size exceeds its extents: insertion never splits nor redistributes objects.
+	*	Nodes and objects live in pools recycled through free lists, objects are identified by stable handles.
+	*	Objects whose center lies outside the world bounds are kept in the root.
+	*/
+	struct MATHLIBRARY_API LooseOctree
+	{
+	public:
+		/// Handle value of no object.
+		static constexpr uint32_t InvalidHandle = 0xFFFFFFFFu;
+
+		/// Maximum depth accepted by the constructor.
+		static constexpr uint32_t MaxDepthLimit = 16;
+
+	private:
+		/**
+		*	\brief Octree node, a cube cell holding a linked list of objects.
+		*/
+		struct Node
+		{
+			Vec3 center;
+			float halfSize = 0.f;
+			uint32_t parent = InvalidHandle;
+			uint32_t children[8];
+			uint32_t firstObject = InvalidHandle;
+			uint32_t objectCount = 0;
+			uint32_t childCount = 0;
+			uint32_t childSlot = 0;
+		};
+
+		/**
+		*	\brief Object slot, node is InvalidHandle for free slots whose next links the free list.
+		*/
+		struct Object
+		{
+			AABB bounds;
+			uint32_t node = InvalidHandle;
+			uint32_t previous = InvalidHandle;
+			uint32_t next = InvalidHandle;
+		};
+
+		/// Node pool, root at index 0.
+		std::vector<Node> nodes;
+
+		/// Object pool indexed by handle.
+		std::vector<Object> objects;
+
+		/// First free node of the pool.
+		uint32_t freeNode = InvalidHandle;
+
+		/// First free object of the pool.
+		uint32_t freeObject = InvalidHandle;
+
+		/// Number of live objects.
+		size_t objectCount = 0;
+
+		/// Number of live nodes.
+		size_t nodeCount = 0;
+
+		/// Depth of the deepest nodes, root being at depth 0.
+		uint32_t maxDepth = 8;
+
+		/**
+		*	\brief Return the node an object of given bounds belongs to, creating missing nodes.
+		*/
+		uint32_t FindNode(const AABB& _bounds);
+
+		/**
+		*	\brief Return the loose bounds of a node.
+		*/
+		AABB GetLooseBounds(const Node& _node) const noexcept;
+
+		/**
+		*	\brief Link an object at the head of a node list.
+		*/
+		void Link(uint32_t _handle, uint32_t _node) noexcept;
+
+		/**
+		*	\brief Unlink an object from its node list.
+		*/
+		void Unlink(uint32_t _handle) noexcept;
+
+		/**
+		*	\brief Return a node and its ancestors to the pool while they hold no object nor child.
+		*/
+		void ReleaseEmptyNodes(uint32_t _node) noexcept;
+
+		/**
+		*	\brief Check if a handle refers to a live object.
+		*/
+		bool IsValidHandle(uint32_t _handle) const noexcept;
+
+		/**
+		*	\brief Depth first traversal shared by queries, visiting nodes whose loose bounds pass _node_test
+		*	and collecting objects whose bounds pass _object_test.
+		*/
+		template<typename NodeTest, typename ObjectTest>
+		size_t Query(const NodeTest& _node_test, const ObjectTest& _object_test, uint32_t* _results, size_t _capacity) const noexcept;
+
+	public:
+		//Constructors
+
+		/**
+		*	\brief Default constructor, world of size 1024 centered on origin.
+		*/
+		LooseOctree();
+
+		/**
+		*	\brief Constructor from world bounds, enlarged to a cube.
+		*
+		*	\param[in] _world_bounds bounds of the world, objects are expected to stay centered inside.
+		*	\param[in] _max_depth depth of the deepest nodes, clamped to MaxDepthLimit.
+		*/
+		LooseOctree(const AABB& _world_bounds, uint32_t _max_depth = 8);
+
+		/**
+		*	\brief Default copy constructor
+		*/
+		LooseOctree(const LooseOctree& _octree) = default;
+
+		/**
+		*	\brief Default move constructor
+		*/
+		LooseOctree(LooseOctree&& _octree) = default;
+
+		//Objects
+
+		/**
+		*	\brief Insert an object.
+		*
+		*	\param[in] _bounds bounds of the object.
+		*
+		*	\return handle of the object, stable until removed.
+		*/
+		uint32_t Insert(const AABB& _bounds);
+
+		/**
+		*	\brief Update the bounds of an object, relinking it only when it changes node.
+		*
+		*	\param[in] _handle handle of the object.
+		*	\param[in] _bounds new bounds of the object.
+		*/
+		void Move(uint32_t _handle, const AABB& _bounds);
+
+		/**
+		*	\brief Remove an object, its handle can be reused by later insertions.
+		*
+		*	\param[in] _handle handle of the object.
+		*/
+		void Remove(uint32_t _handle) noexcept;
+
+		/**
+		*	\brief Remove every object, keeping the world bounds and pool capacity.
+		*/
+		void Clear() noexcept;
+
+		//Accessors
+
+		/**
+		*	\brief return the bounds of an object.
+		*
+		*	\param[in] _handle handle of the object.
+		*/
+		const AABB& GetBounds(uint32_t _handle) const noexcept;
+
+		/**
+		*	\brief return the cubic world bounds.
+		*/
+		AABB GetWorldBounds() const noexcept;
+
+		/**
+		*	\brief return the number of stored objects.
+		*/
+		size_t GetObjectCount() const noexcept;
+
+		/**
+		*	\brief return the number of live nodes, root included.
+		*/
+		size_t GetNodeCount() const noexcept;
+
+		//Queries
+
+		/**
+		*	\brief Collect objects whose bounds overlap a box.
+		*
+		*	\param[in] _aabb box to test.
+		*	\param[out] _results buffer receiving object handles.
+		*	\param[in] _capacity size of _results.
+		*
+		*	\return number of overlapping objects, can exceed _capacity in which case only _capacity were written.
+		*/
+		size_t QueryAABB(const AABB& _aabb, uint32_t* _results, size_t _capacity) const noexcept;
+
+		/**
+		*	\brief Collect objects whose bounds overlap a sphere.
+		*
+		*	\param[in] _sphere sphere to test.
+		*	\param[out] _results buffer receiving object handles.
+		*	\param[in] _capacity size of _results.
+		*
+		*	\return number of overlapping objects, can exceed _capacity in which case only _capacity were written.
+		*/
+		size_t QuerySphere(const Sphere& _sphere, uint32_t* _results, size_t _capacity) const noexcept;
+
+		/**
+		*	\brief Collect objects whose bounds are inside or intersect a frustum.
+		*
+		*	\param[in] _frustum frustum to test.
+		*	\param[out] _results buffer receiving object handles.
+		*	\param[in] _capacity size of _results.
+		*
+		*	\return number of visible objects, can exceed _capacity in which case only _capacity were written.
+		*/
+		size_t QueryFrustum(const Frustum& _frustum, uint32_t* _results, size_t _capacity) const noexcept;
+
+		/**
+		*	\brief Collect objects whose bounds are hit by a ray, in no particular order.
+		*
+		*	\param[in] _ray ray to cast.
+		*	\param[in] _max_distance maximum hit distance along the ray.
+		*	\param[out] _results buffer receiving object handles.
+		*	\param[in] _capacity size of _results.
+		*
+		*	\return number of hit objects, can exceed _capacity in which case only _capacity were written.
+		*/
+		size_t QueryRay(const Ray& _ray, float _max_distance, uint32_t* _results, size_t _capacity) const noexcept;
+
+		//Operator
+
+		/**
+		*	\brief Default move assignement.
+		*
+		*	\return self octree assigned.
+		*/
+		LooseOctree& operator=(LooseOctree&&) = default;
+
+		/**
+		*	\brief Default copy assignement.
+		*
+		*	\return self octree assigned.
+		*/
+		LooseOctree& operator=(const LooseOctree&) = default;
+	};
+}
+
+#endif
@@ -0,0 +1,162 @@
+#pragma once
+
+#ifndef MATHLIB_SPATIAL_HASH
+#define MATHLIB_SPATIAL_HASH
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Misc/DllExport.hpp"
+#include <Space/Vec3.hpp>
+
+/**
+*	\file SpatialHash.hpp
+*
+*	\brief Uniform grid spatial hash over point sets implementation.
+*/
+
+namespace Mathlib
+{
+	/**
+	*	\brief Uniform grid hashing points into buckets, meant to be rebuilt every frame.
+	*	Points are counting sorted by bucket so each bucket is a contiguous range of points.
+	*	Distinct cells can share a bucket, queries filter points by their actual cell.
+	*/
+	struct MATHLIBRARY_API SpatialHash
+	{
+	private:
+		/// Size of a grid cell on each axis.
+		float cellSize = 1.f;
+
+		/// Inverse of cellSize.
+		float inverseCellSize = 1.f;
+
+		/// Number of buckets minus one, bucket count is a power of two.
+		uint32_t bucketMask = 0;
+
+		/// Minimum cell coordinates of the stored points.
+		int32_t minCell[3] = { 0, 0, 0 };
+
+		/// Maximum cell coordinates of the stored points.
+		int32_t maxCell[3] = { 0, 0, 0 };
+
+		/// Index of the first sorted point of each bucket, bucketCount + 1 entries.
+		std::vector<uint32_t> bucketStart;
+
+		/// Original index of each sorted point.
+		std::vector<uint32_t> sortedIndices;
+
+		/// Points sorted by bucket.
+		std::vector<Vec3> sortedPoints;
+
+		/**
+		*	\brief Return the bucket of a cell.
+		*/
+		uint32_t GetBucket(int32_t _x, int32_t _y, int32_t _z) const noexcept;
+
+	public:
+		//Constructors
+
+		/**
+		*	\brief Default constructor, empty grid with cells of size 1.
+		*/
+		SpatialHash() = default;
+
+		/**
+		*	\brief Constructor setting the cell size.
+		*
+		*	\param[in] _cell_size size of a grid cell, ideally close to the typical query radius.
+		*/
+		SpatialHash(float _cell_size) noexcept;
+
+		/**
+		*	\brief Default copy constructor
+		*/
+		SpatialHash(const SpatialHash& _spatial_hash) = default;
+
+		/**
+		*	\brief Default move constructor
+		*/
+		SpatialHash(SpatialHash&& _spatial_hash) = default;
+
+		//Build
+
+		/**
+		*	\brief Rebuild the grid from a point set, point i being identified by its index.
+		*
+		*	\param[in] _points points to store.
+		*	\param[in] _count number of points.
+		*	\param[in] _multithreaded hash and scatter points on several threads.
+		*/
+		void Build(const Vec3* _points, size_t _count, bool _multithreaded = false);
+
+		/**
+		*	\brief Remove every point.
+		*/
+		void Clear() noexcept;
+
+		//Accessors
+
+		/**
+		*	\brief return the size of a grid cell.
+		*/
+		float GetCellSize() const noexcept;
+
+		/**
+		*	\brief Set the size of grid cells, applied at the next Build.
+		*
+		*	\param[in] _cell_size size of a grid cell.
+		*/
+		void SetCellSize(float _cell_size) noexcept;
+
+		/**
+		*	\brief return the number of stored points.
+		*/
+		size_t GetPointCount() const noexcept;
+
+		//Queries
+
+		/**
+		*	\brief Collect points within _radius of _center, bounds included.
+		*
+		*	\param[in] _center query center.
+		*	\param[in] _radius query radius.
+		*	\param[out] _results buffer receiving point indices.
+		*	\param[in] _capacity size of _results.
+		*
+		*	\return number of points in range, can exceed _capacity in which case only _capacity were written.
+		*/
+		size_t QueryRadius(const Vec3& _center, float _radius, uint32_t* _results, size_t _capacity) const noexcept;
+
+		/**
+		*	\brief Find the _k points closest to _point, searching cell rings outward.
+		*
+		*	\param[in] _point query point.
+		*	\param[in] _k number of neighbors to find.
+		*	\param[out] _results buffer of _k entries receiving point indices, closest first.
+		*	\param[out] _sqr_distances optional buffer of _k entries receiving squared distances, can be nullptr.
+		*
+		*	\return number of neighbors found, lower than _k if fewer points are stored.
+		*/
+		size_t QueryKNearest(const Vec3& _point, size_t _k, uint32_t* _results, float* _sqr_distances = nullptr) const;
+
+		//Operator
+
+		/**
+		*	\brief Default move assignement.
+		*
+		*	\return self grid assigned.
+		*/
+		SpatialHash& operator=(SpatialHash&&) = default;
+
+		/**
+		*	\brief Default copy assignement.
+		*
+		*	\return self grid assigned.
+		*/
+		SpatialHash& operator=(const SpatialHash&) = default;
+	};
+}
+
+#endif
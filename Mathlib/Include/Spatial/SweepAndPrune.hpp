@@ -0,0 +1,189 @@
+#pragma once
+
+#ifndef MATHLIB_SWEEP_AND_PRUNE
+#define MATHLIB_SWEEP_AND_PRUNE
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Misc/DllExport.hpp"
+#include <Geometry/AABB.hpp>
+
+/**
+*	\file SweepAndPrune.hpp
+*
+*	\brief Sweep and prune broadphase implementation.
+*/
+
+namespace Mathlib
+{
+	/**
+	*	\brief Pair of overlapping proxies, first being lower than second.
+	*/
+	struct BroadphasePair
+	{
+		/// Lowest proxy handle of the pair.
+		uint32_t first = 0;
+
+		/// Highest proxy handle of the pair.
+		uint32_t second = 0;
+	};
+
+	/**
+	*	\brief Sweep and prune broadphase over moving boxes.
+	*	Box endpoints on the X axis stay sorted across updates, so the insertion sort of each update
+	*	only moves the few endpoints that crossed others since the last one.
+	*	The sweep then tests boxes overlapping on X against each other on Y and Z.
+	*/
+	struct MATHLIBRARY_API SweepAndPrune
+	{
+	public:
+		/// Handle value of no proxy.
+		static constexpr uint32_t InvalidHandle = 0xFFFFFFFFu;
+
+	private:
+		/**
+		*	\brief Box bound on the X axis, data holding the proxy handle shifted left once and 1 in its low bit for max bounds.
+		*/
+		struct Endpoint
+		{
+			float value;
+			uint32_t data;
+		};
+
+		/// Endpoints sorted on X.
+		std::vector<Endpoint> endpoints;
+
+		/// Bounds of each proxy indexed by handle.
+		std::vector<AABB> bounds;
+
+		/// If each proxy is alive, indexed by handle.
+		std::vector<uint8_t> alive;
+
+		/// Handles free for insertion.
+		std::vector<uint32_t> freeHandles;
+
+		/// Handles removed since the last update, their endpoints are still in the sorted array.
+		std::vector<uint32_t> removedHandles;
+
+		/// Overlapping pairs found by the last update.
+		std::vector<BroadphasePair> pairs;
+
+		/// Number of proxies inserted since the last update, their endpoints are unsorted at the array end.
+		size_t insertedCount = 0;
+
+		/// Number of live proxies.
+		size_t proxyCount = 0;
+
+		/// Active proxies during the sweep, stored as structure of arrays for the secondary axes test.
+		std::vector<uint32_t> activeHandles;
+		std::vector<float> activeMinY;
+		std::vector<float> activeMaxY;
+		std::vector<float> activeMinZ;
+		std::vector<float> activeMaxZ;
+
+		/// Position of each proxy in the active arrays, indexed by handle.
+		std::vector<uint32_t> activeSlots;
+
+		/// Active slots passing the secondary axes test, filled by the sweep.
+		std::vector<uint32_t> candidates;
+
+		/**
+		*	\brief Check if a handle refers to a live proxy.
+		*/
+		bool IsValidHandle(uint32_t _handle) const noexcept;
+
+	public:
+		//Constructors
+
+		/**
+		*	\brief Default constructor, no proxy.
+		*/
+		SweepAndPrune() = default;
+
+		/**
+		*	\brief Default copy constructor
+		*/
+		SweepAndPrune(const SweepAndPrune& _broadphase) = default;
+
+		/**
+		*	\brief Default move constructor
+		*/
+		SweepAndPrune(SweepAndPrune&& _broadphase) = default;
+
+		//Proxies
+
+		/**
+		*	\brief Add a box, taken into account by the next Update.
+		*	Boxes with min greater than max, such as AABB::Empty, overlap nothing.
+		*
+		*	\param[in] _bounds bounds of the box.
+		*
+		*	\return handle of the proxy, stable until removed.
+		*/
+		uint32_t Insert(const AABB& _bounds);
+
+		/**
+		*	\brief Change the bounds of a proxy, taken into account by the next Update.
+		*
+		*	\param[in] _handle handle of the proxy.
+		*	\param[in] _bounds new bounds of the box.
+		*/
+		void SetBounds(uint32_t _handle, const AABB& _bounds) noexcept;
+
+		/**
+		*	\brief Remove a proxy, its handle can be reused by later insertions.
+		*
+		*	\param[in] _handle handle of the proxy.
+		*/
+		void Remove(uint32_t _handle) noexcept;
+
+		/**
+		*	\brief Remove every proxy and pair.
+		*/
+		void Clear() noexcept;
+
+		/**
+		*	\brief Sort endpoints and rebuild the overlapping pair list.
+		*/
+		void Update();
+
+		//Accessors
+
+		/**
+		*	\brief return the bounds of a proxy.
+		*
+		*	\param[in] _handle handle of the proxy.
+		*/
+		const AABB& GetBounds(uint32_t _handle) const noexcept;
+
+		/**
+		*	\brief return the number of live proxies.
+		*/
+		size_t GetProxyCount() const noexcept;
+
+		/**
+		*	\brief return the overlapping pairs found by the last Update, bounds touching counting as overlap.
+		*/
+		const std::vector<BroadphasePair>& GetPairs() const noexcept;
+
+		//Operator
+
+		/**
+		*	\brief Default move assignement.
+		*
+		*	\return self broadphase assigned.
+		*/
+		SweepAndPrune& operator=(SweepAndPrune&&) = default;
+
+		/**
+		*	\brief Default copy assignement.
+		*
+		*	\return self broadphase assigned.
+		*/
+		SweepAndPrune& operator=(const SweepAndPrune&) = default;
+	};
+}
+
+#endif
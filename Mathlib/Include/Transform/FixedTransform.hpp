@@ -0,0 +1,149 @@
+#pragma once
+
+#ifndef MATHLIB_FIXEDTRANSFORM
+#define MATHLIB_FIXEDTRANSFORM
+
+#include <Misc/Fixed.hpp>
+#include <Space/Vec.hpp>
+#include <Space/FixedQuat.hpp>
+#include <Transform/Transform.hpp>
+
+/**
+*	\file FixedTransform.hpp
+*
+*	\brief Fixed point transform type implementation.
+*/
+
+namespace Mathlib
+{
+	/**
+	*	\brief transform struct with fixed point components, for deterministic simulation.
+	*/
+	template<typename T>
+	struct FixedTransform
+	{
+		///  Transform rotation quaternion
+		FixedQuat<T> rotation;
+
+		///  Transform position vector 3
+		Vec<T, 3> position;
+
+		/// Transform scale vector 3
+		Vec<T, 3> scale = Vec<T, 3>(T(1));
+
+		//Constructor
+
+		/**
+		*	\brief Default constructor
+		*/
+		FixedTransform() = default;
+
+		/**
+		*	\brief Value constructor
+		*
+		*	\param[in] _rotation transform rotation.
+		*	\param[in] _position transform position.
+		*	\param[in] _scale transform scale.
+		*/
+		FixedTransform(const FixedQuat<T>& _rotation, const Vec<T, 3>& _position, const Vec<T, 3>& _scale = Vec<T, 3>(T(1))) noexcept :
+			rotation{ _rotation }, position{ _position }, scale{ _scale }
+		{
+		}
+
+		/**
+		*	\brief Constructor from a float transform, each component rounded to the nearest fixed point value.
+		*
+		*	\param[in] _transform transform to copy values from.
+		*/
+		explicit FixedTransform(const Transform& _transform) noexcept :
+			rotation{ _transform.rotation },
+			position{ T(_transform.position.X), T(_transform.position.Y), T(_transform.position.Z) },
+			scale{ T(_transform.scale.X), T(_transform.scale.Y), T(_transform.scale.Z) }
+		{
+		}
+
+		/**
+		*	\brief Default copy constructor
+		*/
+		FixedTransform(const FixedTransform& _transform) = default;
+
+		/**
+		*	\brief Default move constructor
+		*/
+		FixedTransform(FixedTransform&& _transform) = default;
+
+		//Equality
+
+		bool operator==(const FixedTransform& _rhs) const noexcept
+		{
+			return rotation == _rhs.rotation && position == _rhs.position && scale == _rhs.scale;
+		}
+
+		bool operator!=(const FixedTransform& _rhs) const noexcept
+		{
+			return !(*this == _rhs);
+		}
+
+		//Accessors
+
+		/**
+		*	\brief Return this transform as a float transform.
+		*/
+		Transform ToTransform() const noexcept
+		{
+			return Transform(rotation.ToQuat(), Vec3(position.X.ToFloat(), position.Y.ToFloat(), position.Z.ToFloat()),
+				Vec3(scale.X.ToFloat(), scale.Y.ToFloat(), scale.Z.ToFloat()));
+		}
+
+		//Methods
+
+		/**
+		*	\brief Transform _point from local to parent space: scale, rotate then translate.
+		*/
+		Vec<T, 3> TransformPoint(const Vec<T, 3>& _point) const noexcept
+		{
+			return rotation.Rotate(_point * scale) + position;
+		}
+
+		/**
+		*	\brief compute child object world transform based on parent transform.
+		*
+		*	\param[in] _parent parent object transfrom.
+		*
+		*	\return return new world transform of the child object.
+		*/
+		FixedTransform GetWorldTransfrom(const FixedTransform& _parent) const noexcept
+		{
+			FixedTransform result;
+			result.rotation = rotation;
+			result.position = _parent.rotation.Rotate(position) + _parent.position;
+			result.scale = _parent.scale * scale;
+
+			return result;
+		}
+
+		//Operator
+
+		/**
+		*	\brief Default move assignement.
+		*
+		*	\return self transform assigned.
+		*/
+		FixedTransform& operator=(FixedTransform&&) = default;
+
+		/**
+		*	\brief Default copy assignement.
+		*
+		*	\return self transform assigned.
+		*/
+		FixedTransform& operator=(const FixedTransform&) = default;
+	};
+
+	/// Q16.16 transform.
+	using TransformQ16 = FixedTransform<Q16_16>;
+
+	/// Q32.32 transform.
+	using TransformQ32 = FixedTransform<Q32_32>;
+}
+
+#endif
@@ -0,0 +1,117 @@
+#pragma once
+
+#ifndef MATHLIB_LARGEWORLD
+#define MATHLIB_LARGEWORLD
+
+#include <cstddef>
+
+#include "Misc/DllExport.hpp"
+#include <Space/Vec3.hpp>
+#include <Space/Vec.hpp>
+#include <Matrix/Mat4.hpp>
+#include <Matrix/Mat.hpp>
+#include <Transform/Transform.hpp>
+#include <Transform/Transformd.hpp>
+
+/**
+*	\file LargeWorld.hpp
+*
+*	\brief Batched conversions between double precision world space and float camera relative or rebased space.
+*/
+
+namespace Mathlib
+{
+	namespace LargeWorld
+	{
+		/**
+		*	\brief Convert world positions to float positions relative to the camera.
+		*	Differences are computed in double so positions near the camera keep full float accuracy.
+		*
+		*	\param[in] _positions world positions.
+		*	\param[in] _count number of positions.
+		*	\param[in] _camera camera world position.
+		*	\param[out] _results camera relative positions.
+		*	\param[in] _multithreaded split positions across threads.
+		*/
+		MATHLIBRARY_API void ToCameraRelative(const Vec3d* _positions, size_t _count, const Vec3d& _camera, Vec3* _results,
+			bool _multithreaded = false);
+
+		/**
+		*	\brief Convert world transforms to float matrices relative to the camera, ready for rendering.
+		*
+		*	\param[in] _transforms world transforms, rotations must be normalized.
+		*	\param[in] _count number of transforms.
+		*	\param[in] _camera camera world position.
+		*	\param[out] _results camera relative transform matrices with scale.
+		*	\param[in] _multithreaded split transforms across threads.
+		*/
+		MATHLIBRARY_API void ToCameraRelative(const Transformd* _transforms, size_t _count, const Vec3d& _camera, Mat4* _results,
+			bool _multithreaded = false);
+
+		/**
+		*	\brief Convert world matrices to float matrices relative to the camera, ready for rendering.
+		*	Only the translation is offset, matrices are expected to be affine.
+		*
+		*	\param[in] _matrices world matrices.
+		*	\param[in] _count number of matrices.
+		*	\param[in] _camera camera world position.
+		*	\param[out] _results camera relative matrices.
+		*	\param[in] _multithreaded split matrices across threads.
+		*/
+		MATHLIBRARY_API void ToCameraRelative(const Mat4d* _matrices, size_t _count, const Vec3d& _camera, Mat4* _results,
+			bool _multithreaded = false);
+
+		/**
+		*	\brief Move the origin of double positions by _shift: positions -= _shift.
+		*
+		*	\param[in,out] _positions positions to rebase.
+		*	\param[in] _count number of positions.
+		*	\param[in] _shift new origin expressed in the current space.
+		*	\param[in] _multithreaded split positions across threads.
+		*/
+		MATHLIBRARY_API void Rebase(Vec3d* _positions, size_t _count, const Vec3d& _shift, bool _multithreaded = false);
+
+		/**
+		*	\brief Move the origin of double transforms by _shift: positions -= _shift.
+		*
+		*	\param[in,out] _transforms transforms to rebase.
+		*	\param[in] _count number of transforms.
+		*	\param[in] _shift new origin expressed in the current space.
+		*	\param[in] _multithreaded split transforms across threads.
+		*/
+		MATHLIBRARY_API void Rebase(Transformd* _transforms, size_t _count, const Vec3d& _shift, bool _multithreaded = false);
+
+		/**
+		*	\brief Move the floating origin of float positions by _shift: positions -= _shift, computed in double.
+		*
+		*	\param[in,out] _positions positions to rebase.
+		*	\param[in] _count number of positions.
+		*	\param[in] _shift new origin expressed in the current space.
+		*	\param[in] _multithreaded split positions across threads.
+		*/
+		MATHLIBRARY_API void Rebase(Vec3* _positions, size_t _count, const Vec3d& _shift, bool _multithreaded = false);
+
+		/**
+		*	\brief Move the floating origin of float transforms by _shift: positions -= _shift, computed in double.
+		*
+		*	\param[in,out] _transforms transforms to rebase.
+		*	\param[in] _count number of transforms.
+		*	\param[in] _shift new origin expressed in the current space.
+		*	\param[in] _multithreaded split transforms across threads.
+		*/
+		MATHLIBRARY_API void Rebase(Transform* _transforms, size_t _count, const Vec3d& _shift, bool _multithreaded = false);
+
+		/**
+		*	\brief Compute a floating origin near _focus, snapped to a grid of _cell_size.
+		*	Snapping keeps successive origins on exact values and avoids rebasing on small moves.
+		*
+		*	\param[in] _focus position the origin should follow, usually the camera.
+		*	\param[in] _cell_size grid size, a power of 2 keeps rebased float positions exact. Not snapped if <= 0.
+		*
+		*	\return snapped origin.
+		*/
+		MATHLIBRARY_API Vec3d ComputeOrigin(const Vec3d& _focus, double _cell_size) noexcept;
+	}
+}
+
+#endif
@@ -0,0 +1,154 @@
+#pragma once
+
+#ifndef MATHLIB_TRANSFORMD
+#define MATHLIB_TRANSFORMD
+
+#include "Misc/DllExport.hpp"
+
+#include <Space/Quaternion.hpp>
+#include <Space/Vec3.hpp>
+#include <Space/Vec.hpp>
+#include <Matrix/Mat.hpp>
+#include <Transform/Transform.hpp>
+
+/**
+*	\file Transformd.hpp
+*
+*	\brief Double precision position transform type implementation.
+*/
+
+namespace Mathlib
+{
+	/**
+	*	\brief transform struct with a double precision position, for worlds larger than float accuracy.
+	*	Rotation and scale do not depend on the distance to the origin and stay in float.
+	*/
+	struct MATHLIBRARY_API Transformd
+	{
+		///  Transform rotation quaternion
+		Quat rotation;
+
+		///  Transform position, double precision
+		Vec3d position;
+
+		/// Transform scale vector 3
+		Vec3 scale = Vec3::One;
+
+		//Constructor
+
+		/**
+		*	\brief Default constructor
+		*/
+		Transformd() noexcept = default;
+
+		/**
+		*	\brief Value constructor
+		*
+		*	\param[in] _rotation transform rotation.
+		*	\param[in] _position transform position.
+		*	\param[in] _scale transform scale.
+		*/
+		Transformd(const Quat& _rotation, const Vec3d& _position, const Vec3& _scale = Vec3::One) noexcept;
+
+		/**
+		*	\brief Constructor from a float transform
+		*
+		*	\param[in] _transform transform to copy values from.
+		*/
+		explicit Transformd(const Transform& _transform) noexcept;
+
+		/**
+		*	\brief Default copy constructor
+		*/
+		Transformd(const Transformd& _transform) noexcept = default;
+
+		/**
+		*	\brief Default move constructor
+		*/
+		Transformd(Transformd&& _transform) noexcept = default;
+
+		//Equality
+
+		/**
+		*	\brief Compare this Transformd with with _other
+		*
+		*	\param[in] _other other Transformd to do the comparison with.
+		* 	\param[in] _epsilon threshold to accept equality.
+		*
+		*	\return if this and _other are equal.
+		*/
+		bool Equals(const Transformd& _other, float _epsilon = 0.f) const noexcept;
+
+		/**
+		*	\brief Operator to compare this Transformd with with _rhs
+		*
+		*	\param[in] _rhs right hand side operand to do the comparison with.
+		*
+		*	\return if this and _rhs are equal.
+		*/
+		bool operator==(const Transformd& _rhs) const noexcept;
+
+		/**
+		*	\brief Operator to compare this Transformd with with _rhs.
+		*
+		*	\param[in] _rhs right hand side operand to do the comparison with.
+		*
+		*	\return if this and _rhs are different.
+		*/
+		bool operator!=(const Transformd& _rhs) const noexcept;
+
+		//ToMatrix
+
+		/**
+		*	\brief Create double precision matrix from transform components.
+		*
+		*	\return transform matrix.
+		*/
+		Mat4d ToMatrixWithScale() const;
+
+		/**
+		*	\brief Create double precision matrix from transform components ignoring scale.
+		*
+		*	\return transform matrix.
+		*/
+		Mat4d ToMatrixNoScale() const;
+
+		/**
+		*	\brief Create the float transform relative to _origin, position difference computed in double.
+		*
+		*	\param[in] _origin origin of the float transform space, usually the camera or floating origin.
+		*
+		*	\return float transform.
+		*/
+		Transform ToTransform(const Vec3d& _origin) const noexcept;
+
+		//GetWorldTransfrom
+
+		/**
+		*	\brief compute child object world transform based on parent transform.
+		*
+		*	\param[in] _parent parent object transfrom.
+		*
+		*	\return return new world transform of the child object.
+		*/
+		Transformd GetWorldTransfrom(const Transformd& _parent) const;
+
+		//Operator
+
+		/**
+		*	\brief Default move assignement.
+		*
+		*	\return self transform assigned.
+		*/
+		Transformd& operator=(Transformd&&) = default;
+
+		/**
+		*	\brief Default copy assignement.
+		*
+		*	\return self transform assigned.
+		*/
+		Transformd& operator=(const Transformd&) = default;
+	};
+}
+
+#endif
@@ -0,0 +1,278 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+
+#include <Geometry/AABB.hpp>
+#include <Matrix/Mat4.hpp>
+#include <Transform/Transform.hpp>
+#include <Misc/Math.hpp>
+
+using namespace Mathlib;
+
+#define CLASS_NAME "AABB"
+
+namespace
+{
+	/**
+	*	\brief Arvo's box transformation expressed on center and extents.
+	*	Branch free so batch loops calling it can be vectorized.
+	*/
+	inline void TransformBox(const AABB& _in, const Mat4& _m, AABB& _out) noexcept
+	{
+		float cx = (_in.min.X + _in.max.X) * 0.5f;
+		float cy = (_in.min.Y + _in.max.Y) * 0.5f;
+		float cz = (_in.min.Z + _in.max.Z) * 0.5f;
+
+		float ex = (_in.max.X - _in.min.X) * 0.5f;
+		float ey = (_in.max.Y - _in.min.Y) * 0.5f;
+		float ez = (_in.max.Z - _in.min.Z) * 0.5f;
+
+		float ncx = _m.e00 * cx + _m.e01 * cy + _m.e02 * cz + _m.e03;
+		float ncy = _m.e10 * cx + _m.e11 * cy + _m.e12 * cz + _m.e13;
+		float ncz = _m.e20 * cx + _m.e21 * cy + _m.e22 * cz + _m.e23;
+
+		float nex = std::abs(_m.e00) * ex + std::abs(_m.e01) * ey + std::abs(_m.e02) * ez;
+		float ney = std::abs(_m.e10) * ex + std::abs(_m.e11) * ey + std::abs(_m.e12) * ez;
+		float nez = std::abs(_m.e20) * ex + std::abs(_m.e21) * ey + std::abs(_m.e22) * ez;
+
+		// Inverted boxes such as Empty have infinite extents that 0 entries would turn into NaN: keep them unchanged.
+		const bool valid = _in.min.X <= _in.max.X && _in.min.Y <= _in.max.Y && _in.min.Z <= _in.max.Z;
+
+		_out.min.X = valid ? ncx - nex : _in.min.X;
+		_out.min.Y = valid ? ncy - ney : _in.min.Y;
+		_out.min.Z = valid ? ncz - nez : _in.min.Z;
+
+		_out.max.X = valid ? ncx + nex : _in.max.X;
+		_out.max.Y = valid ? ncy + ney : _in.max.Y;
+		_out.max.Z = valid ? ncz + nez : _in.max.Z;
+	}
+}
+
+//Constants
+
+const AABB AABB::Empty = AABB(Vec3(std::numeric_limits<float>::max()), Vec3(-std::numeric_limits<float>::max()));
+
+//Constructors
+
+AABB::AABB(const Vec3& _min, const Vec3& _max) noexcept :
+	min{ _min }, max{ _max }
+{
+}
+
+//Static Methods
+
+AABB AABB::FromCenterExtents(const Vec3& _center, const Vec3& _extents) noexcept
+{
+	return AABB(_center - _extents, _center + _extents);
+}
+
+AABB AABB::FromPoints(const Vec3* _points, size_t _count) noexcept
+{
+	AABB result = AABB::Empty;
+
+	for (size_t i = 0; i < _count; ++i)
+		result.Encapsulate(_points[i]);
+
+	return result;
+}
+
+AABB AABB::Union(const AABB& _lhs, const AABB& _rhs) noexcept
+{
+	return AABB(Vec3(std::min(_lhs.min.X, _rhs.min.X), std::min(_lhs.min.Y, _rhs.min.Y), std::min(_lhs.min.Z, _rhs.min.Z)),
+				Vec3(std::max(_lhs.max.X, _rhs.max.X), std::max(_lhs.max.Y, _rhs.max.Y), std::max(_lhs.max.Z, _rhs.max.Z)));
+}
+
+AABB AABB::Intersection(const AABB& _lhs, const AABB& _rhs) noexcept
+{
+	return AABB(Vec3(std::max(_lhs.min.X, _rhs.min.X), std::max(_lhs.min.Y, _rhs.min.Y), std::max(_lhs.min.Z, _rhs.min.Z)),
+				Vec3(std::min(_lhs.max.X, _rhs.max.X), std::min(_lhs.max.Y, _rhs.max.Y), std::min(_lhs.max.Z, _rhs.max.Z)));
+}
+
+//Batch
+
+AABB AABB::UnionBatch(const AABB* _boxes, size_t _count) noexcept
+{
+	// Four independent accumulators per bound to break the min/max dependency chain.
+	const float inf = std::numeric_limits<float>::max();
+	float min_x[4] = { inf, inf, inf, inf };
+	float min_y[4] = { inf, inf, inf, inf };
+	float min_z[4] = { inf, inf, inf, inf };
+	float max_x[4] = { -inf, -inf, -inf, -inf };
+	float max_y[4] = { -inf, -inf, -inf, -inf };
+	float max_z[4] = { -inf, -inf, -inf, -inf };
+
+	size_t i = 0;
+	for (; i + 4 <= _count; i += 4)
+	{
+		for (size_t lane = 0; lane < 4; ++lane)
+		{
+			const AABB& box = _boxes[i + lane];
+			min_x[lane] = std::min(min_x[lane], box.min.X);
+			min_y[lane] = std::min(min_y[lane], box.min.Y);
+			min_z[lane] = std::min(min_z[lane], box.min.Z);
+			max_x[lane] = std::max(max_x[lane], box.max.X);
+			max_y[lane] = std::max(max_y[lane], box.max.Y);
+			max_z[lane] = std::max(max_z[lane], box.max.Z);
+		}
+	}
+
+	for (size_t lane = 0; i < _count; ++i, ++lane)
+	{
+		const AABB& box = _boxes[i];
+		min_x[lane] = std::min(min_x[lane], box.min.X);
+		min_y[lane] = std::min(min_y[lane], box.min.Y);
+		min_z[lane] = std::min(min_z[lane], box.min.Z);
+		max_x[lane] = std::max(max_x[lane], box.max.X);
+		max_y[lane] = std::max(max_y[lane], box.max.Y);
+		max_z[lane] = std::max(max_z[lane], box.max.Z);
+	}
+
+	return AABB(Vec3(std::min(std::min(min_x[0], min_x[1]), std::min(min_x[2], min_x[3])),
+					std::min(std::min(min_y[0], min_y[1]), std::min(min_y[2], min_y[3])),
+					std::min(std::min(min_z[0], min_z[1]), std::min(min_z[2], min_z[3]))),
+				Vec3(std::max(std::max(max_x[0], max_x[1]), std::max(max_x[2], max_x[3])),
+					std::max(std::max(max_y[0], max_y[1]), std::max(max_y[2], max_y[3])),
+					std::max(std::max(max_z[0], max_z[1]), std::max(max_z[2], max_z[3]))));
+}
+
+void AABB::TransformBatch(const AABB* _in, const Mat4* _matrices, AABB* _out, size_t _count) noexcept
+{
+	for (size_t i = 0; i < _count; ++i)
+		TransformBox(_in[i], _matrices[i], _out[i]);
+}
+
+void AABB::TransformBatch(const AABB* _in, const Mat4& _matrix, AABB* _out, size_t _count) noexcept
+{
+	// Copy so the matrix cannot alias the output array.
+	const Mat4 matrix = _matrix;
+
+	for (size_t i = 0; i < _count; ++i)
+		TransformBox(_in[i], matrix, _out[i]);
+}
+
+void AABB::TransformBatch(const AABB* _in, const Transform* _transforms, AABB* _out, size_t _count) noexcept
+{
+	for (size_t i = 0; i < _count; ++i)
+		TransformBox(_in[i], _transforms[i].ToMatrixWithScale(), _out[i]);
+}
+
+//Equality
+
+bool AABB::IsValid() const noexcept
+{
+	return min.X <= max.X && min.Y <= max.Y && min.Z <= max.Z;
+}
+
+bool AABB::Equals(const AABB& _other, float _epsilon) const noexcept
+{
+	return min.Equals(_other.min, _epsilon) && max.Equals(_other.max, _epsilon);
+}
+
+bool AABB::operator==(const AABB& _rhs) const noexcept
+{
+	return min == _rhs.min && max == _rhs.max;
+}
+
+bool AABB::operator!=(const AABB& _rhs) const noexcept
+{
+	return !(min == _rhs.min && max == _rhs.max);
+}
+
+//Accessors
+
+Vec3 AABB::GetCenter() const noexcept
+{
+	return (min + max) * 0.5f;
+}
+
+Vec3 AABB::GetExtents() const noexcept
+{
+	return (max - min) * 0.5f;
+}
+
+Vec3 AABB::GetSize() const noexcept
+{
+	return max - min;
+}
+
+float AABB::GetSurfaceArea() const noexcept
+{
+	Vec3 size = max - min;
+	return 2.f * (size.X * size.Y + size.Y * size.Z + size.Z * size.X);
+}
+
+float AABB::GetVolume() const noexcept
+{
+	Vec3 size = max - min;
+	return size.X * size.Y * size.Z;
+}
+
+//Methods
+
+bool AABB::Contains(const Vec3& _point) const noexcept
+{
+	return _point.X >= min.X && _point.X <= max.X &&
+		_point.Y >= min.Y && _point.Y <= max.Y &&
+		_point.Z >= min.Z && _point.Z <= max.Z;
+}
+
+bool AABB::Contains(const AABB& _other) const noexcept
+{
+	return _other.min.X >= min.X && _other.max.X <= max.X &&
+		_other.min.Y >= min.Y && _other.max.Y <= max.Y &&
+		_other.min.Z >= min.Z && _other.max.Z <= max.Z;
+}
+
+bool AABB::Intersects(const AABB& _other) const noexcept
+{
+	return min.X <= _other.max.X && max.X >= _other.min.X &&
+		min.Y <= _other.max.Y && max.Y >= _other.min.Y &&
+		min.Z <= _other.max.Z && max.Z >= _other.min.Z;
+}
+
+AABB& AABB::Encapsulate(const Vec3& _point) noexcept
+{
+	min.X = std::min(min.X, _point.X);
+	min.Y = std::min(min.Y, _point.Y);
+	min.Z = std::min(min.Z, _point.Z);
+
+	max.X = std::max(max.X, _point.X);
+	max.Y = std::max(max.Y, _point.Y);
+	max.Z = std::max(max.Z, _point.Z);
+
+	return *this;
+}
+
+AABB& AABB::Encapsulate(const AABB& _other) noexcept
+{
+	*this = Union(*this, _other);
+	return *this;
+}
+
+Vec3 AABB::ClosestPoint(const Vec3& _point) const noexcept
+{
+	return Vec3(Math::Clamp(_point.X, min.X, max.X),
+				Math::Clamp(_point.Y, min.Y, max.Y),
+				Math::Clamp(_point.Z, min.Z, max.Z));
+}
+
+AABB AABB::GetTransformed(const Mat4& _matrix) const noexcept
+{
+	AABB result;
+	TransformBox(*this, _matrix, result);
+	return result;
+}
+
+AABB AABB::GetTransformed(const Transform& _transform) const noexcept
+{
+	return GetTransformed(_transform.ToMatrixWithScale());
+}
+
+//Debug
+
+std::string AABB::ToString() const noexcept
+{
+	std::string str = "(min : " + min.ToString() + " ; max : " + max.ToString() + ")";
+	return str;
+}
@@ -0,0 +1,288 @@
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <Geometry/Fit.hpp>
+#include <Geometry/Plane.hpp>
+#include <Geometry/Sphere.hpp>
+#include <Geometry/Ray.hpp>
+#include <Matrix/LeastSquares.hpp>
+#include <Matrix/Decomposition.hpp>
+#include <Misc/Parallel.hpp>
+
+namespace Mathlib
+{
+	namespace Fit
+	{
+		namespace
+		{
+			/// Number of points accumulated in one problem before problems are merged, fixed so results do not depend on threads.
+			constexpr size_t BlockPoints = 4096;
+
+			/// Minimum number of blocks processed by one thread.
+			constexpr size_t MinBlockBatch = 4;
+
+			/// Points are collinear when the second spread of the scatter is below this ratio of the first one.
+			constexpr float CollinearRatio = 1e-6f;
+
+			/**
+			*	\brief Accumulate _count points in a problem of _unknowns unknowns, calling _add_rows(problem, begin, end)
+			*	on fixed size blocks optionally split across threads, then merge blocks in order.
+			*/
+			template<typename AddRows>
+			StreamingLeastSquares Accumulate(size_t _count, size_t _unknowns, bool _multithreaded, AddRows&& _add_rows)
+			{
+				const size_t block_count = (_count + BlockPoints - 1) / BlockPoints;
+				std::vector<StreamingLeastSquares> blocks(block_count, StreamingLeastSquares(_unknowns));
+
+				StreamingLeastSquares* problems = blocks.data();
+				auto process = [problems, _count, &_add_rows](size_t _begin, size_t _end)
+				{
+					for (size_t block = _begin; block < _end; ++block)
+						_add_rows(problems[block], block * BlockPoints, std::min(_count, (block + 1) * BlockPoints));
+				};
+
+				Math::ParallelFor(0, block_count, MinBlockBatch, _multithreaded, process);
+
+				StreamingLeastSquares result(_unknowns);
+				for (const StreamingLeastSquares& block : blocks)
+					result.Merge(block);
+
+				return result;
+			}
+
+			/**
+			*	\brief Accumulate rows (1, p - _points[0]) giving the centroid and scatter of _points.
+			*/
+			template<typename V, size_t N>
+			StreamingLeastSquares AccumulateScatter(const V* _points, size_t _count, bool _multithreaded)
+			{
+				const V reference = _points[0];
+
+				return Accumulate(_count, N + 1, _multithreaded, [_points, reference](StreamingLeastSquares& _problem, size_t _begin, size_t _end)
+				{
+					for (size_t i = _begin; i < _end; ++i)
+					{
+						const V offset = _points[i] - reference;
+						const float* components = offset.Data();
+
+						double row[N + 1] = { 1.0 };
+						for (size_t j = 0; j < N; ++j)
+							row[j + 1] = static_cast<double>(components[j]);
+
+						_problem.AddRow(row, 0.0);
+					}
+				});
+			}
+
+			/**
+			*	\brief Read the centroid offset and scatter matrix of points from the factor of their AccumulateScatter problem.
+			*	With r the factor of rows (1, offset), r[0] holds the sum of offsets and the lower right block of r^T r
+			*	the centered scatter.
+			*/
+			template<size_t N>
+			void ReadScatter(const StreamingLeastSquares& _problem, double (&_centroid)[N], double (&_scatter)[N][N]) noexcept
+			{
+				const double* r = _problem.GetFactors();
+				constexpr size_t width = N + 2;
+
+				for (size_t j = 0; j < N; ++j)
+					_centroid[j] = r[j + 1] / r[0];
+
+				for (size_t i = 0; i < N; ++i)
+				{
+					for (size_t j = 0; j < N; ++j)
+					{
+						double sum = 0.0;
+
+						for (size_t k = 1; k <= std::min(i, j) + 1; ++k)
+							sum += r[k * width + i + 1] * r[k * width + j + 1];
+
+						_scatter[i][j] = sum;
+					}
+				}
+			}
+
+			/**
+			*	\brief Return the eigen decomposition of a 3D point set scatter, scaled to a unit trace.
+			*/
+			SymmetricEigen ScatterEigen(const double (&_scatter)[3][3]) noexcept
+			{
+				const double trace = _scatter[0][0] + _scatter[1][1] + _scatter[2][2];
+				const double scale = trace > 0.0 ? 1.0 / trace : 0.0;
+
+				Mat3 matrix;
+				float* components = &matrix.e00;
+
+				for (size_t i = 0; i < 3; ++i)
+				{
+					for (size_t j = 0; j < 3; ++j)
+						components[i * 3 + j] = static_cast<float>(_scatter[i][j] * scale);
+				}
+
+				return Decomposition::ComputeSymmetricEigen(matrix);
+			}
+		}
+
+		bool BestPlane(const Vec3* _points, size_t _count, Plane& _result, bool _multithreaded)
+		{
+			if (_count < 3)
+				return false;
+
+			double centroid[3], scatter[3][3];
+			ReadScatter(AccumulateScatter<Vec3, 3>(_points, _count, _multithreaded), centroid, scatter);
+
+			const SymmetricEigen eigen = ScatterEigen(scatter);
+			if (!(eigen.values.Y > CollinearRatio * eigen.values.X))
+				return false;
+
+			// Normal along the least spread, last eigenvector.
+			Vec3 normal(eigen.vectors.e02, eigen.vectors.e12, eigen.vectors.e22);
+			const Vec3 center = _points[0] + Vec3(static_cast<float>(centroid[0]), static_cast<float>(centroid[1]),
+				static_cast<float>(centroid[2]));
+
+			_result = Plane(normal.Normalize(), center);
+
+			return true;
+		}
+
+		bool BestSphere(const Vec3* _points, size_t _count, Sphere& _result, bool _multithreaded)
+		{
+			if (_count < 4)
+				return false;
+
+			const Vec3 reference = _points[0];
+
+			// |d|^2 = 2 c . d + k with d = p - reference, c the center offset and k = radius^2 - |c|^2.
+			StreamingLeastSquares problem = Accumulate(_count, 4, _multithreaded,
+				[_points, reference](StreamingLeastSquares& _problem, size_t _begin, size_t _end)
+			{
+				for (size_t i = _begin; i < _end; ++i)
+				{
+					const double x = static_cast<double>(_points[i].X) - static_cast<double>(reference.X);
+					const double y = static_cast<double>(_points[i].Y) - static_cast<double>(reference.Y);
+					const double z = static_cast<double>(_points[i].Z) - static_cast<double>(reference.Z);
+
+					const double row[4] = { 1.0, 2.0 * x, 2.0 * y, 2.0 * z };
+					_problem.AddRow(row, x * x + y * y + z * z);
+				}
+			});
+
+			double solution[4];
+			if (!problem.Solve(solution))
+				return false;
+
+			const double sqr_radius = solution[0] + solution[1] * solution[1] + solution[2] * solution[2] + solution[3] * solution[3];
+			if (!(sqr_radius > 0.0))
+				return false;
+
+			const Vec3 center = reference + Vec3(static_cast<float>(solution[1]), static_cast<float>(solution[2]),
+				static_cast<float>(solution[3]));
+
+			_result = Sphere(center, static_cast<float>(std::sqrt(sqr_radius)));
+
+			return true;
+		}
+
+		bool BestLine(const Vec3* _points, size_t _count, Ray& _result, bool _multithreaded)
+		{
+			if (_count < 2)
+				return false;
+
+			double centroid[3], scatter[3][3];
+			ReadScatter(AccumulateScatter<Vec3, 3>(_points, _count, _multithreaded), centroid, scatter);
+
+			const SymmetricEigen eigen = ScatterEigen(scatter);
+			if (!(eigen.values.X > 0.f))
+				return false;
+
+			// Direction along the largest spread, first eigenvector.
+			Vec3 direction(eigen.vectors.e00, eigen.vectors.e10, eigen.vectors.e20);
+			const Vec3 origin = _points[0] + Vec3(static_cast<float>(centroid[0]), static_cast<float>(centroid[1]),
+				static_cast<float>(centroid[2]));
+
+			_result = Ray(origin, direction.Normalize());
+
+			return true;
+		}
+
+		bool BestLine(const Vec2* _points, size_t _count, Vec2& _point, Vec2& _direction, bool _multithreaded)
+		{
+			if (_count < 2)
+				return false;
+
+			double centroid[2], scatter[2][2];
+			ReadScatter(AccumulateScatter<Vec2, 2>(_points, _count, _multithreaded), centroid, scatter);
+
+			if (!(scatter[0][0] + scatter[1][1] > 0.0))
+				return false;
+
+			// Largest eigenvector of a symmetric 2x2 matrix, at half the angle of (a - c, 2b).
+			const double angle = 0.5 * std::atan2(2.0 * scatter[0][1], scatter[0][0] - scatter[1][1]);
+
+			_point = _points[0] + Vec2(static_cast<float>(centroid[0]), static_cast<float>(centroid[1]));
+			_direction = Vec2(static_cast<float>(std::cos(angle)), static_cast<float>(std::sin(angle)));
+
+			return true;
+		}
+
+		bool BestPolynomial(const Vec2* _points, size_t _count, size_t _degree, float* _coefficients, bool _multithreaded)
+		{
+			const size_t unknowns = _degree + 1;
+
+			if (_count < unknowns)
+				return false;
+
+			float min = _points[0].X;
+			float max = _points[0].X;
+
+			for (size_t i = 1; i < _count; ++i)
+			{
+				min = std::min(min, _points[i].X);
+				max = std::max(max, _points[i].X);
+			}
+
+			// t = scale * x + offset maps [min, max] to [-1, 1].
+			const double half_range = 0.5 * (static_cast<double>(max) - static_cast<double>(min));
+			const double scale = half_range > 0.0 ? 1.0 / half_range : 1.0;
+			const double offset = -0.5 * (static_cast<double>(max) + static_cast<double>(min)) * scale;
+
+			StreamingLeastSquares problem = Accumulate(_count, unknowns, _multithreaded,
+				[_points, unknowns, scale, offset](StreamingLeastSquares& _problem, size_t _begin, size_t _end)
+			{
+				std::vector<double> row(unknowns);
+
+				for (size_t i = _begin; i < _end; ++i)
+				{
+					const double t = scale * static_cast<double>(_points[i].X) + offset;
+
+					row[0] = 1.0;
+					for (size_t j = 1; j < unknowns; ++j)
+						row[j] = row[j - 1] * t;
+
+					_problem.AddRow(row.data(), static_cast<double>(_points[i].Y));
+				}
+			});
+
+			std::vector<double> solution(unknowns);
+			if (!problem.Solve(solution.data()))
+				return false;
+
+			// Back to powers of x: p = (((an * t) + an-1) * t + ...) with t = scale * x + offset.
+			std::vector<double> result(unknowns, 0.0);
+
+			for (size_t k = unknowns; k-- > 0;)
+			{
+				for (size_t j = unknowns - 1; j > 0; --j)
+					result[j] = scale * result[j - 1] + offset * result[j];
+
+				result[0] = offset * result[0] + solution[k];
+			}
+
+			for (size_t j = 0; j < unknowns; ++j)
+				_coefficients[j] = static_cast<float>(result[j]);
+
+			return true;
+		}
+	}
+}
@@ -0,0 +1,286 @@
+#include <algorithm>
+#include <cmath>
+
+#include <Geometry/Frustum.hpp>
+#include <Geometry/AABB.hpp>
+#include <Geometry/Sphere.hpp>
+#include <Matrix/Mat4.hpp>
+#include <Space/Vec3.hpp>
+#include <Space/Vec4.hpp>
+
+using namespace Mathlib;
+
+#define CLASS_NAME "Frustum"
+
+namespace
+{
+	/// Number of objects tested per visibility word.
+	constexpr size_t LaneCount = 32;
+
+	/**
+	*	\brief Frustum planes stored as component streams so every lane of a block
+	*	reads the same plane coefficient.
+	*/
+	struct PlaneStreams
+	{
+		float nx[Frustum::PlaneCount];
+		float ny[Frustum::PlaneCount];
+		float nz[Frustum::PlaneCount];
+		float abs_nx[Frustum::PlaneCount];
+		float abs_ny[Frustum::PlaneCount];
+		float abs_nz[Frustum::PlaneCount];
+		float d[Frustum::PlaneCount];
+
+		PlaneStreams(const Frustum& _frustum) noexcept
+		{
+			for (unsigned int i = 0; i < Frustum::PlaneCount; ++i)
+			{
+				const Plane& plane = _frustum.planes[i];
+				nx[i] = plane.normal.X;
+				ny[i] = plane.normal.Y;
+				nz[i] = plane.normal.Z;
+				abs_nx[i] = std::abs(plane.normal.X);
+				abs_ny[i] = std::abs(plane.normal.Y);
+				abs_nz[i] = std::abs(plane.normal.Z);
+				d[i] = plane.distance;
+			}
+		}
+	};
+
+	/**
+	*	\brief Return mask with the first _lanes bits set.
+	*/
+	inline uint32_t LaneMask(size_t _lanes) noexcept
+	{
+		return _lanes >= LaneCount ? ~uint32_t(0) : (uint32_t(1) << _lanes) - 1u;
+	}
+
+	/**
+	*	\brief Test LaneCount spheres against all planes, branch free over lanes.
+	*/
+	uint32_t CullSphereBlock(const PlaneStreams& _planes, const float* _x, const float* _y, const float* _z, const float* _radius) noexcept
+	{
+		uint32_t visible[LaneCount];
+		for (size_t lane = 0; lane < LaneCount; ++lane)
+			visible[lane] = 1u;
+
+		for (unsigned int p = 0; p < Frustum::PlaneCount; ++p)
+		{
+			const float nx = _planes.nx[p];
+			const float ny = _planes.ny[p];
+			const float nz = _planes.nz[p];
+			const float d = _planes.d[p];
+
+			for (size_t lane = 0; lane < LaneCount; ++lane)
+			{
+				float distance = nx * _x[lane] + ny * _y[lane] + nz * _z[lane] + d;
+				visible[lane] &= uint32_t(distance >= -_radius[lane]);
+			}
+		}
+
+		uint32_t mask = 0u;
+		for (size_t lane = 0; lane < LaneCount; ++lane)
+			mask |= visible[lane] << lane;
+
+		return mask;
+	}
+
+	/**
+	*	\brief Test LaneCount boxes given as center and extents against all planes, branch free over lanes.
+	*/
+	uint32_t CullBoxBlock(const PlaneStreams& _planes, const float* _cx, const float* _cy, const float* _cz,
+		const float* _ex, const float* _ey, const float* _ez) noexcept
+	{
+		uint32_t visible[LaneCount];
+		for (size_t lane = 0; lane < LaneCount; ++lane)
+			visible[lane] = 1u;
+
+		for (unsigned int p = 0; p < Frustum::PlaneCount; ++p)
+		{
+			const float nx = _planes.nx[p];
+			const float ny = _planes.ny[p];
+			const float nz = _planes.nz[p];
+			const float ax = _planes.abs_nx[p];
+			const float ay = _planes.abs_ny[p];
+			const float az = _planes.abs_nz[p];
+			const float d = _planes.d[p];
+
+			for (size_t lane = 0; lane < LaneCount; ++lane)
+			{
+				float distance = nx * _cx[lane] + ny * _cy[lane] + nz * _cz[lane] + d;
+				float projected_radius = ax * _ex[lane] + ay * _ey[lane] + az * _ez[lane];
+				visible[lane] &= uint32_t(distance >= -projected_radius);
+			}
+		}
+
+		uint32_t mask = 0u;
+		for (size_t lane = 0; lane < LaneCount; ++lane)
+			mask |= visible[lane] << lane;
+
+		return mask;
+	}
+}
+
+//Constructors
+
+Frustum::Frustum(const Mat4& _view_projection) noexcept
+{
+	const Mat4& m = _view_projection;
+
+	Vec4 row0(m.e00, m.e01, m.e02, m.e03);
+	Vec4 row1(m.e10, m.e11, m.e12, m.e13);
+	Vec4 row2(m.e20, m.e21, m.e22, m.e23);
+	Vec4 row3(m.e30, m.e31, m.e32, m.e33);
+
+	planes[int(FRUSTUM_PLANE::LEFT)] = Plane(row3 + row0).Normalize();
+	planes[int(FRUSTUM_PLANE::RIGHT)] = Plane(row3 - row0).Normalize();
+	planes[int(FRUSTUM_PLANE::BOTTOM)] = Plane(row3 + row1).Normalize();
+	planes[int(FRUSTUM_PLANE::TOP)] = Plane(row3 - row1).Normalize();
+	planes[int(FRUSTUM_PLANE::NEAR_CLIP)] = Plane(row2).Normalize();
+	planes[int(FRUSTUM_PLANE::FAR_CLIP)] = Plane(row3 - row2).Normalize();
+}
+
+//Static Methods
+
+Frustum Frustum::FromCamera(COORDINATE_SYSTEM _coordinate_system, const Vec3& _eye, const Vec3& _forward, const Vec3& _up,
+	float _fovy, float _aspect, float _near, float _far)
+{
+	Mat4 projection = Mat4::PerspectiveMatrix(_coordinate_system, _fovy, _aspect, _near, _far);
+	Mat4 view = Mat4::InvViewMatrix(_coordinate_system, _eye, _forward, _up);
+
+	return Frustum(projection * view);
+}
+
+//Accessors
+
+const Plane& Frustum::GetPlane(FRUSTUM_PLANE _plane) const noexcept
+{
+	return planes[int(_plane)];
+}
+
+//Methods
+
+bool Frustum::Contains(const Vec3& _point) const noexcept
+{
+	for (unsigned int i = 0; i < PlaneCount; ++i)
+	{
+		if (planes[i].GetSignedDistance(_point) < 0.f)
+			return false;
+	}
+
+	return true;
+}
+
+bool Frustum::Intersects(const Sphere& _sphere) const noexcept
+{
+	for (unsigned int i = 0; i < PlaneCount; ++i)
+	{
+		if (planes[i].GetSignedDistance(_sphere.center) < -_sphere.radius)
+			return false;
+	}
+
+	return true;
+}
+
+bool Frustum::Intersects(const AABB& _aabb) const noexcept
+{
+	Vec3 center = _aabb.GetCenter();
+	Vec3 extents = _aabb.GetExtents();
+
+	for (unsigned int i = 0; i < PlaneCount; ++i)
+	{
+		const Vec3& normal = planes[i].normal;
+		float projected_radius = std::abs(normal.X) * extents.X + std::abs(normal.Y) * extents.Y + std::abs(normal.Z) * extents.Z;
+
+		if (planes[i].GetSignedDistance(center) < -projected_radius)
+			return false;
+	}
+
+	return true;
+}
+
+//Batch
+
+void Frustum::CullSpheres(const Sphere* _spheres, size_t _count, uint32_t* _visibility) const noexcept
+{
+	const PlaneStreams streams(*this);
+
+	float x[LaneCount];
+	float y[LaneCount];
+	float z[LaneCount];
+	float radius[LaneCount];
+
+	for (size_t block = 0; block < _count; block += LaneCount)
+	{
+		size_t lanes = std::min(LaneCount, _count - block);
+
+		for (size_t lane = 0; lane < LaneCount; ++lane)
+		{
+			// Lanes past the end read the last sphere, their bits are masked out.
+			const Sphere& sphere = _spheres[block + std::min(lane, lanes - 1)];
+			x[lane] = sphere.center.X;
+			y[lane] = sphere.center.Y;
+			z[lane] = sphere.center.Z;
+			radius[lane] = sphere.radius;
+		}
+
+		_visibility[block / LaneCount] = CullSphereBlock(streams, x, y, z, radius) & LaneMask(lanes);
+	}
+}
+
+void Frustum::CullSpheres(const float* _x, const float* _y, const float* _z, const float* _radius, size_t _count, uint32_t* _visibility) const noexcept
+{
+	const PlaneStreams streams(*this);
+
+	size_t block = 0;
+	for (; block + LaneCount <= _count; block += LaneCount)
+		_visibility[block / LaneCount] = CullSphereBlock(streams, _x + block, _y + block, _z + block, _radius + block);
+
+	if (block < _count)
+	{
+		size_t lanes = _count - block;
+
+		float x[LaneCount] = {};
+		float y[LaneCount] = {};
+		float z[LaneCount] = {};
+		float radius[LaneCount] = {};
+
+		std::copy(_x + block, _x + _count, x);
+		std::copy(_y + block, _y + _count, y);
+		std::copy(_z + block, _z + _count, z);
+		std::copy(_radius + block, _radius + _count, radius);
+
+		_visibility[block / LaneCount] = CullSphereBlock(streams, x, y, z, radius) & LaneMask(lanes);
+	}
+}
+
+void Frustum::CullAABBs(const AABB* _boxes, size_t _count, uint32_t* _visibility) const noexcept
+{
+	const PlaneStreams streams(*this);
+
+	float cx[LaneCount];
+	float cy[LaneCount];
+	float cz[LaneCount];
+	float ex[LaneCount];
+	float ey[LaneCount];
+	float ez[LaneCount];
+
+	for (size_t block = 0; block < _count; block += LaneCount)
+	{
+		size_t lanes = std::min(LaneCount, _count - block);
+
+		for (size_t lane = 0; lane < LaneCount; ++lane)
+		{
+			// Lanes past the end read the last box, their bits are masked out.
+			const AABB& box = _boxes[block + std::min(lane, lanes - 1)];
+			cx[lane] = (box.min.X + box.max.X) * 0.5f;
+			cy[lane] = (box.min.Y + box.max.Y) * 0.5f;
+			cz[lane] = (box.min.Z + box.max.Z) * 0.5f;
+			ex[lane] = (box.max.X - box.min.X) * 0.5f;
+			ey[lane] = (box.max.Y - box.min.Y) * 0.5f;
+			ez[lane] = (box.max.Z - box.min.Z) * 0.5f;
+		}
+
+		_visibility[block / LaneCount] = CullBoxBlock(streams, cx, cy, cz, ex, ey, ez) & LaneMask(lanes);
+	}
+}
@@ -0,0 +1,273 @@
+#include <algorithm>
+#include <cmath>
+
+#include <Geometry/Intersection.hpp>
+#include <Geometry/Plane.hpp>
+#include <Geometry/Sphere.hpp>
+#include <Geometry/AABB.hpp>
+#include <Geometry/Triangle.hpp>
+
+#define CLASS_NAME "Intersection"
+
+namespace Mathlib
+{
+	namespace Intersection
+	{
+		namespace
+		{
+			/// Threshold under which a ray is considered parallel to a plane or triangle.
+			constexpr float ParallelEpsilon = 1e-8f;
+		}
+
+		bool RayPlane(const Ray& _ray, const Plane& _plane, float& _distance) noexcept
+		{
+			float denominator = Vec3::DotProduct(_plane.normal, _ray.direction);
+
+			if (std::abs(denominator) < ParallelEpsilon)
+				return false;
+
+			float distance = -_plane.GetSignedDistance(_ray.origin) / denominator;
+
+			if (distance < 0.f)
+				return false;
+
+			_distance = distance;
+			return true;
+		}
+
+		bool RaySphere(const Ray& _ray, const Sphere& _sphere, float& _distance) noexcept
+		{
+			Vec3 offset = _ray.origin - _sphere.center;
+
+			float a = Vec3::DotProduct(_ray.direction, _ray.direction);
+			float b = Vec3::DotProduct(offset, _ray.direction);
+			float c = Vec3::DotProduct(offset, offset) - _sphere.radius * _sphere.radius;
+
+			// Origin outside and ray pointing away.
+			if (c > 0.f && b > 0.f)
+				return false;
+
+			float discriminant = b * b - a * c;
+			if (discriminant < 0.f)
+				return false;
+
+			_distance = std::max((-b - std::sqrt(discriminant)) / a, 0.f);
+			return true;
+		}
+
+		bool RayAABB(const Ray& _ray, const AABB& _aabb, float& _distance) noexcept
+		{
+			float inverse_x = 1.f / _ray.direction.X;
+			float inverse_y = 1.f / _ray.direction.Y;
+			float inverse_z = 1.f / _ray.direction.Z;
+
+			float t1_x = (_aabb.min.X - _ray.origin.X) * inverse_x;
+			float t2_x = (_aabb.max.X - _ray.origin.X) * inverse_x;
+			float t1_y = (_aabb.min.Y - _ray.origin.Y) * inverse_y;
+			float t2_y = (_aabb.max.Y - _ray.origin.Y) * inverse_y;
+			float t1_z = (_aabb.min.Z - _ray.origin.Z) * inverse_z;
+			float t2_z = (_aabb.max.Z - _ray.origin.Z) * inverse_z;
+
+			float t_min = std::max(std::max(std::min(t1_x, t2_x), std::min(t1_y, t2_y)), std::max(std::min(t1_z, t2_z), 0.f));
+			float t_max = std::min(std::min(std::max(t1_x, t2_x), std::max(t1_y, t2_y)), std::max(t1_z, t2_z));
+
+			if (t_min > t_max)
+				return false;
+
+			_distance = t_min;
+			return true;
+		}
+
+		bool RayTriangle(const Ray& _ray, const Triangle& _triangle, float& _distance) noexcept
+		{
+			float u = 0.f;
+			float v = 0.f;
+			return RayTriangle(_ray, _triangle, _distance, u, v);
+		}
+
+		bool RayTriangle(const Ray& _ray, const Triangle& _triangle, float& _distance, float& _u, float& _v) noexcept
+		{
+			Vec3 edge_1 = _triangle.b - _triangle.a;
+			Vec3 edge_2 = _triangle.c - _triangle.a;
+
+			Vec3 p = Vec3::CrossProduct(_ray.direction, edge_2);
+			float determinant = Vec3::DotProduct(edge_1, p);
+
+			if (std::abs(determinant) < ParallelEpsilon)
+				return false;
+
+			float inverse_determinant = 1.f / determinant;
+
+			Vec3 s = _ray.origin - _triangle.a;
+			float u = Vec3::DotProduct(s, p) * inverse_determinant;
+			if (u < 0.f || u > 1.f)
+				return false;
+
+			Vec3 q = Vec3::CrossProduct(s, edge_1);
+			float v = Vec3::DotProduct(_ray.direction, q) * inverse_determinant;
+			if (v < 0.f || u + v > 1.f)
+				return false;
+
+			float distance = Vec3::DotProduct(edge_2, q) * inverse_determinant;
+			if (distance < 0.f)
+				return false;
+
+			_distance = distance;
+			_u = u;
+			_v = v;
+			return true;
+		}
+
+		//Packets
+
+		// Packet kernels compute every lane unconditionally and combine conditions with bitwise
+		// operations, leaving fixed size branch free loops the compiler maps to vector registers.
+
+		template<unsigned int N>
+		uint32_t RayPlane(const RayPacket<N>& _packet, const Plane& _plane, float* _distance) noexcept
+		{
+			const float nx = _plane.normal.X;
+			const float ny = _plane.normal.Y;
+			const float nz = _plane.normal.Z;
+			const float d = _plane.distance;
+
+			uint32_t mask = 0u;
+
+			for (unsigned int lane = 0; lane < N; ++lane)
+			{
+				float denominator = nx * _packet.directionX[lane] + ny * _packet.directionY[lane] + nz * _packet.directionZ[lane];
+				float numerator = nx * _packet.originX[lane] + ny * _packet.originY[lane] + nz * _packet.originZ[lane] + d;
+				float distance = -numerator / denominator;
+
+				uint32_t hit = uint32_t(std::abs(denominator) >= ParallelEpsilon) & uint32_t(distance >= 0.f) & uint32_t(distance <= _distance[lane]);
+
+				_distance[lane] = hit ? distance : _distance[lane];
+				mask |= hit << lane;
+			}
+
+			return mask;
+		}
+
+		template<unsigned int N>
+		uint32_t RaySphere(const RayPacket<N>& _packet, const Sphere& _sphere, float* _distance) noexcept
+		{
+			const float cx = _sphere.center.X;
+			const float cy = _sphere.center.Y;
+			const float cz = _sphere.center.Z;
+			const float sqr_radius = _sphere.radius * _sphere.radius;
+
+			uint32_t mask = 0u;
+
+			for (unsigned int lane = 0; lane < N; ++lane)
+			{
+				float ox = _packet.originX[lane] - cx;
+				float oy = _packet.originY[lane] - cy;
+				float oz = _packet.originZ[lane] - cz;
+				float dx = _packet.directionX[lane];
+				float dy = _packet.directionY[lane];
+				float dz = _packet.directionZ[lane];
+
+				float a = dx * dx + dy * dy + dz * dz;
+				float b = ox * dx + oy * dy + oz * dz;
+				float c = ox * ox + oy * oy + oz * oz - sqr_radius;
+				float discriminant = b * b - a * c;
+
+				float distance = std::max((-b - std::sqrt(std::max(discriminant, 0.f))) / a, 0.f);
+
+				uint32_t hit = uint32_t(discriminant >= 0.f) & uint32_t(c <= 0.f || b <= 0.f) & uint32_t(distance <= _distance[lane]);
+
+				_distance[lane] = hit ? distance : _distance[lane];
+				mask |= hit << lane;
+			}
+
+			return mask;
+		}
+
+		template<unsigned int N>
+		uint32_t RayAABB(const RayPacket<N>& _packet, const AABB& _aabb, float* _distance) noexcept
+		{
+			uint32_t mask = 0u;
+
+			for (unsigned int lane = 0; lane < N; ++lane)
+			{
+				float t1_x = (_aabb.min.X - _packet.originX[lane]) * _packet.inverseDirectionX[lane];
+				float t2_x = (_aabb.max.X - _packet.originX[lane]) * _packet.inverseDirectionX[lane];
+				float t1_y = (_aabb.min.Y - _packet.originY[lane]) * _packet.inverseDirectionY[lane];
+				float t2_y = (_aabb.max.Y - _packet.originY[lane]) * _packet.inverseDirectionY[lane];
+				float t1_z = (_aabb.min.Z - _packet.originZ[lane]) * _packet.inverseDirectionZ[lane];
+				float t2_z = (_aabb.max.Z - _packet.originZ[lane]) * _packet.inverseDirectionZ[lane];
+
+				float t_min = std::max(std::max(std::min(t1_x, t2_x), std::min(t1_y, t2_y)), std::max(std::min(t1_z, t2_z), 0.f));
+				float t_max = std::min(std::min(std::max(t1_x, t2_x), std::max(t1_y, t2_y)), std::min(std::max(t1_z, t2_z), _distance[lane]));
+
+				uint32_t hit = uint32_t(t_min <= t_max);
+
+				_distance[lane] = hit ? t_min : _distance[lane];
+				mask |= hit << lane;
+			}
+
+			return mask;
+		}
+
+		template<unsigned int N>
+		uint32_t RayTriangle(const RayPacket<N>& _packet, const Triangle& _triangle, float* _distance) noexcept
+		{
+			const float e1x = _triangle.b.X - _triangle.a.X;
+			const float e1y = _triangle.b.Y - _triangle.a.Y;
+			const float e1z = _triangle.b.Z - _triangle.a.Z;
+			const float e2x = _triangle.c.X - _triangle.a.X;
+			const float e2y = _triangle.c.Y - _triangle.a.Y;
+			const float e2z = _triangle.c.Z - _triangle.a.Z;
+
+			uint32_t mask = 0u;
+
+			for (unsigned int lane = 0; lane < N; ++lane)
+			{
+				float dx = _packet.directionX[lane];
+				float dy = _packet.directionY[lane];
+				float dz = _packet.directionZ[lane];
+
+				float px = dy * e2z - dz * e2y;
+				float py = dz * e2x - dx * e2z;
+				float pz = dx * e2y - dy * e2x;
+
+				float determinant = e1x * px + e1y * py + e1z * pz;
+				float inverse_determinant = 1.f / determinant;
+
+				float sx = _packet.originX[lane] - _triangle.a.X;
+				float sy = _packet.originY[lane] - _triangle.a.Y;
+				float sz = _packet.originZ[lane] - _triangle.a.Z;
+
+				float u = (sx * px + sy * py + sz * pz) * inverse_determinant;
+
+				float qx = sy * e1z - sz * e1y;
+				float qy = sz * e1x - sx * e1z;
+				float qz = sx * e1y - sy * e1x;
+
+				float v = (dx * qx + dy * qy + dz * qz) * inverse_determinant;
+				float distance = (e2x * qx + e2y * qy + e2z * qz) * inverse_determinant;
+
+				uint32_t hit = uint32_t(std::abs(determinant) >= ParallelEpsilon) &
+					uint32_t(u >= 0.f) & uint32_t(v >= 0.f) & uint32_t(u + v <= 1.f) &
+					uint32_t(distance >= 0.f) & uint32_t(distance <= _distance[lane]);
+
+				_distance[lane] = hit ? distance : _distance[lane];
+				mask |= hit << lane;
+			}
+
+			return mask;
+		}
+
+#define MATHLIB_INSTANTIATE_RAY_PACKET(N)																					\
+		template MATHLIBRARY_API uint32_t RayPlane<N>(const RayPacket<N>&, const Plane&, float*) noexcept;			\
+		template MATHLIBRARY_API uint32_t RaySphere<N>(const RayPacket<N>&, const Sphere&, float*) noexcept;		\
+		template MATHLIBRARY_API uint32_t RayAABB<N>(const RayPacket<N>&, const AABB&, float*) noexcept;			\
+		template MATHLIBRARY_API uint32_t RayTriangle<N>(const RayPacket<N>&, const Triangle&, float*) noexcept;
+
+		MATHLIB_INSTANTIATE_RAY_PACKET(4)
+		MATHLIB_INSTANTIATE_RAY_PACKET(8)
+		MATHLIB_INSTANTIATE_RAY_PACKET(16)
+
+#undef MATHLIB_INSTANTIATE_RAY_PACKET
+	}
+}
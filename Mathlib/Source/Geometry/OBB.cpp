@@ -0,0 +1,352 @@
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+#include <Geometry/OBB.hpp>
+#include <Geometry/AABB.hpp>
+#include <Geometry/Sphere.hpp>
+#include <Space/Quaternion.hpp>
+#include <Transform/Transform.hpp>
+#include <Misc/Math.hpp>
+
+using namespace Mathlib;
+
+#define CLASS_NAME "OBB"
+
+namespace
+{
+	/// Number of boxes tested per overlap word.
+	constexpr size_t LaneCount = 32;
+
+	/// Added to the absolute rotation terms so near parallel edges do not produce a null cross axis.
+	constexpr float ParallelEpsilon = 1e-6f;
+
+	/**
+	*	\brief Box fixed for a whole batch, axes and extents split into scalars read by every lane.
+	*/
+	struct BoxConstants
+	{
+		float center[3];
+		float axis[3][3];
+		float extents[3];
+
+		BoxConstants(const OBB& _box) noexcept
+		{
+			const float* m = _box.orientation.Data();
+
+			for (unsigned int i = 0; i < 3; ++i)
+			{
+				center[i] = _box.center.Data()[i];
+				extents[i] = _box.halfExtents.Data()[i];
+
+				// Axis i is column i of the row major orientation.
+				for (unsigned int k = 0; k < 3; ++k)
+					axis[i][k] = m[k * 3 + i];
+			}
+		}
+	};
+
+	/**
+	*	\brief Boxes of a block stored as component streams, one entry per lane.
+	*/
+	struct BoxStreams
+	{
+		float center[3][LaneCount];
+		float axis[3][3][LaneCount];
+		float extents[3][LaneCount];
+
+		void Load(size_t _lane, const OBB& _box) noexcept
+		{
+			const float* m = _box.orientation.Data();
+
+			for (unsigned int i = 0; i < 3; ++i)
+			{
+				center[i][_lane] = _box.center.Data()[i];
+				extents[i][_lane] = _box.halfExtents.Data()[i];
+
+				for (unsigned int k = 0; k < 3; ++k)
+					axis[i][k][_lane] = m[k * 3 + i];
+			}
+		}
+	};
+
+	/**
+	*	\brief Return mask with the first _lanes bits set.
+	*/
+	inline uint32_t LaneMask(size_t _lanes) noexcept
+	{
+		return _lanes >= LaneCount ? ~uint32_t(0) : (uint32_t(1) << _lanes) - 1u;
+	}
+
+	/**
+	*	\brief Separating axis test between two boxes (Ericson, Real-Time Collision Detection 4.4.1).
+	*
+	*	\param[in] _rotation rotation of the second box expressed in the first box frame, R[i][j] = Ai . Bj.
+	*	\param[in] _offset center of the second box expressed in the first box frame.
+	*	\param[in] _a first box extents.
+	*	\param[in] _b second box extents.
+	*
+	*	\return if one of the 15 axes separates the boxes, evaluated without branches.
+	*/
+	inline bool IsSeparated(const float _rotation[3][3], const float _offset[3], const float _a[3], const float _b[3]) noexcept
+	{
+		float abs_rotation[3][3];
+		for (unsigned int i = 0; i < 3; ++i)
+		{
+			for (unsigned int j = 0; j < 3; ++j)
+				abs_rotation[i][j] = std::abs(_rotation[i][j]) + ParallelEpsilon;
+		}
+
+		bool separated = false;
+
+		// First box axes.
+		for (unsigned int i = 0; i < 3; ++i)
+		{
+			float rb = _b[0] * abs_rotation[i][0] + _b[1] * abs_rotation[i][1] + _b[2] * abs_rotation[i][2];
+			separated |= std::abs(_offset[i]) > _a[i] + rb;
+		}
+
+		// Second box axes.
+		for (unsigned int j = 0; j < 3; ++j)
+		{
+			float ra = _a[0] * abs_rotation[0][j] + _a[1] * abs_rotation[1][j] + _a[2] * abs_rotation[2][j];
+			float distance = _offset[0] * _rotation[0][j] + _offset[1] * _rotation[1][j] + _offset[2] * _rotation[2][j];
+			separated |= std::abs(distance) > ra + _b[j];
+		}
+
+		// Cross products of one axis of each box.
+		for (unsigned int i = 0; i < 3; ++i)
+		{
+			const unsigned int i1 = (i + 1) % 3;
+			const unsigned int i2 = (i + 2) % 3;
+
+			for (unsigned int j = 0; j < 3; ++j)
+			{
+				const unsigned int j1 = (j + 1) % 3;
+				const unsigned int j2 = (j + 2) % 3;
+
+				float ra = _a[i1] * abs_rotation[i2][j] + _a[i2] * abs_rotation[i1][j];
+				float rb = _b[j1] * abs_rotation[i][j2] + _b[j2] * abs_rotation[i][j1];
+				float distance = _offset[i2] * _rotation[i1][j] - _offset[i1] * _rotation[i2][j];
+				separated |= std::abs(distance) > ra + rb;
+			}
+		}
+
+		return separated;
+	}
+
+	/**
+	*	\brief Test LaneCount boxes against a fixed box, branch free over lanes.
+	*/
+	uint32_t IntersectBoxBlock(const BoxConstants& _box, const BoxStreams& _streams) noexcept
+	{
+		uint32_t overlap[LaneCount];
+
+		for (size_t lane = 0; lane < LaneCount; ++lane)
+		{
+			float rotation[3][3];
+			float offset[3];
+			float extents[3];
+
+			float delta[3];
+			for (unsigned int k = 0; k < 3; ++k)
+			{
+				delta[k] = _streams.center[k][lane] - _box.center[k];
+				extents[k] = _streams.extents[k][lane];
+			}
+
+			for (unsigned int i = 0; i < 3; ++i)
+			{
+				offset[i] = delta[0] * _box.axis[i][0] + delta[1] * _box.axis[i][1] + delta[2] * _box.axis[i][2];
+
+				for (unsigned int j = 0; j < 3; ++j)
+				{
+					rotation[i][j] = _box.axis[i][0] * _streams.axis[j][0][lane] + _box.axis[i][1] * _streams.axis[j][1][lane] +
+						_box.axis[i][2] * _streams.axis[j][2][lane];
+				}
+			}
+
+			overlap[lane] = uint32_t(!IsSeparated(rotation, offset, _box.extents, extents));
+		}
+
+		uint32_t mask = 0u;
+		for (size_t lane = 0; lane < LaneCount; ++lane)
+			mask |= overlap[lane] << lane;
+
+		return mask;
+	}
+}
+
+//Constructors
+
+OBB::OBB(const Vec3& _center, const Mat3& _orientation, const Vec3& _half_extents) noexcept :
+	center{ _center }, orientation{ _orientation }, halfExtents{ _half_extents }
+{
+}
+
+OBB::OBB(const Vec3& _center, const Quat& _orientation, const Vec3& _half_extents) noexcept :
+	center{ _center }, orientation{ Mat3::RotationMatrix(_orientation) }, halfExtents{ _half_extents }
+{
+}
+
+//Static Methods
+
+OBB OBB::FromAABB(const AABB& _aabb) noexcept
+{
+	return OBB(_aabb.GetCenter(), Mat3::Identity, _aabb.GetExtents());
+}
+
+OBB OBB::FromTransform(const AABB& _local, const Transform& _transform) noexcept
+{
+	Mat3 rotation = Mat3::RotationMatrix(_transform.rotation);
+	Vec3 scale(std::abs(_transform.scale.X), std::abs(_transform.scale.Y), std::abs(_transform.scale.Z));
+
+	// Box is symmetric: a negative scale flips an axis without changing the covered volume.
+	return OBB(rotation * (_local.GetCenter() * _transform.scale) + _transform.position, rotation, _local.GetExtents() * scale);
+}
+
+//Equality
+
+bool OBB::Equals(const OBB& _other, float _epsilon) const noexcept
+{
+	return center.Equals(_other.center, _epsilon) && orientation.Equals(_other.orientation, _epsilon) &&
+		halfExtents.Equals(_other.halfExtents, _epsilon);
+}
+
+bool OBB::operator==(const OBB& _rhs) const noexcept
+{
+	return center == _rhs.center && orientation == _rhs.orientation && halfExtents == _rhs.halfExtents;
+}
+
+bool OBB::operator!=(const OBB& _rhs) const noexcept
+{
+	return !(*this == _rhs);
+}
+
+//Accessors
+
+Vec3 OBB::GetAxis(unsigned int _index) const noexcept
+{
+	const float* m = orientation.Data();
+	return Vec3(m[_index], m[3 + _index], m[6 + _index]);
+}
+
+void OBB::GetCorners(Vec3 _corners[8]) const noexcept
+{
+	Vec3 x = GetAxis(0) * halfExtents.X;
+	Vec3 y = GetAxis(1) * halfExtents.Y;
+	Vec3 z = GetAxis(2) * halfExtents.Z;
+
+	for (unsigned int i = 0; i < 8; ++i)
+		_corners[i] = center + ((i & 1) ? x : -x) + ((i & 2) ? y : -y) + ((i & 4) ? z : -z);
+}
+
+AABB OBB::GetAABB() const noexcept
+{
+	const Mat3& m = orientation;
+
+	Vec3 extents(std::abs(m.e00) * halfExtents.X + std::abs(m.e01) * halfExtents.Y + std::abs(m.e02) * halfExtents.Z,
+		std::abs(m.e10) * halfExtents.X + std::abs(m.e11) * halfExtents.Y + std::abs(m.e12) * halfExtents.Z,
+		std::abs(m.e20) * halfExtents.X + std::abs(m.e21) * halfExtents.Y + std::abs(m.e22) * halfExtents.Z);
+
+	return AABB::FromCenterExtents(center, extents);
+}
+
+float OBB::GetVolume() const noexcept
+{
+	return 8.f * halfExtents.X * halfExtents.Y * halfExtents.Z;
+}
+
+//Methods
+
+bool OBB::Contains(const Vec3& _point) const noexcept
+{
+	Vec3 offset = _point - center;
+
+	for (unsigned int i = 0; i < 3; ++i)
+	{
+		if (std::abs(Vec3::DotProduct(offset, GetAxis(i))) > halfExtents.Data()[i])
+			return false;
+	}
+
+	return true;
+}
+
+Vec3 OBB::ClosestPoint(const Vec3& _point) const noexcept
+{
+	Vec3 offset = _point - center;
+	Vec3 result = center;
+
+	for (unsigned int i = 0; i < 3; ++i)
+	{
+		const Vec3 axis = GetAxis(i);
+		const float extent = halfExtents.Data()[i];
+
+		result += axis * std::clamp(Vec3::DotProduct(offset, axis), -extent, extent);
+	}
+
+	return result;
+}
+
+bool OBB::Intersects(const OBB& _other) const noexcept
+{
+	const BoxConstants box(*this);
+	const BoxConstants other(_other);
+
+	float rotation[3][3];
+	float offset[3];
+	float delta[3];
+
+	for (unsigned int k = 0; k < 3; ++k)
+		delta[k] = other.center[k] - box.center[k];
+
+	for (unsigned int i = 0; i < 3; ++i)
+	{
+		offset[i] = delta[0] * box.axis[i][0] + delta[1] * box.axis[i][1] + delta[2] * box.axis[i][2];
+
+		for (unsigned int j = 0; j < 3; ++j)
+			rotation[i][j] = box.axis[i][0] * other.axis[j][0] + box.axis[i][1] * other.axis[j][1] + box.axis[i][2] * other.axis[j][2];
+	}
+
+	return !IsSeparated(rotation, offset, box.extents, other.extents);
+}
+
+bool OBB::Intersects(const AABB& _aabb) const noexcept
+{
+	return Intersects(FromAABB(_aabb));
+}
+
+bool OBB::Intersects(const Sphere& _sphere) const noexcept
+{
+	return Vec3::SqrDistance(_sphere.center, ClosestPoint(_sphere.center)) <= _sphere.radius * _sphere.radius;
+}
+
+//Batch
+
+void OBB::IntersectsBatch(const OBB* _boxes, size_t _count, uint32_t* _overlaps) const noexcept
+{
+	const BoxConstants box(*this);
+	BoxStreams streams;
+
+	for (size_t block = 0; block < _count; block += LaneCount)
+	{
+		size_t lanes = std::min(LaneCount, _count - block);
+
+		for (size_t lane = 0; lane < LaneCount; ++lane)
+		{
+			// Lanes past the end read the last box, their bits are masked out.
+			streams.Load(lane, _boxes[block + std::min(lane, lanes - 1)]);
+		}
+
+		_overlaps[block / LaneCount] = IntersectBoxBlock(box, streams) & LaneMask(lanes);
+	}
+}
+
+//Debug
+
+std::string OBB::ToString() const noexcept
+{
+	std::string str = "(center : " + center.ToString() + " ; axes : " + GetAxis(0).ToString() + " " + GetAxis(1).ToString() + " " +
+		GetAxis(2).ToString() + " ; half extents : " + halfExtents.ToString() + ")";
+	return str;
+}
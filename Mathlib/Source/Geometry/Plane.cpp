@@ -0,0 +1,105 @@
+#include <string>
+
+#include <Geometry/Plane.hpp>
+#include <Space/Vec4.hpp>
+#include <Misc/Math.hpp>
+#include <Misc/Callback.hpp>
+
+using namespace Mathlib;
+
+#define CLASS_NAME "Plane"
+
+//Constructors
+
+Plane::Plane(const Vec3& _normal, float _distance) noexcept :
+	normal{ _normal }, distance{ _distance }
+{
+}
+
+Plane::Plane(const Vec3& _normal, const Vec3& _point) noexcept :
+	normal{ _normal }, distance{ -Vec3::DotProduct(_normal, _point) }
+{
+}
+
+Plane::Plane(const Vec4& _equation) noexcept :
+	normal{ _equation.X, _equation.Y, _equation.Z }, distance{ _equation.W }
+{
+}
+
+//Static Methods
+
+Plane Plane::FromPoints(const Vec3& _a, const Vec3& _b, const Vec3& _c) noexcept
+{
+	Vec3 normal = Vec3::CrossProduct(_b - _a, _c - _a).Normalize();
+
+	return Plane(normal, _a);
+}
+
+//Equality
+
+bool Plane::Equals(const Plane& _other, float _epsilon) const noexcept
+{
+	return normal.Equals(_other.normal, _epsilon) && Math::Equals(distance, _other.distance, _epsilon);
+}
+
+bool Plane::operator==(const Plane& _rhs) const noexcept
+{
+	return normal == _rhs.normal && distance == _rhs.distance;
+}
+
+bool Plane::operator!=(const Plane& _rhs) const noexcept
+{
+	return !(normal == _rhs.normal && distance == _rhs.distance);
+}
+
+//Methods
+
+Plane& Plane::Normalize() noexcept
+{
+	float length = normal.Length();
+
+	if (length != 0.f)
+	{
+		normal /= length;
+		distance /= length;
+	}
+	else
+	{
+		Callback::CallErrorCallback(CLASS_NAME, "Normalize", "Division by O due to normal length being equal to 0");
+	}
+
+	return *this;
+}
+
+Plane Plane::GetNormalized() const noexcept
+{
+	Plane tmp = *this;
+	tmp.Normalize();
+
+	return tmp;
+}
+
+float Plane::GetSignedDistance(const Vec3& _point) const noexcept
+{
+	return Vec3::DotProduct(normal, _point) + distance;
+}
+
+Vec3 Plane::ClosestPoint(const Vec3& _point) const noexcept
+{
+	return _point - normal * GetSignedDistance(_point);
+}
+
+//Operator
+
+Plane Plane::operator-() const noexcept
+{
+	return Plane(-normal, -distance);
+}
+
+//Debug
+
+std::string Plane::ToString() const noexcept
+{
+	std::string str = "(normal : " + normal.ToString() + " ; distance : " + std::to_string(distance) + ")";
+	return str;
+}
@@ -0,0 +1,53 @@
+#include <string>
+
+#include <Geometry/Ray.hpp>
+
+using namespace Mathlib;
+
+#define CLASS_NAME "Ray"
+
+//Constructors
+
+Ray::Ray(const Vec3& _origin, const Vec3& _direction) noexcept :
+	origin{ _origin }, direction{ _direction }
+{
+}
+
+//Static Methods
+
+Ray Ray::FromPoints(const Vec3& _start, const Vec3& _end) noexcept
+{
+	return Ray(_start, (_end - _start).Normalize());
+}
+
+//Equality
+
+bool Ray::Equals(const Ray& _other, float _epsilon) const noexcept
+{
+	return origin.Equals(_other.origin, _epsilon) && direction.Equals(_other.direction, _epsilon);
+}
+
+bool Ray::operator==(const Ray& _rhs) const noexcept
+{
+	return origin == _rhs.origin && direction == _rhs.direction;
+}
+
+bool Ray::operator!=(const Ray& _rhs) const noexcept
+{
+	return !(origin == _rhs.origin && direction == _rhs.direction);
+}
+
+//Methods
+
+Vec3 Ray::GetPoint(float _distance) const noexcept
+{
+	return origin + direction * _distance;
+}
+
+//Debug
+
+std::string Ray::ToString() const noexcept
+{
+	std::string str = "(origin : " + origin.ToString() + " ; direction : " + direction.ToString() + ")";
+	return str;
+}
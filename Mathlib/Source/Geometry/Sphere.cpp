@@ -0,0 +1,151 @@
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+#include <Geometry/Sphere.hpp>
+#include <Geometry/AABB.hpp>
+#include <Transform/Transform.hpp>
+#include <Misc/Math.hpp>
+
+using namespace Mathlib;
+
+#define CLASS_NAME "Sphere"
+
+//Constructors
+
+Sphere::Sphere(const Vec3& _center, float _radius) noexcept :
+	center{ _center }, radius{ _radius }
+{
+}
+
+//Static Methods
+
+Sphere Sphere::FromAABB(const AABB& _aabb) noexcept
+{
+	return Sphere(_aabb.GetCenter(), _aabb.GetExtents().Length());
+}
+
+Sphere Sphere::FromPoints(const Vec3* _points, size_t _count) noexcept
+{
+	if (_count == 0)
+		return Sphere();
+
+	// Ritter: start from the most separated pair of extreme points along the axes.
+	size_t min_index[3] = { 0, 0, 0 };
+	size_t max_index[3] = { 0, 0, 0 };
+
+	for (size_t i = 1; i < _count; ++i)
+	{
+		for (unsigned int axis = 0; axis < 3; ++axis)
+		{
+			if (_points[i].Data()[axis] < _points[min_index[axis]].Data()[axis])
+				min_index[axis] = i;
+			if (_points[i].Data()[axis] > _points[max_index[axis]].Data()[axis])
+				max_index[axis] = i;
+		}
+	}
+
+	unsigned int best_axis = 0;
+	float best_distance = -1.f;
+	for (unsigned int axis = 0; axis < 3; ++axis)
+	{
+		float distance = Vec3::SqrDistance(_points[min_index[axis]], _points[max_index[axis]]);
+		if (distance > best_distance)
+		{
+			best_distance = distance;
+			best_axis = axis;
+		}
+	}
+
+	const Vec3& start = _points[min_index[best_axis]];
+	const Vec3& end = _points[max_index[best_axis]];
+
+	Sphere result((start + end) * 0.5f, Math::Sqrt(best_distance) * 0.5f);
+
+	// Grow sphere to include every outlying point.
+	for (size_t i = 0; i < _count; ++i)
+	{
+		Vec3 offset = _points[i] - result.center;
+		float sqr_distance = offset.SquaredLength();
+
+		if (sqr_distance > result.radius * result.radius)
+		{
+			float distance = std::sqrt(sqr_distance);
+			float new_radius = (result.radius + distance) * 0.5f;
+			result.center += offset * ((new_radius - result.radius) / distance);
+			result.radius = new_radius;
+		}
+	}
+
+	return result;
+}
+
+Sphere Sphere::Union(const Sphere& _lhs, const Sphere& _rhs) noexcept
+{
+	Vec3 offset = _rhs.center - _lhs.center;
+	float distance = offset.Length();
+
+	if (distance + _rhs.radius <= _lhs.radius)
+		return _lhs;
+	if (distance + _lhs.radius <= _rhs.radius)
+		return _rhs;
+
+	float radius = (distance + _lhs.radius + _rhs.radius) * 0.5f;
+
+	return Sphere(_lhs.center + offset * ((radius - _lhs.radius) / distance), radius);
+}
+
+//Equality
+
+bool Sphere::Equals(const Sphere& _other, float _epsilon) const noexcept
+{
+	return center.Equals(_other.center, _epsilon) && Math::Equals(radius, _other.radius, _epsilon);
+}
+
+bool Sphere::operator==(const Sphere& _rhs) const noexcept
+{
+	return center == _rhs.center && radius == _rhs.radius;
+}
+
+bool Sphere::operator!=(const Sphere& _rhs) const noexcept
+{
+	return !(center == _rhs.center && radius == _rhs.radius);
+}
+
+//Methods
+
+bool Sphere::Contains(const Vec3& _point) const noexcept
+{
+	return Vec3::SqrDistance(center, _point) <= radius * radius;
+}
+
+bool Sphere::Intersects(const Sphere& _other) const noexcept
+{
+	float radius_sum = radius + _other.radius;
+	return Vec3::SqrDistance(center, _other.center) <= radius_sum * radius_sum;
+}
+
+bool Sphere::Intersects(const AABB& _aabb) const noexcept
+{
+	return Vec3::SqrDistance(center, _aabb.ClosestPoint(center)) <= radius * radius;
+}
+
+AABB Sphere::GetAABB() const noexcept
+{
+	return AABB::FromCenterExtents(center, Vec3(radius));
+}
+
+Sphere Sphere::GetTransformed(const Transform& _transform) const noexcept
+{
+	float max_scale = std::max(std::max(std::abs(_transform.scale.X), std::abs(_transform.scale.Y)), std::abs(_transform.scale.Z));
+
+	return Sphere(_transform.rotation.Rotate(center * _transform.scale) + _transform.position, radius * max_scale);
+}
+
+//Debug
+
+std::string Sphere::ToString() const noexcept
+{
+	std::string str = "(center : " + center.ToString() + " ; radius : " + std::to_string(radius) + ")";
+	return str;
+}
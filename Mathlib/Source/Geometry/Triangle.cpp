@@ -0,0 +1,144 @@
+#include <string>
+
+#include <Geometry/Triangle.hpp>
+#include <Geometry/AABB.hpp>
+#include <Geometry/Plane.hpp>
+#include <Misc/Callback.hpp>
+
+using namespace Mathlib;
+
+#define CLASS_NAME "Triangle"
+
+//Constructors
+
+Triangle::Triangle(const Vec3& _a, const Vec3& _b, const Vec3& _c) noexcept :
+	a{ _a }, b{ _b }, c{ _c }
+{
+}
+
+//Equality
+
+bool Triangle::Equals(const Triangle& _other, float _epsilon) const noexcept
+{
+	return a.Equals(_other.a, _epsilon) && b.Equals(_other.b, _epsilon) && c.Equals(_other.c, _epsilon);
+}
+
+bool Triangle::operator==(const Triangle& _rhs) const noexcept
+{
+	return a == _rhs.a && b == _rhs.b && c == _rhs.c;
+}
+
+bool Triangle::operator!=(const Triangle& _rhs) const noexcept
+{
+	return !(a == _rhs.a && b == _rhs.b && c == _rhs.c);
+}
+
+//Accessors
+
+Vec3 Triangle::GetNormal() const noexcept
+{
+	return Vec3::CrossProduct(b - a, c - a).Normalize();
+}
+
+float Triangle::GetArea() const noexcept
+{
+	return Vec3::CrossProduct(b - a, c - a).Length() * 0.5f;
+}
+
+Vec3 Triangle::GetCentroid() const noexcept
+{
+	return (a + b + c) / 3.f;
+}
+
+AABB Triangle::GetAABB() const noexcept
+{
+	AABB result(a, a);
+	result.Encapsulate(b);
+	result.Encapsulate(c);
+
+	return result;
+}
+
+Plane Triangle::GetPlane() const noexcept
+{
+	return Plane::FromPoints(a, b, c);
+}
+
+//Methods
+
+Vec3 Triangle::GetBarycentric(const Vec3& _point) const noexcept
+{
+	Vec3 ab = b - a;
+	Vec3 ac = c - a;
+	Vec3 ap = _point - a;
+
+	float d00 = Vec3::DotProduct(ab, ab);
+	float d01 = Vec3::DotProduct(ab, ac);
+	float d11 = Vec3::DotProduct(ac, ac);
+	float d20 = Vec3::DotProduct(ap, ab);
+	float d21 = Vec3::DotProduct(ap, ac);
+
+	float denominator = d00 * d11 - d01 * d01;
+
+	if (denominator == 0.f)
+	{
+		Callback::CallErrorCallback(CLASS_NAME, "GetBarycentric", "Division by 0 due to degenerate triangle");
+		return Vec3(1.f, 0.f, 0.f);
+	}
+
+	float v = (d11 * d20 - d01 * d21) / denominator;
+	float w = (d00 * d21 - d01 * d20) / denominator;
+
+	return Vec3(1.f - v - w, v, w);
+}
+
+Vec3 Triangle::ClosestPoint(const Vec3& _point) const noexcept
+{
+	// Voronoi region classification (Ericson, Real-Time Collision Detection 5.1.5).
+	Vec3 ab = b - a;
+	Vec3 ac = c - a;
+	Vec3 ap = _point - a;
+
+	float d1 = Vec3::DotProduct(ab, ap);
+	float d2 = Vec3::DotProduct(ac, ap);
+	if (d1 <= 0.f && d2 <= 0.f)
+		return a;
+
+	Vec3 bp = _point - b;
+	float d3 = Vec3::DotProduct(ab, bp);
+	float d4 = Vec3::DotProduct(ac, bp);
+	if (d3 >= 0.f && d4 <= d3)
+		return b;
+
+	float vc = d1 * d4 - d3 * d2;
+	if (vc <= 0.f && d1 >= 0.f && d3 <= 0.f)
+		return a + ab * (d1 / (d1 - d3));
+
+	Vec3 cp = _point - c;
+	float d5 = Vec3::DotProduct(ab, cp);
+	float d6 = Vec3::DotProduct(ac, cp);
+	if (d6 >= 0.f && d5 <= d6)
+		return c;
+
+	float vb = d5 * d2 - d1 * d6;
+	if (vb <= 0.f && d2 >= 0.f && d6 <= 0.f)
+		return a + ac * (d2 / (d2 - d6));
+
+	float va = d3 * d6 - d5 * d4;
+	if (va <= 0.f && (d4 - d3) >= 0.f && (d5 - d6) >= 0.f)
+		return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+
+	float denominator = 1.f / (va + vb + vc);
+	float v = vb * denominator;
+	float w = vc * denominator;
+
+	return a + ab * v + ac * w;
+}
+
+//Debug
+
+std::string Triangle::ToString() const noexcept
+{
+	std::string str = "(" + a.ToString() + " ; " + b.ToString() + " ; " + c.ToString() + ")";
+	return str;
+}
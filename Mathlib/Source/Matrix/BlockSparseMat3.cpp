@@ -0,0 +1,158 @@
+#include <algorithm>
+#include <utility>
+
+#include <Matrix/BlockSparseMat3.hpp>
+#include <Misc/Callback.hpp>
+#include <Misc/Parallel.hpp>
+
+using namespace Mathlib;
+
+#define CLASS_NAME "BlockSparseMat3"
+
+namespace
+{
+	/// Minimum number of block rows processed by one thread.
+	constexpr size_t MinBatch = 1024;
+}
+
+//Constructors
+
+BlockSparseMat3::BlockSparseMat3(size_t _rows, size_t _columns, const BlockSparseEntry3* _entries, size_t _count) :
+	rows{ _rows }, columns{ _columns }, rowStarts(_rows + 1, 0)
+{
+	// Count blocks per row, then place them with a prefix sum.
+	for (size_t i = 0; i < _count; ++i)
+	{
+		if (_entries[i].row >= rows || _entries[i].column >= columns)
+		{
+			Callback::CallErrorCallback(CLASS_NAME, "BlockSparseMat3", "Block out of the matrix");
+			continue;
+		}
+
+		++rowStarts[_entries[i].row + 1];
+	}
+
+	for (size_t row = 0; row < rows; ++row)
+		rowStarts[row + 1] += rowStarts[row];
+
+	std::vector<std::pair<uint32_t, const Mat3*>> sorted(rowStarts[rows]);
+	std::vector<size_t> cursors(rowStarts.begin(), rowStarts.end() - 1);
+
+	for (size_t i = 0; i < _count; ++i)
+	{
+		if (_entries[i].row < rows && _entries[i].column < columns)
+			sorted[cursors[_entries[i].row]++] = { static_cast<uint32_t>(_entries[i].column), &_entries[i].block };
+	}
+
+	// Sort each row by column and sum duplicates.
+	columnIndices.reserve(sorted.size());
+	blocks.reserve(sorted.size());
+
+	for (size_t row = 0; row < rows; ++row)
+	{
+		auto begin = sorted.begin() + rowStarts[row];
+		auto end = sorted.begin() + rowStarts[row + 1];
+		std::stable_sort(begin, end, [](const auto& _lhs, const auto& _rhs) { return _lhs.first < _rhs.first; });
+
+		rowStarts[row] = blocks.size();
+
+		for (auto it = begin; it != end; ++it)
+		{
+			if (blocks.size() > rowStarts[row] && columnIndices.back() == it->first)
+				blocks.back() += *it->second;
+			else
+			{
+				columnIndices.push_back(it->first);
+				blocks.push_back(*it->second);
+			}
+		}
+	}
+
+	rowStarts[rows] = blocks.size();
+}
+
+//Static methods
+
+void BlockSparseMat3::Multiply(const BlockSparseMat3& _lhs, const Vec3* _vector, Vec3* _result, bool _multithreaded)
+{
+	const size_t* row_starts = _lhs.rowStarts.data();
+	const uint32_t* column_indices = _lhs.columnIndices.data();
+	const Mat3* blocks = _lhs.blocks.data();
+
+	auto process = [row_starts, column_indices, blocks, _vector, _result](size_t _begin, size_t _end)
+	{
+		for (size_t row = _begin; row < _end; ++row)
+		{
+			float x = 0.f, y = 0.f, z = 0.f;
+
+			for (size_t i = row_starts[row]; i < row_starts[row + 1]; ++i)
+			{
+				const Mat3& block = blocks[i];
+				const Vec3& vector = _vector[column_indices[i]];
+
+				x += block.e00 * vector.X + block.e01 * vector.Y + block.e02 * vector.Z;
+				y += block.e10 * vector.X + block.e11 * vector.Y + block.e12 * vector.Z;
+				z += block.e20 * vector.X + block.e21 * vector.Y + block.e22 * vector.Z;
+			}
+
+			_result[row] = Vec3(x, y, z);
+		}
+	};
+
+	Math::ParallelFor(0, _lhs.rows, MinBatch, _multithreaded, process);
+}
+
+//Accessors
+
+size_t BlockSparseMat3::GetRows() const noexcept
+{
+	return rows;
+}
+
+size_t BlockSparseMat3::GetColumns() const noexcept
+{
+	return columns;
+}
+
+size_t BlockSparseMat3::GetNonZeroCount() const noexcept
+{
+	return blocks.size();
+}
+
+const size_t* BlockSparseMat3::GetRowStarts() const noexcept
+{
+	return rowStarts.data();
+}
+
+const uint32_t* BlockSparseMat3::GetColumnIndices() const noexcept
+{
+	return columnIndices.data();
+}
+
+const Mat3* BlockSparseMat3::GetBlocks() const noexcept
+{
+	return blocks.data();
+}
+
+Mat3* BlockSparseMat3::GetBlocks() noexcept
+{
+	return blocks.data();
+}
+
+Mat3 BlockSparseMat3::Get(size_t _row, size_t _column) const noexcept
+{
+	if (_row >= rows)
+		return Mat3::Zero;
+
+	auto begin = columnIndices.begin() + rowStarts[_row];
+	auto end = columnIndices.begin() + rowStarts[_row + 1];
+	auto it = std::lower_bound(begin, end, _column);
+
+	return it != end && *it == _column ? blocks[it - columnIndices.begin()] : Mat3::Zero;
+}
+
+void BlockSparseMat3::GetDiagonal(Mat3* _result) const noexcept
+{
+	for (size_t row = 0; row < std::min(rows, columns); ++row)
+		_result[row] = Get(row, row);
+}
@@ -0,0 +1,211 @@
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <Matrix/ConjugateGradient.hpp>
+#include <Misc/Parallel.hpp>
+
+namespace Mathlib
+{
+	namespace Solver
+	{
+		namespace
+		{
+			/// Minimum number of vector components processed by one thread.
+			constexpr size_t MinBatch = 8192;
+
+			/// Number of components summed together before partial sums are added, fixed so results do not depend on threads.
+			constexpr size_t ReductionBlock = 1024;
+
+			inline double Dot(float _lhs, float _rhs) noexcept
+			{
+				return static_cast<double>(_lhs) * static_cast<double>(_rhs);
+			}
+
+			inline double Dot(double _lhs, double _rhs) noexcept
+			{
+				return _lhs * _rhs;
+			}
+
+			inline double Dot(const Vec3& _lhs, const Vec3& _rhs) noexcept
+			{
+				return Dot(_lhs.X, _rhs.X) + Dot(_lhs.Y, _rhs.Y) + Dot(_lhs.Z, _rhs.Z);
+			}
+
+			/**
+			*	\brief Return the dot product of two vectors of _count components, summed in double by fixed size blocks.
+			*/
+			template<typename V>
+			double DotProduct(const V* _lhs, const V* _rhs, size_t _count, bool _multithreaded, std::vector<double>& _partials)
+			{
+				const size_t block_count = (_count + ReductionBlock - 1) / ReductionBlock;
+				_partials.assign(block_count, 0.0);
+
+				double* partials = _partials.data();
+				Math::ParallelFor(0, block_count, MinBatch / ReductionBlock, _multithreaded, [_lhs, _rhs, _count, partials](size_t _begin, size_t _end)
+				{
+					for (size_t block = _begin; block < _end; ++block)
+					{
+						const size_t end = std::min(_count, (block + 1) * ReductionBlock);
+						double sum = 0.0;
+
+						for (size_t i = block * ReductionBlock; i < end; ++i)
+							sum += Dot(_lhs[i], _rhs[i]);
+
+						partials[block] = sum;
+					}
+				});
+
+				double result = 0.0;
+				for (double partial : _partials)
+					result += partial;
+
+				return result;
+			}
+
+			/**
+			*	\brief Preconditioned conjugate gradient on any matrix providing a static Multiply(matrix, vector, result, threads).
+			*
+			*	\param[in] _inverse_diagonal preconditioner applied as _inverse_diagonal[i] * r[i], nullptr for none.
+			*/
+			template<typename Matrix, typename V, typename D, typename S>
+			ConjugateGradientResult Solve(const Matrix& _matrix, const V* _rhs, V* _solution, const D* _inverse_diagonal,
+				const ConjugateGradientSettings& _settings)
+			{
+				const size_t count = _matrix.GetRows();
+				const bool multithreaded = _settings.multithreaded;
+
+				std::vector<V> residual(count);
+				std::vector<V> direction(count);
+				std::vector<V> product(count);
+				std::vector<V> preconditioned(_inverse_diagonal ? count : 0);
+				std::vector<double> partials;
+
+				V* r = residual.data();
+				V* p = direction.data();
+				V* ap = product.data();
+				V* z = _inverse_diagonal ? preconditioned.data() : r;
+
+				auto precondition = [r, z, _inverse_diagonal](size_t _begin, size_t _end)
+				{
+					for (size_t i = _begin; i < _end; ++i)
+						z[i] = _inverse_diagonal[i] * r[i];
+				};
+
+				ConjugateGradientResult result;
+
+				const double rhs_length = std::sqrt(DotProduct(_rhs, _rhs, count, multithreaded, partials));
+				if (rhs_length == 0.0)
+				{
+					for (size_t i = 0; i < count; ++i)
+						_solution[i] = V();
+
+					result.converged = true;
+					return result;
+				}
+
+				// r = b - A x, p = z = M^-1 r.
+				Matrix::Multiply(_matrix, _solution, ap, multithreaded);
+				Math::ParallelFor(0, count, MinBatch, multithreaded, [r, ap, _rhs](size_t _begin, size_t _end)
+				{
+					for (size_t i = _begin; i < _end; ++i)
+						r[i] = _rhs[i] - ap[i];
+				});
+
+				if (_inverse_diagonal)
+					Math::ParallelFor(0, count, MinBatch, multithreaded, precondition);
+
+				for (size_t i = 0; i < count; ++i)
+					p[i] = z[i];
+
+				double r_dot_z = DotProduct(r, z, count, multithreaded, partials);
+				result.residual = std::sqrt(DotProduct(r, r, count, multithreaded, partials)) / rhs_length;
+				result.converged = result.residual <= _settings.tolerance;
+
+				while (!result.converged && result.iterations < _settings.maxIterations)
+				{
+					Matrix::Multiply(_matrix, p, ap, multithreaded);
+
+					// Stop on breakdown, the matrix is not positive definite along p.
+					const double curvature = DotProduct(p, ap, count, multithreaded, partials);
+					if (!(curvature > 0.0))
+						break;
+
+					const S alpha = static_cast<S>(r_dot_z / curvature);
+					Math::ParallelFor(0, count, MinBatch, multithreaded, [_solution, r, p, ap, alpha](size_t _begin, size_t _end)
+					{
+						for (size_t i = _begin; i < _end; ++i)
+						{
+							_solution[i] += p[i] * alpha;
+							r[i] -= ap[i] * alpha;
+						}
+					});
+
+					++result.iterations;
+					result.residual = std::sqrt(DotProduct(r, r, count, multithreaded, partials)) / rhs_length;
+					result.converged = result.residual <= _settings.tolerance;
+
+					if (result.converged)
+						break;
+
+					if (_inverse_diagonal)
+						Math::ParallelFor(0, count, MinBatch, multithreaded, precondition);
+
+					const double next_r_dot_z = DotProduct(r, z, count, multithreaded, partials);
+					const S beta = static_cast<S>(next_r_dot_z / r_dot_z);
+					r_dot_z = next_r_dot_z;
+
+					Math::ParallelFor(0, count, MinBatch, multithreaded, [p, z, beta](size_t _begin, size_t _end)
+					{
+						for (size_t i = _begin; i < _end; ++i)
+							p[i] = z[i] + p[i] * beta;
+					});
+				}
+
+				return result;
+			}
+		}
+
+		template<typename T>
+		ConjugateGradientResult ConjugateGradient(const SparseMat<T>& _matrix, const T* _rhs, T* _solution,
+			const ConjugateGradientSettings& _settings)
+		{
+			std::vector<T> inverse_diagonal;
+
+			if (_settings.preconditioned)
+			{
+				inverse_diagonal.resize(_matrix.GetRows());
+				_matrix.GetDiagonal(inverse_diagonal.data());
+
+				for (T& value : inverse_diagonal)
+					value = value != T(0) ? T(1) / value : T(1);
+			}
+
+			return Solve<SparseMat<T>, T, T, T>(_matrix, _rhs, _solution, _settings.preconditioned ? inverse_diagonal.data() : nullptr,
+				_settings);
+		}
+
+		ConjugateGradientResult ConjugateGradient(const BlockSparseMat3& _matrix, const Vec3* _rhs, Vec3* _solution,
+			const ConjugateGradientSettings& _settings)
+		{
+			std::vector<Mat3> inverse_diagonal;
+
+			if (_settings.preconditioned)
+			{
+				inverse_diagonal.resize(_matrix.GetRows());
+				_matrix.GetDiagonal(inverse_diagonal.data());
+
+				for (Mat3& block : inverse_diagonal)
+					block = block.Determinant() != 0.f ? block.GetInverse() : Mat3::Identity;
+			}
+
+			return Solve<BlockSparseMat3, Vec3, Mat3, float>(_matrix, _rhs, _solution,
+				_settings.preconditioned ? inverse_diagonal.data() : nullptr, _settings);
+		}
+
+		template MATHLIBRARY_API ConjugateGradientResult ConjugateGradient<float>(const SparseMat<float>&, const float*, float*,
+			const ConjugateGradientSettings&);
+		template MATHLIBRARY_API ConjugateGradientResult ConjugateGradient<double>(const SparseMat<double>&, const double*, double*,
+			const ConjugateGradientSettings&);
+	}
+}
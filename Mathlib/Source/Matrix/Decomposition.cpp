@@ -0,0 +1,463 @@
+#include <algorithm>
+#include <cmath>
+
+#include <Matrix/Decomposition.hpp>
+#include <Misc/Parallel.hpp>
+
+namespace Mathlib
+{
+	namespace Decomposition
+	{
+		namespace
+		{
+			/// Number of matrices decomposed together by batches.
+			constexpr size_t LaneCount = 16;
+
+			/// Minimum number of blocks processed by one thread.
+			constexpr size_t MinBlockBatch = 64;
+
+			/// Number of Jacobi sweeps, each one zeroing every off diagonal pair once. Convergence is quadratic,
+			/// a fixed count keeps every lane of a block on the same path.
+			constexpr unsigned int JacobiSweeps = 5;
+
+			/// Keeps the rotation denominator away from 0 when a pair is already diagonal.
+			constexpr float TinyDenominator = 1e-30f;
+
+			/**
+			*	\brief Symmetric matrices and their eigenvectors stored as component streams, one entry per lane.
+			*/
+			template<size_t Lanes>
+			struct SymmetricStreams
+			{
+				/// Upper triangle: a00, a01, a02, a11, a12, a22.
+				float a[6][Lanes];
+
+				/// Eigenvectors as columns of a row major matrix.
+				float v[9][Lanes];
+
+				/// Factor applied to the input to keep squares in float range.
+				float scale[Lanes];
+			};
+
+			/**
+			*	\brief Return the upper triangle stream index of element (i, j).
+			*/
+			constexpr unsigned int SymmetricIndex(unsigned int _i, unsigned int _j) noexcept
+			{
+				return _i > _j ? SymmetricIndex(_j, _i) : (_i == 0 ? _j : (_i == 1 ? 2 + _j : 5));
+			}
+
+			template<size_t Lanes>
+			void Load(SymmetricStreams<Lanes>& _streams, size_t _lane, const Mat3& _matrix) noexcept
+			{
+				_streams.a[0][_lane] = _matrix.e00;
+				_streams.a[1][_lane] = _matrix.e01;
+				_streams.a[2][_lane] = _matrix.e02;
+				_streams.a[3][_lane] = _matrix.e11;
+				_streams.a[4][_lane] = _matrix.e12;
+				_streams.a[5][_lane] = _matrix.e22;
+			}
+
+			template<size_t Lanes>
+			void Store(const SymmetricStreams<Lanes>& _streams, size_t _lane, SymmetricEigen& _result) noexcept
+			{
+				const float inverse_scale = 1.f / _streams.scale[_lane];
+
+				_result.values = Vec3(_streams.a[0][_lane] * inverse_scale, _streams.a[3][_lane] * inverse_scale,
+					_streams.a[5][_lane] * inverse_scale);
+
+				_result.vectors = Mat3(_streams.v[0][_lane], _streams.v[1][_lane], _streams.v[2][_lane],
+					_streams.v[3][_lane], _streams.v[4][_lane], _streams.v[5][_lane],
+					_streams.v[6][_lane], _streams.v[7][_lane], _streams.v[8][_lane]);
+			}
+
+			/**
+			*	\brief Apply the Jacobi rotation zeroing element (P, Q) on every lane, R being the third index.
+			*/
+			template<size_t Lanes, unsigned int P, unsigned int Q, unsigned int R>
+			void Rotate(SymmetricStreams<Lanes>& _streams) noexcept
+			{
+				float* app = _streams.a[SymmetricIndex(P, P)];
+				float* aqq = _streams.a[SymmetricIndex(Q, Q)];
+				float* apq = _streams.a[SymmetricIndex(P, Q)];
+				float* arp = _streams.a[SymmetricIndex(R, P)];
+				float* arq = _streams.a[SymmetricIndex(R, Q)];
+
+				for (size_t lane = 0; lane < Lanes; ++lane)
+				{
+					// t = tan(angle), smallest root of t^2 + t (aqq - app) / apq - 1 = 0, 0 when apq is 0.
+					const float off = apq[lane];
+					const float tau = aqq[lane] - app[lane];
+					const float sign = tau >= 0.f ? 1.f : -1.f;
+					const float t = 2.f * off * sign / (std::abs(tau) + std::sqrt(tau * tau + 4.f * off * off) + TinyDenominator);
+					const float c = 1.f / std::sqrt(1.f + t * t);
+					const float s = t * c;
+
+					app[lane] -= t * off;
+					aqq[lane] += t * off;
+					apq[lane] = 0.f;
+
+					const float rp = arp[lane];
+					const float rq = arq[lane];
+					arp[lane] = c * rp - s * rq;
+					arq[lane] = s * rp + c * rq;
+
+					for (unsigned int k = 0; k < 3; ++k)
+					{
+						const float vp = _streams.v[k * 3 + P][lane];
+						const float vq = _streams.v[k * 3 + Q][lane];
+						_streams.v[k * 3 + P][lane] = c * vp - s * vq;
+						_streams.v[k * 3 + Q][lane] = s * vp + c * vq;
+					}
+				}
+			}
+
+			/**
+			*	\brief Swap eigenpairs I and J on lanes where value I is lower than value J.
+			*/
+			template<size_t Lanes, unsigned int I, unsigned int J>
+			void CompareExchange(SymmetricStreams<Lanes>& _streams) noexcept
+			{
+				float* value_i = _streams.a[SymmetricIndex(I, I)];
+				float* value_j = _streams.a[SymmetricIndex(J, J)];
+
+				for (size_t lane = 0; lane < Lanes; ++lane)
+				{
+					const bool swap = value_i[lane] < value_j[lane];
+
+					const float vi = value_i[lane];
+					const float vj = value_j[lane];
+					value_i[lane] = swap ? vj : vi;
+					value_j[lane] = swap ? vi : vj;
+
+					for (unsigned int k = 0; k < 3; ++k)
+					{
+						const float ci = _streams.v[k * 3 + I][lane];
+						const float cj = _streams.v[k * 3 + J][lane];
+						_streams.v[k * 3 + I][lane] = swap ? cj : ci;
+						_streams.v[k * 3 + J][lane] = swap ? ci : cj;
+					}
+				}
+			}
+
+			/**
+			*	\brief Diagonalize every lane, leaving sorted eigenvalues on the diagonal of a and eigenvectors in v.
+			*/
+			template<size_t Lanes>
+			void Diagonalize(SymmetricStreams<Lanes>& _streams) noexcept
+			{
+				for (size_t lane = 0; lane < Lanes; ++lane)
+				{
+					float max = 0.f;
+					for (unsigned int i = 0; i < 6; ++i)
+						max = std::max(max, std::abs(_streams.a[i][lane]));
+
+					const float scale = max > 0.f ? 1.f / max : 1.f;
+					_streams.scale[lane] = scale;
+
+					for (unsigned int i = 0; i < 6; ++i)
+						_streams.a[i][lane] *= scale;
+
+					for (unsigned int i = 0; i < 9; ++i)
+						_streams.v[i][lane] = (i % 4 == 0) ? 1.f : 0.f;
+				}
+
+				for (unsigned int sweep = 0; sweep < JacobiSweeps; ++sweep)
+				{
+					Rotate<Lanes, 0, 1, 2>(_streams);
+					Rotate<Lanes, 0, 2, 1>(_streams);
+					Rotate<Lanes, 1, 2, 0>(_streams);
+				}
+
+				CompareExchange<Lanes, 0, 1>(_streams);
+				CompareExchange<Lanes, 0, 2>(_streams);
+				CompareExchange<Lanes, 1, 2>(_streams);
+
+				// Flip the last eigenvector of reflections so the basis is a rotation.
+				for (size_t lane = 0; lane < Lanes; ++lane)
+				{
+					const float v0 = _streams.v[0][lane], v1 = _streams.v[1][lane], v2 = _streams.v[2][lane];
+					const float v3 = _streams.v[3][lane], v4 = _streams.v[4][lane], v5 = _streams.v[5][lane];
+					const float v6 = _streams.v[6][lane], v7 = _streams.v[7][lane], v8 = _streams.v[8][lane];
+
+					const float determinant = v0 * (v4 * v8 - v5 * v7) - v1 * (v3 * v8 - v5 * v6) + v2 * (v3 * v7 - v4 * v6);
+					const float sign = determinant < 0.f ? -1.f : 1.f;
+
+					_streams.v[2][lane] *= sign;
+					_streams.v[5][lane] *= sign;
+					_streams.v[8][lane] *= sign;
+				}
+			}
+
+			/**
+			*	\brief Matrices, their singular vectors and values stored as component streams, one entry per lane.
+			*/
+			template<size_t Lanes>
+			struct SVDStreams
+			{
+				/// Normal matrix m^T * m, eigenvectors giving v.
+				SymmetricStreams<Lanes> normal;
+
+				/// Input matrices, row major.
+				float m[9][Lanes];
+
+				/// m * v, reduced to upper triangular by the QR, singular values on its diagonal.
+				float b[9][Lanes];
+
+				/// Left singular vectors as columns of a row major matrix.
+				float u[9][Lanes];
+
+				/// Factor applied to the input to keep m^T * m in float range.
+				float scale[Lanes];
+			};
+
+			template<size_t Lanes>
+			void Load(SVDStreams<Lanes>& _streams, size_t _lane, const Mat3& _matrix) noexcept
+			{
+				const float* data = _matrix.Data();
+
+				float max = 0.f;
+				for (unsigned int i = 0; i < 9; ++i)
+					max = std::max(max, std::abs(data[i]));
+
+				const float scale = max > 0.f ? 1.f / max : 1.f;
+				_streams.scale[_lane] = scale;
+
+				for (unsigned int i = 0; i < 9; ++i)
+					_streams.m[i][_lane] = data[i] * scale;
+			}
+
+			template<size_t Lanes>
+			void Store(const SVDStreams<Lanes>& _streams, size_t _lane, SVD& _result) noexcept
+			{
+				const float (&u)[9][Lanes] = _streams.u;
+				const float (&v)[9][Lanes] = _streams.normal.v;
+
+				_result.u = Mat3(u[0][_lane], u[1][_lane], u[2][_lane],
+					u[3][_lane], u[4][_lane], u[5][_lane],
+					u[6][_lane], u[7][_lane], u[8][_lane]);
+
+				const float inverse_scale = 1.f / _streams.scale[_lane];
+
+				_result.values = Vec3(_streams.b[0][_lane] * inverse_scale, _streams.b[4][_lane] * inverse_scale,
+					_streams.b[8][_lane] * inverse_scale);
+
+				_result.v = Mat3(v[0][_lane], v[1][_lane], v[2][_lane],
+					v[3][_lane], v[4][_lane], v[5][_lane],
+					v[6][_lane], v[7][_lane], v[8][_lane]);
+			}
+
+			template<size_t Lanes>
+			void Store(const SVDStreams<Lanes>& _streams, size_t _lane, PolarDecomposition& _result) noexcept
+			{
+				const float (&u)[9][Lanes] = _streams.u;
+				const float (&v)[9][Lanes] = _streams.normal.v;
+				const float inverse_scale = 1.f / _streams.scale[_lane];
+				const float sigma[3] = { _streams.b[0][_lane] * inverse_scale, _streams.b[4][_lane] * inverse_scale,
+					_streams.b[8][_lane] * inverse_scale };
+
+				float rotation[9];
+				float stretch[9];
+
+				// rotation = u * v^T, stretch = v * diag(sigma) * v^T.
+				for (unsigned int i = 0; i < 3; ++i)
+				{
+					for (unsigned int j = 0; j < 3; ++j)
+					{
+						rotation[i * 3 + j] = 0.f;
+						stretch[i * 3 + j] = 0.f;
+
+						for (unsigned int k = 0; k < 3; ++k)
+						{
+							rotation[i * 3 + j] += u[i * 3 + k][_lane] * v[j * 3 + k][_lane];
+							stretch[i * 3 + j] += v[i * 3 + k][_lane] * sigma[k] * v[j * 3 + k][_lane];
+						}
+					}
+				}
+
+				_result.rotation = Mat3(rotation[0], rotation[1], rotation[2],
+					rotation[3], rotation[4], rotation[5],
+					rotation[6], rotation[7], rotation[8]);
+
+				_result.stretch = Mat3(stretch[0], stretch[1], stretch[2],
+					stretch[3], stretch[4], stretch[5],
+					stretch[6], stretch[7], stretch[8]);
+			}
+
+			/**
+			*	\brief Apply on every lane the Givens rotation of rows P and Q zeroing element (Q, Col) of b, accumulated in u.
+			*/
+			template<size_t Lanes, unsigned int P, unsigned int Q, unsigned int Col>
+			void Givens(SVDStreams<Lanes>& _streams) noexcept
+			{
+				for (size_t lane = 0; lane < Lanes; ++lane)
+				{
+					const float x = _streams.b[P * 3 + Col][lane];
+					const float y = _streams.b[Q * 3 + Col][lane];
+					const float sqr_length = x * x + y * y;
+
+					// Identity when both elements are null.
+					const bool valid = sqr_length > TinyDenominator;
+					const float inverse_length = 1.f / std::sqrt(valid ? sqr_length : 1.f);
+					const float c = valid ? x * inverse_length : 1.f;
+					const float s = valid ? y * inverse_length : 0.f;
+
+					for (unsigned int k = 0; k < 3; ++k)
+					{
+						const float bp = _streams.b[P * 3 + k][lane];
+						const float bq = _streams.b[Q * 3 + k][lane];
+						_streams.b[P * 3 + k][lane] = c * bp + s * bq;
+						_streams.b[Q * 3 + k][lane] = -s * bp + c * bq;
+
+						const float up = _streams.u[k * 3 + P][lane];
+						const float uq = _streams.u[k * 3 + Q][lane];
+						_streams.u[k * 3 + P][lane] = c * up + s * uq;
+						_streams.u[k * 3 + Q][lane] = -s * up + c * uq;
+					}
+				}
+			}
+
+			/**
+			*	\brief Compute the singular value decomposition of every lane.
+			*/
+			template<size_t Lanes>
+			void Decompose(SVDStreams<Lanes>& _streams) noexcept
+			{
+				// v from the eigenvectors of m^T * m, sorted by decreasing singular value.
+				for (size_t lane = 0; lane < Lanes; ++lane)
+				{
+					for (unsigned int i = 0; i < 3; ++i)
+					{
+						for (unsigned int j = i; j < 3; ++j)
+						{
+							_streams.normal.a[SymmetricIndex(i, j)][lane] = _streams.m[i][lane] * _streams.m[j][lane] +
+								_streams.m[3 + i][lane] * _streams.m[3 + j][lane] + _streams.m[6 + i][lane] * _streams.m[6 + j][lane];
+						}
+					}
+				}
+
+				Diagonalize(_streams.normal);
+
+				// b = m * v has orthogonal columns, its QR gives u and the singular values.
+				for (size_t lane = 0; lane < Lanes; ++lane)
+				{
+					for (unsigned int i = 0; i < 3; ++i)
+					{
+						for (unsigned int j = 0; j < 3; ++j)
+						{
+							_streams.b[i * 3 + j][lane] = _streams.m[i * 3][lane] * _streams.normal.v[j][lane] +
+								_streams.m[i * 3 + 1][lane] * _streams.normal.v[3 + j][lane] + _streams.m[i * 3 + 2][lane] * _streams.normal.v[6 + j][lane];
+						}
+					}
+
+					for (unsigned int i = 0; i < 9; ++i)
+						_streams.u[i][lane] = (i % 4 == 0) ? 1.f : 0.f;
+				}
+
+				Givens<Lanes, 0, 1, 0>(_streams);
+				Givens<Lanes, 0, 2, 0>(_streams);
+				Givens<Lanes, 1, 2, 1>(_streams);
+			}
+
+			/**
+			*	\brief Load up to LaneCount matrices in _streams, run _compute and store the results.
+			*/
+			template<typename Streams, typename Output, typename Compute>
+			void ComputeBlock(Streams& _streams, const Mat3* _matrices, size_t _lanes, Output* _results, Compute&& _compute) noexcept
+			{
+				// Lanes past the end repeat the last matrix, their results are dropped.
+				for (size_t lane = 0; lane < LaneCount; ++lane)
+					Load(_streams, lane, _matrices[std::min(lane, _lanes - 1)]);
+
+				_compute(_streams);
+
+				for (size_t lane = 0; lane < _lanes; ++lane)
+					Store(_streams, lane, _results[lane]);
+			}
+
+			/**
+			*	\brief Run _compute over all matrices by blocks of LaneCount, blocks optionally split across threads.
+			*/
+			template<typename Streams, typename Output, typename Compute>
+			void ComputeBatch(const Mat3* _matrices, size_t _count, Output* _results, bool _multithreaded, Compute _compute)
+			{
+				auto process = [_matrices, _count, _results, &_compute](size_t _begin, size_t _end)
+				{
+					Streams streams;
+
+					for (size_t block = _begin; block < _end; ++block)
+					{
+						const size_t first = block * LaneCount;
+						ComputeBlock(streams, _matrices + first, std::min(LaneCount, _count - first), _results + first, _compute);
+					}
+				};
+
+				const size_t block_count = (_count + LaneCount - 1) / LaneCount;
+
+				Math::ParallelFor(0, block_count, MinBlockBatch, _multithreaded, process);
+			}
+		}
+
+		SymmetricEigen ComputeSymmetricEigen(const Mat3& _matrix) noexcept
+		{
+			SymmetricStreams<1> streams;
+			Load(streams, 0, _matrix);
+			Diagonalize(streams);
+
+			SymmetricEigen result;
+			Store(streams, 0, result);
+
+			return result;
+		}
+
+		void ComputeSymmetricEigen(const Mat3& _matrix, Vec3& _values, Quat& _rotation) noexcept
+		{
+			SymmetricEigen result = ComputeSymmetricEigen(_matrix);
+
+			_values = result.values;
+			_rotation = Quat::FromMatrix(result.vectors);
+		}
+
+		void ComputeSymmetricEigenBatch(const Mat3* _matrices, size_t _count, SymmetricEigen* _results, bool _multithreaded)
+		{
+			ComputeBatch<SymmetricStreams<LaneCount>>(_matrices, _count, _results, _multithreaded,
+				[](SymmetricStreams<LaneCount>& _streams) { Diagonalize(_streams); });
+		}
+
+		SVD ComputeSVD(const Mat3& _matrix) noexcept
+		{
+			SVDStreams<1> streams;
+			Load(streams, 0, _matrix);
+			Decompose(streams);
+
+			SVD result;
+			Store(streams, 0, result);
+
+			return result;
+		}
+
+		void ComputeSVDBatch(const Mat3* _matrices, size_t _count, SVD* _results, bool _multithreaded)
+		{
+			ComputeBatch<SVDStreams<LaneCount>>(_matrices, _count, _results, _multithreaded,
+				[](SVDStreams<LaneCount>& _streams) { Decompose(_streams); });
+		}
+
+		PolarDecomposition ComputePolar(const Mat3& _matrix) noexcept
+		{
+			SVDStreams<1> streams;
+			Load(streams, 0, _matrix);
+			Decompose(streams);
+
+			PolarDecomposition result;
+			Store(streams, 0, result);
+
+			return result;
+		}
+
+		void ComputePolarBatch(const Mat3* _matrices, size_t _count, PolarDecomposition* _results, bool _multithreaded)
+		{
+			ComputeBatch<SVDStreams<LaneCount>>(_matrices, _count, _results, _multithreaded,
+				[](SVDStreams<LaneCount>& _streams) { Decompose(_streams); });
+		}
+	}
+}
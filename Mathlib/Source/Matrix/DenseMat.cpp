@@ -0,0 +1,494 @@
+#include <algorithm>
+#include <cmath>
+
+#include <Matrix/DenseMat.hpp>
+#include <Misc/Callback.hpp>
+#include <Misc/Parallel.hpp>
+
+#define CLASS_NAME "DenseMat"
+
+namespace Mathlib
+{
+	namespace
+	{
+		/// Rows of the result computed together by the micro kernel.
+		constexpr size_t KernelRows = 4;
+
+		/// Depth of a block: rows of _rhs kept in cache while a block of the result accumulates.
+		constexpr size_t BlockDepth = 256;
+
+		/// Rows of _lhs kept in cache while every column panel of _rhs goes through the micro kernel.
+		constexpr size_t BlockRows = 64;
+
+		/// Minimum number of multiply adds computed by one thread.
+		constexpr size_t MinThreadWork = size_t(1) << 18;
+
+		/**
+		*	\brief Columns of the result computed together by the micro kernel, one cache line of T.
+		*/
+		template<typename T>
+		constexpr size_t KernelColumns = 64 / sizeof(T);
+
+		/**
+		*	\brief Copy _rhs in panels of KernelColumns columns, each panel storing its rows one after the other so the
+		*	micro kernel reads it contiguously. Last panel is padded with zeros.
+		*/
+		template<typename T>
+		void PackPanels(const T* _rhs, size_t _rows, size_t _columns, T* _panels, size_t _begin, size_t _end) noexcept
+		{
+			constexpr size_t Width = KernelColumns<T>;
+
+			for (size_t panel = _begin; panel < _end; ++panel)
+			{
+				const size_t column = panel * Width;
+				const size_t width = std::min(Width, _columns - column);
+				T* destination = _panels + panel * _rows * Width;
+
+				for (size_t k = 0; k < _rows; ++k)
+				{
+					const T* source = _rhs + k * _columns + column;
+
+					for (size_t j = 0; j < width; ++j)
+						destination[k * Width + j] = source[j];
+					for (size_t j = width; j < Width; ++j)
+						destination[k * Width + j] = T(0);
+				}
+			}
+		}
+
+		/**
+		*	\brief Accumulate a _row_count x _column_count block of the result over _depth:
+		*	_result += _lhs * _panel, keeping the whole block in registers.
+		*/
+		template<typename T>
+		void MicroKernel(const T* _lhs, size_t _lhs_stride, const T* _panel, size_t _depth, T* _result, size_t _result_stride,
+			size_t _row_count, size_t _column_count) noexcept
+		{
+			constexpr size_t Width = KernelColumns<T>;
+
+			T accumulators[KernelRows][Width] = {};
+			const T* rows[KernelRows];
+
+			// Missing rows read the last valid one, their results are dropped.
+			for (size_t r = 0; r < KernelRows; ++r)
+				rows[r] = _lhs + std::min(r, _row_count - 1) * _lhs_stride;
+
+			for (size_t k = 0; k < _depth; ++k)
+			{
+				const T* panel = _panel + k * Width;
+
+				for (size_t r = 0; r < KernelRows; ++r)
+				{
+					const T lhs = rows[r][k];
+
+					for (size_t j = 0; j < Width; ++j)
+						accumulators[r][j] += lhs * panel[j];
+				}
+			}
+
+			for (size_t r = 0; r < _row_count; ++r)
+			{
+				T* result = _result + r * _result_stride;
+
+				for (size_t j = 0; j < _column_count; ++j)
+					result[j] += accumulators[r][j];
+			}
+		}
+
+		/**
+		*	\brief Compute rows [_begin, _end) of _result = _lhs * _rhs from the packed panels of _rhs.
+		*	Rows of _result must be set to 0.
+		*/
+		template<typename T>
+		void MultiplyRows(const T* _lhs, const T* _panels, T* _result, size_t _depth, size_t _columns, size_t _begin, size_t _end) noexcept
+		{
+			constexpr size_t Width = KernelColumns<T>;
+			const size_t panel_count = (_columns + Width - 1) / Width;
+
+			for (size_t block_k = 0; block_k < _depth; block_k += BlockDepth)
+			{
+				const size_t depth = std::min(BlockDepth, _depth - block_k);
+
+				for (size_t block_i = _begin; block_i < _end; block_i += BlockRows)
+				{
+					const size_t block_end = std::min(block_i + BlockRows, _end);
+
+					for (size_t panel = 0; panel < panel_count; ++panel)
+					{
+						const size_t column = panel * Width;
+						const size_t width = std::min(Width, _columns - column);
+						const T* panel_data = _panels + panel * _depth * Width + block_k * Width;
+
+						for (size_t i = block_i; i < block_end; i += KernelRows)
+						{
+							MicroKernel(_lhs + i * _depth + block_k, _depth, panel_data, depth, _result + i * _columns + column, _columns,
+								std::min(KernelRows, block_end - i), width);
+						}
+					}
+				}
+			}
+		}
+
+		/**
+		*	\brief Return the dot product of _count components, with independent partial sums the compiler can vectorize.
+		*/
+		template<typename T>
+		T Dot(const T* _lhs, const T* _rhs, size_t _count) noexcept
+		{
+			constexpr size_t Lanes = KernelColumns<T>;
+
+			T sums[Lanes] = {};
+			size_t i = 0;
+
+			for (; i + Lanes <= _count; i += Lanes)
+			{
+				for (size_t l = 0; l < Lanes; ++l)
+					sums[l] += _lhs[i + l] * _rhs[i + l];
+			}
+
+			T result = T(0);
+			for (; i < _count; ++i)
+				result += _lhs[i] * _rhs[i];
+
+			for (size_t l = 0; l < Lanes; ++l)
+				result += sums[l];
+
+			return result;
+		}
+
+		/**
+		*	\brief Return the minimum rows per thread so a thread gets at least MinThreadWork multiply adds.
+		*/
+		inline size_t GetMinRows(size_t _work_per_row) noexcept
+		{
+			return std::max<size_t>(KernelRows, MinThreadWork / std::max<size_t>(_work_per_row, 1));
+		}
+	}
+
+	//Constructors
+
+	template<typename T>
+	DenseMat<T>::DenseMat(size_t _rows, size_t _columns, T _value) :
+		rows{ _rows }, columns{ _columns }, values(_rows * _columns, _value)
+	{
+	}
+
+	template<typename T>
+	DenseMat<T>::DenseMat(size_t _rows, size_t _columns, const T* _values) :
+		rows{ _rows }, columns{ _columns }, values(_values, _values + _rows * _columns)
+	{
+	}
+
+	//Static methods
+
+	template<typename T>
+	DenseMat<T> DenseMat<T>::Identity(size_t _size)
+	{
+		DenseMat result(_size, _size);
+
+		for (size_t i = 0; i < _size; ++i)
+			result(i, i) = T(1);
+
+		return result;
+	}
+
+	template<typename T>
+	void DenseMat<T>::Multiply(const DenseMat& _lhs, const DenseMat& _rhs, DenseMat& _result, bool _multithreaded)
+	{
+		if (_lhs.columns != _rhs.rows)
+		{
+			Callback::CallErrorCallback(CLASS_NAME, "Multiply", "Left matrix columns and right matrix rows differ");
+			_result.Resize(0, 0);
+			return;
+		}
+
+		_result.Resize(_lhs.rows, _rhs.columns);
+
+		if (_result.values.empty() || _lhs.columns == 0)
+			return;
+
+		constexpr size_t Width = KernelColumns<T>;
+		const size_t depth = _lhs.columns;
+		const size_t columns = _rhs.columns;
+		const size_t panel_count = (columns + Width - 1) / Width;
+
+		std::vector<T, AlignedAllocator<T>> panels(panel_count * depth * Width);
+
+		const T* lhs = _lhs.values.data();
+		const T* rhs = _rhs.values.data();
+		T* packed = panels.data();
+		T* result = _result.values.data();
+
+		auto pack = [rhs, depth, columns, packed](size_t _begin, size_t _end)
+		{
+			PackPanels(rhs, depth, columns, packed, _begin, _end);
+		};
+
+		auto process = [lhs, packed, result, depth, columns](size_t _begin, size_t _end)
+		{
+			MultiplyRows(lhs, packed, result, depth, columns, _begin, _end);
+		};
+
+		Math::ParallelFor(0, panel_count, std::max<size_t>(1, MinThreadWork / (depth * Width)), _multithreaded, pack);
+		Math::ParallelFor(0, _lhs.rows, GetMinRows(depth * columns), _multithreaded, process);
+	}
+
+	template<typename T>
+	void DenseMat<T>::Multiply(const DenseMat& _lhs, const T* _vector, T* _result, bool _multithreaded)
+	{
+		const T* lhs = _lhs.values.data();
+		const size_t columns = _lhs.columns;
+
+		auto process = [lhs, columns, _vector, _result](size_t _begin, size_t _end)
+		{
+			for (size_t i = _begin; i < _end; ++i)
+				_result[i] = Dot(lhs + i * columns, _vector, columns);
+		};
+
+		Math::ParallelFor(0, _lhs.rows, GetMinRows(columns), _multithreaded, process);
+	}
+
+	//Accessors
+
+	template<typename T>
+	size_t DenseMat<T>::GetRows() const noexcept
+	{
+		return rows;
+	}
+
+	template<typename T>
+	size_t DenseMat<T>::GetColumns() const noexcept
+	{
+		return columns;
+	}
+
+	template<typename T>
+	const T* DenseMat<T>::Data() const noexcept
+	{
+		return values.data();
+	}
+
+	template<typename T>
+	T* DenseMat<T>::Data() noexcept
+	{
+		return values.data();
+	}
+
+	template<typename T>
+	void DenseMat<T>::Resize(size_t _rows, size_t _columns)
+	{
+		rows = _rows;
+		columns = _columns;
+		values.assign(_rows * _columns, T(0));
+	}
+
+	//Equality
+
+	template<typename T>
+	bool DenseMat<T>::IsZero() const noexcept
+	{
+		return std::all_of(values.begin(), values.end(), [](T _value) { return _value == T(0); });
+	}
+
+	template<typename T>
+	bool DenseMat<T>::IsIdentity() const noexcept
+	{
+		if (rows != columns)
+			return false;
+
+		for (size_t i = 0; i < rows; ++i)
+		{
+			for (size_t j = 0; j < columns; ++j)
+			{
+				if ((*this)(i, j) != (i == j ? T(1) : T(0)))
+					return false;
+			}
+		}
+
+		return true;
+	}
+
+	template<typename T>
+	bool DenseMat<T>::Equals(const DenseMat& _other, T _epsilon) const noexcept
+	{
+		if (rows != _other.rows || columns != _other.columns)
+			return false;
+
+		for (size_t i = 0; i < values.size(); ++i)
+		{
+			if (std::abs(values[i] - _other.values[i]) > _epsilon)
+				return false;
+		}
+
+		return true;
+	}
+
+	template<typename T>
+	bool DenseMat<T>::operator==(const DenseMat& _rhs) const noexcept
+	{
+		return rows == _rhs.rows && columns == _rhs.columns && values == _rhs.values;
+	}
+
+	template<typename T>
+	bool DenseMat<T>::operator!=(const DenseMat& _rhs) const noexcept
+	{
+		return !(*this == _rhs);
+	}
+
+	//Methods
+
+	template<typename T>
+	DenseMat<T>& DenseMat<T>::Transpose()
+	{
+		return *this = GetTranspose();
+	}
+
+	template<typename T>
+	DenseMat<T> DenseMat<T>::GetTranspose() const
+	{
+		// Tiled copy so both matrices are walked a cache line at a time.
+		constexpr size_t Tile = KernelColumns<T>;
+
+		DenseMat result(columns, rows);
+
+		for (size_t block_i = 0; block_i < rows; block_i += Tile)
+		{
+			for (size_t block_j = 0; block_j < columns; block_j += Tile)
+			{
+				const size_t end_i = std::min(block_i + Tile, rows);
+				const size_t end_j = std::min(block_j + Tile, columns);
+
+				for (size_t i = block_i; i < end_i; ++i)
+				{
+					for (size_t j = block_j; j < end_j; ++j)
+						result(j, i) = (*this)(i, j);
+				}
+			}
+		}
+
+		return result;
+	}
+
+	//Operators
+
+	template<typename T>
+	DenseMat<T> DenseMat<T>::operator-() const
+	{
+		DenseMat result = *this;
+
+		for (T& value : result.values)
+			value = -value;
+
+		return result;
+	}
+
+	template<typename T>
+	DenseMat<T> DenseMat<T>::operator+(const DenseMat& _rhs) const
+	{
+		DenseMat result = *this;
+		return result += _rhs;
+	}
+
+	template<typename T>
+	DenseMat<T> DenseMat<T>::operator-(const DenseMat& _rhs) const
+	{
+		DenseMat result = *this;
+		return result -= _rhs;
+	}
+
+	template<typename T>
+	DenseMat<T>& DenseMat<T>::operator+=(const DenseMat& _rhs)
+	{
+		if (rows != _rhs.rows || columns != _rhs.columns)
+		{
+			Callback::CallErrorCallback(CLASS_NAME, "operator+", "Matrices sizes differ");
+			return *this;
+		}
+
+		for (size_t i = 0; i < values.size(); ++i)
+			values[i] += _rhs.values[i];
+
+		return *this;
+	}
+
+	template<typename T>
+	DenseMat<T>& DenseMat<T>::operator-=(const DenseMat& _rhs)
+	{
+		if (rows != _rhs.rows || columns != _rhs.columns)
+		{
+			Callback::CallErrorCallback(CLASS_NAME, "operator-", "Matrices sizes differ");
+			return *this;
+		}
+
+		for (size_t i = 0; i < values.size(); ++i)
+			values[i] -= _rhs.values[i];
+
+		return *this;
+	}
+
+	template<typename T>
+	DenseMat<T> DenseMat<T>::operator*(T _scale) const
+	{
+		DenseMat result = *this;
+		return result *= _scale;
+	}
+
+	template<typename T>
+	DenseMat<T>& DenseMat<T>::operator*=(T _scale) noexcept
+	{
+		for (T& value : values)
+			value *= _scale;
+
+		return *this;
+	}
+
+	template<typename T>
+	DenseMat<T> DenseMat<T>::operator/(T _scale) const
+	{
+		DenseMat result = *this;
+		return result /= _scale;
+	}
+
+	template<typename T>
+	DenseMat<T>& DenseMat<T>::operator/=(T _scale)
+	{
+		if (_scale == T(0))
+			Callback::CallErrorCallback(CLASS_NAME, "operator/", "Division by 0");
+
+		for (T& value : values)
+			value /= _scale;
+
+		return *this;
+	}
+
+	template<typename T>
+	DenseMat<T> DenseMat<T>::operator*(const DenseMat& _rhs) const
+	{
+		DenseMat result;
+		Multiply(*this, _rhs, result);
+
+		return result;
+	}
+
+	//Debug
+
+	template<typename T>
+	std::string DenseMat<T>::ToString() const
+	{
+		std::string result;
+
+		for (size_t i = 0; i < rows; ++i)
+		{
+			for (size_t j = 0; j < columns; ++j)
+				result += (j == 0 ? "" : ", ") + std::to_string((*this)(i, j));
+
+			if (i + 1 < rows)
+				result += "\n";
+		}
+
+		return result;
+	}
+
+	template struct MATHLIBRARY_API DenseMat<float>;
+	template struct MATHLIBRARY_API DenseMat<double>;
+}
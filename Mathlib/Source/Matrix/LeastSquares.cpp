@@ -0,0 +1,336 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <Matrix/LeastSquares.hpp>
+#include <Misc/Callback.hpp>
+
+#define CLASS_NAME "StreamingLeastSquares"
+
+namespace Mathlib
+{
+	namespace
+	{
+		/**
+		*	\brief Apply reflector _k, I - beta * v * v^T with v = (_head, column _k of _factors below the diagonal),
+		*	to rows _k and below of _target, columns _first and after. Rows are swept one after the other.
+		*
+		*	\param[in] _factors factorized matrix, _columns columns, reflector vectors stored below the diagonal.
+		*	\param[in,out] _target matrix of _rows rows and _target_columns columns.
+		*	\param[out] _w scratch of _target_columns components.
+		*/
+		template<typename T>
+		void Reflect(const T* _factors, size_t _rows, size_t _columns, size_t _k, T _head, T _beta,
+			T* _target, size_t _target_columns, size_t _first, T* _w) noexcept
+		{
+			// w = beta * v^T * target.
+			const T* pivot_row = _target + _k * _target_columns;
+			for (size_t j = _first; j < _target_columns; ++j)
+				_w[j] = _head * pivot_row[j];
+
+			for (size_t i = _k + 1; i < _rows; ++i)
+			{
+				const T v = _factors[i * _columns + _k];
+				const T* row = _target + i * _target_columns;
+
+				for (size_t j = _first; j < _target_columns; ++j)
+					_w[j] += v * row[j];
+			}
+
+			for (size_t j = _first; j < _target_columns; ++j)
+				_w[j] *= _beta;
+
+			// target -= v * w.
+			T* row = _target + _k * _target_columns;
+			for (size_t j = _first; j < _target_columns; ++j)
+				row[j] -= _head * _w[j];
+
+			for (size_t i = _k + 1; i < _rows; ++i)
+			{
+				const T v = _factors[i * _columns + _k];
+				row = _target + i * _target_columns;
+
+				for (size_t j = _first; j < _target_columns; ++j)
+					row[j] -= v * _w[j];
+			}
+		}
+
+		/**
+		*	\brief Householder QR factorization in place: r in the upper triangle of _matrix, reflector vectors
+		*	below the diagonal with their first component in _heads.
+		*/
+		template<typename T>
+		void Factorize(DenseMat<T>& _matrix, std::vector<T>& _heads, std::vector<T>& _betas, std::vector<T>& _w)
+		{
+			const size_t rows = _matrix.GetRows();
+			const size_t columns = _matrix.GetColumns();
+			T* a = _matrix.Data();
+
+			_heads.assign(columns, T(0));
+			_betas.assign(columns, T(0));
+			_w.assign(columns, T(0));
+
+			for (size_t k = 0; k < columns; ++k)
+			{
+				// Column length scaled by its largest component to avoid overflow.
+				T scale = T(0);
+				for (size_t i = k; i < rows; ++i)
+					scale = std::max(scale, std::abs(a[i * columns + k]));
+
+				// Null column, identity reflector.
+				if (scale == T(0))
+					continue;
+
+				T sqr_length = T(0);
+				for (size_t i = k; i < rows; ++i)
+				{
+					const T x = a[i * columns + k] / scale;
+					sqr_length += x * x;
+				}
+
+				const T length = scale * std::sqrt(sqr_length);
+				const T diagonal = a[k * columns + k];
+
+				// Reflect onto -sign(diagonal) * length to avoid cancellation, v^T v = 2 * length * (length + |diagonal|).
+				const T alpha = diagonal > T(0) ? -length : length;
+				_heads[k] = diagonal - alpha;
+				_betas[k] = T(1) / (length * (length + std::abs(diagonal)));
+				a[k * columns + k] = alpha;
+
+				Reflect(a, rows, columns, k, _heads[k], _betas[k], a, columns, k + 1, _w.data());
+			}
+		}
+
+		/**
+		*	\brief Return whether every diagonal element of the upper triangular _r is above _tolerance times the largest one.
+		*/
+		template<typename T>
+		bool IsFullRank(const T* _r, size_t _size, size_t _stride, T _tolerance) noexcept
+		{
+			T max = T(0);
+			for (size_t k = 0; k < _size; ++k)
+				max = std::max(max, std::abs(_r[k * _stride + k]));
+
+			for (size_t k = 0; k < _size; ++k)
+			{
+				if (!(std::abs(_r[k * _stride + k]) > _tolerance * max))
+					return false;
+			}
+
+			return true;
+		}
+
+		/**
+		*	\brief Solve the upper triangular system _r * _result = _rhs, _rhs read with _rhs_stride.
+		*/
+		template<typename T>
+		void BackSubstitute(const T* _r, size_t _size, size_t _stride, const T* _rhs, size_t _rhs_stride, T* _result) noexcept
+		{
+			for (size_t k = _size; k-- > 0;)
+			{
+				T sum = _rhs[k * _rhs_stride];
+
+				for (size_t j = k + 1; j < _size; ++j)
+					sum -= _r[k * _stride + j] * _result[j];
+
+				_result[k] = sum / _r[k * _stride + k];
+			}
+		}
+	}
+
+	namespace Decomposition
+	{
+		template<typename T>
+		QRDecomposition<T> ComputeQR(const DenseMat<T>& _matrix)
+		{
+			const size_t rows = _matrix.GetRows();
+			const size_t columns = _matrix.GetColumns();
+
+			QRDecomposition<T> result;
+
+			if (rows < columns)
+			{
+				Callback::CallErrorCallback("Decomposition", "ComputeQR", "Matrix has less rows than columns");
+				return result;
+			}
+
+			DenseMat<T> factors(_matrix);
+			std::vector<T> heads, betas, w;
+			Factorize(factors, heads, betas, w);
+
+			// q = H0 * H1 * ... applied to the first columns of identity, last reflector first.
+			result.q = DenseMat<T>(rows, columns);
+			for (size_t k = 0; k < columns; ++k)
+				result.q(k, k) = T(1);
+
+			for (size_t k = columns; k-- > 0;)
+				Reflect(factors.Data(), rows, columns, k, heads[k], betas[k], result.q.Data(), columns, k, w.data());
+
+			result.r = DenseMat<T>(columns, columns);
+			for (size_t i = 0; i < columns; ++i)
+			{
+				for (size_t j = i; j < columns; ++j)
+					result.r(i, j) = factors(i, j);
+			}
+
+			return result;
+		}
+
+		template MATHLIBRARY_API QRDecomposition<float> ComputeQR<float>(const DenseMat<float>&);
+		template MATHLIBRARY_API QRDecomposition<double> ComputeQR<double>(const DenseMat<double>&);
+	}
+
+	namespace Solver
+	{
+		template<typename T>
+		bool SolveLeastSquares(const DenseMat<T>& _matrix, const T* _rhs, T* _result)
+		{
+			const size_t rows = _matrix.GetRows();
+			const size_t columns = _matrix.GetColumns();
+
+			std::fill(_result, _result + columns, T(0));
+
+			if (rows < columns)
+				return false;
+
+			DenseMat<T> factors(_matrix);
+			std::vector<T> heads, betas, w;
+			Factorize(factors, heads, betas, w);
+
+			// rhs = q^T * rhs.
+			std::vector<T> rhs(_rhs, _rhs + rows);
+			for (size_t k = 0; k < columns; ++k)
+				Reflect(factors.Data(), rows, columns, k, heads[k], betas[k], rhs.data(), 1, 0, w.data());
+
+			const T tolerance = std::numeric_limits<T>::epsilon() * static_cast<T>(rows);
+			if (!IsFullRank(factors.Data(), columns, columns, tolerance))
+				return false;
+
+			BackSubstitute(factors.Data(), columns, columns, rhs.data(), 1, _result);
+
+			return true;
+		}
+
+		template MATHLIBRARY_API bool SolveLeastSquares<float>(const DenseMat<float>&, const float*, float*);
+		template MATHLIBRARY_API bool SolveLeastSquares<double>(const DenseMat<double>&, const double*, double*);
+	}
+
+	//Constructors
+
+	StreamingLeastSquares::StreamingLeastSquares(size_t _unknowns) :
+		unknowns{ _unknowns }, factors(_unknowns * (_unknowns + 1), 0.0), scratch(_unknowns + 1, 0.0)
+	{
+	}
+
+	//Accessors
+
+	size_t StreamingLeastSquares::GetUnknownCount() const noexcept
+	{
+		return unknowns;
+	}
+
+	size_t StreamingLeastSquares::GetRowCount() const noexcept
+	{
+		return rowCount;
+	}
+
+	double StreamingLeastSquares::GetSquaredResidual() const noexcept
+	{
+		return squaredResidual;
+	}
+
+	const double* StreamingLeastSquares::GetFactors() const noexcept
+	{
+		return factors.data();
+	}
+
+	//Methods
+
+	void StreamingLeastSquares::AddRow(const double* _row, double _rhs, double _weight) noexcept
+	{
+		const size_t width = unknowns + 1;
+		const double scale = std::sqrt(_weight);
+		double* x = scratch.data();
+
+		for (size_t j = 0; j < unknowns; ++j)
+			x[j] = _row[j] * scale;
+		x[unknowns] = _rhs * scale;
+
+		// Zero the row against the diagonal of r, one Givens rotation per non zero component.
+		for (size_t k = 0; k < unknowns; ++k)
+		{
+			const double b = x[k];
+			if (b == 0.0)
+				continue;
+
+			double* r = factors.data() + k * width;
+			const double a = r[k];
+			const double length = std::sqrt(a * a + b * b);
+			const double c = a / length;
+			const double s = b / length;
+
+			r[k] = length;
+
+			for (size_t j = k + 1; j < width; ++j)
+			{
+				const double rj = r[j];
+				const double xj = x[j];
+				r[j] = c * rj + s * xj;
+				x[j] = c * xj - s * rj;
+			}
+		}
+
+		// What is left of the right hand side is out of reach of the unknowns.
+		squaredResidual += x[unknowns] * x[unknowns];
+		++rowCount;
+	}
+
+	void StreamingLeastSquares::Merge(const StreamingLeastSquares& _other) noexcept
+	{
+		if (_other.unknowns != unknowns)
+		{
+			Callback::CallErrorCallback(CLASS_NAME, "Merge", "Numbers of unknowns differ");
+			return;
+		}
+
+		if (&_other == this)
+		{
+			// Same rows twice: r scales by sqrt(2), the residual doubles.
+			for (double& value : factors)
+				value *= std::sqrt(2.0);
+
+			squaredResidual *= 2.0;
+			rowCount *= 2;
+			return;
+		}
+
+		const size_t row_count = rowCount + _other.rowCount;
+		const size_t width = unknowns + 1;
+
+		// The rows of the other factor have the same normal equations as the rows it was built from.
+		for (size_t k = 0; k < unknowns; ++k)
+			AddRow(_other.factors.data() + k * width, _other.factors[k * width + unknowns]);
+
+		squaredResidual += _other.squaredResidual;
+		rowCount = row_count;
+	}
+
+	void StreamingLeastSquares::Clear() noexcept
+	{
+		std::fill(factors.begin(), factors.end(), 0.0);
+		squaredResidual = 0.0;
+		rowCount = 0;
+	}
+
+	bool StreamingLeastSquares::Solve(double* _result, double _tolerance) const noexcept
+	{
+		std::fill(_result, _result + unknowns, 0.0);
+
+		if (!IsFullRank(factors.data(), unknowns, unknowns + 1, _tolerance))
+			return false;
+
+		BackSubstitute(factors.data(), unknowns, unknowns + 1, factors.data() + unknowns, unknowns + 1, _result);
+
+		return true;
+	}
+}
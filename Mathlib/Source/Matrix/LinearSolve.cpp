@@ -0,0 +1,390 @@
+#include <algorithm>
+#include <cmath>
+
+#include <Matrix/LinearSolve.hpp>
+#include <Misc/Parallel.hpp>
+
+namespace Mathlib
+{
+	namespace Solver
+	{
+		namespace
+		{
+			/// Number of systems solved together by batches.
+			constexpr size_t LaneCount = 16;
+
+			/// Minimum number of blocks processed by one thread.
+			constexpr size_t MinBlockBatch = 64;
+
+			/// A pivot smaller than this times the largest matrix component makes the system singular.
+			constexpr float SingularThreshold = 1e-6f;
+
+			/**
+			*	\brief Linear systems stored as component streams, one system per lane.
+			*/
+			template<size_t N, size_t Lanes>
+			struct SystemStreams
+			{
+				/// Matrix components, factorized in place.
+				float a[N][N][Lanes];
+
+				/// Right hand side, then solution.
+				float b[N][Lanes];
+
+				/// Largest magnitude of the matrix components, to detect singular pivots.
+				float scale[Lanes];
+
+				/// 1 when the system is solvable, 0 otherwise.
+				float valid[Lanes];
+			};
+
+			/**
+			*	\brief Load system _lane from the row major _matrix and _rhs components.
+			*/
+			template<size_t N, size_t Lanes>
+			void Load(SystemStreams<N, Lanes>& _streams, size_t _lane, const float* _matrix, const float* _rhs) noexcept
+			{
+				float scale = 0.f;
+
+				for (size_t i = 0; i < N; ++i)
+				{
+					for (size_t j = 0; j < N; ++j)
+					{
+						_streams.a[i][j][_lane] = _matrix[i * N + j];
+						scale = std::max(scale, std::abs(_matrix[i * N + j]));
+					}
+
+					_streams.b[i][_lane] = _rhs[i];
+				}
+
+				_streams.scale[_lane] = scale;
+				_streams.valid[_lane] = scale > 0.f ? 1.f : 0.f;
+			}
+
+			/**
+			*	\brief Store the solution of system _lane, 0 when it is not solvable.
+			*/
+			template<size_t N, size_t Lanes>
+			bool Store(const SystemStreams<N, Lanes>& _streams, size_t _lane, float* _result) noexcept
+			{
+				const bool valid = _streams.valid[_lane] != 0.f;
+
+				for (size_t i = 0; i < N; ++i)
+					_result[i] = valid ? _streams.b[i][_lane] : 0.f;
+
+				return valid;
+			}
+
+			/**
+			*	\brief Gaussian elimination with partial pivoting on every lane, then back substitution.
+			*	Row swaps are done with selects so every lane follows the same path.
+			*/
+			template<size_t N, size_t Lanes>
+			void EliminateLU(SystemStreams<N, Lanes>& _streams) noexcept
+			{
+				auto& a = _streams.a;
+				auto& b = _streams.b;
+
+				for (size_t k = 0; k < N; ++k)
+				{
+					size_t pivot[Lanes];
+					float largest[Lanes];
+
+					for (size_t lane = 0; lane < Lanes; ++lane)
+					{
+						pivot[lane] = k;
+						largest[lane] = std::abs(a[k][k][lane]);
+					}
+
+					for (size_t i = k + 1; i < N; ++i)
+					{
+						for (size_t lane = 0; lane < Lanes; ++lane)
+						{
+							const float magnitude = std::abs(a[i][k][lane]);
+							const bool larger = magnitude > largest[lane];
+
+							largest[lane] = larger ? magnitude : largest[lane];
+							pivot[lane] = larger ? i : pivot[lane];
+						}
+					}
+
+					// Columns before k are already eliminated, only the rest of the rows are swapped.
+					for (size_t i = k + 1; i < N; ++i)
+					{
+						for (size_t lane = 0; lane < Lanes; ++lane)
+						{
+							const bool swap = pivot[lane] == i;
+
+							for (size_t j = k; j < N; ++j)
+							{
+								const float top = a[k][j][lane];
+								a[k][j][lane] = swap ? a[i][j][lane] : top;
+								a[i][j][lane] = swap ? top : a[i][j][lane];
+							}
+
+							const float top = b[k][lane];
+							b[k][lane] = swap ? b[i][lane] : top;
+							b[i][lane] = swap ? top : b[i][lane];
+						}
+					}
+
+					float inverse[Lanes];
+					for (size_t lane = 0; lane < Lanes; ++lane)
+					{
+						const bool singular = largest[lane] <= SingularThreshold * _streams.scale[lane];
+						_streams.valid[lane] = singular ? 0.f : _streams.valid[lane];
+						inverse[lane] = singular ? 0.f : 1.f / a[k][k][lane];
+					}
+
+					for (size_t i = k + 1; i < N; ++i)
+					{
+						for (size_t lane = 0; lane < Lanes; ++lane)
+						{
+							const float factor = a[i][k][lane] * inverse[lane];
+
+							for (size_t j = k + 1; j < N; ++j)
+								a[i][j][lane] -= factor * a[k][j][lane];
+
+							b[i][lane] -= factor * b[k][lane];
+						}
+					}
+
+					for (size_t lane = 0; lane < Lanes; ++lane)
+						a[k][k][lane] = inverse[lane];
+				}
+
+				// Back substitution, diagonal holds the inverse pivots.
+				for (size_t i = N; i-- > 0;)
+				{
+					for (size_t lane = 0; lane < Lanes; ++lane)
+					{
+						float sum = b[i][lane];
+
+						for (size_t j = i + 1; j < N; ++j)
+							sum -= a[i][j][lane] * b[j][lane];
+
+						b[i][lane] = sum * a[i][i][lane];
+					}
+				}
+			}
+
+			/**
+			*	\brief Cholesky factorization L * L^T of the lower triangle on every lane, then forward and back substitution.
+			*/
+			template<size_t N, size_t Lanes>
+			void EliminateCholesky(SystemStreams<N, Lanes>& _streams) noexcept
+			{
+				auto& a = _streams.a;
+				auto& b = _streams.b;
+
+				// Lower triangle is replaced by L, diagonal by the inverse of L diagonal.
+				for (size_t j = 0; j < N; ++j)
+				{
+					for (size_t lane = 0; lane < Lanes; ++lane)
+					{
+						float diagonal = a[j][j][lane];
+
+						for (size_t k = 0; k < j; ++k)
+							diagonal -= a[j][k][lane] * a[j][k][lane];
+
+						const bool positive = diagonal > SingularThreshold * _streams.scale[lane];
+						_streams.valid[lane] = positive ? _streams.valid[lane] : 0.f;
+
+						const float inverse = positive ? 1.f / std::sqrt(diagonal) : 0.f;
+						a[j][j][lane] = inverse;
+
+						for (size_t i = j + 1; i < N; ++i)
+						{
+							float value = a[i][j][lane];
+
+							for (size_t k = 0; k < j; ++k)
+								value -= a[i][k][lane] * a[j][k][lane];
+
+							a[i][j][lane] = value * inverse;
+						}
+					}
+				}
+
+				// L * y = b.
+				for (size_t i = 0; i < N; ++i)
+				{
+					for (size_t lane = 0; lane < Lanes; ++lane)
+					{
+						float sum = b[i][lane];
+
+						for (size_t k = 0; k < i; ++k)
+							sum -= a[i][k][lane] * b[k][lane];
+
+						b[i][lane] = sum * a[i][i][lane];
+					}
+				}
+
+				// L^T * x = y.
+				for (size_t i = N; i-- > 0;)
+				{
+					for (size_t lane = 0; lane < Lanes; ++lane)
+					{
+						float sum = b[i][lane];
+
+						for (size_t k = i + 1; k < N; ++k)
+							sum -= a[k][i][lane] * b[k][lane];
+
+						b[i][lane] = sum * a[i][i][lane];
+					}
+				}
+			}
+
+			/**
+			*	\brief Solve one system of N unknowns with _compute, on a single lane.
+			*/
+			template<size_t N, typename Compute>
+			bool SolveSingle(const float* _matrix, const float* _rhs, float* _result, Compute&& _compute) noexcept
+			{
+				SystemStreams<N, 1> streams;
+				Load(streams, 0, _matrix, _rhs);
+				_compute(streams);
+
+				return Store(streams, 0, _result);
+			}
+
+			/**
+			*	\brief Solve systems of N unknowns by blocks of LaneCount with _compute, blocks optionally split across threads.
+			*	Matrices, right hand sides and results are tightly packed float components.
+			*/
+			template<size_t N, typename Compute>
+			void SolveBatch(const float* _matrices, const float* _rhs, size_t _count, float* _results, bool* _solved, bool _multithreaded,
+				Compute _compute)
+			{
+				auto process = [_matrices, _rhs, _count, _results, _solved, &_compute](size_t _begin, size_t _end)
+				{
+					SystemStreams<N, LaneCount> streams;
+
+					for (size_t block = _begin; block < _end; ++block)
+					{
+						const size_t first = block * LaneCount;
+						const size_t lanes = std::min(LaneCount, _count - first);
+
+						// Lanes past the end repeat the last system, their results are dropped.
+						for (size_t lane = 0; lane < LaneCount; ++lane)
+						{
+							const size_t system = first + std::min(lane, lanes - 1);
+							Load(streams, lane, _matrices + system * N * N, _rhs + system * N);
+						}
+
+						_compute(streams);
+
+						for (size_t lane = 0; lane < lanes; ++lane)
+						{
+							const bool solved = Store(streams, lane, _results + (first + lane) * N);
+
+							if (_solved)
+								_solved[first + lane] = solved;
+						}
+					}
+				};
+
+				const size_t block_count = (_count + LaneCount - 1) / LaneCount;
+
+				Math::ParallelFor(0, block_count, MinBlockBatch, _multithreaded, process);
+			}
+
+			struct LU
+			{
+				template<typename Streams>
+				void operator()(Streams& _streams) const noexcept
+				{
+					EliminateLU(_streams);
+				}
+			};
+
+			struct Cholesky
+			{
+				template<typename Streams>
+				void operator()(Streams& _streams) const noexcept
+				{
+					EliminateCholesky(_streams);
+				}
+			};
+
+			static_assert(sizeof(Mat2) == 4 * sizeof(float) && sizeof(Mat3) == 9 * sizeof(float) && sizeof(Mat4) == 16 * sizeof(float),
+				"Matrices must be tightly packed row major components");
+			static_assert(sizeof(Vec2) == 2 * sizeof(float) && sizeof(Vec3) == 3 * sizeof(float) && sizeof(Vec4) == 4 * sizeof(float),
+				"Vectors must be tightly packed components");
+		}
+
+#define MATHLIB_DEFINE_SOLVERS(MAT, VEC, N)																						\
+		bool SolveLU(const MAT& _matrix, const VEC& _rhs, VEC& _result) noexcept												\
+		{																														\
+			return SolveSingle<N>(_matrix.Data(), _rhs.Data(), &_result.X, LU());												\
+		}																														\
+																																\
+		bool SolveCholesky(const MAT& _matrix, const VEC& _rhs, VEC& _result) noexcept										\
+		{																														\
+			return SolveSingle<N>(_matrix.Data(), _rhs.Data(), &_result.X, Cholesky());										\
+		}																														\
+																																\
+		void SolveLUBatch(const MAT* _matrices, const VEC* _rhs, size_t _count, VEC* _results, bool* _solved, bool _multithreaded)	\
+		{																														\
+			SolveBatch<N>(_matrices->Data(), _rhs->Data(), _count, &_results->X, _solved, _multithreaded, LU());				\
+		}																														\
+																																\
+		void SolveCholeskyBatch(const MAT* _matrices, const VEC* _rhs, size_t _count, VEC* _results, bool* _solved,			\
+			bool _multithreaded)																								\
+		{																														\
+			SolveBatch<N>(_matrices->Data(), _rhs->Data(), _count, &_results->X, _solved, _multithreaded, Cholesky());			\
+		}
+
+		MATHLIB_DEFINE_SOLVERS(Mat2, Vec2, 2)
+		MATHLIB_DEFINE_SOLVERS(Mat3, Vec3, 3)
+		MATHLIB_DEFINE_SOLVERS(Mat4, Vec4, 4)
+
+#undef MATHLIB_DEFINE_SOLVERS
+
+		template<size_t N>
+		bool SolveLU(const Mat<float, N, N>& _matrix, const Vec<float, N>& _rhs, Vec<float, N>& _result) noexcept
+		{
+			return SolveSingle<N>(_matrix.Data(), _rhs.Data(), _result.Data(), LU());
+		}
+
+		template<size_t N>
+		bool SolveCholesky(const Mat<float, N, N>& _matrix, const Vec<float, N>& _rhs, Vec<float, N>& _result) noexcept
+		{
+			return SolveSingle<N>(_matrix.Data(), _rhs.Data(), _result.Data(), Cholesky());
+		}
+
+		template<size_t N>
+		void SolveLUBatch(const Mat<float, N, N>* _matrices, const Vec<float, N>* _rhs, size_t _count, Vec<float, N>* _results,
+			bool* _solved, bool _multithreaded)
+		{
+			static_assert(sizeof(Mat<float, N, N>) == N * N * sizeof(float) && sizeof(Vec<float, N>) == N * sizeof(float),
+				"Generic matrices and vectors must be tightly packed");
+
+			SolveBatch<N>(_matrices->Data(), _rhs->Data(), _count, _results->Data(), _solved, _multithreaded, LU());
+		}
+
+		template<size_t N>
+		void SolveCholeskyBatch(const Mat<float, N, N>* _matrices, const Vec<float, N>* _rhs, size_t _count, Vec<float, N>* _results,
+			bool* _solved, bool _multithreaded)
+		{
+			SolveBatch<N>(_matrices->Data(), _rhs->Data(), _count, _results->Data(), _solved, _multithreaded, Cholesky());
+		}
+
+#define MATHLIB_INSTANTIATE_SOLVERS(N)																							\
+		template MATHLIBRARY_API bool SolveLU<N>(const Mat<float, N, N>&, const Vec<float, N>&, Vec<float, N>&) noexcept;			\
+		template MATHLIBRARY_API bool SolveCholesky<N>(const Mat<float, N, N>&, const Vec<float, N>&, Vec<float, N>&) noexcept;	\
+		template MATHLIBRARY_API void SolveLUBatch<N>(const Mat<float, N, N>*, const Vec<float, N>*, size_t, Vec<float, N>*,		\
+			bool*, bool);																										\
+		template MATHLIBRARY_API void SolveCholeskyBatch<N>(const Mat<float, N, N>*, const Vec<float, N>*, size_t, Vec<float, N>*,	\
+			bool*, bool);
+
+		MATHLIB_INSTANTIATE_SOLVERS(2)
+		MATHLIB_INSTANTIATE_SOLVERS(3)
+		MATHLIB_INSTANTIATE_SOLVERS(4)
+		MATHLIB_INSTANTIATE_SOLVERS(5)
+		MATHLIB_INSTANTIATE_SOLVERS(6)
+		MATHLIB_INSTANTIATE_SOLVERS(7)
+		MATHLIB_INSTANTIATE_SOLVERS(8)
+
+#undef MATHLIB_INSTANTIATE_SOLVERS
+	}
+}
@@ -23,27 +23,36 @@ const Mat2 Mat2::Identity = Mat2(1.f, 0.f,
 //Constructors
 
 Mat2::Mat2(float _e00, float _e01, float _e10, float _e11) noexcept :
-	e00{ _e00 }, e01{ _e01 }, e10{ _e10 }, e11{ _e11 }
+	Base(_e00, _e01,
+		_e10, _e11)
 {
 }
 
 Mat2::Mat2(float _value) noexcept :
-	e00{ _value }, e01{ _value }, e10{ _value }, e11{ _value }
+	Base(_value)
 {
 }
 
 Mat2::Mat2(const Vec2& _row0, const Vec2& _row1) noexcept:
-	e00{ _row0.X }, e01{ _row0.Y }, e10{ _row1.X }, e11{ _row1.Y }
+	Base(_row0.X, _row0.Y,
+		_row1.X, _row1.Y)
 {
 }
 
 Mat2::Mat2(const Mat3& _mat) noexcept :
-	e00{ _mat.e00 }, e01{ _mat.e01 }, e10{ _mat.e10 }, e11{ _mat.e11 }
+	Base(_mat.e00, _mat.e01,
+		_mat.e10, _mat.e11)
 {
 }
 
 Mat2::Mat2(const Mat4& _mat) noexcept :
-	e00{ _mat.e00 }, e01{ _mat.e01 }, e10{ _mat.e10 }, e11{ _mat.e11 }
+	Base(_mat.e00, _mat.e01,
+		_mat.e10, _mat.e11)
+{
+}
+
+Mat2::Mat2(const Base& _mat) noexcept :
+	Base(_mat)
 {
 }
 
@@ -68,7 +77,7 @@ Mat2 Mat2::ScaleMatrix(float _scale) noexcept
 
 const float* Mat2::Data() const noexcept
 {
-	return &e00;
+	return Base::Data();
 }
 
 float& Mat2::operator[](unsigned int _index) 
@@ -93,23 +102,17 @@ bool Mat2::IsIdentity() const noexcept
 
 bool Mat2::Equals(const Mat2& _other, float _epsilon) const noexcept
 {
-	return Math::Equals(e00, _other.e00, _epsilon) &&
-		Math::Equals(e01, _other.e01, _epsilon) &&
-		Math::Equals(e10, _other.e10, _epsilon) &&
-		Math::Equals(e11, _other.e11, _epsilon);
+	return Base::Equals(_other, _epsilon);
 }
 
 bool Mat2::operator==(const Mat2& _rhs) const noexcept
 {
-	return e00 == _rhs.e00 &&
-		e01 == _rhs.e01 &&
-		e10 == _rhs.e10 &&
-		e11 == _rhs.e11;
+	return Base::operator==(_rhs);
 }
 
 bool Mat2::operator!=(const Mat2& _rhs) const noexcept
 {
-	return !(*this == _rhs);
+	return Base::operator!=(_rhs);
 }
 
 //methods
@@ -122,7 +125,7 @@ Mat2 Mat2::Transpose() noexcept
 
 Mat2 Mat2::GetTranspose()const noexcept
 {
-	return Mat2(e00, e10, e01, e11);
+	return Base::GetTranspose();
 }
 
 Mat2 Mat2::Inverse() noexcept
@@ -143,125 +146,88 @@ Mat2 Mat2::GetInverse() const noexcept
 
 float Mat2::Determinant() const noexcept
 {
-	return e00 * e11 - e01 * e10;
+	return Base::Determinant();
 }
 
 //operator
 
 Mat2 Mat2::operator+(float _scale) const noexcept
 {
-	return Mat2(e00 + _scale, e01 + _scale,
-		e10 + _scale, e11 + _scale);
+	return Base::operator+(_scale);
 }
 
 Mat2 Mat2::operator-(float _scale) const noexcept
 {
-	return Mat2(e00 - _scale, e01 - _scale,
-		e10 - _scale, e11 - _scale);
+	return Base::operator-(_scale);
 }
 
 Mat2 Mat2::operator*(float _scale) const noexcept
 {
-	return Mat2(e00 * _scale, e01 * _scale,
-		e10 * _scale, e11 * _scale);
+	return Base::operator*(_scale);
 }
 
 Mat2 Mat2::operator/(float _scale) const
 {
-	if (_scale == 0.f )
-		Callback::CallErrorCallback(CLASS_NAME, "operator/", "Division by 0");
-
-	return Mat2(e00 / _scale, e01 / _scale,
-		e10 / _scale, e11 / _scale);
+	return Base::operator/(_scale);
 }
 
 Mat2& Mat2::operator+=(float _scale) noexcept
 {
-	e00 += _scale;
-	e01 += _scale;
-	e10 += _scale;
-	e11 += _scale;
+	Base::operator+=(_scale);
 	return *this;
 }
 
 Mat2& Mat2::operator-=(float _scale) noexcept
 {
-	e00 -= _scale;
-	e01 -= _scale;
-	e10 -= _scale;
-	e11 -= _scale;
+	Base::operator-=(_scale);
 	return *this;
 }
 
 Mat2& Mat2::operator*=(float _scale) noexcept
 {
-	e00 *= _scale;
-	e01 *= _scale;
-	e10 *= _scale;
-	e11 *= _scale;
+	Base::operator*=(_scale);
 	return *this;
 }
 
 Mat2& Mat2::operator/=(float _scale)
 {
-	if (_scale == 0.f)
-		Callback::CallErrorCallback(CLASS_NAME, "operator/=", "Division by 0");
-
-	e00 /= _scale;
-	e01 /= _scale;
-	e10 /= _scale;
-	e11 /= _scale;
+	Base::operator/=(_scale);
 	return *this;
 }
 
 Vec2 Mat2::operator*(const Vec2& _rhs) const noexcept
 {
-	return Vec2(e00 * _rhs.X + e01 * _rhs.Y,
-		e10 * _rhs.X + e11 * _rhs.Y);
+	return Base::operator*(_rhs);
 }
 
 Mat2 Mat2::operator+(const Mat2& _rhs) const noexcept
 {
-	return Mat2(e00 + _rhs.e00, e01 + _rhs.e01,
-		e10 + _rhs.e10, e11 + _rhs.e11);
+	return Base::operator+(_rhs);
 }
 
 Mat2 Mat2::operator-(const Mat2& _rhs) const noexcept
 {
-	return Mat2(e00 - _rhs.e00, e01 - _rhs.e01,
-		e10 - _rhs.e10, e11 - _rhs.e11);
+	return Base::operator-(_rhs);
 }
 
 Mat2 Mat2::operator*(const Mat2& _rhs) const noexcept
 {
-	return Mat2(e00 * _rhs.e00 + e01 * _rhs.e10, e00 * _rhs.e01 + e01 * _rhs.e11,
-		e10 * _rhs.e00 + e11 * _rhs.e10, e10 * _rhs.e01 + e11 * _rhs.e11);
+	return Base::operator*(_rhs);
 }
 
 Mat2& Mat2::operator+=(const Mat2& _rhs) noexcept
 {
-	e00 += _rhs.e00;
-	e01 += _rhs.e01;
-	e10 += _rhs.e10;
-	e11 += _rhs.e11;
+	Base::operator+=(_rhs);
 	return *this;
 }
 
 Mat2& Mat2::operator-=(const Mat2& _rhs) noexcept
 {
-	e00 -= _rhs.e00;
-	e01 -= _rhs.e01;
-	e10 -= _rhs.e10;
-	e11 -= _rhs.e11;
+	Base::operator-=(_rhs);
 	return *this;
 }
 
 Mat2& Mat2::operator*=(const Mat2& _rhs) noexcept
 {
-	Mat2 tmp = *this;
-	e00 = tmp.e00 * _rhs.e00 + tmp.e01 * _rhs.e10;
-	e01 = tmp.e00 * _rhs.e01 + tmp.e01 * _rhs.e11;
-	e10 = tmp.e10 * _rhs.e00 + tmp.e11 * _rhs.e10;
-	e11 = tmp.e10 * _rhs.e01 + tmp.e11 * _rhs.e11;
-	return *this;
+	return *this = *this * _rhs;
 }
\ No newline at end of file
@@ -1,9 +1,12 @@
+#include <algorithm>
+
 #include <Space/Vec3.hpp>
 #include <Space/Vec4.hpp>
 #include <Space/Quaternion.hpp>
 #include <Misc/Math.hpp>
 #include <Misc/Callback.hpp>
 #include <Misc/Trigonometry.hpp>
+#include <Misc/Parallel.hpp>
 
 #include <Matrix/Mat2.hpp>
 #include <Matrix/Mat3.hpp>
@@ -14,6 +17,235 @@ using namespace Mathlib;
 
 #define CLASS_NAME "Mat4"
 
+namespace
+{
+	/// Number of matrices inverted together by batches.
+	constexpr size_t LaneCount = 16;
+
+	/// Minimum number of blocks processed by one thread.
+	constexpr size_t MinBlockBatch = 64;
+
+	/**
+	*	\brief Matrices and their inverses stored as component streams, one entry per lane.
+	*/
+	struct InverseStreams
+	{
+		/// Input matrices, row major.
+		float a[16][LaneCount];
+
+		/// Inverse matrices, row major.
+		float b[16][LaneCount];
+
+		/// Whether the matrix of each lane is invertible.
+		bool valid[LaneCount];
+	};
+
+	/**
+	*	\brief Keep the input of lanes that are not invertible, as GetInverse does.
+	*/
+	void KeepSingular(InverseStreams& _streams) noexcept
+	{
+		for (size_t i = 0; i < 16; ++i)
+		{
+			for (size_t lane = 0; lane < LaneCount; ++lane)
+				_streams.b[i][lane] = _streams.valid[lane] ? _streams.b[i][lane] : _streams.a[i][lane];
+		}
+	}
+
+	/**
+	*	\brief Invert every lane from the 2x2 determinants of the two upper rows and the two lower rows.
+	*/
+	void InvertGeneral(InverseStreams& _streams) noexcept
+	{
+		const float (&a)[16][LaneCount] = _streams.a;
+		float (&b)[16][LaneCount] = _streams.b;
+
+		for (size_t lane = 0; lane < LaneCount; ++lane)
+		{
+			const float a00 = a[0][lane], a01 = a[1][lane], a02 = a[2][lane], a03 = a[3][lane];
+			const float a10 = a[4][lane], a11 = a[5][lane], a12 = a[6][lane], a13 = a[7][lane];
+			const float a20 = a[8][lane], a21 = a[9][lane], a22 = a[10][lane], a23 = a[11][lane];
+			const float a30 = a[12][lane], a31 = a[13][lane], a32 = a[14][lane], a33 = a[15][lane];
+
+			const float s0 = a00 * a11 - a10 * a01;
+			const float s1 = a00 * a12 - a10 * a02;
+			const float s2 = a00 * a13 - a10 * a03;
+			const float s3 = a01 * a12 - a11 * a02;
+			const float s4 = a01 * a13 - a11 * a03;
+			const float s5 = a02 * a13 - a12 * a03;
+
+			const float c0 = a20 * a31 - a30 * a21;
+			const float c1 = a20 * a32 - a30 * a22;
+			const float c2 = a20 * a33 - a30 * a23;
+			const float c3 = a21 * a32 - a31 * a22;
+			const float c4 = a21 * a33 - a31 * a23;
+			const float c5 = a22 * a33 - a32 * a23;
+
+			const float determinant = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+			const bool valid = determinant != 0.f;
+			const float inverse = 1.f / (valid ? determinant : 1.f);
+
+			b[0][lane] = (a11 * c5 - a12 * c4 + a13 * c3) * inverse;
+			b[1][lane] = (-a01 * c5 + a02 * c4 - a03 * c3) * inverse;
+			b[2][lane] = (a31 * s5 - a32 * s4 + a33 * s3) * inverse;
+			b[3][lane] = (-a21 * s5 + a22 * s4 - a23 * s3) * inverse;
+
+			b[4][lane] = (-a10 * c5 + a12 * c2 - a13 * c1) * inverse;
+			b[5][lane] = (a00 * c5 - a02 * c2 + a03 * c1) * inverse;
+			b[6][lane] = (-a30 * s5 + a32 * s2 - a33 * s1) * inverse;
+			b[7][lane] = (a20 * s5 - a22 * s2 + a23 * s1) * inverse;
+
+			b[8][lane] = (a10 * c4 - a11 * c2 + a13 * c0) * inverse;
+			b[9][lane] = (-a00 * c4 + a01 * c2 - a03 * c0) * inverse;
+			b[10][lane] = (a30 * s4 - a31 * s2 + a33 * s0) * inverse;
+			b[11][lane] = (-a20 * s4 + a21 * s2 - a23 * s0) * inverse;
+
+			b[12][lane] = (-a10 * c3 + a11 * c1 - a12 * c0) * inverse;
+			b[13][lane] = (a00 * c3 - a01 * c1 + a02 * c0) * inverse;
+			b[14][lane] = (-a30 * s3 + a31 * s1 - a32 * s0) * inverse;
+			b[15][lane] = (a20 * s3 - a21 * s1 + a22 * s0) * inverse;
+
+			_streams.valid[lane] = valid;
+		}
+
+		KeepSingular(_streams);
+	}
+
+	/**
+	*	\brief Write the translation -_rotation * _translation of an inverse whose 3x3 block is already in b,
+	*	and the (0, 0, 0, 1) last row.
+	*/
+	void InvertTranslation(InverseStreams& _streams) noexcept
+	{
+		const float (&a)[16][LaneCount] = _streams.a;
+		float (&b)[16][LaneCount] = _streams.b;
+
+		for (size_t lane = 0; lane < LaneCount; ++lane)
+		{
+			const float tx = a[3][lane], ty = a[7][lane], tz = a[11][lane];
+
+			b[3][lane] = -(b[0][lane] * tx + b[1][lane] * ty + b[2][lane] * tz);
+			b[7][lane] = -(b[4][lane] * tx + b[5][lane] * ty + b[6][lane] * tz);
+			b[11][lane] = -(b[8][lane] * tx + b[9][lane] * ty + b[10][lane] * tz);
+
+			b[12][lane] = 0.f;
+			b[13][lane] = 0.f;
+			b[14][lane] = 0.f;
+			b[15][lane] = 1.f;
+		}
+	}
+
+	/**
+	*	\brief Invert every lane as an affine matrix, from the adjugate of its upper 3x3 block.
+	*/
+	void InvertAffine(InverseStreams& _streams) noexcept
+	{
+		const float (&a)[16][LaneCount] = _streams.a;
+		float (&b)[16][LaneCount] = _streams.b;
+
+		for (size_t lane = 0; lane < LaneCount; ++lane)
+		{
+			const float a00 = a[0][lane], a01 = a[1][lane], a02 = a[2][lane];
+			const float a10 = a[4][lane], a11 = a[5][lane], a12 = a[6][lane];
+			const float a20 = a[8][lane], a21 = a[9][lane], a22 = a[10][lane];
+
+			const float c00 = a11 * a22 - a12 * a21;
+			const float c01 = a12 * a20 - a10 * a22;
+			const float c02 = a10 * a21 - a11 * a20;
+
+			const float determinant = a00 * c00 + a01 * c01 + a02 * c02;
+			const bool valid = determinant != 0.f;
+			const float inverse = 1.f / (valid ? determinant : 1.f);
+
+			b[0][lane] = c00 * inverse;
+			b[1][lane] = (a02 * a21 - a01 * a22) * inverse;
+			b[2][lane] = (a01 * a12 - a02 * a11) * inverse;
+
+			b[4][lane] = c01 * inverse;
+			b[5][lane] = (a00 * a22 - a02 * a20) * inverse;
+			b[6][lane] = (a02 * a10 - a00 * a12) * inverse;
+
+			b[8][lane] = c02 * inverse;
+			b[9][lane] = (a01 * a20 - a00 * a21) * inverse;
+			b[10][lane] = (a00 * a11 - a01 * a10) * inverse;
+
+			_streams.valid[lane] = valid;
+		}
+
+		InvertTranslation(_streams);
+		KeepSingular(_streams);
+	}
+
+	/**
+	*	\brief Invert every lane as a rigid matrix, transposing its rotation.
+	*/
+	void InvertRigid(InverseStreams& _streams) noexcept
+	{
+		const float (&a)[16][LaneCount] = _streams.a;
+		float (&b)[16][LaneCount] = _streams.b;
+
+		for (size_t i = 0; i < 3; ++i)
+		{
+			for (size_t j = 0; j < 3; ++j)
+			{
+				for (size_t lane = 0; lane < LaneCount; ++lane)
+					b[i * 4 + j][lane] = a[j * 4 + i][lane];
+			}
+		}
+
+		for (size_t lane = 0; lane < LaneCount; ++lane)
+			_streams.valid[lane] = true;
+
+		InvertTranslation(_streams);
+	}
+
+	/**
+	*	\brief Run _invert over all matrices by blocks of LaneCount, blocks optionally split across threads.
+	*/
+	template<typename Invert>
+	void InvertBatch(const Mat4* _matrices, size_t _count, Mat4* _result, bool* _invertible, bool _multithreaded, Invert _invert)
+	{
+		static_assert(sizeof(Mat4) == 16 * sizeof(float), "Mat4 must be tightly packed for batched inversion");
+
+		auto process = [_matrices, _count, _result, _invertible, &_invert](size_t _begin, size_t _end)
+		{
+			InverseStreams streams;
+
+			for (size_t block = _begin; block < _end; ++block)
+			{
+				const size_t first = block * LaneCount;
+				const size_t lanes = std::min(LaneCount, _count - first);
+
+				// Lanes past the end repeat the last matrix, their results are dropped.
+				for (size_t lane = 0; lane < LaneCount; ++lane)
+				{
+					const float* input = &_matrices[first + std::min(lane, lanes - 1)].e00;
+
+					for (size_t i = 0; i < 16; ++i)
+						streams.a[i][lane] = input[i];
+				}
+
+				_invert(streams);
+
+				for (size_t lane = 0; lane < lanes; ++lane)
+				{
+					float* output = &_result[first + lane].e00;
+
+					for (size_t i = 0; i < 16; ++i)
+						output[i] = streams.b[i][lane];
+
+					if (_invertible)
+						_invertible[first + lane] = streams.valid[lane];
+				}
+			}
+		};
+
+		const size_t block_count = (_count + LaneCount - 1) / LaneCount;
+
+		Math::ParallelFor(0, block_count, MinBlockBatch, _multithreaded, process);
+	}
+}
+
 //Constants
 
 const Mat4 Mat4::Zero = Mat4(0.f, 0.f, 0.f, 0.f,
@@ -33,42 +265,44 @@ Mat4::Mat4(float _e00, float _e01, float _e02, float _e03,
 	float _e10, float _e11, float _e12, float _e13,
 	float _e20, float _e21, float _e22, float _e23,
 	float _e30, float _e31, float _e32, float _e33) noexcept :
-	e00{ _e00 }, e01{ _e01 }, e02{ _e02 }, e03{ _e03 },
-	e10{ _e10 }, e11{ _e11 }, e12{ _e12 }, e13{ _e13 },
-	e20{ _e20 }, e21{ _e21 }, e22{ _e22 }, e23{ _e23 },
-	e30{ _e30 }, e31{ _e31 }, e32{ _e32 }, e33{ _e33 }
+	Base(_e00, _e01, _e02, _e03,
+		_e10, _e11, _e12, _e13,
+		_e20, _e21, _e22, _e23,
+		_e30, _e31, _e32, _e33)
 {
 }
 
 Mat4::Mat4(float _value) noexcept :
-	e00{ _value }, e01{ _value }, e02{ _value }, e03{ _value },
-	e10{ _value }, e11{ _value }, e12{ _value }, e13{ _value },
-	e20{ _value }, e21{ _value }, e22{ _value }, e23{ _value },
-	e30{ _value }, e31{ _value }, e32{ _value }, e33{ _value }
+	Base(_value)
 {
 }
 
 Mat4::Mat4(const Vec4& _row0, const Vec4& _row1, const Vec4& _row2, const Vec4& _row3) noexcept :
-	e00{ _row0.X }, e01{ _row0.Y }, e02{ _row0.Z }, e03{ _row0.W },
-	e10{ _row1.X }, e11{ _row1.Y }, e12{ _row1.Z }, e13{ _row1.W },
-	e20{ _row2.X }, e21{ _row2.Y }, e22{ _row2.Z }, e23{ _row2.W },
-	e30{ _row3.X }, e31{ _row3.Y }, e32{ _row3.Z }, e33{ _row3.W }
+	Base(_row0.X, _row0.Y, _row0.Z, _row0.W,
+		_row1.X, _row1.Y, _row1.Z, _row1.W,
+		_row2.X, _row2.Y, _row2.Z, _row2.W,
+		_row3.X, _row3.Y, _row3.Z, _row3.W)
 {
 }
 
 Mat4::Mat4(const Mat2& _mat) noexcept :
-	e00{ _mat.e00 }, e01{ _mat.e01 }, e02{ 0.f }, e03{ 0.f },
-	e10{ _mat.e10 }, e11{ _mat.e11 }, e12{ 0.f }, e13{ 0.f },
-	e20{ 0.f }, e21{ 0.f }, e22{ 1.f }, e23{ 0.f },
-	e30{ 0.f }, e31{ 0.f }, e32{ 0.f }, e33{ 1.f }
+	Base(_mat.e00, _mat.e01, 0.f, 0.f,
+		_mat.e10, _mat.e11, 0.f, 0.f,
+		0.f, 0.f, 1.f, 0.f,
+		0.f, 0.f, 0.f, 1.f)
 {
 }
 
 Mat4::Mat4(const Mat3& _mat) noexcept :
-	e00{ _mat.e00 }, e01{ _mat.e01 }, e02{ _mat.e02 }, e03{ 0.f },
-	e10{ _mat.e10 }, e11{ _mat.e11 }, e12{ _mat.e12 }, e13{ 0.f },
-	e20{ _mat.e20 }, e21{ _mat.e21 }, e22{ _mat.e22 }, e23{ 0.f },
-	e30{ 0.f }, e31{ 0.f }, e32{ 0.f }, e33{ 1.f }
+	Base(_mat.e00, _mat.e01, _mat.e02, 0.f,
+		_mat.e10, _mat.e11, _mat.e12, 0.f,
+		_mat.e20, _mat.e21, _mat.e22, 0.f,
+		0.f, 0.f, 0.f, 1.f)
+{
+}
+
+Mat4::Mat4(const Base& _mat) noexcept :
+	Base(_mat)
 {
 }
 
@@ -228,7 +462,7 @@ Mat4 Mat4::PerspectiveMatrix(COORDINATE_SYSTEM _coordinate_system, float _fovy,
 
 const float* Mat4::Data() const noexcept
 {
-	return &e00;
+	return Base::Data();
 }
 
 float& Mat4::operator[](unsigned int _index)
@@ -253,48 +487,17 @@ bool Mat4::IsIdentity() const noexcept
 
 bool Mat4::Equals(const Mat4& _other, float _epsilon) const noexcept
 {
-	return Math::Equals(e00, _other.e00, _epsilon) &&
-		Math::Equals(e01, _other.e01, _epsilon) &&
-		Math::Equals(e02, _other.e02, _epsilon) &&
-		Math::Equals(e03, _other.e03, _epsilon) &&
-		Math::Equals(e10, _other.e10, _epsilon) &&
-		Math::Equals(e11, _other.e11, _epsilon) &&
-		Math::Equals(e12, _other.e12, _epsilon) &&
-		Math::Equals(e13, _other.e13, _epsilon) &&
-		Math::Equals(e20, _other.e20, _epsilon) &&
-		Math::Equals(e21, _other.e21, _epsilon) &&
-		Math::Equals(e22, _other.e22, _epsilon) &&
-		Math::Equals(e23, _other.e23, _epsilon) &&
-		Math::Equals(e30, _other.e30, _epsilon) &&
-		Math::Equals(e31, _other.e31, _epsilon) &&
-		Math::Equals(e32, _other.e32, _epsilon) &&
-		Math::Equals(e33, _other.e33, _epsilon);
+	return Base::Equals(_other, _epsilon);
 }
 
 bool Mat4::operator==(const Mat4& _rhs) const noexcept
 {
-	return e00 == _rhs.e00 &&
-		e01 == _rhs.e01 &&
-		e02 == _rhs.e02 &&
-		e03 == _rhs.e03 &&
-		e10 == _rhs.e10 &&
-		e11 == _rhs.e11 &&
-		e12 == _rhs.e12 &&
-		e13 == _rhs.e13 &&
-		e20 == _rhs.e20 &&
-		e21 == _rhs.e21 &&
-		e22 == _rhs.e22 &&
-		e23 == _rhs.e23 &&
-		e30 == _rhs.e30 &&
-		e31 == _rhs.e31 &&
-		e32 == _rhs.e32 &&
-		e33 == _rhs.e33;
-
+	return Base::operator==(_rhs);
 }
 
 bool Mat4::operator!=(const Mat4& _rhs) const noexcept
 {
-	return !(*this == _rhs);
+	return Base::operator!=(_rhs);
 }
 
 //methods
@@ -307,10 +510,7 @@ Mat4 Mat4::Transpose() noexcept
 
 Mat4 Mat4::GetTranspose()const noexcept
 {
-	return Mat4(e00, e10, e20, e30,
-		e01, e11, e21, e31,
-		e02, e12, e22, e32,
-		e03, e13, e23, e33);
+	return Base::GetTranspose();
 }
 
 Mat4 Mat4::Inverse() noexcept
@@ -386,19 +586,24 @@ Mat4 Mat4::GetInverse() const noexcept
 	return *this;
 }
 
-float Mat4::Determinant() const noexcept
+void Mat4::InverseBatch(const Mat4* _matrices, size_t _count, Mat4* _result, bool* _invertible, bool _multithreaded)
+{
+	InvertBatch(_matrices, _count, _result, _invertible, _multithreaded, InvertGeneral);
+}
+
+void Mat4::InverseAffineBatch(const Mat4* _matrices, size_t _count, Mat4* _result, bool* _invertible, bool _multithreaded)
+{
+	InvertBatch(_matrices, _count, _result, _invertible, _multithreaded, InvertAffine);
+}
+
+void Mat4::InverseRigidBatch(const Mat4* _matrices, size_t _count, Mat4* _result, bool _multithreaded)
 {
-	float det_22_23_32_33 = e22 * e33 - e23 * e32;
-	float det_21_22_31_32 = e21 * e32 - e22 * e31;
-	float det_21_23_31_33 = e21 * e33 - e23 * e31;
-	float det_20_23_30_33 = e20 * e33 - e23 * e30;
-	float det_20_22_30_32 = e20 * e32 - e22 * e30;
-	float det_20_21_30_31 = e20 * e31 - e21 * e30;
+	InvertBatch(_matrices, _count, _result, nullptr, _multithreaded, InvertRigid);
+}
 
-	return e00 * (e11 * det_22_23_32_33 - e12 * det_21_23_31_33 + e13 * det_21_22_31_32) -
-		e01 * (e10 * det_22_23_32_33 - e12 * det_20_23_30_33 + e13 * det_20_22_30_32) +
-		e02 * (e10 * det_21_23_31_33 - e11 * det_20_23_30_33 + e13 * det_20_21_30_31) -
-		e03 * (e10 * det_21_22_31_32 - e11 * det_20_22_30_32 + e12 * det_20_21_30_31);
+float Mat4::Determinant() const noexcept
+{
+	return Base::Determinant();
 }
 
 
@@ -406,245 +611,81 @@ float Mat4::Determinant() const noexcept
 
 Mat4 Mat4::operator+(float _scale) const noexcept
 {
-	return Mat4(e00 + _scale, e01 + _scale, e02 + _scale, e03 + _scale,
-		e10 + _scale, e11 + _scale, e12 + _scale, e13 + _scale,
-		e20 + _scale, e21 + _scale, e22 + _scale, e23 + _scale,
-		e30 + _scale, e31 + _scale, e32 + _scale, e33 + _scale);
+	return Base::operator+(_scale);
 }
 
 Mat4 Mat4::operator-(float _scale) const noexcept
 {
-	return Mat4(e00 - _scale, e01 - _scale, e02 - _scale, e03 - _scale,
-		e10 - _scale, e11 - _scale, e12 - _scale, e13 - _scale,
-		e20 - _scale, e21 - _scale, e22 - _scale, e23 - _scale,
-		e30 - _scale, e31 - _scale, e32 - _scale, e33 - _scale);
+	return Base::operator-(_scale);
 }
 
 Mat4 Mat4::operator*(float _scale) const noexcept
 {
-	return Mat4(e00 * _scale, e01 * _scale, e02 * _scale, e03 * _scale,
-		e10 * _scale, e11 * _scale, e12 * _scale, e13 * _scale,
-		e20 * _scale, e21 * _scale, e22 * _scale, e23 * _scale,
-		e30 * _scale, e31 * _scale, e32 * _scale, e33 * _scale);
+	return Base::operator*(_scale);
 }
 
 Mat4 Mat4::operator/(float _scale) const
 {
-	if (_scale == 0.f)
-		Callback::CallErrorCallback(CLASS_NAME, "operator/", "Division by 0");
-
-	return Mat4(e00 / _scale, e01 / _scale, e02 / _scale, e03 / _scale,
-		e10 / _scale, e11 / _scale, e12 / _scale, e13 / _scale,
-		e20 / _scale, e21 / _scale, e22 / _scale, e23 / _scale,
-		e30 / _scale, e31 / _scale, e32 / _scale, e33 / _scale);
+	return Base::operator/(_scale);
 }
 
 Mat4& Mat4::operator+=(float _scale) noexcept
 {
-	e00 += _scale;
-	e01 += _scale;
-	e02 += _scale;
-	e03 += _scale;
-	e10 += _scale;
-	e11 += _scale;
-	e12 += _scale;
-	e13 += _scale;
-	e20 += _scale;
-	e21 += _scale;
-	e22 += _scale;
-	e23 += _scale;
-	e30 += _scale;
-	e31 += _scale;
-	e32 += _scale;
-	e33 += _scale;
-
+	Base::operator+=(_scale);
 	return *this;
 }
 
 Mat4& Mat4::operator-=(float _scale) noexcept
 {
-	e00 -= _scale;
-	e01 -= _scale;
-	e02 -= _scale;
-	e03 -= _scale;
-	e10 -= _scale;
-	e11 -= _scale;
-	e12 -= _scale;
-	e13 -= _scale;
-	e20 -= _scale;
-	e21 -= _scale;
-	e22 -= _scale;
-	e23 -= _scale;
-	e30 -= _scale;
-	e31 -= _scale;
-	e32 -= _scale;
-	e33 -= _scale;
-
+	Base::operator-=(_scale);
 	return *this;
 }
 
 Mat4& Mat4::operator*=(float _scale) noexcept
 {
-	e00 *= _scale;
-	e01 *= _scale;
-	e02 *= _scale;
-	e03 *= _scale;
-	e10 *= _scale;
-	e11 *= _scale;
-	e12 *= _scale;
-	e13 *= _scale;
-	e20 *= _scale;
-	e21 *= _scale;
-	e22 *= _scale;
-	e23 *= _scale;
-	e30 *= _scale;
-	e31 *= _scale;
-	e32 *= _scale;
-	e33 *= _scale;
-
+	Base::operator*=(_scale);
 	return *this;
 }
 
 Mat4& Mat4::operator/=(float _scale)
 {
-	if (_scale == 0.f)
-		Callback::CallErrorCallback(CLASS_NAME, "operator/=", "Division by 0");
-
-	e00 /= _scale;
-	e01 /= _scale;
-	e02 /= _scale;
-	e03 /= _scale;
-	e10 /= _scale;
-	e11 /= _scale;
-	e12 /= _scale;
-	e13 /= _scale;
-	e20 /= _scale;
-	e21 /= _scale;
-	e22 /= _scale;
-	e23 /= _scale;
-	e30 /= _scale;
-	e31 /= _scale;
-	e32 /= _scale;
-	e33 /= _scale;
-
+	Base::operator/=(_scale);
 	return *this;
 }
 
 Vec4 Mat4::operator*(const Vec4& _rhs) const noexcept
 {
-	return Vec4(e00 * _rhs.X + e01 * _rhs.Y + e02 * _rhs.Z + e03 * _rhs.W,
-		e10 * _rhs.X + e11 * _rhs.Y + e12 * _rhs.Z + e13 * _rhs.W,
-		e20 * _rhs.X + e21 * _rhs.Y + e22 * _rhs.Z + e23 * _rhs.W,
-		e30 * _rhs.X + e31 * _rhs.Y + e32 * _rhs.Z + e33 * _rhs.W);
+	return Base::operator*(_rhs);
 }
 
 Mat4 Mat4::operator+(const Mat4& _rhs) const noexcept
 {
-	return Mat4(e00 + _rhs.e00, e01 + _rhs.e01, e02 + _rhs.e02, e03 + _rhs.e03,
-		e10 + _rhs.e10, e11 + _rhs.e11, e12 + _rhs.e12, e13 + _rhs.e13,
-		e20 + _rhs.e20, e21 + _rhs.e21, e22 + _rhs.e22, e23 + _rhs.e23, 
-		e30 + _rhs.e30, e31 + _rhs.e31, e32 + _rhs.e32, e33 + _rhs.e33);
+	return Base::operator+(_rhs);
 }
 
 Mat4 Mat4::operator-(const Mat4& _rhs) const noexcept
 {
-	return Mat4(e00 - _rhs.e00, e01 - _rhs.e01, e02 - _rhs.e02, e03 - _rhs.e03,
-		e10 - _rhs.e10, e11 - _rhs.e11, e12 - _rhs.e12, e13 - _rhs.e13,
-		e20 - _rhs.e20, e21 - _rhs.e21, e22 - _rhs.e22, e23 - _rhs.e23,
-		e30 - _rhs.e30, e31 - _rhs.e31, e32 - _rhs.e32, e33 - _rhs.e33);
+	return Base::operator-(_rhs);
 }
 
 Mat4 Mat4::operator*(const Mat4& _rhs) const noexcept
 {
-	return Mat4(
-		e00 * _rhs.e00 + e01 * _rhs.e10 + e02 * _rhs.e20 + e03 * _rhs.e30,
-		e00 * _rhs.e01 + e01 * _rhs.e11 + e02 * _rhs.e21 + e03 * _rhs.e31,
-		e00 * _rhs.e02 + e01 * _rhs.e12 + e02 * _rhs.e22 + e03 * _rhs.e32,
-		e00 * _rhs.e03 + e01 * _rhs.e13 + e02 * _rhs.e23 + e03 * _rhs.e33,
-
-		e10 * _rhs.e00 + e11 * _rhs.e10 + e12 * _rhs.e20 + e13 * _rhs.e30,
-		e10 * _rhs.e01 + e11 * _rhs.e11 + e12 * _rhs.e21 + e13 * _rhs.e31,
-		e10 * _rhs.e02 + e11 * _rhs.e12 + e12 * _rhs.e22 + e13 * _rhs.e32,
-		e10 * _rhs.e03 + e11 * _rhs.e13 + e12 * _rhs.e23 + e13 * _rhs.e33,
-
-		e20 * _rhs.e00 + e21 * _rhs.e10 + e22 * _rhs.e20 + e23 * _rhs.e30,
-		e20 * _rhs.e01 + e21 * _rhs.e11 + e22 * _rhs.e21 + e23 * _rhs.e31,
-		e20 * _rhs.e02 + e21 * _rhs.e12 + e22 * _rhs.e22 + e23 * _rhs.e32,
-		e20 * _rhs.e03 + e21 * _rhs.e13 + e22 * _rhs.e23 + e23 * _rhs.e33,
-
-		e30 * _rhs.e00 + e31 * _rhs.e10 + e32 * _rhs.e20 + e33 * _rhs.e30,
-		e30 * _rhs.e01 + e31 * _rhs.e11 + e32 * _rhs.e21 + e33 * _rhs.e31,
-		e30 * _rhs.e02 + e31 * _rhs.e12 + e32 * _rhs.e22 + e33 * _rhs.e32,
-		e30 * _rhs.e03 + e31 * _rhs.e13 + e32 * _rhs.e23 + e33 * _rhs.e33
-	);
+	return Base::operator*(_rhs);
 }
 
 Mat4& Mat4::operator+=(const Mat4& _rhs) noexcept
 {
-	e00 += _rhs.e00;
-	e01 += _rhs.e01;
-	e02 += _rhs.e02;
-	e03 += _rhs.e03;
-	e10 += _rhs.e10;
-	e11 += _rhs.e11;
-	e12 += _rhs.e12;
-	e13 += _rhs.e13;
-	e20 += _rhs.e20;
-	e21 += _rhs.e21;
-	e22 += _rhs.e22;
-	e23 += _rhs.e23;
-	e30 += _rhs.e30;
-	e31 += _rhs.e31;
-	e32 += _rhs.e32;
-	e33 += _rhs.e33;
-
+	Base::operator+=(_rhs);
 	return *this;
 }
 
 Mat4& Mat4::operator-=(const Mat4& _rhs) noexcept
 {
-	e00 -= _rhs.e00;
-	e01 -= _rhs.e01;
-	e02 -= _rhs.e02;
-	e03 -= _rhs.e03;
-	e10 -= _rhs.e10;
-	e11 -= _rhs.e11;
-	e12 -= _rhs.e12;
-	e13 -= _rhs.e13;
-	e20 -= _rhs.e20;
-	e21 -= _rhs.e21;
-	e22 -= _rhs.e22;
-	e23 -= _rhs.e23;
-	e30 -= _rhs.e30;
-	e31 -= _rhs.e31;
-	e32 -= _rhs.e32;
-	e33 -= _rhs.e33;
-
+	Base::operator-=(_rhs);
 	return *this;
 }
 
 Mat4& Mat4::operator*=(const Mat4& _rhs) noexcept
 {
-	Mat4 tmp = *this;
-	e00 = tmp.e00 * _rhs.e00 + tmp.e01 * _rhs.e10 + tmp.e02 * _rhs.e20 + tmp.e03 * _rhs.e30;
-	e01 = tmp.e00 * _rhs.e01 + tmp.e01 * _rhs.e11 + tmp.e02 * _rhs.e21 + tmp.e03 * _rhs.e31;
-	e02 = tmp.e00 * _rhs.e02 + tmp.e01 * _rhs.e12 + tmp.e02 * _rhs.e22 + tmp.e03 * _rhs.e32;
-	e03 = tmp.e00 * _rhs.e03 + tmp.e01 * _rhs.e13 + tmp.e02 * _rhs.e23 + tmp.e03 * _rhs.e33;
-
-	e10 = tmp.e10 * _rhs.e00 + tmp.e11 * _rhs.e10 + tmp.e12 * _rhs.e20 + tmp.e13 * _rhs.e30;
-	e11 = tmp.e10 * _rhs.e01 + tmp.e11 * _rhs.e11 + tmp.e12 * _rhs.e21 + tmp.e13 * _rhs.e31;
-	e12 = tmp.e10 * _rhs.e02 + tmp.e11 * _rhs.e12 + tmp.e12 * _rhs.e22 + tmp.e13 * _rhs.e32;
-	e13 = tmp.e10 * _rhs.e03 + tmp.e11 * _rhs.e13 + tmp.e12 * _rhs.e23 + tmp.e13 * _rhs.e33;
-
-	e20 = tmp.e20 * _rhs.e00 + tmp.e21 * _rhs.e10 + tmp.e22 * _rhs.e20 + tmp.e23 * _rhs.e30;
-	e21 = tmp.e20 * _rhs.e01 + tmp.e21 * _rhs.e11 + tmp.e22 * _rhs.e21 + tmp.e23 * _rhs.e31;
-	e22 = tmp.e20 * _rhs.e02 + tmp.e21 * _rhs.e12 + tmp.e22 * _rhs.e22 + tmp.e23 * _rhs.e32;
-	e23 = tmp.e20 * _rhs.e03 + tmp.e21 * _rhs.e13 + tmp.e22 * _rhs.e23 + tmp.e23 * _rhs.e33;
-
-	e30 = tmp.e30 * _rhs.e00 + tmp.e31 * _rhs.e10 + tmp.e32 * _rhs.e20 + tmp.e33 * _rhs.e30;
-	e31 = tmp.e30 * _rhs.e01 + tmp.e31 * _rhs.e11 + tmp.e32 * _rhs.e21 + tmp.e33 * _rhs.e31;
-	e32 = tmp.e30 * _rhs.e02 + tmp.e31 * _rhs.e12 + tmp.e32 * _rhs.e22 + tmp.e33 * _rhs.e32;
-	e33 = tmp.e30 * _rhs.e03 + tmp.e31 * _rhs.e13 + tmp.e32 * _rhs.e23 + tmp.e33 * _rhs.e33;
-
-	return *this;
+	return *this = *this * _rhs;
 }
\ No newline at end of file
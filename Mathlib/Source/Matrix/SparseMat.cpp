@@ -0,0 +1,200 @@
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include <Matrix/SparseMat.hpp>
+#include <Misc/Callback.hpp>
+#include <Misc/Parallel.hpp>
+
+#define CLASS_NAME "SparseMat"
+
+namespace Mathlib
+{
+	namespace
+	{
+		/// Minimum number of rows processed by one thread.
+		constexpr size_t MinBatch = 2048;
+	}
+
+	//Constructors
+
+	template<typename T>
+	SparseMat<T>::SparseMat(size_t _rows, size_t _columns, const SparseEntry<T>* _entries, size_t _count) :
+		rows{ _rows }, columns{ _columns }, rowStarts(_rows + 1, 0)
+	{
+		// Count entries per row, then place them with a prefix sum.
+		for (size_t i = 0; i < _count; ++i)
+		{
+			if (_entries[i].row >= rows || _entries[i].column >= columns)
+			{
+				Callback::CallErrorCallback(CLASS_NAME, "SparseMat", "Entry out of the matrix");
+				continue;
+			}
+
+			++rowStarts[_entries[i].row + 1];
+		}
+
+		for (size_t row = 0; row < rows; ++row)
+			rowStarts[row + 1] += rowStarts[row];
+
+		std::vector<std::pair<uint32_t, T>> sorted(rowStarts[rows]);
+		std::vector<size_t> cursors(rowStarts.begin(), rowStarts.end() - 1);
+
+		for (size_t i = 0; i < _count; ++i)
+		{
+			if (_entries[i].row < rows && _entries[i].column < columns)
+				sorted[cursors[_entries[i].row]++] = { static_cast<uint32_t>(_entries[i].column), _entries[i].value };
+		}
+
+		// Sort each row by column and sum duplicates.
+		columnIndices.reserve(sorted.size());
+		values.reserve(sorted.size());
+
+		for (size_t row = 0; row < rows; ++row)
+		{
+			auto begin = sorted.begin() + rowStarts[row];
+			auto end = sorted.begin() + rowStarts[row + 1];
+			std::stable_sort(begin, end, [](const auto& _lhs, const auto& _rhs) { return _lhs.first < _rhs.first; });
+
+			rowStarts[row] = values.size();
+
+			for (auto it = begin; it != end; ++it)
+			{
+				if (values.size() > rowStarts[row] && columnIndices.back() == it->first)
+					values.back() += it->second;
+				else
+				{
+					columnIndices.push_back(it->first);
+					values.push_back(it->second);
+				}
+			}
+		}
+
+		rowStarts[rows] = values.size();
+	}
+
+	//Static methods
+
+	template<typename T>
+	SparseMat<T> SparseMat<T>::FromDense(const DenseMat<T>& _mat, T _threshold)
+	{
+		std::vector<SparseEntry<T>> entries;
+
+		for (size_t i = 0; i < _mat.GetRows(); ++i)
+		{
+			for (size_t j = 0; j < _mat.GetColumns(); ++j)
+			{
+				if (std::abs(_mat(i, j)) > _threshold)
+					entries.push_back({ i, j, _mat(i, j) });
+			}
+		}
+
+		return SparseMat(_mat.GetRows(), _mat.GetColumns(), entries.data(), entries.size());
+	}
+
+	template<typename T>
+	void SparseMat<T>::Multiply(const SparseMat& _lhs, const T* _vector, T* _result, bool _multithreaded)
+	{
+		const size_t* row_starts = _lhs.rowStarts.data();
+		const uint32_t* column_indices = _lhs.columnIndices.data();
+		const T* values = _lhs.values.data();
+
+		auto process = [row_starts, column_indices, values, _vector, _result](size_t _begin, size_t _end)
+		{
+			for (size_t row = _begin; row < _end; ++row)
+			{
+				T sum = T(0);
+
+				for (size_t i = row_starts[row]; i < row_starts[row + 1]; ++i)
+					sum += values[i] * _vector[column_indices[i]];
+
+				_result[row] = sum;
+			}
+		};
+
+		Math::ParallelFor(0, _lhs.rows, MinBatch, _multithreaded, process);
+	}
+
+	//Accessors
+
+	template<typename T>
+	size_t SparseMat<T>::GetRows() const noexcept
+	{
+		return rows;
+	}
+
+	template<typename T>
+	size_t SparseMat<T>::GetColumns() const noexcept
+	{
+		return columns;
+	}
+
+	template<typename T>
+	size_t SparseMat<T>::GetNonZeroCount() const noexcept
+	{
+		return values.size();
+	}
+
+	template<typename T>
+	const size_t* SparseMat<T>::GetRowStarts() const noexcept
+	{
+		return rowStarts.data();
+	}
+
+	template<typename T>
+	const uint32_t* SparseMat<T>::GetColumnIndices() const noexcept
+	{
+		return columnIndices.data();
+	}
+
+	template<typename T>
+	const T* SparseMat<T>::GetValues() const noexcept
+	{
+		return values.data();
+	}
+
+	template<typename T>
+	T* SparseMat<T>::GetValues() noexcept
+	{
+		return values.data();
+	}
+
+	template<typename T>
+	T SparseMat<T>::Get(size_t _row, size_t _column) const noexcept
+	{
+		if (_row >= rows)
+			return T(0);
+
+		auto begin = columnIndices.begin() + rowStarts[_row];
+		auto end = columnIndices.begin() + rowStarts[_row + 1];
+		auto it = std::lower_bound(begin, end, _column);
+
+		return it != end && *it == _column ? values[it - columnIndices.begin()] : T(0);
+	}
+
+	template<typename T>
+	void SparseMat<T>::GetDiagonal(T* _result) const noexcept
+	{
+		for (size_t row = 0; row < std::min(rows, columns); ++row)
+			_result[row] = Get(row, row);
+	}
+
+	//Methods
+
+	template<typename T>
+	DenseMat<T> SparseMat<T>::ToDense() const
+	{
+		DenseMat<T> result(rows, columns);
+
+		for (size_t row = 0; row < rows; ++row)
+		{
+			for (size_t i = rowStarts[row]; i < rowStarts[row + 1]; ++i)
+				result(row, columnIndices[i]) = values[i];
+		}
+
+		return result;
+	}
+
+	template struct MATHLIBRARY_API SparseMat<float>;
+	template struct MATHLIBRARY_API SparseMat<double>;
+}
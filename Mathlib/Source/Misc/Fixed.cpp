@@ -0,0 +1,159 @@
+#include <Misc/Fixed.hpp>
+#include <Misc/Callback.hpp>
+
+#define CLASS_NAME "Fixed"
+
+namespace Mathlib
+{
+	namespace
+	{
+		/**
+		*	\brief Divide the magnitudes _numerator * 2^_shift by _denominator, truncating.
+		*/
+		inline uint32_t DivideShifted(uint32_t _numerator, uint32_t _denominator, unsigned int _shift) noexcept
+		{
+			return static_cast<uint32_t>((static_cast<uint64_t>(_numerator) << _shift) / _denominator);
+		}
+
+		inline uint64_t DivideShifted(uint64_t _numerator, uint64_t _denominator, unsigned int _shift) noexcept
+		{
+			// Restoring long division of the 128 bits numerator (high, low), one quotient bit per step.
+			uint64_t high = _numerator >> (64 - _shift);
+			uint64_t low = _numerator << _shift;
+			uint64_t remainder = 0;
+			uint64_t quotient = 0;
+
+			for (int bit = 127; bit >= 0; --bit)
+			{
+				const bool carry = (remainder >> 63) != 0;
+				const uint64_t next = bit >= 64 ? (high >> (bit - 64)) & 1 : (low >> bit) & 1;
+				remainder = (remainder << 1) | next;
+
+				if (carry || remainder >= _denominator)
+				{
+					remainder -= _denominator;
+
+					if (bit < 64)
+						quotient |= uint64_t(1) << bit;
+				}
+			}
+
+			return quotient;
+		}
+	}
+
+	template<typename Storage, unsigned int FractionBits>
+	Fixed<Storage, FractionBits> Fixed<Storage, FractionBits>::Sqrt(Fixed _value) noexcept
+	{
+		if (_value.raw < 0)
+		{
+			Callback::CallErrorCallback(CLASS_NAME, "Sqrt", "Square root of a negative value");
+			return Fixed();
+		}
+
+		// Digit by digit square root of raw * 2^FractionBits, two bits of input at a time.
+		// remainder = input so far - result^2 stays below 2 * result + 1, so it never needs more than Storage bits.
+		static_assert(FractionBits % 2 == 0, "Sqrt consumes the fraction bits two by two");
+
+		constexpr unsigned int TotalBits = sizeof(Storage) * 8;
+		constexpr unsigned int Steps = (TotalBits + FractionBits) / 2;
+
+		UnsignedType value = static_cast<UnsignedType>(_value.raw);
+		UnsignedType remainder = 0;
+		UnsignedType result = 0;
+
+		for (unsigned int step = 0; step < Steps; ++step)
+		{
+			remainder <<= 2;
+
+			// The low FractionBits bits of the input are the zeros appended by the shift.
+			if (step < TotalBits / 2)
+			{
+				remainder |= value >> (TotalBits - 2);
+				value <<= 2;
+			}
+
+			const UnsignedType trial = (result << 2) | 1;
+			result <<= 1;
+
+			if (remainder >= trial)
+			{
+				remainder -= trial;
+				result |= 1;
+			}
+		}
+
+		// Round up when input >= (result + 0.5)^2, i.e. remainder >= result + 0.25.
+		if (remainder > result)
+			++result;
+
+		return FromRaw(static_cast<Storage>(result));
+	}
+
+	template<typename Storage, unsigned int FractionBits>
+	Fixed<Storage, FractionBits> Fixed<Storage, FractionBits>::Sin(Fixed _angle) noexcept
+	{
+		const Storage pi = Pi().raw;
+		const Storage two_pi = pi * 2;
+		const Storage half_pi = pi / 2;
+
+		// Reduce to [-pi, pi] then to [-pi/2, pi/2] with sin(pi - x) = sin(x).
+		Storage x = _angle.raw % two_pi;
+
+		if (x > pi)
+			x -= two_pi;
+		else if (x < -pi)
+			x += two_pi;
+
+		if (x > half_pi)
+			x = pi - x;
+		else if (x < -half_pi)
+			x = -pi - x;
+
+		// Taylor series up to x^15 in Horner form: x (1 - x^2 / (2 * 3) (1 - x^2 / (4 * 5) (1 - ...))).
+		const Fixed angle = FromRaw(x);
+		const Fixed sqr_angle = angle * angle;
+		const Fixed one = Fixed(1);
+
+		Fixed result = one;
+		for (Storage k = 14; k >= 2; k -= 2)
+		{
+			const Storage denominator = k * (k + 1);
+			const Fixed coefficient = FromRaw((OneRaw + denominator / 2) / denominator);
+
+			result = one - sqr_angle * coefficient * result;
+		}
+
+		return angle * result;
+	}
+
+	template<typename Storage, unsigned int FractionBits>
+	Fixed<Storage, FractionBits> Fixed<Storage, FractionBits>::Cos(Fixed _angle) noexcept
+	{
+		// Reduce first so adding pi/2 can not overflow.
+		const Storage two_pi = Pi().raw * 2;
+
+		return Sin(FromRaw(_angle.raw % two_pi + Pi().raw / 2));
+	}
+
+	template<typename Storage, unsigned int FractionBits>
+	Fixed<Storage, FractionBits> Fixed<Storage, FractionBits>::operator/(Fixed _rhs) const noexcept
+	{
+		if (_rhs.raw == 0)
+		{
+			Callback::CallErrorCallback(CLASS_NAME, "operator/", "Division by 0");
+			return Fixed();
+		}
+
+		const bool negative = (raw < 0) != (_rhs.raw < 0);
+		const UnsignedType lhs = raw < 0 ? UnsignedType(0) - static_cast<UnsignedType>(raw) : static_cast<UnsignedType>(raw);
+		const UnsignedType rhs = _rhs.raw < 0 ? UnsignedType(0) - static_cast<UnsignedType>(_rhs.raw) : static_cast<UnsignedType>(_rhs.raw);
+
+		const UnsignedType quotient = DivideShifted(lhs, rhs, FractionBits);
+
+		return FromRaw(static_cast<Storage>(negative ? UnsignedType(0) - quotient : quotient));
+	}
+
+	template struct MATHLIBRARY_API Fixed<int32_t, 16>;
+	template struct MATHLIBRARY_API Fixed<int64_t, 32>;
+}
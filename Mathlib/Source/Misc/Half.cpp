@@ -0,0 +1,294 @@
+#include <cstring>
+
+// F16C kernels are compiled for x86 even when the library is not built with -mf16c, and picked at runtime.
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <cpuid.h>
+#include <immintrin.h>
+#define MATHLIB_HALF_F16C
+#define MATHLIB_HALF_F16C_TARGET __attribute__((target("avx,f16c")))
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#include <immintrin.h>
+#define MATHLIB_HALF_F16C
+#define MATHLIB_HALF_F16C_TARGET
+#endif
+
+#include <Misc/Half.hpp>
+#include <Misc/Parallel.hpp>
+
+using namespace Mathlib;
+
+namespace
+{
+	/// Minimum number of values converted by one thread.
+	constexpr size_t MinBatch = 16384;
+
+	/**
+	*	\brief Convert float bits to half bits, rounding to nearest even.
+	*/
+	uint16_t FloatToHalfBits(float _value) noexcept
+	{
+		uint32_t value;
+		std::memcpy(&value, &_value, sizeof(value));
+
+		const uint16_t sign = static_cast<uint16_t>((value >> 16) & 0x8000u);
+		const uint32_t magnitude = value & 0x7FFFFFFFu;
+
+		// Infinity and NaN, NaN payloads are truncated and made quiet.
+		if (magnitude >= 0x7F800000u)
+			return sign | 0x7C00u | (magnitude > 0x7F800000u ? 0x0200u | ((magnitude >> 13) & 0x03FFu) : 0u);
+
+		// 65520 and above round to infinity.
+		if (magnitude >= 0x477FF000u)
+			return sign | 0x7C00u;
+
+		// Below the smallest normal half: subnormal result, 2^-25 and below round to 0.
+		if (magnitude < 0x38800000u)
+		{
+			if (magnitude < 0x33000000u)
+				return sign;
+
+			const uint32_t shift = 126u - (magnitude >> 23);
+			const uint32_t mantissa = (magnitude & 0x007FFFFFu) | 0x00800000u;
+			const uint32_t remainder = mantissa & ((1u << shift) - 1u);
+			const uint32_t halfway = 1u << (shift - 1u);
+			uint32_t result = mantissa >> shift;
+
+			if (remainder > halfway || (remainder == halfway && (result & 1u)))
+				++result;
+
+			return sign | static_cast<uint16_t>(result);
+		}
+
+		// Normal result, rebias the exponent from 127 to 15. A carry out of the mantissa correctly bumps the exponent.
+		uint32_t result = (magnitude - 0x38000000u) >> 13;
+		const uint32_t remainder = magnitude & 0x1FFFu;
+
+		if (remainder > 0x1000u || (remainder == 0x1000u && (result & 1u)))
+			++result;
+
+		return sign | static_cast<uint16_t>(result);
+	}
+
+	/**
+	*	\brief Convert half bits to float, exact.
+	*/
+	float HalfBitsToFloat(uint16_t _bits) noexcept
+	{
+		const uint32_t sign = static_cast<uint32_t>(_bits & 0x8000u) << 16;
+		const uint32_t exponent = (_bits >> 10) & 0x1Fu;
+		uint32_t mantissa = _bits & 0x03FFu;
+		uint32_t result;
+
+		if (exponent == 0x1Fu)
+			result = sign | 0x7F800000u | (mantissa << 13) | (mantissa != 0 ? 0x00400000u : 0u);
+		else if (exponent != 0)
+			result = sign | ((exponent + 112u) << 23) | (mantissa << 13);
+		else if (mantissa == 0)
+			result = sign;
+		else
+		{
+			// Subnormal half, normalize the mantissa.
+			uint32_t float_exponent = 113u;
+
+			while ((mantissa & 0x0400u) == 0)
+			{
+				mantissa <<= 1;
+				--float_exponent;
+			}
+
+			result = sign | (float_exponent << 23) | ((mantissa & 0x03FFu) << 13);
+		}
+
+		float value;
+		std::memcpy(&value, &result, sizeof(value));
+
+		return value;
+	}
+
+#ifdef MATHLIB_HALF_F16C
+	/**
+	*	\brief Check with cpuid that the CPU has F16C and AVX, and that the OS saves the YMM registers.
+	*/
+	bool DetectF16C() noexcept
+	{
+#if defined(__F16C__)
+		return true;
+#else
+		unsigned int registers[4] = {};
+
+#if defined(_MSC_VER)
+		int info[4];
+		__cpuid(info, 1);
+		std::memcpy(registers, info, sizeof(registers));
+#else
+		if (!__get_cpuid(1, &registers[0], &registers[1], &registers[2], &registers[3]))
+			return false;
+#endif
+
+		const unsigned int ecx = registers[2];
+		const bool osxsave = (ecx & (1u << 27)) != 0;
+		const bool avx = (ecx & (1u << 28)) != 0;
+		const bool f16c = (ecx & (1u << 29)) != 0;
+
+		if (!osxsave || !avx || !f16c)
+			return false;
+
+		// XCR0 bits 1 and 2: SSE and AVX states are enabled by the OS.
+#if defined(_MSC_VER)
+		const unsigned long long xcr0 = _xgetbv(0);
+#else
+		unsigned int eax, edx;
+		__asm__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+		const unsigned long long xcr0 = (static_cast<unsigned long long>(edx) << 32) | eax;
+#endif
+
+		return (xcr0 & 0x6u) == 0x6u;
+#endif
+	}
+
+	/**
+	*	\brief Convert values by 8 with F16C from _begin, return the index of the first value left.
+	*/
+	MATHLIB_HALF_F16C_TARGET size_t ToFloatF16C(const Half* _values, float* _results, size_t _begin, size_t _end) noexcept
+	{
+		size_t i = _begin;
+
+		for (; i + 8 <= _end; i += 8)
+		{
+			const __m128i halves = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_values + i));
+			_mm256_storeu_ps(_results + i, _mm256_cvtph_ps(halves));
+		}
+
+		return i;
+	}
+
+	/**
+	*	\brief Convert values by 8 with F16C from _begin, return the index of the first value left.
+	*/
+	MATHLIB_HALF_F16C_TARGET size_t FromFloatF16C(const float* _values, Half* _results, size_t _begin, size_t _end) noexcept
+	{
+		size_t i = _begin;
+
+		for (; i + 8 <= _end; i += 8)
+		{
+			const __m128i halves = _mm256_cvtps_ph(_mm256_loadu_ps(_values + i), _MM_FROUND_TO_NEAREST_INT);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(_results + i), halves);
+		}
+
+		return i;
+	}
+#endif
+
+	void ToFloatRange(const Half* _values, float* _results, size_t _begin, size_t _end) noexcept
+	{
+		size_t i = _begin;
+
+#ifdef MATHLIB_HALF_F16C
+		if (Half::HasHardwareConversion())
+			i = ToFloatF16C(_values, _results, i, _end);
+#endif
+
+		for (; i < _end; ++i)
+			_results[i] = HalfBitsToFloat(_values[i].bits);
+	}
+
+	void FromFloatRange(const float* _values, Half* _results, size_t _begin, size_t _end) noexcept
+	{
+		size_t i = _begin;
+
+#ifdef MATHLIB_HALF_F16C
+		if (Half::HasHardwareConversion())
+			i = FromFloatF16C(_values, _results, i, _end);
+#endif
+
+		for (; i < _end; ++i)
+			_results[i].bits = FloatToHalfBits(_values[i]);
+	}
+}
+
+static_assert(sizeof(Half) == sizeof(uint16_t), "Half must be tightly packed for bulk conversions");
+
+//Constructors
+
+Half::Half(float _value) noexcept :
+	bits{ FloatToHalfBits(_value) }
+{
+}
+
+//Static Methods
+
+Half Half::FromBits(uint16_t _bits) noexcept
+{
+	Half result;
+	result.bits = _bits;
+
+	return result;
+}
+
+void Half::ToFloat(const Half* _values, size_t _count, float* _results, bool _multithreaded)
+{
+	auto process = [_values, _results](size_t _begin, size_t _end) { ToFloatRange(_values, _results, _begin, _end); };
+
+	Math::ParallelFor(0, _count, MinBatch, _multithreaded, process);
+}
+
+void Half::FromFloat(const float* _values, size_t _count, Half* _results, bool _multithreaded)
+{
+	auto process = [_values, _results](size_t _begin, size_t _end) { FromFloatRange(_values, _results, _begin, _end); };
+
+	Math::ParallelFor(0, _count, MinBatch, _multithreaded, process);
+}
+
+bool Half::HasHardwareConversion() noexcept
+{
+#ifdef MATHLIB_HALF_F16C
+	static const bool supported = DetectF16C();
+	return supported;
+#else
+	return false;
+#endif
+}
+
+//Equality
+
+bool Half::operator==(const Half& _rhs) const noexcept
+{
+	return bits == _rhs.bits;
+}
+
+bool Half::operator!=(const Half& _rhs) const noexcept
+{
+	return bits != _rhs.bits;
+}
+
+//Accessors
+
+float Half::ToFloat() const noexcept
+{
+	return HalfBitsToFloat(bits);
+}
+
+bool Half::IsNaN() const noexcept
+{
+	return (bits & 0x7C00u) == 0x7C00u && (bits & 0x03FFu) != 0;
+}
+
+bool Half::IsInfinity() const noexcept
+{
+	return (bits & 0x7FFFu) == 0x7C00u;
+}
+
+//Operator
+
+Half::operator float() const noexcept
+{
+	return HalfBitsToFloat(bits);
+}
+
+//Debug
+
+std::string Half::ToString() const noexcept
+{
+	return std::to_string(ToFloat());
+}
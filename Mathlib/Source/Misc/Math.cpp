@@ -1,10 +1,19 @@
+#if defined(__SSE__) || defined(_M_X64)
+#include <xmmintrin.h>
+#define MATHLIB_MATH_SSE
+#endif
+
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <ctime>
+#include <limits>
 
 #include <Misc/Math.hpp>
 #include <Misc/Callback.hpp>
+#include <Misc/Parallel.hpp>
 
 #define CLASS_NAME "Math"
 
@@ -12,6 +21,96 @@ namespace Mathlib
 {
 	namespace Math
 	{
+		namespace
+		{
+			/// Number of vectors normalized together by NormalizeFast.
+			constexpr size_t NormalizeBlock = 64;
+
+			/// Minimum number of vectors normalized by one thread.
+			constexpr size_t MinNormalizeBatch = 16384;
+
+			/**
+			*	\brief Refine an estimate of 1 / sqrt(_value) with one Newton step, squaring its relative error.
+			*/
+			inline float Refine(float _value, float _estimate) noexcept
+			{
+				const float half_value_estimate = 0.5f * _value * _estimate;
+				return _estimate * (1.5f - half_value_estimate * _estimate);
+			}
+
+			/**
+			*	\brief Normalize a vector of D components whose squared length is denormal or 0, by dividing it by its largest component first.
+			*	Squaring a denormal loses its precision and FastInverseSqrt overflows, the rescaled squared length is in [1, D].
+			*/
+			template<size_t D>
+			void NormalizeTiny(const float* _vector, float* _result) noexcept
+			{
+				float largest = 0.f;
+				for (size_t d = 0; d < D; ++d)
+					largest = std::max(largest, std::abs(_vector[d]));
+
+				if (largest == 0.f)
+				{
+					for (size_t d = 0; d < D; ++d)
+						_result[d] = 0.f;
+
+					return;
+				}
+
+				float scaled[D];
+				float squared_length = 0.f;
+				for (size_t d = 0; d < D; ++d)
+				{
+					scaled[d] = _vector[d] / largest;
+					squared_length += scaled[d] * scaled[d];
+				}
+
+				const float scale = FastInverseSqrt(squared_length);
+				for (size_t d = 0; d < D; ++d)
+					_result[d] = scaled[d] * scale;
+			}
+
+			/**
+			*	\brief Normalize vectors [_begin, _end) of D components by blocks, inverse square roots computed together.
+			*/
+			template<size_t D>
+			void NormalizeRange(const float* _vectors, float* _result, size_t _begin, size_t _end) noexcept
+			{
+				float squared_lengths[NormalizeBlock];
+				float inverse_lengths[NormalizeBlock];
+
+				for (size_t first = _begin; first < _end; first += NormalizeBlock)
+				{
+					const size_t count = std::min(NormalizeBlock, _end - first);
+					const float* input = _vectors + first * D;
+					float* output = _result + first * D;
+
+					for (size_t i = 0; i < count; ++i)
+					{
+						float squared_length = 0.f;
+						for (size_t d = 0; d < D; ++d)
+							squared_length += input[i * D + d] * input[i * D + d];
+
+						squared_lengths[i] = squared_length;
+					}
+
+					FastInverseSqrt(squared_lengths, count, inverse_lengths);
+
+					for (size_t i = 0; i < count; ++i)
+					{
+						if (squared_lengths[i] < std::numeric_limits<float>::min())
+						{
+							NormalizeTiny<D>(input + i * D, output + i * D);
+							continue;
+						}
+
+						for (size_t d = 0; d < D; ++d)
+							output[i * D + d] = input[i * D + d] * inverse_lengths[i];
+					}
+				}
+			}
+		}
+
 		int Abs(int _value) noexcept
 		{
 			return _value < 0 ? -_value : _value;
@@ -80,6 +179,69 @@ namespace Mathlib
 			return std::sqrt(_value);
 		}
 
+		float FastInverseSqrt(float _value) noexcept
+		{
+#ifdef MATHLIB_MATH_SSE
+			// Estimate with 1.5 * 2^-12 relative error, one step brings it to float precision.
+			const float estimate = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(_value)));
+
+			return Refine(_value, estimate);
+#else
+			// Estimate with 3.5e-2 relative error from the exponent bits, three steps bring it to float precision.
+			uint32_t bits;
+			std::memcpy(&bits, &_value, sizeof(bits));
+			bits = 0x5f375a86u - (bits >> 1);
+
+			float estimate;
+			std::memcpy(&estimate, &bits, sizeof(estimate));
+
+			return Refine(_value, Refine(_value, Refine(_value, estimate)));
+#endif
+		}
+
+		void FastInverseSqrt(const float* _values, size_t _count, float* _result) noexcept
+		{
+			size_t i = 0;
+
+#ifdef MATHLIB_MATH_SSE
+			const __m128 half = _mm_set1_ps(0.5f);
+			const __m128 three_halves = _mm_set1_ps(1.5f);
+
+			for (; i + 4 <= _count; i += 4)
+			{
+				const __m128 values = _mm_loadu_ps(_values + i);
+				const __m128 estimate = _mm_rsqrt_ps(values);
+				const __m128 half_value_estimate = _mm_mul_ps(_mm_mul_ps(half, values), estimate);
+
+				_mm_storeu_ps(_result + i, _mm_mul_ps(estimate, _mm_sub_ps(three_halves, _mm_mul_ps(half_value_estimate, estimate))));
+			}
+#endif
+
+			for (; i < _count; ++i)
+				_result[i] = FastInverseSqrt(_values[i]);
+		}
+
+		void NormalizeFast(const float* _vectors, size_t _count, size_t _dimension, float* _result, bool _multithreaded)
+		{
+			if (_dimension < 2 || _dimension > 4)
+			{
+				Callback::CallErrorCallback(CLASS_NAME, "NormalizeFast", "Vectors must have 2 to 4 components");
+				return;
+			}
+
+			auto process = [_vectors, _dimension, _result](size_t _begin, size_t _end)
+			{
+				if (_dimension == 2)
+					NormalizeRange<2>(_vectors, _result, _begin, _end);
+				else if (_dimension == 3)
+					NormalizeRange<3>(_vectors, _result, _begin, _end);
+				else
+					NormalizeRange<4>(_vectors, _result, _begin, _end);
+			};
+
+			ParallelFor(0, _count, MinNormalizeBatch, _multithreaded, process);
+		}
+
 		bool Equals(float _lhs, float _rhs, float _epsilon) noexcept
 		{
 			return std::abs(_lhs - _rhs) <= _epsilon;
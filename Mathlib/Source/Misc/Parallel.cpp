@@ -0,0 +1,16 @@
+#include <algorithm>
+#include <thread>
+
+#include <Misc/Parallel.hpp>
+
+namespace Mathlib
+{
+	namespace Math
+	{
+		unsigned int GetThreadCount() noexcept
+		{
+			static const unsigned int thread_count = std::max(1u, std::thread::hardware_concurrency());
+			return thread_count;
+		}
+	}
+}
@@ -0,0 +1,174 @@
+#include <algorithm>
+#include <cmath>
+
+#include <Physics/ConvexShape.hpp>
+#include <Transform/Transform.hpp>
+#include <Matrix/Mat4.hpp>
+#include <Misc/Callback.hpp>
+
+using namespace Mathlib;
+
+#define CLASS_NAME "ConvexShape"
+
+namespace
+{
+	/**
+	*	\brief Multiply a vector by the transpose of a matrix.
+	*/
+	inline Vec3 MultiplyTransposed(const Mat3& _m, const Vec3& _v) noexcept
+	{
+		return Vec3(_m.e00 * _v.X + _m.e10 * _v.Y + _m.e20 * _v.Z,
+			_m.e01 * _v.X + _m.e11 * _v.Y + _m.e21 * _v.Z,
+			_m.e02 * _v.X + _m.e12 * _v.Y + _m.e22 * _v.Z);
+	}
+}
+
+//Static Methods
+
+ConvexShape ConvexShape::CreateSphere(float _radius, const Transform& _transform)
+{
+	ConvexShape shape;
+	shape.type = CONVEX_SHAPE::SPHERE;
+	shape.radius = _radius;
+	shape.SetTransform(_transform);
+	return shape;
+}
+
+ConvexShape ConvexShape::CreateBox(const Vec3& _half_extents, const Transform& _transform)
+{
+	ConvexShape shape;
+	shape.type = CONVEX_SHAPE::BOX;
+	shape.halfExtents = _half_extents;
+	shape.SetTransform(_transform);
+	return shape;
+}
+
+ConvexShape ConvexShape::CreateCapsule(float _half_height, float _radius, const Transform& _transform)
+{
+	ConvexShape shape;
+	shape.type = CONVEX_SHAPE::CAPSULE;
+	shape.halfHeight = _half_height;
+	shape.radius = _radius;
+	shape.SetTransform(_transform);
+	return shape;
+}
+
+ConvexShape ConvexShape::CreateHull(const Vec3* _points, size_t _count, const Transform& _transform)
+{
+	ConvexShape shape;
+	shape.type = CONVEX_SHAPE::HULL;
+
+	if (_points == nullptr || _count == 0)
+		Callback::CallErrorCallback(CLASS_NAME, "CreateHull", "Hull needs at least one point.");
+	else
+	{
+		shape.points = _points;
+		shape.pointCount = _count;
+	}
+
+	shape.SetTransform(_transform);
+	return shape;
+}
+
+ConvexShape ConvexShape::CreateCustom(ConvexSupportFunction _function, const void* _user_data, const Transform& _transform)
+{
+	ConvexShape shape;
+	shape.type = CONVEX_SHAPE::CUSTOM;
+
+	if (_function == nullptr)
+		Callback::CallErrorCallback(CLASS_NAME, "CreateCustom", "Support function is null.");
+
+	shape.function = _function;
+	shape.userData = _user_data;
+	shape.SetTransform(_transform);
+	return shape;
+}
+
+//Accessors
+
+void ConvexShape::SetTransform(const Transform& _transform)
+{
+	position = _transform.position;
+	basis = Mat3(_transform.ToMatrixWithScale());
+
+	float scale_x = std::abs(_transform.scale.X);
+	float scale_y = std::abs(_transform.scale.Y);
+	float scale_z = std::abs(_transform.scale.Z);
+
+	// Capsules keep a round section perpendicular to their axis.
+	radiusScale = type == CONVEX_SHAPE::CAPSULE ? std::max(scale_x, scale_z) : std::max(std::max(scale_x, scale_y), scale_z);
+}
+
+float ConvexShape::GetMargin() const noexcept
+{
+	return (type == CONVEX_SHAPE::SPHERE || type == CONVEX_SHAPE::CAPSULE) ? radius * radiusScale : 0.f;
+}
+
+//Methods
+
+Vec3 ConvexShape::GetSupport(const Vec3& _direction) const noexcept
+{
+	Vec3 support = GetCoreSupport(_direction);
+
+	float margin = GetMargin();
+	if (margin > 0.f)
+	{
+		float length = _direction.Length();
+		if (length > 0.f)
+			support += _direction * (margin / length);
+	}
+
+	return support;
+}
+
+Vec3 ConvexShape::GetCoreSupport(const Vec3& _direction) const noexcept
+{
+	// Support of a linearly transformed shape: basis * support(basis^T * direction).
+	const Vec3 local_direction = MultiplyTransposed(basis, _direction);
+	Vec3 local_support;
+
+	switch (type)
+	{
+	case CONVEX_SHAPE::SPHERE:
+		break;
+
+	case CONVEX_SHAPE::BOX:
+		local_support = Vec3(local_direction.X >= 0.f ? halfExtents.X : -halfExtents.X,
+			local_direction.Y >= 0.f ? halfExtents.Y : -halfExtents.Y,
+			local_direction.Z >= 0.f ? halfExtents.Z : -halfExtents.Z);
+		break;
+
+	case CONVEX_SHAPE::CAPSULE:
+		local_support = Vec3(0.f, local_direction.Y >= 0.f ? halfHeight : -halfHeight, 0.f);
+		break;
+
+	case CONVEX_SHAPE::HULL:
+	{
+		if (pointCount == 0)
+			break;
+
+		size_t best = 0;
+		float best_dot = Vec3::DotProduct(points[0], local_direction);
+
+		for (size_t i = 1; i < pointCount; ++i)
+		{
+			float dot = Vec3::DotProduct(points[i], local_direction);
+			if (dot > best_dot)
+			{
+				best_dot = dot;
+				best = i;
+			}
+		}
+
+		local_support = points[best];
+		break;
+	}
+
+	case CONVEX_SHAPE::CUSTOM:
+		if (function)
+			local_support = function(local_direction, userData);
+		break;
+	}
+
+	return position + basis * local_support;
+}
@@ -0,0 +1,650 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#include <Physics/GJK.hpp>
+#include <Physics/ConvexShape.hpp>
+#include <Misc/Parallel.hpp>
+
+namespace Mathlib
+{
+	namespace GJK
+	{
+		namespace
+		{
+			/// Maximum number of GJK iterations.
+			constexpr unsigned int MaxIterations = 64;
+
+			/// Relative distance improvement under which GJK stops.
+			constexpr float RelativeTolerance = 1e-6f;
+
+			/// Squared distance under which the origin is considered inside the simplex.
+			constexpr float IntersectionTolerance = 1e-10f;
+
+			/// Squared relative height under which a tetrahedron is considered flat.
+			constexpr float FlatTolerance = 1e-10f;
+
+			/// Maximum number of EPA expansions.
+			constexpr unsigned int MaxEPAIterations = 64;
+
+			/// Relative depth improvement under which EPA stops.
+			constexpr float EPATolerance = 1e-4f;
+
+			/// Capacity of the EPA polytope.
+			constexpr unsigned int MaxPolytopeVertices = MaxEPAIterations + 4;
+			constexpr unsigned int MaxPolytopeFaces = 2 * MaxPolytopeVertices;
+			constexpr unsigned int MaxHorizonEdges = 3 * MaxPolytopeFaces;
+
+			/// Minimum number of pairs processed by one thread of CollideBatch.
+			constexpr size_t ParallelBatch = 64;
+
+			/**
+			*	\brief Point of the Minkowski difference w = a - b with its witness points on each shape.
+			*/
+			struct SupportPoint
+			{
+				Vec3 w;
+				Vec3 a;
+				Vec3 b;
+			};
+
+			/**
+			*	\brief GJK simplex, the closest point to the origin being the weighted sum of its points.
+			*/
+			struct Simplex
+			{
+				SupportPoint points[4];
+				float weights[4] = { 1.f, 0.f, 0.f, 0.f };
+				unsigned int count = 0;
+			};
+
+			/**
+			*	\brief How a GJK run ended.
+			*/
+			enum class GJK_STATUS
+			{
+				SEPARATED,
+				CONVERGED,
+				INTERSECTING
+			};
+
+			/**
+			*	\brief EPA polytope face, wound counter clockwise seen from outside.
+			*/
+			struct Face
+			{
+				uint32_t vertices[3];
+				Vec3 normal;
+				float distance;
+			};
+
+			inline SupportPoint CoreSupport(const ConvexShape& _a, const ConvexShape& _b, const Vec3& _direction) noexcept
+			{
+				SupportPoint point;
+				point.a = _a.GetCoreSupport(_direction);
+				point.b = _b.GetCoreSupport(-_direction);
+				point.w = point.a - point.b;
+				return point;
+			}
+
+			/**
+			*	\brief Reduce a simplex to one of its vertices.
+			*/
+			inline Vec3 KeepVertex(Simplex& _simplex, unsigned int _index) noexcept
+			{
+				_simplex.points[0] = _simplex.points[_index];
+				_simplex.weights[0] = 1.f;
+				_simplex.count = 1;
+				return _simplex.points[0].w;
+			}
+
+			/**
+			*	\brief Reduce a simplex to one of its edges, _t weighting the second vertex.
+			*/
+			inline Vec3 KeepEdge(Simplex& _simplex, unsigned int _first, unsigned int _second, float _t) noexcept
+			{
+				SupportPoint first = _simplex.points[_first];
+				SupportPoint second = _simplex.points[_second];
+
+				_simplex.points[0] = first;
+				_simplex.points[1] = second;
+				_simplex.weights[0] = 1.f - _t;
+				_simplex.weights[1] = _t;
+				_simplex.count = 2;
+				return first.w + (second.w - first.w) * _t;
+			}
+
+			Vec3 SolveSegment(Simplex& _simplex) noexcept
+			{
+				const Vec3 a = _simplex.points[0].w;
+				const Vec3 ab = _simplex.points[1].w - a;
+
+				float t = -Vec3::DotProduct(a, ab);
+				if (t <= 0.f)
+					return KeepVertex(_simplex, 0);
+
+				float denominator = Vec3::DotProduct(ab, ab);
+				if (t >= denominator)
+					return KeepVertex(_simplex, 1);
+
+				return KeepEdge(_simplex, 0, 1, t / denominator);
+			}
+
+			/**
+			*	\brief Closest point of a triangle to the origin (Ericson, Real-Time Collision Detection 5.1.5).
+			*/
+			Vec3 SolveTriangle(Simplex& _simplex) noexcept
+			{
+				const Vec3 a = _simplex.points[0].w;
+				const Vec3 b = _simplex.points[1].w;
+				const Vec3 c = _simplex.points[2].w;
+				const Vec3 ab = b - a;
+				const Vec3 ac = c - a;
+
+				float d1 = -Vec3::DotProduct(ab, a);
+				float d2 = -Vec3::DotProduct(ac, a);
+				if (d1 <= 0.f && d2 <= 0.f)
+					return KeepVertex(_simplex, 0);
+
+				float d3 = -Vec3::DotProduct(ab, b);
+				float d4 = -Vec3::DotProduct(ac, b);
+				if (d3 >= 0.f && d4 <= d3)
+					return KeepVertex(_simplex, 1);
+
+				float vc = d1 * d4 - d3 * d2;
+				if (vc <= 0.f && d1 >= 0.f && d3 <= 0.f)
+					return KeepEdge(_simplex, 0, 1, d1 / (d1 - d3));
+
+				float d5 = -Vec3::DotProduct(ab, c);
+				float d6 = -Vec3::DotProduct(ac, c);
+				if (d6 >= 0.f && d5 <= d6)
+					return KeepVertex(_simplex, 2);
+
+				float vb = d5 * d2 - d1 * d6;
+				if (vb <= 0.f && d2 >= 0.f && d6 <= 0.f)
+					return KeepEdge(_simplex, 0, 2, d2 / (d2 - d6));
+
+				float va = d3 * d6 - d5 * d4;
+				if (va <= 0.f && (d4 - d3) >= 0.f && (d5 - d6) >= 0.f)
+					return KeepEdge(_simplex, 1, 2, (d4 - d3) / ((d4 - d3) + (d5 - d6)));
+
+				float denominator = 1.f / (va + vb + vc);
+				float v = vb * denominator;
+				float w = vc * denominator;
+
+				_simplex.weights[0] = 1.f - v - w;
+				_simplex.weights[1] = v;
+				_simplex.weights[2] = w;
+				return a + ab * v + ac * w;
+			}
+
+			/**
+			*	\brief Closest point of a tetrahedron to the origin, _inside set when it contains the origin.
+			*/
+			Vec3 SolveTetrahedron(Simplex& _simplex, bool& _inside) noexcept
+			{
+				static constexpr unsigned int faces[4][4] = { { 0, 1, 2, 3 }, { 0, 2, 3, 1 }, { 0, 3, 1, 2 }, { 1, 3, 2, 0 } };
+
+				float best_sqr_distance = std::numeric_limits<float>::max();
+				Simplex best;
+				Vec3 best_point;
+				bool outside_any = false;
+
+				float sqr_size = 0.f;
+				for (unsigned int i = 1; i < 4; ++i)
+					sqr_size = std::max(sqr_size, (_simplex.points[i].w - _simplex.points[0].w).SquaredLength());
+
+				for (const unsigned int* face : faces)
+				{
+					const Vec3& a = _simplex.points[face[0]].w;
+					const Vec3 normal = Vec3::CrossProduct(_simplex.points[face[1]].w - a, _simplex.points[face[2]].w - a);
+
+					float origin_side = -Vec3::DotProduct(normal, a);
+					float opposite_side = Vec3::DotProduct(normal, _simplex.points[face[3]].w - a);
+
+					// A nearly flat tetrahedron gives unreliable sides, only trust its faces.
+					bool flat = opposite_side * opposite_side <= FlatTolerance * normal.SquaredLength() * sqr_size;
+
+					// Origin strictly on the other side of the face than the fourth vertex.
+					if (flat || origin_side * opposite_side < 0.f)
+					{
+						outside_any = true;
+
+						Simplex triangle;
+						triangle.points[0] = _simplex.points[face[0]];
+						triangle.points[1] = _simplex.points[face[1]];
+						triangle.points[2] = _simplex.points[face[2]];
+						triangle.count = 3;
+
+						Vec3 point = SolveTriangle(triangle);
+						float sqr_distance = Vec3::DotProduct(point, point);
+
+						if (sqr_distance < best_sqr_distance)
+						{
+							best_sqr_distance = sqr_distance;
+							best = triangle;
+							best_point = point;
+						}
+					}
+				}
+
+				if (!outside_any)
+				{
+					_inside = true;
+					return Vec3::Zero;
+				}
+
+				_simplex = best;
+				return best_point;
+			}
+
+			Vec3 Solve(Simplex& _simplex, bool& _inside) noexcept
+			{
+				switch (_simplex.count)
+				{
+				case 2:
+					return SolveSegment(_simplex);
+				case 3:
+					return SolveTriangle(_simplex);
+				case 4:
+					return SolveTetrahedron(_simplex, _inside);
+				default:
+					return _simplex.points[0].w;
+				}
+			}
+
+			/**
+			*	\brief Run GJK on shape cores from a start direction pointing from the second shape to the first.
+			*	With _separation_margin >= 0, stops as soon as the cores are proven farther apart than it.
+			*/
+			GJK_STATUS RunGJK(const ConvexShape& _a, const ConvexShape& _b, const Vec3& _direction, float _separation_margin,
+				Simplex& _simplex, Vec3& _closest) noexcept
+			{
+				Vec3 direction = Vec3::DotProduct(_direction, _direction) > 0.f ? _direction : Vec3(1.f, 0.f, 0.f);
+
+				_simplex.points[0] = CoreSupport(_a, _b, -direction);
+				_simplex.weights[0] = 1.f;
+				_simplex.count = 1;
+				_closest = _simplex.points[0].w;
+
+				for (unsigned int iteration = 0; iteration < MaxIterations; ++iteration)
+				{
+					const float sqr_distance = Vec3::DotProduct(_closest, _closest);
+					if (sqr_distance <= IntersectionTolerance)
+						return GJK_STATUS::INTERSECTING;
+
+					SupportPoint support = CoreSupport(_a, _b, -_closest);
+					const float projection = Vec3::DotProduct(_closest, support.w);
+
+					// projection / |v| lower bounds the distance between the cores.
+					if (_separation_margin >= 0.f && projection > 0.f && projection * projection > sqr_distance * _separation_margin * _separation_margin)
+						return GJK_STATUS::SEPARATED;
+
+					if (sqr_distance - projection <= RelativeTolerance * sqr_distance)
+						return GJK_STATUS::CONVERGED;
+
+					for (unsigned int i = 0; i < _simplex.count; ++i)
+					{
+						if (_simplex.points[i].w == support.w)
+							return GJK_STATUS::CONVERGED;
+					}
+
+					_simplex.points[_simplex.count++] = support;
+
+					bool inside = false;
+					_closest = Solve(_simplex, inside);
+
+					if (inside)
+						return GJK_STATUS::INTERSECTING;
+
+					// No progress left to make in float precision.
+					if (Vec3::DotProduct(_closest, _closest) >= sqr_distance)
+						return GJK_STATUS::CONVERGED;
+				}
+
+				return GJK_STATUS::CONVERGED;
+			}
+
+			/**
+			*	\brief Grow a simplex containing the origin into a non degenerate tetrahedron of the cores difference.
+			*/
+			bool BuildTetrahedron(const ConvexShape& _a, const ConvexShape& _b, Simplex& _simplex) noexcept
+			{
+				static const Vec3 axes[3] = { Vec3(1.f, 0.f, 0.f), Vec3(0.f, 1.f, 0.f), Vec3(0.f, 0.f, 1.f) };
+				constexpr float DegenerateTolerance = 1e-10f;
+
+				if (_simplex.count == 1)
+				{
+					for (unsigned int i = 0; i < 6 && _simplex.count == 1; ++i)
+					{
+						SupportPoint point = CoreSupport(_a, _b, i < 3 ? axes[i] : -axes[i - 3]);
+						if ((point.w - _simplex.points[0].w).SquaredLength() > DegenerateTolerance)
+							_simplex.points[_simplex.count++] = point;
+					}
+				}
+
+				if (_simplex.count == 2)
+				{
+					const Vec3 segment = _simplex.points[1].w - _simplex.points[0].w;
+
+					for (unsigned int i = 0; i < 6 && _simplex.count == 2; ++i)
+					{
+						Vec3 direction = Vec3::CrossProduct(segment, axes[i % 3]);
+						if (i >= 3)
+							direction = -direction;
+
+						if (direction.SquaredLength() <= DegenerateTolerance)
+							continue;
+
+						SupportPoint point = CoreSupport(_a, _b, direction);
+						if (Vec3::CrossProduct(point.w - _simplex.points[0].w, segment).SquaredLength() > DegenerateTolerance)
+							_simplex.points[_simplex.count++] = point;
+					}
+				}
+
+				if (_simplex.count == 3)
+				{
+					const Vec3 normal = Vec3::CrossProduct(_simplex.points[1].w - _simplex.points[0].w, _simplex.points[2].w - _simplex.points[0].w);
+
+					for (unsigned int i = 0; i < 2 && _simplex.count == 3; ++i)
+					{
+						SupportPoint point = CoreSupport(_a, _b, i == 0 ? normal : -normal);
+						float offset = Vec3::DotProduct(point.w - _simplex.points[0].w, normal);
+
+						if (offset * offset > DegenerateTolerance * normal.SquaredLength())
+							_simplex.points[_simplex.count++] = point;
+					}
+				}
+
+				return _simplex.count == 4;
+			}
+
+			/**
+			*	\brief Compute normal and distance to the origin of a face, degenerate faces being pushed away from selection.
+			*/
+			void ComputeFace(const SupportPoint* _vertices, Face& _face) noexcept
+			{
+				const Vec3& a = _vertices[_face.vertices[0]].w;
+				Vec3 normal = Vec3::CrossProduct(_vertices[_face.vertices[1]].w - a, _vertices[_face.vertices[2]].w - a);
+				float length = normal.Length();
+
+				if (length <= std::numeric_limits<float>::min())
+				{
+					_face.normal = Vec3::Zero;
+					_face.distance = std::numeric_limits<float>::max();
+					return;
+				}
+
+				_face.normal = normal / length;
+				_face.distance = Vec3::DotProduct(_face.normal, a);
+			}
+
+			/**
+			*	\brief Expanding polytope algorithm on shape cores, _simplex being a tetrahedron containing the origin.
+			*/
+			void RunEPA(const ConvexShape& _a, const ConvexShape& _b, const Simplex& _simplex, GJKResult& _result) noexcept
+			{
+				SupportPoint vertices[MaxPolytopeVertices];
+				Face faces[MaxPolytopeFaces];
+				uint32_t edges[MaxHorizonEdges][2];
+
+				unsigned int vertex_count = 4;
+				unsigned int face_count = 0;
+
+				for (unsigned int i = 0; i < 4; ++i)
+					vertices[i] = _simplex.points[i];
+
+				static constexpr uint32_t tetrahedron[4][4] = { { 0, 1, 2, 3 }, { 0, 3, 1, 2 }, { 0, 2, 3, 1 }, { 1, 3, 2, 0 } };
+				for (const uint32_t* indices : tetrahedron)
+				{
+					Face& face = faces[face_count++];
+					face.vertices[0] = indices[0];
+					face.vertices[1] = indices[1];
+					face.vertices[2] = indices[2];
+
+					// Wind outward, away from the opposite vertex.
+					const Vec3& a = vertices[indices[0]].w;
+					Vec3 normal = Vec3::CrossProduct(vertices[indices[1]].w - a, vertices[indices[2]].w - a);
+					if (Vec3::DotProduct(normal, vertices[indices[3]].w - a) > 0.f)
+						std::swap(face.vertices[1], face.vertices[2]);
+
+					ComputeFace(vertices, face);
+				}
+
+				unsigned int closest = 0;
+
+				for (unsigned int iteration = 0; iteration < MaxEPAIterations; ++iteration)
+				{
+					closest = 0;
+					for (unsigned int i = 1; i < face_count; ++i)
+					{
+						if (faces[i].distance < faces[closest].distance)
+							closest = i;
+					}
+
+					const Face& face = faces[closest];
+					SupportPoint support = CoreSupport(_a, _b, face.normal);
+					float support_distance = Vec3::DotProduct(support.w, face.normal);
+
+					if (support_distance - face.distance <= EPATolerance * std::max(1.f, support_distance) || vertex_count == MaxPolytopeVertices)
+						break;
+
+					const uint32_t new_vertex = vertex_count;
+					vertices[vertex_count++] = support;
+
+					// Remove faces seen from the new vertex, keeping the edges of their boundary.
+					unsigned int edge_count = 0;
+					unsigned int kept_count = 0;
+
+					for (unsigned int i = 0; i < face_count; ++i)
+					{
+						const Face& current = faces[i];
+
+						if (Vec3::DotProduct(current.normal, support.w - vertices[current.vertices[0]].w) <= 0.f && i != closest)
+						{
+							faces[kept_count++] = current;
+							continue;
+						}
+
+						for (unsigned int j = 0; j < 3; ++j)
+						{
+							uint32_t from = current.vertices[j];
+							uint32_t to = current.vertices[(j + 1) % 3];
+
+							// An edge shared by two removed faces appears in both directions and is not on the horizon.
+							bool shared = false;
+							for (unsigned int k = 0; k < edge_count; ++k)
+							{
+								if (edges[k][0] == to && edges[k][1] == from)
+								{
+									edges[k][0] = edges[edge_count - 1][0];
+									edges[k][1] = edges[edge_count - 1][1];
+									--edge_count;
+									shared = true;
+									break;
+								}
+							}
+
+							if (!shared && edge_count < MaxHorizonEdges)
+							{
+								edges[edge_count][0] = from;
+								edges[edge_count][1] = to;
+								++edge_count;
+							}
+						}
+					}
+
+					face_count = kept_count;
+
+					if (face_count + edge_count > MaxPolytopeFaces)
+						break;
+
+					for (unsigned int i = 0; i < edge_count; ++i)
+					{
+						Face& new_face = faces[face_count++];
+						new_face.vertices[0] = edges[i][0];
+						new_face.vertices[1] = edges[i][1];
+						new_face.vertices[2] = new_vertex;
+						ComputeFace(vertices, new_face);
+					}
+
+					if (face_count == 0)
+						break;
+				}
+
+				if (face_count == 0)
+				{
+					_result.normal = Vec3(0.f, 1.f, 0.f);
+					_result.distance = 0.f;
+					_result.pointA = _simplex.points[0].a;
+					_result.pointB = _simplex.points[0].b;
+					return;
+				}
+
+				closest = 0;
+				for (unsigned int i = 1; i < face_count; ++i)
+				{
+					if (faces[i].distance < faces[closest].distance)
+						closest = i;
+				}
+
+				const Face& face = faces[closest];
+				const SupportPoint& a = vertices[face.vertices[0]];
+				const SupportPoint& b = vertices[face.vertices[1]];
+				const SupportPoint& c = vertices[face.vertices[2]];
+
+				// Barycentric coordinates of the origin projected on the closest face.
+				const Vec3 projection = face.normal * face.distance;
+				const Vec3 v0 = b.w - a.w;
+				const Vec3 v1 = c.w - a.w;
+				const Vec3 v2 = projection - a.w;
+
+				float d00 = Vec3::DotProduct(v0, v0);
+				float d01 = Vec3::DotProduct(v0, v1);
+				float d11 = Vec3::DotProduct(v1, v1);
+				float d20 = Vec3::DotProduct(v2, v0);
+				float d21 = Vec3::DotProduct(v2, v1);
+				float denominator = d00 * d11 - d01 * d01;
+
+				float v = 0.f;
+				float w = 0.f;
+				if (std::abs(denominator) > std::numeric_limits<float>::min())
+				{
+					v = (d11 * d20 - d01 * d21) / denominator;
+					w = (d00 * d21 - d01 * d20) / denominator;
+				}
+				float u = 1.f - v - w;
+
+				_result.normal = face.normal;
+				_result.distance = -face.distance;
+				_result.pointA = a.a * u + b.a * v + c.a * w;
+				_result.pointB = a.b * u + b.b * v + c.b * w;
+			}
+
+			inline Vec3 GetStartDirection(const ConvexShape& _a, const ConvexShape& _b, const GJKCache* _cache) noexcept
+			{
+				return (_cache && _cache->valid) ? _cache->direction : _a.position - _b.position;
+			}
+
+			inline void StoreDirection(GJKCache* _cache, const Vec3& _direction) noexcept
+			{
+				if (_cache && Vec3::DotProduct(_direction, _direction) > 0.f)
+				{
+					_cache->direction = _direction;
+					_cache->valid = true;
+				}
+			}
+		}
+
+		bool Intersects(const ConvexShape& _a, const ConvexShape& _b, GJKCache* _cache) noexcept
+		{
+			const float margin = _a.GetMargin() + _b.GetMargin();
+
+			Simplex simplex;
+			Vec3 closest;
+			GJK_STATUS status = RunGJK(_a, _b, GetStartDirection(_a, _b, _cache), margin, simplex, closest);
+
+			StoreDirection(_cache, closest);
+
+			if (status == GJK_STATUS::SEPARATED)
+				return false;
+
+			return status == GJK_STATUS::INTERSECTING || Vec3::DotProduct(closest, closest) <= margin * margin;
+		}
+
+		bool Collide(const ConvexShape& _a, const ConvexShape& _b, GJKResult& _result, GJKCache* _cache) noexcept
+		{
+			const float margin_a = _a.GetMargin();
+			const float margin_b = _b.GetMargin();
+
+			Simplex simplex;
+			Vec3 closest;
+			GJK_STATUS status = RunGJK(_a, _b, GetStartDirection(_a, _b, _cache), -1.f, simplex, closest);
+
+			if (status != GJK_STATUS::INTERSECTING)
+			{
+				// Cores apart: the margins give the distance, including shallow sphere and capsule contacts.
+				Vec3 point_a;
+				Vec3 point_b;
+				for (unsigned int i = 0; i < simplex.count; ++i)
+				{
+					point_a += simplex.points[i].a * simplex.weights[i];
+					point_b += simplex.points[i].b * simplex.weights[i];
+				}
+
+				float core_distance = closest.Length();
+
+				_result.normal = -closest / core_distance;
+				_result.pointA = point_a + _result.normal * margin_a;
+				_result.pointB = point_b - _result.normal * margin_b;
+				_result.distance = core_distance - margin_a - margin_b;
+				_result.intersecting = _result.distance <= 0.f;
+
+				StoreDirection(_cache, closest);
+				return _result.intersecting;
+			}
+
+			_result.intersecting = true;
+
+			// Cores overlap: EPA runs on the polyhedral cores, margins then deepen the contact along its normal.
+			if (BuildTetrahedron(_a, _b, simplex))
+				RunEPA(_a, _b, simplex, _result);
+			else
+			{
+				// Flat cores difference, cores only touch.
+				Vec3 direction = _b.position - _a.position;
+				float length = direction.Length();
+
+				_result.normal = length > 0.f ? direction / length : Vec3(0.f, 1.f, 0.f);
+				_result.distance = 0.f;
+				_result.pointA = simplex.points[0].a;
+				_result.pointB = simplex.points[0].b;
+			}
+
+			_result.distance -= margin_a + margin_b;
+			_result.pointA += _result.normal * margin_a;
+			_result.pointB -= _result.normal * margin_b;
+
+			StoreDirection(_cache, -_result.normal);
+			return true;
+		}
+
+		size_t CollideBatch(const ConvexShape* _a, const ConvexShape* _b, size_t _count, GJKResult* _results, GJKCache* _caches, bool _multithreaded)
+		{
+			auto process = [&](size_t _begin, size_t _end)
+			{
+				for (size_t i = _begin; i < _end; ++i)
+					Collide(_a[i], _b[i], _results[i], _caches ? _caches + i : nullptr);
+			};
+
+			Math::ParallelFor(0, _count, ParallelBatch, _multithreaded, process);
+
+			size_t intersecting = 0;
+			for (size_t i = 0; i < _count; ++i)
+				intersecting += _results[i].intersecting ? 1 : 0;
+
+			return intersecting;
+		}
+	}
+}
@@ -0,0 +1,441 @@
+#include <cmath>
+#include <initializer_list>
+
+#include <Physics/RigidBodyStore.hpp>
+#include <Transform/Transform.hpp>
+#include <Misc/Callback.hpp>
+#include <Misc/Parallel.hpp>
+
+using namespace Mathlib;
+
+#define CLASS_NAME "RigidBodyStore"
+
+namespace
+{
+	/// Minimum number of bodies integrated by one thread.
+	constexpr size_t MinBatch = 2048;
+
+	/**
+	*	\brief Return the inverse of a mass or inertia value, 0 for non positive values.
+	*/
+	inline float SafeInverse(float _value) noexcept
+	{
+		return _value > 0.f ? 1.f / _value : 0.f;
+	}
+
+	/**
+	*	\brief Multiply a vector by the world inverse inertia R * diag(_inertia) * R^T of a body rotated by q.
+	*/
+	inline void MultiplyInverseInertia(float _qw, float _qx, float _qy, float _qz, float _ix, float _iy, float _iz,
+		float& _x, float& _y, float& _z) noexcept
+	{
+		const float r00 = 1.f - 2.f * (_qy * _qy + _qz * _qz);
+		const float r01 = 2.f * (_qx * _qy - _qz * _qw);
+		const float r02 = 2.f * (_qx * _qz + _qy * _qw);
+		const float r10 = 2.f * (_qx * _qy + _qz * _qw);
+		const float r11 = 1.f - 2.f * (_qx * _qx + _qz * _qz);
+		const float r12 = 2.f * (_qy * _qz - _qx * _qw);
+		const float r20 = 2.f * (_qx * _qz - _qy * _qw);
+		const float r21 = 2.f * (_qy * _qz + _qx * _qw);
+		const float r22 = 1.f - 2.f * (_qx * _qx + _qy * _qy);
+
+		// To body space, scale by the principal inverse inertia, back to world space.
+		const float local_x = (r00 * _x + r10 * _y + r20 * _z) * _ix;
+		const float local_y = (r01 * _x + r11 * _y + r21 * _z) * _iy;
+		const float local_z = (r02 * _x + r12 * _y + r22 * _z) * _iz;
+
+		_x = r00 * local_x + r01 * local_y + r02 * local_z;
+		_y = r10 * local_x + r11 * local_y + r12 * local_z;
+		_z = r20 * local_x + r21 * local_y + r22 * local_z;
+	}
+}
+
+template<typename Function>
+void RigidBodyStore::ForEachComponent(Function&& _function)
+{
+	for (std::vector<float>* component : { &positionX, &positionY, &positionZ, &rotationW, &rotationX, &rotationY, &rotationZ,
+		&linearVelocityX, &linearVelocityY, &linearVelocityZ, &angularVelocityX, &angularVelocityY, &angularVelocityZ, &forceX, &forceY,
+		&forceZ, &torqueX, &torqueY, &torqueZ, &inverseMass, &inverseInertiaX, &inverseInertiaY, &inverseInertiaZ })
+		_function(*component);
+}
+
+bool RigidBodyStore::IsValidIndex(uint32_t _index) const noexcept
+{
+	return _index < positionX.size();
+}
+
+void RigidBodyStore::IntegrateRange(size_t _begin, size_t _end, float _delta_time, const Vec3& _gravity) noexcept
+{
+	float* px = positionX.data();
+	float* py = positionY.data();
+	float* pz = positionZ.data();
+	float* qw = rotationW.data();
+	float* qx = rotationX.data();
+	float* qy = rotationY.data();
+	float* qz = rotationZ.data();
+	float* vx = linearVelocityX.data();
+	float* vy = linearVelocityY.data();
+	float* vz = linearVelocityZ.data();
+	float* wx = angularVelocityX.data();
+	float* wy = angularVelocityY.data();
+	float* wz = angularVelocityZ.data();
+	float* fx = forceX.data();
+	float* fy = forceY.data();
+	float* fz = forceZ.data();
+	float* tx = torqueX.data();
+	float* ty = torqueY.data();
+	float* tz = torqueZ.data();
+	const float* inverse_mass = inverseMass.data();
+	const float* ix = inverseInertiaX.data();
+	const float* iy = inverseInertiaY.data();
+	const float* iz = inverseInertiaZ.data();
+
+	const float dt = _delta_time;
+	const float half_dt = 0.5f * _delta_time;
+	const float gx = _gravity.X;
+	const float gy = _gravity.Y;
+	const float gz = _gravity.Z;
+
+	for (size_t i = _begin; i < _end; ++i)
+	{
+		// Velocities from forces, gravity only moves dynamic bodies.
+		const float m = inverse_mass[i];
+		const float dynamic = m > 0.f ? 1.f : 0.f;
+
+		const float new_vx = vx[i] + (gx * dynamic + fx[i] * m) * dt;
+		const float new_vy = vy[i] + (gy * dynamic + fy[i] * m) * dt;
+		const float new_vz = vz[i] + (gz * dynamic + fz[i] * m) * dt;
+
+		const float rw = qw[i];
+		const float rx = qx[i];
+		const float ry = qy[i];
+		const float rz = qz[i];
+
+		float dwx = tx[i] * dt;
+		float dwy = ty[i] * dt;
+		float dwz = tz[i] * dt;
+		MultiplyInverseInertia(rw, rx, ry, rz, ix[i], iy[i], iz[i], dwx, dwy, dwz);
+
+		const float new_wx = wx[i] + dwx;
+		const float new_wy = wy[i] + dwy;
+		const float new_wz = wz[i] + dwz;
+
+		// Positions from the new velocities.
+		px[i] += new_vx * dt;
+		py[i] += new_vy * dt;
+		pz[i] += new_vz * dt;
+
+		// q += dt / 2 * (0, w) * q, then renormalize.
+		float nw = rw + half_dt * (-new_wx * rx - new_wy * ry - new_wz * rz);
+		float nx = rx + half_dt * (new_wx * rw + new_wy * rz - new_wz * ry);
+		float ny = ry + half_dt * (new_wy * rw + new_wz * rx - new_wx * rz);
+		float nz = rz + half_dt * (new_wz * rw + new_wx * ry - new_wy * rx);
+
+		const float inverse_length = 1.f / std::sqrt(nw * nw + nx * nx + ny * ny + nz * nz);
+
+		qw[i] = nw * inverse_length;
+		qx[i] = nx * inverse_length;
+		qy[i] = ny * inverse_length;
+		qz[i] = nz * inverse_length;
+
+		vx[i] = new_vx;
+		vy[i] = new_vy;
+		vz[i] = new_vz;
+		wx[i] = new_wx;
+		wy[i] = new_wy;
+		wz[i] = new_wz;
+
+		fx[i] = 0.f;
+		fy[i] = 0.f;
+		fz[i] = 0.f;
+		tx[i] = 0.f;
+		ty[i] = 0.f;
+		tz[i] = 0.f;
+	}
+}
+
+//Bodies
+
+uint32_t RigidBodyStore::Add(const Vec3& _position, const Quat& _rotation, float _mass, const Vec3& _inertia)
+{
+	const uint32_t index = static_cast<uint32_t>(positionX.size());
+
+	positionX.push_back(_position.X);
+	positionY.push_back(_position.Y);
+	positionZ.push_back(_position.Z);
+
+	rotationW.push_back(_rotation.W);
+	rotationX.push_back(_rotation.X);
+	rotationY.push_back(_rotation.Y);
+	rotationZ.push_back(_rotation.Z);
+
+	// Every other component starts at 0, mass properties are set below.
+	ForEachComponent([index](std::vector<float>& _component)
+		{
+			if (_component.size() == index)
+				_component.push_back(0.f);
+		});
+
+	SetMass(index, _mass, _inertia);
+
+	return index;
+}
+
+void RigidBodyStore::Remove(uint32_t _index) noexcept
+{
+	if (!IsValidIndex(_index))
+	{
+		Callback::CallErrorCallback(CLASS_NAME, "Remove", "Invalid body index.");
+		return;
+	}
+
+	ForEachComponent([_index](std::vector<float>& _component)
+		{
+			_component[_index] = _component.back();
+			_component.pop_back();
+		});
+}
+
+void RigidBodyStore::Reserve(size_t _count)
+{
+	ForEachComponent([_count](std::vector<float>& _component) { _component.reserve(_count); });
+}
+
+void RigidBodyStore::Clear() noexcept
+{
+	ForEachComponent([](std::vector<float>& _component) { _component.clear(); });
+}
+
+//Accessors
+
+size_t RigidBodyStore::GetBodyCount() const noexcept
+{
+	return positionX.size();
+}
+
+Vec3 RigidBodyStore::GetPosition(uint32_t _index) const noexcept
+{
+	if (!IsValidIndex(_index))
+	{
+		Callback::CallErrorCallback(CLASS_NAME, "GetPosition", "Invalid body index.");
+		return Vec3::Zero;
+	}
+
+	return Vec3(positionX[_index], positionY[_index], positionZ[_index]);
+}
+
+void RigidBodyStore::SetPosition(uint32_t _index, const Vec3& _position) noexcept
+{
+	if (!IsValidIndex(_index))
+	{
+		Callback::CallErrorCallback(CLASS_NAME, "SetPosition", "Invalid body index.");
+		return;
+	}
+
+	positionX[_index] = _position.X;
+	positionY[_index] = _position.Y;
+	positionZ[_index] = _position.Z;
+}
+
+Quat RigidBodyStore::GetRotation(uint32_t _index) const noexcept
+{
+	if (!IsValidIndex(_index))
+	{
+		Callback::CallErrorCallback(CLASS_NAME, "GetRotation", "Invalid body index.");
+		return Quat::Identity;
+	}
+
+	return Quat(rotationW[_index], rotationX[_index], rotationY[_index], rotationZ[_index]);
+}
+
+void RigidBodyStore::SetRotation(uint32_t _index, const Quat& _rotation) noexcept
+{
+	if (!IsValidIndex(_index))
+	{
+		Callback::CallErrorCallback(CLASS_NAME, "SetRotation", "Invalid body index.");
+		return;
+	}
+
+	rotationW[_index] = _rotation.W;
+	rotationX[_index] = _rotation.X;
+	rotationY[_index] = _rotation.Y;
+	rotationZ[_index] = _rotation.Z;
+}
+
+Vec3 RigidBodyStore::GetLinearVelocity(uint32_t _index) const noexcept
+{
+	if (!IsValidIndex(_index))
+	{
+		Callback::CallErrorCallback(CLASS_NAME, "GetLinearVelocity", "Invalid body index.");
+		return Vec3::Zero;
+	}
+
+	return Vec3(linearVelocityX[_index], linearVelocityY[_index], linearVelocityZ[_index]);
+}
+
+void RigidBodyStore::SetLinearVelocity(uint32_t _index, const Vec3& _velocity) noexcept
+{
+	if (!IsValidIndex(_index))
+	{
+		Callback::CallErrorCallback(CLASS_NAME, "SetLinearVelocity", "Invalid body index.");
+		return;
+	}
+
+	linearVelocityX[_index] = _velocity.X;
+	linearVelocityY[_index] = _velocity.Y;
+	linearVelocityZ[_index] = _velocity.Z;
+}
+
+Vec3 RigidBodyStore::GetAngularVelocity(uint32_t _index) const noexcept
+{
+	if (!IsValidIndex(_index))
+	{
+		Callback::CallErrorCallback(CLASS_NAME, "GetAngularVelocity", "Invalid body index.");
+		return Vec3::Zero;
+	}
+
+	return Vec3(angularVelocityX[_index], angularVelocityY[_index], angularVelocityZ[_index]);
+}
+
+void RigidBodyStore::SetAngularVelocity(uint32_t _index, const Vec3& _velocity) noexcept
+{
+	if (!IsValidIndex(_index))
+	{
+		Callback::CallErrorCallback(CLASS_NAME, "SetAngularVelocity", "Invalid body index.");
+		return;
+	}
+
+	angularVelocityX[_index] = _velocity.X;
+	angularVelocityY[_index] = _velocity.Y;
+	angularVelocityZ[_index] = _velocity.Z;
+}
+
+float RigidBodyStore::GetInverseMass(uint32_t _index) const noexcept
+{
+	if (!IsValidIndex(_index))
+	{
+		Callback::CallErrorCallback(CLASS_NAME, "GetInverseMass", "Invalid body index.");
+		return 0.f;
+	}
+
+	return inverseMass[_index];
+}
+
+void RigidBodyStore::SetMass(uint32_t _index, float _mass, const Vec3& _inertia) noexcept
+{
+	if (!IsValidIndex(_index))
+	{
+		Callback::CallErrorCallback(CLASS_NAME, "SetMass", "Invalid body index.");
+		return;
+	}
+
+	// Static bodies ignore torques as well as forces.
+	const bool dynamic = _mass > 0.f;
+
+	inverseMass[_index] = SafeInverse(_mass);
+	inverseInertiaX[_index] = dynamic ? SafeInverse(_inertia.X) : 0.f;
+	inverseInertiaY[_index] = dynamic ? SafeInverse(_inertia.Y) : 0.f;
+	inverseInertiaZ[_index] = dynamic ? SafeInverse(_inertia.Z) : 0.f;
+}
+
+Transform RigidBodyStore::GetTransform(uint32_t _index) const noexcept
+{
+	if (!IsValidIndex(_index))
+	{
+		Callback::CallErrorCallback(CLASS_NAME, "GetTransform", "Invalid body index.");
+		return Transform();
+	}
+
+	return Transform(Quat(rotationW[_index], rotationX[_index], rotationY[_index], rotationZ[_index]),
+		Vec3(positionX[_index], positionY[_index], positionZ[_index]), Vec3::One);
+}
+
+void RigidBodyStore::GetTransforms(Transform* _transforms) const noexcept
+{
+	for (size_t i = 0; i < positionX.size(); ++i)
+	{
+		_transforms[i].position = Vec3(positionX[i], positionY[i], positionZ[i]);
+		_transforms[i].rotation = Quat(rotationW[i], rotationX[i], rotationY[i], rotationZ[i]);
+		_transforms[i].scale = Vec3::One;
+	}
+}
+
+//Forces
+
+void RigidBodyStore::ApplyForce(uint32_t _index, const Vec3& _force) noexcept
+{
+	if (!IsValidIndex(_index))
+	{
+		Callback::CallErrorCallback(CLASS_NAME, "ApplyForce", "Invalid body index.");
+		return;
+	}
+
+	forceX[_index] += _force.X;
+	forceY[_index] += _force.Y;
+	forceZ[_index] += _force.Z;
+}
+
+void RigidBodyStore::ApplyForce(uint32_t _index, const Vec3& _force, const Vec3& _point) noexcept
+{
+	if (!IsValidIndex(_index))
+	{
+		Callback::CallErrorCallback(CLASS_NAME, "ApplyForce", "Invalid body index.");
+		return;
+	}
+
+	Vec3 torque = Vec3::CrossProduct(_point - Vec3(positionX[_index], positionY[_index], positionZ[_index]), _force);
+
+	forceX[_index] += _force.X;
+	forceY[_index] += _force.Y;
+	forceZ[_index] += _force.Z;
+	torqueX[_index] += torque.X;
+	torqueY[_index] += torque.Y;
+	torqueZ[_index] += torque.Z;
+}
+
+void RigidBodyStore::ApplyTorque(uint32_t _index, const Vec3& _torque) noexcept
+{
+	if (!IsValidIndex(_index))
+	{
+		Callback::CallErrorCallback(CLASS_NAME, "ApplyTorque", "Invalid body index.");
+		return;
+	}
+
+	torqueX[_index] += _torque.X;
+	torqueY[_index] += _torque.Y;
+	torqueZ[_index] += _torque.Z;
+}
+
+void RigidBodyStore::ApplyImpulse(uint32_t _index, const Vec3& _impulse, const Vec3& _point) noexcept
+{
+	if (!IsValidIndex(_index))
+	{
+		Callback::CallErrorCallback(CLASS_NAME, "ApplyImpulse", "Invalid body index.");
+		return;
+	}
+
+	const float m = inverseMass[_index];
+	linearVelocityX[_index] += _impulse.X * m;
+	linearVelocityY[_index] += _impulse.Y * m;
+	linearVelocityZ[_index] += _impulse.Z * m;
+
+	Vec3 angular = Vec3::CrossProduct(_point - Vec3(positionX[_index], positionY[_index], positionZ[_index]), _impulse);
+	MultiplyInverseInertia(rotationW[_index], rotationX[_index], rotationY[_index], rotationZ[_index],
+		inverseInertiaX[_index], inverseInertiaY[_index], inverseInertiaZ[_index], angular.X, angular.Y, angular.Z);
+
+	angularVelocityX[_index] += angular.X;
+	angularVelocityY[_index] += angular.Y;
+	angularVelocityZ[_index] += angular.Z;
+}
+
+//Methods
+
+void RigidBodyStore::Integrate(float _delta_time, const Vec3& _gravity, bool _multithreaded)
+{
+	auto process = [this, _delta_time, &_gravity](size_t _begin, size_t _end)
+	{
+		IntegrateRange(_begin, _end, _delta_time, _gravity);
+	};
+
+	Math::ParallelFor(0, positionX.size(), MinBatch, _multithreaded, process);
+}
@@ -0,0 +1,54 @@
+#include <Space/HalfVec.hpp>
+
+using namespace Mathlib;
+
+static_assert(sizeof(Quath) == 4 * sizeof(Half) && sizeof(Quat) == 4 * sizeof(float),
+	"Quath and Quat must be tightly packed for bulk conversions");
+
+//Constructors
+
+Quath::Quath(Half _w, Half _x, Half _y, Half _z) noexcept :
+	W{ _w }, X{ _x }, Y{ _y }, Z{ _z }
+{
+}
+
+//Equality
+
+bool Quath::operator==(const Quath& _rhs) const noexcept
+{
+	return W == _rhs.W && X == _rhs.X && Y == _rhs.Y && Z == _rhs.Z;
+}
+
+bool Quath::operator!=(const Quath& _rhs) const noexcept
+{
+	return !(*this == _rhs);
+}
+
+//Debug
+
+std::string Quath::ToString() const noexcept
+{
+	return "(" + W.ToString() + " ; " + X.ToString() + " ; " + Y.ToString() + " ; " + Z.ToString() + ")";
+}
+
+//Conversions
+
+Quath Mathlib::ToHalf(const Quat& _quat) noexcept
+{
+	return Quath(Half(_quat.W), Half(_quat.X), Half(_quat.Y), Half(_quat.Z));
+}
+
+Quat Mathlib::ToQuat(const Quath& _quat) noexcept
+{
+	return Quat(_quat.W.ToFloat(), _quat.X.ToFloat(), _quat.Y.ToFloat(), _quat.Z.ToFloat());
+}
+
+void Mathlib::ToHalf(const Quat* _values, size_t _count, Quath* _results, bool _multithreaded)
+{
+	Half::FromFloat(&_values->W, _count * 4, &_results->W, _multithreaded);
+}
+
+void Mathlib::ToQuat(const Quath* _values, size_t _count, Quat* _results, bool _multithreaded)
+{
+	Half::ToFloat(&_values->W, _count * 4, &_results->W, _multithreaded);
+}
@@ -0,0 +1,140 @@
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define MATHLIB_INTVEC_SSE2
+#endif
+
+#include <Space/IntVec.hpp>
+#include <Misc/Parallel.hpp>
+
+namespace Mathlib
+{
+	namespace Math
+	{
+		namespace
+		{
+			/// Minimum number of components converted by one thread.
+			constexpr size_t MinBatch = 16384;
+
+			static_assert(sizeof(Vec2i) == 2 * sizeof(int32_t) && sizeof(Vec3i) == 3 * sizeof(int32_t) &&
+				sizeof(Vec4i) == 4 * sizeof(int32_t), "Integer vectors must be tightly packed for bulk conversions");
+
+			/**
+			*	\brief Floor without calling std::floor: truncate, then step down when truncation rounded up.
+			*/
+			inline int32_t Floor(float _value) noexcept
+			{
+				const int32_t truncated = static_cast<int32_t>(_value);
+				return truncated - (_value < static_cast<float>(truncated) ? 1 : 0);
+			}
+
+			void FloorRange(const float* _values, float _scale, int32_t* _results, size_t _begin, size_t _end) noexcept
+			{
+				size_t i = _begin;
+
+#if defined(MATHLIB_INTVEC_SSE2)
+				const __m128 scale = _mm_set1_ps(_scale);
+
+				for (; i + 4 <= _end; i += 4)
+				{
+					const __m128 values = _mm_mul_ps(_mm_loadu_ps(_values + i), scale);
+					const __m128i truncated = _mm_cvttps_epi32(values);
+
+					// Comparison mask is -1 where truncation rounded up.
+					const __m128i step = _mm_castps_si128(_mm_cmplt_ps(values, _mm_cvtepi32_ps(truncated)));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(_results + i), _mm_add_epi32(truncated, step));
+				}
+#endif
+
+				for (; i < _end; ++i)
+					_results[i] = Floor(_values[i] * _scale);
+			}
+
+		}
+
+		void FloorToInt(const float* _values, size_t _count, float _scale, int32_t* _results, bool _multithreaded)
+		{
+			Math::ParallelFor(0, _count, MinBatch, _multithreaded, [_values, _scale, _results](size_t _begin, size_t _end)
+			{
+				FloorRange(_values, _scale, _results, _begin, _end);
+			});
+		}
+
+		void ToFloat(const int32_t* _values, size_t _count, float _scale, float* _results, bool _multithreaded)
+		{
+			Math::ParallelFor(0, _count, MinBatch, _multithreaded, [_values, _scale, _results](size_t _begin, size_t _end)
+			{
+				for (size_t i = _begin; i < _end; ++i)
+					_results[i] = static_cast<float>(_values[i]) * _scale;
+			});
+		}
+
+		Vec2i FloorToInt(const Vec2& _value, float _scale) noexcept
+		{
+			Vec2i result;
+			FloorRange(_value.Data(), _scale, result.Data(), 0, 2);
+
+			return result;
+		}
+
+		void FloorToInt(const Vec2* _values, size_t _count, float _scale, Vec2i* _results, bool _multithreaded)
+		{
+			FloorToInt(_values->Data(), _count * 2, _scale, _results->Data(), _multithreaded);
+		}
+
+		Vec2 ToFloat(const Vec2i& _value, float _scale) noexcept
+		{
+			return static_cast<Vec2>(_value) * _scale;
+		}
+
+		void ToFloat(const Vec2i* _values, size_t _count, float _scale, Vec2* _results, bool _multithreaded)
+		{
+			ToFloat(_values->Data(), _count * 2, _scale, &_results->X, _multithreaded);
+		}
+
+		Vec3i FloorToInt(const Vec3& _value, float _scale) noexcept
+		{
+			Vec3i result;
+			FloorRange(_value.Data(), _scale, result.Data(), 0, 3);
+
+			return result;
+		}
+
+		void FloorToInt(const Vec3* _values, size_t _count, float _scale, Vec3i* _results, bool _multithreaded)
+		{
+			FloorToInt(_values->Data(), _count * 3, _scale, _results->Data(), _multithreaded);
+		}
+
+		Vec3 ToFloat(const Vec3i& _value, float _scale) noexcept
+		{
+			return static_cast<Vec3>(_value) * _scale;
+		}
+
+		void ToFloat(const Vec3i* _values, size_t _count, float _scale, Vec3* _results, bool _multithreaded)
+		{
+			ToFloat(_values->Data(), _count * 3, _scale, &_results->X, _multithreaded);
+		}
+
+		Vec4i FloorToInt(const Vec4& _value, float _scale) noexcept
+		{
+			Vec4i result;
+			FloorRange(_value.Data(), _scale, result.Data(), 0, 4);
+
+			return result;
+		}
+
+		void FloorToInt(const Vec4* _values, size_t _count, float _scale, Vec4i* _results, bool _multithreaded)
+		{
+			FloorToInt(_values->Data(), _count * 4, _scale, _results->Data(), _multithreaded);
+		}
+
+		Vec4 ToFloat(const Vec4i& _value, float _scale) noexcept
+		{
+			return static_cast<Vec4>(_value) * _scale;
+		}
+
+		void ToFloat(const Vec4i* _values, size_t _count, float _scale, Vec4* _results, bool _multithreaded)
+		{
+			ToFloat(_values->Data(), _count * 4, _scale, &_results->X, _multithreaded);
+		}
+	}
+}
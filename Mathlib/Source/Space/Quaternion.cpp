@@ -1,5 +1,9 @@
+#include <limits>
+
 #include <Space/Quaternion.hpp>
 #include <Space/Vec3.hpp>
+#include <Space/VecExpression.hpp>
+#include <Matrix/Mat3.hpp>
 #include <Matrix/Mat4.hpp>
 
 #include <Misc/Math.hpp>
@@ -74,6 +78,42 @@ Quat Quat::GetNormalized() const noexcept
 	);
 }
 
+Quat& Quat::NormalizeFast() noexcept
+{
+	const float squared_length = W * W + X * X + Y * Y + Z * Z;
+
+	// Denormal or null squared length: the batch path rescales tiny vectors before the inverse square root.
+	if (squared_length < std::numeric_limits<float>::min())
+	{
+		Math::NormalizeFast(&W, 1, 4, &W);
+		return *this;
+	}
+
+	const float scale = Math::FastInverseSqrt(squared_length);
+
+	W *= scale;
+	X *= scale;
+	Y *= scale;
+	Z *= scale;
+
+	return *this;
+}
+
+Quat Quat::GetNormalizedFast() const noexcept
+{
+	Quat tmp = *this;
+	tmp.NormalizeFast();
+
+	return tmp;
+}
+
+void Quat::NormalizeFast(const Quat* _quaternions, size_t _count, Quat* _result, bool _multithreaded)
+{
+	static_assert(sizeof(Quat) == 4 * sizeof(float), "Quat must be tightly packed for bulk normalization");
+
+	Math::NormalizeFast(reinterpret_cast<const float*>(_quaternions), _count, 4, reinterpret_cast<float*>(_result), _multithreaded);
+}
+
 bool  Quat::IsNormalized() const noexcept
 {
 	return Math::Equals(Length(), 1.f);
@@ -123,6 +163,52 @@ Vec3 Quat::Euler() const noexcept
 	return result * Math::RadToDeg;
 }
 
+//Matrix
+
+Quat Quat::FromMatrix(const Mat3& _rotation) noexcept
+{
+	const Mat3& m = _rotation;
+	float trace = m.e00 + m.e11 + m.e22;
+
+	Quat result;
+
+	// Build from the largest component to keep the square root away from 0.
+	if (trace > 0.f)
+	{
+		float scale = Math::Sqrt(trace + 1.f) * 2.f;
+		result.W = 0.25f * scale;
+		result.X = (m.e21 - m.e12) / scale;
+		result.Y = (m.e02 - m.e20) / scale;
+		result.Z = (m.e10 - m.e01) / scale;
+	}
+	else if (m.e00 > m.e11 && m.e00 > m.e22)
+	{
+		float scale = Math::Sqrt(1.f + m.e00 - m.e11 - m.e22) * 2.f;
+		result.W = (m.e21 - m.e12) / scale;
+		result.X = 0.25f * scale;
+		result.Y = (m.e01 + m.e10) / scale;
+		result.Z = (m.e02 + m.e20) / scale;
+	}
+	else if (m.e11 > m.e22)
+	{
+		float scale = Math::Sqrt(1.f + m.e11 - m.e00 - m.e22) * 2.f;
+		result.W = (m.e02 - m.e20) / scale;
+		result.X = (m.e01 + m.e10) / scale;
+		result.Y = 0.25f * scale;
+		result.Z = (m.e12 + m.e21) / scale;
+	}
+	else
+	{
+		float scale = Math::Sqrt(1.f + m.e22 - m.e00 - m.e11) * 2.f;
+		result.W = (m.e10 - m.e01) / scale;
+		result.X = (m.e02 + m.e20) / scale;
+		result.Y = (m.e12 + m.e21) / scale;
+		result.Z = 0.25f * scale;
+	}
+
+	return result.GetNormalized();
+}
+
 //Invert
 
 Quat& Quat::Inverse() noexcept
@@ -211,7 +297,7 @@ Vec3 Quat::Rotate(const Vec3& _vec) const noexcept
 	Vec3 const uv(Vec3::CrossProduct(QuatVector, _vec));
 	Vec3 const uuv(Vec3::CrossProduct(QuatVector, uv));
 
-	return _vec + ((uv * W) + uuv) * 2.f;
+	return Expression::Lazy(_vec) + ((Expression::Lazy(uv) * W) + uuv) * 2.f;
 }
 
 Vec3 Quat::GetRightVector() const noexcept
@@ -29,29 +29,34 @@ const Vec2 Vec2::Down = Vec2(0.f, -1.f);
 //Constructors
 
 Vec2::Vec2(float _x, float _y) noexcept :
-	X{ _x }, Y{ _y }
+	Base(_x, _y)
 {
 }
 
 Vec2::Vec2(float _xy) noexcept :
-	X{ _xy }, Y{ _xy }
+	Base(_xy)
 {
 }
 
 Vec2::Vec2(const Vec3& _vec3) noexcept :
-	X{ _vec3.X }, Y{ _vec3.Y }
+	Base(_vec3.X, _vec3.Y)
 {
 }
 
 Vec2::Vec2(const Vec4& _vec4) noexcept :
-	X{ _vec4.X }, Y{ _vec4.Y }
+	Base(_vec4.X, _vec4.Y)
+{
+}
+
+Vec2::Vec2(const Base& _vec) noexcept :
+	Base(_vec)
 {
 }
 
 //Static Methods
 float Vec2::DotProduct(const Vec2& _lhs, const Vec2& _rhs) noexcept
 {
-	return _lhs.X * _rhs.X + _lhs.Y * _rhs.Y;
+	return Base::DotProduct(_lhs, _rhs);
 }
 
 float Vec2::CrossProduct(const Vec2& _lhs, const Vec2& _rhs) noexcept
@@ -68,18 +73,17 @@ float Vec2::Angle(const Vec2& _start, const Vec2& _end)
 
 float Vec2::Distance(const Vec2& _start, const Vec2& _end) noexcept
 {
-	return (_end - _start).Length();
+	return Base::Distance(_start, _end);
 }
 
 float Vec2::SqrDistance(const Vec2& _start, const Vec2& _end) noexcept
 {
-	return (_end - _start).SquaredLength();
+	return Base::SqrDistance(_start, _end);
 }
 
 Vec2 Vec2::Lerp(const Vec2& _start, const Vec2& _end, float _alpha) noexcept
 {
-	float alpha = Math::Clamp(_alpha, 0.f, 1.f);
-	return _start + (_end - _start) * alpha;
+	return Base::Lerp(_start, _end, Math::Clamp(_alpha, 0.f, 1.f));
 }
 
 Vec2 Vec2::SLerp(const Vec2& _start, const Vec2& _end, float _alpha) noexcept
@@ -115,67 +119,50 @@ Vec2 Vec2::SLerp(const Vec2& _start, const Vec2& _end, float _alpha) noexcept
 
 bool Vec2::IsZero() const noexcept
 {
-	return *this == Vec2::Zero;
+	return Base::IsZero();
 }
 
 bool Vec2::Equals(const Vec2& _other, float _epsilon) const noexcept
 {
-	bool compare_X = Math::Equals(X, _other.X, _epsilon);
-	bool compare_Y = Math::Equals(Y, _other.Y, _epsilon);
-
-	return compare_X && compare_Y;
+	return Base::Equals(_other, _epsilon);
 }
 
 bool Vec2::operator==(const Vec2& _rhs) const noexcept
 {
-	return (X == _rhs.X && Y == _rhs.Y);
+	return Base::operator==(_rhs);
 }
 
 bool Vec2::operator!=(const Vec2& _rhs) const noexcept
 {
-	return !(X == _rhs.X && Y == _rhs.Y);
+	return Base::operator!=(_rhs);
 }
 
 //Accessors
 const float* Vec2::Data() const noexcept
 {
-	return &X;
+	return Base::Data();
 }
 
 //Methods
 float Vec2::Length() const noexcept
 {
-	return Math::Sqrt(SquaredLength());
+	return Base::Length();
 }
 
 float Vec2::SquaredLength() const noexcept
 {
-	return X * X + Y * Y;
+	return Base::SquaredLength();
 }
 
 Vec2& Vec2::Normalize() noexcept
 {
-	float length = Length();
-
-	if (length != 0.f)
-	{
-		X /= length;
-		Y /= length;
-	}
-	else
-	{
-		Callback::CallErrorCallback(CLASS_NAME, "Normalize", "Division by O due to vector length being equal to 0");
-	}
-
+	Base::Normalize();
 	return *this;
 }
 
 Vec2 Vec2::GetNormalized() const noexcept
 {
-	Vec2 tmp = *this;
-	tmp.Normalize();
-
-	return tmp;
+	return Base::GetNormalized();
 }
 
 bool  Vec2::IsNormalized() const noexcept
@@ -196,113 +183,94 @@ Vec2 Vec2::ProjectOn(const Vec2& _other) const noexcept
 //Operator
 Vec2 Vec2::operator-() const noexcept
 {
-	return Vec2(-X, -Y);
+	return Base::operator-();
 }
 
 Vec2 Vec2::operator+(const Vec2& _rhs) const noexcept
 {
-	return Vec2(X + _rhs.X, Y + _rhs.Y);
+	return Base::operator+(_rhs);
 }
 
 Vec2 Vec2::operator-(const Vec2& _rhs) const noexcept
 {
-	return Vec2(X - _rhs.X, Y - _rhs.Y);
+	return Base::operator-(_rhs);
 }
 
 Vec2 Vec2::operator*(const Vec2& _rhs) const noexcept
 {
-	return Vec2(X * _rhs.X, Y * _rhs.Y);
+	return Base::operator*(_rhs);
 }
 
 Vec2 Vec2::operator/(const Vec2& _rhs) const
 {
-	if (_rhs.X == 0.f || _rhs.Y == 0.f)
-		Callback::CallErrorCallback(CLASS_NAME, "operator/", "Division by 0");
-
-	return Vec2(X / _rhs.X, Y / _rhs.Y);
+	return Base::operator/(_rhs);
 }
 
 Vec2& Vec2::operator+=(const Vec2& _rhs) noexcept
 {
-	X += _rhs.X;
-	Y += _rhs.Y;
+	Base::operator+=(_rhs);
 	return *this;
 }
 
 Vec2& Vec2::operator-=(const Vec2& _rhs) noexcept
 {
-	X -= _rhs.X;
-	Y -= _rhs.Y;
+	Base::operator-=(_rhs);
 	return *this;
 }
 
 Vec2& Vec2::operator*=(const Vec2& _rhs) noexcept
 {
-	X *= _rhs.X;
-	Y *= _rhs.Y;
+	Base::operator*=(_rhs);
 	return *this;
 }
 
 Vec2& Vec2::operator/=(const Vec2& _rhs)
 {
-	if (_rhs.X == 0.f || _rhs.Y == 0.f )
-		Callback::CallErrorCallback(CLASS_NAME, "operator/", "Division by 0");
-
-	X /= _rhs.X;
-	Y /= _rhs.Y;
+	Base::operator/=(_rhs);
 	return *this;
 }
 
 Vec2 Vec2::operator+(float _scale) const noexcept
 {
-	return Vec2(X + _scale, Y + _scale);
+	return Base::operator+(_scale);
 }
 
 Vec2 Vec2::operator-(float _scale) const noexcept
 {
-	return Vec2(X - _scale, Y - _scale);
+	return Base::operator-(_scale);
 }
 
 Vec2 Vec2::operator*(float _scale) const noexcept
 {
-	return Vec2(X * _scale, Y * _scale);
+	return Base::operator*(_scale);
 }
 
 Vec2 Vec2::operator/(float _scale) const
 {
-	if (_scale == 0.f)
-		Callback::CallErrorCallback(CLASS_NAME, "operator/", "Division by 0");
-	return Vec2(X / _scale, Y / _scale);
+	return Base::operator/(_scale);
 }
 
 Vec2& Vec2::operator+=(float _scale) noexcept
 {
-	X += _scale;
-	Y += _scale;
+	Base::operator+=(_scale);
 	return *this;
 }
 
 Vec2& Vec2::operator-=(float _scale) noexcept
 {
-	X -= _scale;
-	Y -= _scale;
+	Base::operator-=(_scale);
 	return *this;
 }
 
 Vec2& Vec2::operator*=(float _scale) noexcept
 {
-	X *= _scale;
-	Y *= _scale;
+	Base::operator*=(_scale);
 	return *this;
 }
 
 Vec2& Vec2::operator/=(float _scale)
 {
-	if (_scale == 0.f)
-		Callback::CallErrorCallback(CLASS_NAME, "operator/", "Division by 0");
-
-	X /= _scale;
-	Y /= _scale;
+	Base::operator/=(_scale);
 	return *this;
 }
 
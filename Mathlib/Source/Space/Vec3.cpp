@@ -1,3 +1,4 @@
+#include <limits>
 #include <stdexcept>
 #include <string>
 
@@ -33,36 +34,39 @@ const Vec3 Vec3::Backward = Vec3(0.f, 0.f, -1.f);
 //Constructors
 
 Vec3::Vec3(float _x, float _y, float _z) noexcept :
-	X{ _x }, Y{ _y }, Z{ _z }
+	Base(_x, _y, _z)
 {
 }
 
 Vec3::Vec3(float _xyz) noexcept :
-	X{ _xyz }, Y{ _xyz }, Z{ _xyz }
+	Base(_xyz)
 {
 }
 
 Vec3::Vec3(const Vec2& _vec2, float _z) noexcept :
-	X{ _vec2.X }, Y{ _vec2.Y }, Z{ _z }
+	Base(_vec2.X, _vec2.Y, _z)
 {
 }
 
 Vec3::Vec3(const Vec4& _vec4) noexcept :
-	X{ _vec4.X }, Y{ _vec4.Y }, Z{ _vec4.Z }
+	Base(_vec4.X, _vec4.Y, _vec4.Z)
+{
+}
+
+Vec3::Vec3(const Base& _vec) noexcept :
+	Base(_vec)
 {
 }
 
 //Static Methods
 float Vec3::DotProduct(const Vec3& _lhs, const Vec3& _rhs) noexcept
 {
-	return _lhs.X * _rhs.X + _lhs.Y * _rhs.Y + _lhs.Z * _rhs.Z;
+	return Base::DotProduct(_lhs, _rhs);
 }
 
 Vec3 Vec3::CrossProduct(const Vec3& _lhs, const Vec3& _rhs) noexcept
 {
-	return Vec3(_lhs.Y * _rhs.Z - _lhs.Z * _rhs.Y,
-				_lhs.Z * _rhs.X - _lhs.X * _rhs.Z,
-				_lhs.X * _rhs.Y - _lhs.Y * _rhs.X);
+	return Base::CrossProduct(_lhs, _rhs);
 }
 
 float Vec3::Angle(const Vec3& _start, const Vec3& _end, const Vec3& _normal)
@@ -79,20 +83,17 @@ float Vec3::Angle(const Vec3& _start, const Vec3& _end, const Vec3& _normal)
 
 float Vec3::Distance(const Vec3& _start, const Vec3& _end) noexcept
 {
-	return (_end - _start).Length();
+	return Base::Distance(_start, _end);
 }
 
 float Vec3::SqrDistance(const Vec3& _start, const Vec3& _end) noexcept
 {
-	return (_end - _start).SquaredLength();
+	return Base::SqrDistance(_start, _end);
 }
 
 Vec3 Vec3::Lerp(const Vec3& _start, const Vec3& _end, float _alpha) noexcept
 {
-	float alpha = Math::Clamp(_alpha, 0.f, 1.f);
-
-	Vec3 temp = _end - _start;
-	return _start + (_end - _start) * alpha;
+	return Base::Lerp(_start, _end, Math::Clamp(_alpha, 0.f, 1.f));
 }
 
 Vec3 Vec3::SLerp(const Vec3& _start, const Vec3& _end, float _alpha) noexcept
@@ -128,71 +129,87 @@ Vec3 Vec3::SLerp(const Vec3& _start, const Vec3& _end, float _alpha) noexcept
 
 bool Vec3::IsZero() const noexcept
 {
-	return *this == Vec3::Zero;
+	return Base::IsZero();
 }
 
 bool Vec3::Equals(const Vec3& _other, float _epsilon) const noexcept
 {
-	bool compare_X = Math::Equals(X, _other.X, _epsilon);
-	bool compare_Y = Math::Equals(Y, _other.Y, _epsilon);
-	bool compare_Z = Math::Equals(Z, _other.Z, _epsilon);
-
-	return compare_X && compare_Y && compare_Z;
+	return Base::Equals(_other, _epsilon);
 }
 
 bool Vec3::operator==(const Vec3& _rhs) const noexcept
 {
-	return (X == _rhs.X && Y == _rhs.Y && Z == _rhs.Z);
+	return Base::operator==(_rhs);
 }
 
 bool Vec3::operator!=(const Vec3& _rhs) const noexcept
 {
-	return !(X == _rhs.X && Y == _rhs.Y && Z == _rhs.Z);
+	return Base::operator!=(_rhs);
 }
 
 //Accessors
 const float* Vec3::Data() const noexcept
 {
-	return &X;
+	return Base::Data();
 }
 
 //Methods
 float Vec3::Length() const noexcept
 {
-	return Math::Sqrt(SquaredLength());
+	return Base::Length();
 }
 
 float Vec3::SquaredLength() const noexcept
 {
-	return X * X + Y * Y + Z * Z;
+	return Base::SquaredLength();
 }
 
 Vec3& Vec3::Normalize() noexcept
 {
-	float length = Length();
+	Base::Normalize();
+	return *this;
+}
 
-	if(length != 0.f)
-	{ 
-		X /= length;
-		Y /= length;
-		Z /= length;
-	}
-	else
+Vec3 Vec3::GetNormalized() const noexcept
+{
+	return Base::GetNormalized();
+}
+
+Vec3& Vec3::NormalizeFast() noexcept
+{
+	const float squared_length = X * X + Y * Y + Z * Z;
+
+	// Denormal or null squared length: the batch path rescales tiny vectors before the inverse square root.
+	if (squared_length < std::numeric_limits<float>::min())
 	{
-		Callback::CallErrorCallback(CLASS_NAME, "Normalize", "Division by O due to vector length being equal to 0");
+		Math::NormalizeFast(&X, 1, 3, &X);
+		return *this;
 	}
-	
+
+	const float scale = Math::FastInverseSqrt(squared_length);
+
+	X *= scale;
+	Y *= scale;
+	Z *= scale;
+
 	return *this;
 }
 
-Vec3 Vec3::GetNormalized() const noexcept
+Vec3 Vec3::GetNormalizedFast() const noexcept
 {
 	Vec3 tmp = *this;
-	tmp.Normalize();
+	tmp.NormalizeFast();
 
 	return tmp;
 }
 
+void Vec3::NormalizeFast(const Vec3* _vectors, size_t _count, Vec3* _result, bool _multithreaded)
+{
+	static_assert(sizeof(Vec3) == 3 * sizeof(float), "Vec3 must be tightly packed for bulk normalization");
+
+	Math::NormalizeFast(reinterpret_cast<const float*>(_vectors), _count, 3, reinterpret_cast<float*>(_result), _multithreaded);
+}
+
 bool  Vec3::IsNormalized() const noexcept
 {
 	return Math::Equals(Length(), 1.f, 0.001f);
@@ -211,121 +228,94 @@ Vec3 Vec3::ProjectOn(const Vec3& _other) const noexcept
 //Operator
 Vec3 Vec3::operator-() const noexcept
 {
-	return Vec3(-X, -Y, -Z);
+	return Base::operator-();
 }
 
 Vec3 Vec3::operator+(const Vec3& _rhs) const noexcept
 {
-	return Vec3(X + _rhs.X, Y + _rhs.Y, Z + _rhs.Z);
+	return Base::operator+(_rhs);
 }
 
 Vec3 Vec3::operator-(const Vec3& _rhs) const noexcept
 {
-	return Vec3(X - _rhs.X, Y - _rhs.Y, Z - _rhs.Z);
+	return Base::operator-(_rhs);
 }
 
 Vec3 Vec3::operator*(const Vec3& _rhs) const noexcept
 {
-	return Vec3(X * _rhs.X, Y * _rhs.Y, Z * _rhs.Z);
+	return Base::operator*(_rhs);
 }
 
-Vec3 Vec3::operator/(const Vec3& _rhs) const 
+Vec3 Vec3::operator/(const Vec3& _rhs) const
 {
-	if (_rhs.X == 0.f || _rhs.Y == 0.f || _rhs.Z == 0.f)
-		Callback::CallErrorCallback(CLASS_NAME, "operator/", "Division by 0");
-
-	return Vec3(X / _rhs.X, Y / _rhs.Y, Z / _rhs.Z);
+	return Base::operator/(_rhs);
 }
 
 Vec3& Vec3::operator+=(const Vec3& _rhs) noexcept
 {
-	X += _rhs.X;
-	Y += _rhs.Y;
-	Z += _rhs.Z;
+	Base::operator+=(_rhs);
 	return *this;
 }
 
 Vec3& Vec3::operator-=(const Vec3& _rhs) noexcept
 {
-	X -= _rhs.X;
-	Y -= _rhs.Y;
-	Z -= _rhs.Z;
+	Base::operator-=(_rhs);
 	return *this;
 }
 
 Vec3& Vec3::operator*=(const Vec3& _rhs) noexcept
 {
-	X *= _rhs.X;
-	Y *= _rhs.Y;
-	Z *= _rhs.Z;
+	Base::operator*=(_rhs);
 	return *this;
 }
 
-Vec3& Vec3::operator/=(const Vec3& _rhs) 
+Vec3& Vec3::operator/=(const Vec3& _rhs)
 {
-	if (_rhs.X == 0.f || _rhs.Y == 0.f || _rhs.Z == 0.f)
-		Callback::CallErrorCallback(CLASS_NAME, "operator/", "Division by 0");
-
-	X /= _rhs.X;
-	Y /= _rhs.Y;
-	Z /= _rhs.Z;
+	Base::operator/=(_rhs);
 	return *this;
 }
 
 Vec3 Vec3::operator+(float _scale) const noexcept
 {
-	return Vec3(X + _scale, Y + _scale, Z + _scale);
+	return Base::operator+(_scale);
 }
 
 Vec3 Vec3::operator-(float _scale) const noexcept
 {
-	return Vec3(X - _scale, Y - _scale, Z - _scale);
+	return Base::operator-(_scale);
 }
 
 Vec3 Vec3::operator*(float _scale) const noexcept
 {
-	return Vec3(X * _scale, Y * _scale, Z * _scale);
+	return Base::operator*(_scale);
 }
 
 Vec3 Vec3::operator/(float _scale) const
 {
-	if (_scale == 0.f)
-		Callback::CallErrorCallback(CLASS_NAME, "operator/", "Division by 0");
-	return Vec3(X / _scale, Y / _scale, Z / _scale);
+	return Base::operator/(_scale);
 }
 
 Vec3& Vec3::operator+=(float _scale) noexcept
 {
-	X += _scale;
-	Y += _scale;
-	Z += _scale;
+	Base::operator+=(_scale);
 	return *this;
 }
 
 Vec3& Vec3::operator-=(float _scale) noexcept
 {
-	X -= _scale;
-	Y -= _scale;
-	Z -= _scale;
+	Base::operator-=(_scale);
 	return *this;
 }
 
 Vec3& Vec3::operator*=(float _scale) noexcept
 {
-	X *= _scale;
-	Y *= _scale;
-	Z *= _scale;
+	Base::operator*=(_scale);
 	return *this;
 }
 
-Vec3& Vec3::operator/=(float _scale) 
+Vec3& Vec3::operator/=(float _scale)
 {
-	if (_scale == 0.f)
-		Callback::CallErrorCallback(CLASS_NAME, "operator/", "Division by 0");
-
-	X /= _scale;
-	Y /= _scale;
-	Z /= _scale;
+	Base::operator/=(_scale);
 	return *this;
 }
 
@@ -1,3 +1,4 @@
+#include <limits>
 #include <stdexcept>
 #include <string>
 
@@ -33,115 +34,132 @@ const Vec4 Vec4::Backward = Vec4(0.f, 0.f, -1.f, 0.f);
 //Constructors
 
 Vec4::Vec4(float _x, float _y, float _z, float _w) noexcept :
-	X{ _x }, Y{ _y }, Z{ _z }, W{_w}
+	Base(_x, _y, _z, _w)
 {
 }
 
 Vec4::Vec4(float _xyzw) noexcept :
-	X{ _xyzw }, Y{ _xyzw }, Z{ _xyzw }, W{ _xyzw}
+	Base(_xyzw)
 {
 }
 
 Vec4::Vec4(const Vec2& _vec2, float _z, float _w) noexcept :
-	X{ _vec2.X }, Y{ _vec2.Y }, Z{ _z }, W{ _w}
+	Base(_vec2.X, _vec2.Y, _z, _w)
 {
 }
 
 Vec4::Vec4(const Vec3& _vec3, float _w) noexcept :
-	X{ _vec3.X }, Y{ _vec3.Y }, Z{ _vec3.Z }, W{ _w }
+	Base(_vec3.X, _vec3.Y, _vec3.Z, _w)
+{
+}
+
+Vec4::Vec4(const Base& _vec) noexcept :
+	Base(_vec)
 {
 }
 
 //Static Methods
 float Vec4::Distance(const Vec4& _start, const Vec4& _end) noexcept
 {
-	return (_end - _start).Length();
+	return Base::Distance(_start, _end);
 }
 
 float Vec4::SqrDistance(const Vec4& _start, const Vec4& _end) noexcept
 {
-	return (_end - _start).SquaredLength();
+	return Base::SqrDistance(_start, _end);
 }
 
 Vec4 Vec4::Lerp(const Vec4& _start, const Vec4& _end, float _alpha) noexcept
 {
-	float alpha = Math::Clamp(_alpha, 0.f, 1.f);
-
-	Vec4 temp = _end - _start;
-	return _start + (_end - _start) * alpha;
+	return Base::Lerp(_start, _end, Math::Clamp(_alpha, 0.f, 1.f));
 }
 
 
 //Equality
 bool Vec4::IsZero() const noexcept
 {
-	return *this == Vec4::Zero;
+	return Base::IsZero();
 }
 
 bool Vec4::Equals(const Vec4& _other, float _epsilon) const noexcept
 {
-	bool compare_X = Math::Equals(X, _other.X, _epsilon);
-	bool compare_Y = Math::Equals(Y, _other.Y, _epsilon);
-	bool compare_Z = Math::Equals(Z, _other.Z, _epsilon);
-	bool compare_W = Math::Equals(W, _other.W, _epsilon);
-
-	return compare_X && compare_Y && compare_Z && compare_W;
+	return Base::Equals(_other, _epsilon);
 }
 
 bool Vec4::operator==(const Vec4& _rhs) const noexcept
 {
-	return (X == _rhs.X && Y == _rhs.Y && Z == _rhs.Z && W == _rhs.W);
+	return Base::operator==(_rhs);
 }
 
 bool Vec4::operator!=(const Vec4& _rhs) const noexcept
 {
-	return !(X == _rhs.X && Y == _rhs.Y && Z == _rhs.Z && W == _rhs.W);
+	return Base::operator!=(_rhs);
 }
 
 //Accessors
 const float* Vec4::Data() const noexcept
 {
-	return &X;
+	return Base::Data();
 }
 
 //Methods
 float Vec4::Length() const noexcept
 {
-	return Math::Sqrt(SquaredLength());
+	return Base::Length();
 }
 
 float Vec4::SquaredLength() const noexcept
 {
-	return X * X + Y * Y + Z * Z + W * W;
+	return Base::SquaredLength();
 }
 
 Vec4& Vec4::Normalize() noexcept
 {
-	float length = Length();
+	Base::Normalize();
+	return *this;
+}
 
-	if (length != 0.f)
-	{
-		X /= length;
-		Y /= length;
-		Z /= length;
-		W /= length;
-	}
-	else
+Vec4 Vec4::GetNormalized() const noexcept
+{
+	return Base::GetNormalized();
+}
+
+Vec4& Vec4::NormalizeFast() noexcept
+{
+	const float squared_length = X * X + Y * Y + Z * Z + W * W;
+
+	// Denormal or null squared length: the batch path rescales tiny vectors before the inverse square root.
+	if (squared_length < std::numeric_limits<float>::min())
 	{
-		Callback::CallErrorCallback(CLASS_NAME, "Normalize", "Division by O due to vector length being equal to 0");
+		Math::NormalizeFast(&X, 1, 4, &X);
+		return *this;
 	}
 
+	const float scale = Math::FastInverseSqrt(squared_length);
+
+	X *= scale;
+	Y *= scale;
+	Z *= scale;
+	W *= scale;
+
 	return *this;
 }
 
-Vec4 Vec4::GetNormalized() const noexcept
+Vec4 Vec4::GetNormalizedFast() const noexcept
 {
 	Vec4 tmp = *this;
-	tmp.Normalize();
+	tmp.NormalizeFast();
 
 	return tmp;
 }
 
+void Vec4::NormalizeFast(const Vec4* _vectors, size_t _count, Vec4* _result, bool _multithreaded)
+{
+	static_assert(sizeof(Vec4) == 4 * sizeof(float), "Vec4 must be tightly packed for bulk normalization");
+
+	Math::NormalizeFast(reinterpret_cast<const float*>(_vectors), _count, 4, reinterpret_cast<float*>(_result), _multithreaded);
+}
+
 bool  Vec4::IsNormalized() const noexcept
 {
 	return Math::Equals(Length(), 1.f, 0.001f);
@@ -150,130 +168,95 @@ bool  Vec4::IsNormalized() const noexcept
 //Operator
 Vec4 Vec4::operator-() const noexcept
 {
-	return Vec4(-X, -Y, -Z, -W);
+	return Base::operator-();
 }
 
 Vec4 Vec4::operator+(const Vec4& _rhs) const noexcept
 {
-	return Vec4(X + _rhs.X, Y + _rhs.Y, Z + _rhs.Z, W + _rhs.W);
+	return Base::operator+(_rhs);
 }
 
 Vec4 Vec4::operator-(const Vec4& _rhs) const noexcept
 {
-	return Vec4(X - _rhs.X, Y - _rhs.Y, Z - _rhs.Z, W - _rhs.W);
+	return Base::operator-(_rhs);
 }
 
 Vec4 Vec4::operator*(const Vec4& _rhs) const noexcept
 {
-	return Vec4(X * _rhs.X, Y * _rhs.Y, Z * _rhs.Z, W * _rhs.W);
+	return Base::operator*(_rhs);
 }
 
 Vec4 Vec4::operator/(const Vec4& _rhs) const
 {
-	if (_rhs.X == 0.f || _rhs.Y == 0.f || _rhs.Z == 0.f || _rhs.W == 0.f)
-		Callback::CallErrorCallback(CLASS_NAME, "operator/", "Division by 0");
-
-	return Vec4(X / _rhs.X, Y / _rhs.Y, Z / _rhs.Z, W / _rhs.W);
+	return Base::operator/(_rhs);
 }
 
 Vec4& Vec4::operator+=(const Vec4& _rhs) noexcept
 {
-	X += _rhs.X;
-	Y += _rhs.Y;
-	Z += _rhs.Z;
-	W += _rhs.W;
+	Base::operator+=(_rhs);
 	return *this;
 }
 
 Vec4& Vec4::operator-=(const Vec4& _rhs) noexcept
 {
-	X -= _rhs.X;
-	Y -= _rhs.Y;
-	Z -= _rhs.Z;
-	W -= _rhs.W;
+	Base::operator-=(_rhs);
 	return *this;
 }
 
 Vec4& Vec4::operator*=(const Vec4& _rhs) noexcept
 {
-	X *= _rhs.X;
-	Y *= _rhs.Y;
-	Z *= _rhs.Z;
-	W *= _rhs.W;
+	Base::operator*=(_rhs);
 	return *this;
 }
 
 Vec4& Vec4::operator/=(const Vec4& _rhs)
 {
-	if (_rhs.X == 0.f || _rhs.Y == 0.f || _rhs.Z == 0.f || _rhs.W == 0.f)
-		Callback::CallErrorCallback(CLASS_NAME, "operator/", "Division by 0");
-
-	X /= _rhs.X;
-	Y /= _rhs.Y;
-	Z /= _rhs.Z;
-	W /= _rhs.W;
+	Base::operator/=(_rhs);
 	return *this;
 }
 
 Vec4 Vec4::operator+(float _scale) const noexcept
 {
-	return Vec4(X + _scale, Y + _scale, Z + _scale, W + _scale);
+	return Base::operator+(_scale);
 }
 
 Vec4 Vec4::operator-(float _scale) const noexcept
 {
-	return Vec4(X - _scale, Y - _scale, Z - _scale, W - _scale);
+	return Base::operator-(_scale);
 }
 
 Vec4 Vec4::operator*(float _scale) const noexcept
 {
-	return Vec4(X * _scale, Y * _scale, Z * _scale, W * _scale);
+	return Base::operator*(_scale);
 }
 
 Vec4 Vec4::operator/(float _scale) const
 {
-	if (_scale == 0.f)
-		Callback::CallErrorCallback(CLASS_NAME, "operator/", "Division by 0");
-	return Vec4(X / _scale, Y / _scale, Z / _scale, W / _scale);
+	return Base::operator/(_scale);
 }
 
 Vec4& Vec4::operator+=(float _scale) noexcept
 {
-	X += _scale;
-	Y += _scale;
-	Z += _scale;
-	W += _scale;
+	Base::operator+=(_scale);
 	return *this;
 }
 
 Vec4& Vec4::operator-=(float _scale) noexcept
 {
-	X -= _scale;
-	Y -= _scale;
-	Z -= _scale;
-	W -= _scale;
+	Base::operator-=(_scale);
 	return *this;
 }
 
 
 Vec4& Vec4::operator*=(float _scale) noexcept
 {
-	X *= _scale;
-	Y *= _scale;
-	Z *= _scale;
-	W *= _scale;
+	Base::operator*=(_scale);
 	return *this;
 }
 
 Vec4& Vec4::operator/=(float _scale)
 {
-	if (_scale == 0.f)
-		Callback::CallErrorCallback(CLASS_NAME, "operator/", "Division by 0");
-
-	X /= _scale;
-	Y /= _scale;
-	Z /= _scale;
-	W /= _scale;
+	Base::operator/=(_scale);
 	return *this;
 }
 
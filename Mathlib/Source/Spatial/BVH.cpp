@@ -0,0 +1,604 @@
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <thread>
+
+#include <Spatial/BVH.hpp>
+#include <Geometry/Ray.hpp>
+#include <Geometry/Triangle.hpp>
+#include <Geometry/Intersection.hpp>
+#include <Misc/Callback.hpp>
+#include <Misc/Parallel.hpp>
+
+using namespace Mathlib;
+
+#define CLASS_NAME "BVH"
+
+namespace
+{
+	/// Maximum tree depth reachable by traversal stacks.
+	constexpr uint32_t StackSize = 64;
+
+	/// Depth at which degenerate splits force leaves, keeps traversal stacks bounded.
+	constexpr uint32_t MaxDepth = StackSize - 2;
+
+	/// Minimum number of primitives of a subtree worth building on its own thread.
+	constexpr size_t ParallelBuildThreshold = 4096;
+
+	/**
+	*	\brief Node produced by the build, before the depth first flattening.
+	*/
+	struct BuildNode
+	{
+		AABB bounds;
+		uint32_t left = 0;
+		uint32_t first = 0;
+		uint32_t count = 0;
+	};
+
+	/**
+	*	\brief State shared by every build task.
+	*/
+	struct BuildContext
+	{
+		const AABB* bounds = nullptr;
+		std::vector<Vec3> centroids;
+		uint32_t* indices = nullptr;
+		std::vector<BuildNode> nodes;
+		std::atomic<uint32_t> nodeCount{ 0 };
+		uint32_t threadDepth = 0;
+	};
+
+	/**
+	*	\brief Bin of the surface area heuristic.
+	*/
+	struct Bin
+	{
+		AABB bounds = AABB::Empty;
+		uint32_t count = 0;
+	};
+
+	/**
+	*	\brief Return the surface area of a box, 0 for empty boxes.
+	*/
+	inline float SurfaceArea(const AABB& _aabb) noexcept
+	{
+		return _aabb.IsValid() ? _aabb.GetSurfaceArea() : 0.f;
+	}
+
+	/**
+	*	\brief Find the best binned SAH split of a node.
+	*
+	*	\return if a split cheaper than a leaf was found.
+	*/
+	bool FindSplit(const BuildContext& _context, uint32_t _first, uint32_t _count, const AABB& _node_bounds, const AABB& _centroid_bounds,
+		unsigned int& _axis, float& _position) noexcept
+	{
+		const float leaf_cost = static_cast<float>(_count);
+		const float inverse_area = 1.f / std::max(SurfaceArea(_node_bounds), std::numeric_limits<float>::min());
+
+		float best_cost = std::numeric_limits<float>::max();
+
+		for (unsigned int axis = 0; axis < 3; ++axis)
+		{
+			const float axis_min = _centroid_bounds.min.Data()[axis];
+			const float axis_extent = _centroid_bounds.max.Data()[axis] - axis_min;
+
+			if (axis_extent <= 0.f)
+				continue;
+
+			Bin bins[BVH::BinCount];
+			const float bin_scale = static_cast<float>(BVH::BinCount) / axis_extent;
+
+			for (uint32_t i = _first; i < _first + _count; ++i)
+			{
+				uint32_t primitive = _context.indices[i];
+				uint32_t bin = std::min(BVH::BinCount - 1, static_cast<uint32_t>((_context.centroids[primitive].Data()[axis] - axis_min) * bin_scale));
+				bins[bin].bounds.Encapsulate(_context.bounds[primitive]);
+				++bins[bin].count;
+			}
+
+			// Sweep from the right to get every right partition, then from the left.
+			float right_area[BVH::BinCount - 1];
+			uint32_t right_count[BVH::BinCount - 1];
+			AABB accumulated = AABB::Empty;
+			uint32_t accumulated_count = 0;
+
+			for (uint32_t i = BVH::BinCount - 1; i > 0; --i)
+			{
+				accumulated.Encapsulate(bins[i].bounds);
+				accumulated_count += bins[i].count;
+				right_area[i - 1] = SurfaceArea(accumulated);
+				right_count[i - 1] = accumulated_count;
+			}
+
+			accumulated = AABB::Empty;
+			accumulated_count = 0;
+
+			for (uint32_t i = 0; i < BVH::BinCount - 1; ++i)
+			{
+				accumulated.Encapsulate(bins[i].bounds);
+				accumulated_count += bins[i].count;
+
+				if (accumulated_count == 0 || right_count[i] == 0)
+					continue;
+
+				float cost = 1.f + (SurfaceArea(accumulated) * accumulated_count + right_area[i] * right_count[i]) * inverse_area;
+
+				if (cost < best_cost)
+				{
+					best_cost = cost;
+					_axis = axis;
+					_position = axis_min + static_cast<float>(i + 1) / bin_scale;
+				}
+			}
+		}
+
+		return best_cost < leaf_cost;
+	}
+
+	/**
+	*	\brief Recursively build the subtree of _node over indices [_first, _first + _count).
+	*/
+	void BuildRecursive(BuildContext& _context, uint32_t _node, uint32_t _first, uint32_t _count, uint32_t _depth)
+	{
+		BuildNode& node = _context.nodes[_node];
+
+		AABB centroid_bounds = AABB::Empty;
+		node.bounds = AABB::Empty;
+
+		for (uint32_t i = _first; i < _first + _count; ++i)
+		{
+			uint32_t primitive = _context.indices[i];
+			node.bounds.Encapsulate(_context.bounds[primitive]);
+			centroid_bounds.Encapsulate(_context.centroids[primitive]);
+		}
+
+		node.first = _first;
+		node.count = _count;
+
+		if (_count <= 1 || _depth >= MaxDepth)
+			return;
+
+		unsigned int axis = 0;
+		float position = 0.f;
+		uint32_t middle = _first;
+
+		if (FindSplit(_context, _first, _count, node.bounds, centroid_bounds, axis, position))
+		{
+			uint32_t* partition = std::partition(_context.indices + _first, _context.indices + _first + _count,
+				[&_context, axis, position](uint32_t _primitive) { return _context.centroids[_primitive].Data()[axis] < position; });
+
+			middle = static_cast<uint32_t>(partition - _context.indices);
+		}
+
+		if ((middle == _first || middle == _first + _count) && _count > BVH::MaxLeafSize)
+		{
+			// No useful split but too many primitives for a leaf: median split on the centroids along the largest extent.
+			const Vec3 extent = centroid_bounds.max - centroid_bounds.min;
+			const unsigned int largest = extent.X >= extent.Y ? (extent.X >= extent.Z ? 0 : 2) : (extent.Y >= extent.Z ? 1 : 2);
+
+			middle = _first + _count / 2;
+			std::nth_element(_context.indices + _first, _context.indices + middle, _context.indices + _first + _count,
+				[&_context, largest](uint32_t _left, uint32_t _right)
+				{ return _context.centroids[_left].Data()[largest] < _context.centroids[_right].Data()[largest]; });
+		}
+
+		if (middle == _first || middle == _first + _count)
+			return;
+
+		uint32_t left = _context.nodeCount.fetch_add(2);
+		node.left = left;
+		node.count = 0;
+
+		uint32_t left_count = middle - _first;
+		uint32_t right_count = _count - left_count;
+
+		if (_depth < _context.threadDepth && _count >= ParallelBuildThreshold)
+		{
+			std::thread left_thread(BuildRecursive, std::ref(_context), left, _first, left_count, _depth + 1);
+			BuildRecursive(_context, left + 1, middle, right_count, _depth + 1);
+			left_thread.join();
+		}
+		else
+		{
+			BuildRecursive(_context, left, _first, left_count, _depth + 1);
+			BuildRecursive(_context, left + 1, middle, right_count, _depth + 1);
+		}
+	}
+
+	/**
+	*	\brief Copy build nodes in depth first order so left children follow their parent.
+	*/
+	void Flatten(const std::vector<BuildNode>& _build_nodes, uint32_t _build_node, std::vector<BVHNode>& _nodes)
+	{
+		const BuildNode& build_node = _build_nodes[_build_node];
+
+		uint32_t index = static_cast<uint32_t>(_nodes.size());
+		_nodes.push_back(BVHNode());
+		_nodes[index].bounds = build_node.bounds;
+
+		if (build_node.count != 0)
+		{
+			_nodes[index].offset = build_node.first;
+			_nodes[index].count = build_node.count;
+			return;
+		}
+
+		Flatten(_build_nodes, build_node.left, _nodes);
+		_nodes[index].offset = static_cast<uint32_t>(_nodes.size());
+		Flatten(_build_nodes, build_node.left + 1, _nodes);
+	}
+
+	/**
+	*	\brief Ray slab test against a node, returning the entry distance or infinity on miss.
+	*/
+	inline float NodeEntry(const AABB& _bounds, const Vec3& _origin, const Vec3& _inverse_direction, float _max_distance) noexcept
+	{
+		float t1_x = (_bounds.min.X - _origin.X) * _inverse_direction.X;
+		float t2_x = (_bounds.max.X - _origin.X) * _inverse_direction.X;
+		float t1_y = (_bounds.min.Y - _origin.Y) * _inverse_direction.Y;
+		float t2_y = (_bounds.max.Y - _origin.Y) * _inverse_direction.Y;
+		float t1_z = (_bounds.min.Z - _origin.Z) * _inverse_direction.Z;
+		float t2_z = (_bounds.max.Z - _origin.Z) * _inverse_direction.Z;
+
+		float t_min = std::max(std::max(std::min(t1_x, t2_x), std::min(t1_y, t2_y)), std::max(std::min(t1_z, t2_z), 0.f));
+		float t_max = std::min(std::min(std::max(t1_x, t2_x), std::max(t1_y, t2_y)), std::min(std::max(t1_z, t2_z), _max_distance));
+
+		return t_min <= t_max ? t_min : std::numeric_limits<float>::infinity();
+	}
+
+	/**
+	*	\brief Ray test against one triangle for the triangle Raycast overload.
+	*/
+	bool RaycastTriangle(const Ray& _ray, uint32_t _primitive, float& _distance, void* _user_data)
+	{
+		const Triangle* triangles = static_cast<const Triangle*>(_user_data);
+
+		float distance = 0.f;
+		if (Intersection::RayTriangle(_ray, triangles[_primitive], distance) && distance < _distance)
+		{
+			_distance = distance;
+			return true;
+		}
+
+		return false;
+	}
+
+	/**
+	*	\brief Closest point of one triangle for the triangle ClosestPoint overload.
+	*/
+	Vec3 ClosestPointTriangle(const Vec3& _point, uint32_t _primitive, void* _user_data)
+	{
+		const Triangle* triangles = static_cast<const Triangle*>(_user_data);
+		return triangles[_primitive].ClosestPoint(_point);
+	}
+
+	/**
+	*	\brief Compute each triangle bounds.
+	*/
+	std::vector<AABB> TriangleBounds(const Triangle* _triangles, size_t _count)
+	{
+		std::vector<AABB> bounds(_count);
+
+		for (size_t i = 0; i < _count; ++i)
+			bounds[i] = _triangles[i].GetAABB();
+
+		return bounds;
+	}
+}
+
+//Build
+
+void BVH::Build(const AABB* _bounds, size_t _count, bool _multithreaded)
+{
+	Clear();
+
+	if (_count == 0)
+		return;
+
+	if (_count > std::numeric_limits<uint32_t>::max() / 2)
+	{
+		Callback::CallErrorCallback(CLASS_NAME, "Build", "Too many primitives");
+		return;
+	}
+
+	uint32_t count = static_cast<uint32_t>(_count);
+
+	primitiveIndices.resize(count);
+	for (uint32_t i = 0; i < count; ++i)
+		primitiveIndices[i] = i;
+
+	BuildContext context;
+	context.bounds = _bounds;
+	context.indices = primitiveIndices.data();
+	context.centroids.resize(count);
+	context.nodes.resize(2 * count - 1);
+	context.nodeCount = 1;
+
+	for (uint32_t i = 0; i < count; ++i)
+		context.centroids[i] = _bounds[i].GetCenter();
+
+	if (_multithreaded)
+	{
+		// Split the top levels until every hardware thread has a subtree.
+		unsigned int threads = Math::GetThreadCount();
+		while ((1u << context.threadDepth) < threads)
+			++context.threadDepth;
+	}
+
+	BuildRecursive(context, 0, 0, count, 0);
+
+	nodes.reserve(context.nodeCount);
+	Flatten(context.nodes, 0, nodes);
+
+	primitiveBounds.resize(count);
+	for (uint32_t i = 0; i < count; ++i)
+		primitiveBounds[i] = _bounds[primitiveIndices[i]];
+}
+
+void BVH::Build(const Triangle* _triangles, size_t _count, bool _multithreaded)
+{
+	std::vector<AABB> bounds = TriangleBounds(_triangles, _count);
+	Build(bounds.data(), _count, _multithreaded);
+}
+
+void BVH::Refit(const AABB* _bounds) noexcept
+{
+	// Children are always stored after their parent, a reverse sweep updates them first.
+	for (size_t i = nodes.size(); i-- > 0;)
+	{
+		BVHNode& node = nodes[i];
+
+		if (node.IsLeaf())
+		{
+			node.bounds = AABB::Empty;
+			for (uint32_t j = node.offset; j < node.offset + node.count; ++j)
+			{
+				primitiveBounds[j] = _bounds[primitiveIndices[j]];
+				node.bounds.Encapsulate(primitiveBounds[j]);
+			}
+		}
+		else
+		{
+			node.bounds = AABB::Union(nodes[i + 1].bounds, nodes[node.offset].bounds);
+		}
+	}
+}
+
+void BVH::Refit(const Triangle* _triangles) noexcept
+{
+	for (size_t i = nodes.size(); i-- > 0;)
+	{
+		BVHNode& node = nodes[i];
+
+		if (node.IsLeaf())
+		{
+			node.bounds = AABB::Empty;
+			for (uint32_t j = node.offset; j < node.offset + node.count; ++j)
+			{
+				primitiveBounds[j] = _triangles[primitiveIndices[j]].GetAABB();
+				node.bounds.Encapsulate(primitiveBounds[j]);
+			}
+		}
+		else
+		{
+			node.bounds = AABB::Union(nodes[i + 1].bounds, nodes[node.offset].bounds);
+		}
+	}
+}
+
+void BVH::Clear() noexcept
+{
+	nodes.clear();
+	primitiveIndices.clear();
+	primitiveBounds.clear();
+}
+
+//Accessors
+
+bool BVH::IsEmpty() const noexcept
+{
+	return nodes.empty();
+}
+
+AABB BVH::GetBounds() const noexcept
+{
+	return nodes.empty() ? AABB::Empty : nodes[0].bounds;
+}
+
+const std::vector<BVHNode>& BVH::GetNodes() const noexcept
+{
+	return nodes;
+}
+
+const std::vector<uint32_t>& BVH::GetPrimitiveIndices() const noexcept
+{
+	return primitiveIndices;
+}
+
+//Queries
+
+bool BVH::Raycast(const Ray& _ray, BVHRaycastFunction _function, void* _user_data, float& _distance, uint32_t& _primitive) const noexcept
+{
+	if (nodes.empty())
+		return false;
+
+	const Vec3 inverse_direction(1.f / _ray.direction.X, 1.f / _ray.direction.Y, 1.f / _ray.direction.Z);
+
+	if (NodeEntry(nodes[0].bounds, _ray.origin, inverse_direction, _distance) == std::numeric_limits<float>::infinity())
+		return false;
+
+	uint32_t stack[StackSize];
+	uint32_t stack_size = 0;
+	uint32_t current = 0;
+	bool hit = false;
+
+	while (true)
+	{
+		const BVHNode& node = nodes[current];
+
+		if (node.IsLeaf())
+		{
+			for (uint32_t i = 0; i < node.count; ++i)
+			{
+				uint32_t primitive = primitiveIndices[node.offset + i];
+				if (_function(_ray, primitive, _distance, _user_data))
+				{
+					_primitive = primitive;
+					hit = true;
+				}
+			}
+		}
+		else
+		{
+			uint32_t near_child = current + 1;
+			uint32_t far_child = node.offset;
+
+			float near_entry = NodeEntry(nodes[near_child].bounds, _ray.origin, inverse_direction, _distance);
+			float far_entry = NodeEntry(nodes[far_child].bounds, _ray.origin, inverse_direction, _distance);
+
+			if (far_entry < near_entry)
+			{
+				std::swap(near_child, far_child);
+				std::swap(near_entry, far_entry);
+			}
+
+			if (near_entry != std::numeric_limits<float>::infinity())
+			{
+				if (far_entry != std::numeric_limits<float>::infinity())
+					stack[stack_size++] = far_child;
+
+				current = near_child;
+				continue;
+			}
+		}
+
+		// Pop the next node still in front of the closest hit.
+		bool found = false;
+		while (stack_size > 0 && !found)
+		{
+			current = stack[--stack_size];
+			found = NodeEntry(nodes[current].bounds, _ray.origin, inverse_direction, _distance) != std::numeric_limits<float>::infinity();
+		}
+
+		if (!found)
+			break;
+	}
+
+	return hit;
+}
+
+bool BVH::Raycast(const Ray& _ray, const Triangle* _triangles, float& _distance, uint32_t& _primitive) const noexcept
+{
+	return Raycast(_ray, RaycastTriangle, const_cast<Triangle*>(_triangles), _distance, _primitive);
+}
+
+size_t BVH::QueryAABB(const AABB& _aabb, uint32_t* _results, size_t _capacity) const noexcept
+{
+	if (nodes.empty())
+		return 0;
+
+	uint32_t stack[StackSize];
+	uint32_t stack_size = 0;
+	stack[stack_size++] = 0;
+
+	size_t result_count = 0;
+
+	while (stack_size > 0)
+	{
+		const uint32_t current = stack[--stack_size];
+		const BVHNode& node = nodes[current];
+
+		if (!node.bounds.Intersects(_aabb))
+			continue;
+
+		if (node.IsLeaf())
+		{
+			for (uint32_t i = node.offset; i < node.offset + node.count; ++i)
+			{
+				if (!primitiveBounds[i].Intersects(_aabb))
+					continue;
+
+				if (result_count < _capacity)
+					_results[result_count] = primitiveIndices[i];
+				++result_count;
+			}
+		}
+		else
+		{
+			stack[stack_size++] = node.offset;
+			stack[stack_size++] = current + 1;
+		}
+	}
+
+	return result_count;
+}
+
+bool BVH::ClosestPoint(const Vec3& _point, BVHClosestPointFunction _function, void* _user_data,
+	float& _max_distance, Vec3& _closest, uint32_t& _primitive) const noexcept
+{
+	if (nodes.empty())
+		return false;
+
+	float best_sqr_distance = _max_distance * _max_distance;
+	bool found = false;
+
+	uint32_t stack[StackSize];
+	uint32_t stack_size = 0;
+	stack[stack_size++] = 0;
+
+	while (stack_size > 0)
+	{
+		const uint32_t current = stack[--stack_size];
+		const BVHNode& node = nodes[current];
+
+		if (Vec3::SqrDistance(_point, node.bounds.ClosestPoint(_point)) >= best_sqr_distance)
+			continue;
+
+		if (node.IsLeaf())
+		{
+			for (uint32_t i = 0; i < node.count; ++i)
+			{
+				uint32_t primitive = primitiveIndices[node.offset + i];
+				Vec3 closest = _function(_point, primitive, _user_data);
+				float sqr_distance = Vec3::SqrDistance(_point, closest);
+
+				if (sqr_distance < best_sqr_distance)
+				{
+					best_sqr_distance = sqr_distance;
+					_closest = closest;
+					_primitive = primitive;
+					found = true;
+				}
+			}
+		}
+		else
+		{
+			uint32_t near_child = current + 1;
+			uint32_t far_child = node.offset;
+
+			float near_distance = Vec3::SqrDistance(_point, nodes[near_child].bounds.ClosestPoint(_point));
+			float far_distance = Vec3::SqrDistance(_point, nodes[far_child].bounds.ClosestPoint(_point));
+
+			if (far_distance < near_distance)
+				std::swap(near_child, far_child);
+
+			// Nearest child popped first.
+			stack[stack_size++] = far_child;
+			stack[stack_size++] = near_child;
+		}
+	}
+
+	if (found)
+		_max_distance = std::sqrt(best_sqr_distance);
+
+	return found;
+}
+
+bool BVH::ClosestPoint(const Vec3& _point, const Triangle* _triangles, float& _max_distance, Vec3& _closest, uint32_t& _primitive) const noexcept
+{
+	return ClosestPoint(_point, ClosestPointTriangle, const_cast<Triangle*>(_triangles), _max_distance, _closest, _primitive);
+}
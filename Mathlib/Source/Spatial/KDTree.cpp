@@ -0,0 +1,344 @@
+#include <algorithm>
+#include <limits>
+#include <thread>
+
+#include <Spatial/KDTree.hpp>
+#include <Misc/Parallel.hpp>
+#include <Misc/Callback.hpp>
+
+using namespace Mathlib;
+
+#define CLASS_NAME "KDTree"
+
+namespace
+{
+	/// Traversal stack size, each level leaves at most one pending sibling.
+	constexpr uint32_t StackSize = 96;
+
+	/// Minimum number of points of a subtree worth building on its own thread.
+	constexpr size_t ParallelBuildThreshold = 16384;
+
+	/// Minimum number of queries processed by one thread of batched queries.
+	constexpr size_t ParallelQueryBatch = 64;
+
+	/**
+	*	\brief Subtree waiting to be visited, _bound being a lower bound of its squared distance to the query.
+	*/
+	struct StackEntry
+	{
+		uint32_t begin;
+		uint32_t end;
+		float bound;
+	};
+
+	/**
+	*	\brief Return one coordinate of a vector, 0 for X, 1 for Y, 2 for Z.
+	*/
+	inline float GetAxis(const Vec3& _vector, unsigned int _axis) noexcept
+	{
+		return _axis == 0 ? _vector.X : (_axis == 1 ? _vector.Y : _vector.Z);
+	}
+
+	/**
+	*	\brief Recursively split [_begin, _end) of _order at its median along the axis of largest spread.
+	*/
+	void BuildRange(const Vec3* _points, uint32_t* _order, uint8_t* _axes, size_t _begin, size_t _end, unsigned int _depth, unsigned int _thread_depth)
+	{
+		if (_end - _begin <= 1)
+		{
+			if (_end > _begin)
+				_axes[_begin] = 0;
+			return;
+		}
+
+		Vec3 min = _points[_order[_begin]];
+		Vec3 max = min;
+		for (size_t i = _begin + 1; i < _end; ++i)
+		{
+			const Vec3& point = _points[_order[i]];
+			min = Vec3(std::min(min.X, point.X), std::min(min.Y, point.Y), std::min(min.Z, point.Z));
+			max = Vec3(std::max(max.X, point.X), std::max(max.Y, point.Y), std::max(max.Z, point.Z));
+		}
+
+		Vec3 spread = max - min;
+		unsigned int axis = spread.X >= spread.Y ? (spread.X >= spread.Z ? 0 : 2) : (spread.Y >= spread.Z ? 1 : 2);
+
+		size_t median = (_begin + _end) / 2;
+		std::nth_element(_order + _begin, _order + median, _order + _end, [_points, axis](uint32_t _lhs, uint32_t _rhs)
+		{
+			return GetAxis(_points[_lhs], axis) < GetAxis(_points[_rhs], axis);
+		});
+
+		_axes[median] = static_cast<uint8_t>(axis);
+
+		if (_depth < _thread_depth && _end - _begin >= ParallelBuildThreshold)
+		{
+			std::thread left_thread(BuildRange, _points, _order, _axes, _begin, median, _depth + 1, _thread_depth);
+			BuildRange(_points, _order, _axes, median + 1, _end, _depth + 1, _thread_depth);
+			left_thread.join();
+		}
+		else
+		{
+			BuildRange(_points, _order, _axes, _begin, median, _depth + 1, _thread_depth);
+			BuildRange(_points, _order, _axes, median + 1, _end, _depth + 1, _thread_depth);
+		}
+	}
+
+	/**
+	*	\brief Restore the max heap property from the root of a heap of _size entries.
+	*/
+	void SiftDown(uint32_t* _indices, float* _keys, size_t _size) noexcept
+	{
+		size_t parent = 0;
+
+		while (true)
+		{
+			size_t child = 2 * parent + 1;
+			if (child >= _size)
+				break;
+
+			if (child + 1 < _size && _keys[child + 1] > _keys[child])
+				++child;
+
+			if (_keys[child] <= _keys[parent])
+				break;
+
+			std::swap(_keys[child], _keys[parent]);
+			std::swap(_indices[child], _indices[parent]);
+			parent = child;
+		}
+	}
+
+	/**
+	*	\brief Add an entry at the end of a max heap of _size entries and restore the heap property.
+	*/
+	void PushHeap(uint32_t* _indices, float* _keys, size_t _size, uint32_t _index, float _key) noexcept
+	{
+		size_t child = _size;
+		_indices[child] = _index;
+		_keys[child] = _key;
+
+		while (child > 0)
+		{
+			size_t parent = (child - 1) / 2;
+			if (_keys[parent] >= _keys[child])
+				break;
+
+			std::swap(_keys[child], _keys[parent]);
+			std::swap(_indices[child], _indices[parent]);
+			child = parent;
+		}
+	}
+}
+
+//Build
+
+void KDTree::Build(const Vec3* _points, size_t _count, bool _multithreaded)
+{
+	Clear();
+
+	if (_count == 0)
+		return;
+
+	if (_count >= std::numeric_limits<uint32_t>::max())
+	{
+		Callback::CallErrorCallback(CLASS_NAME, "Build", "Point count exceeds 32 bits indices.");
+		return;
+	}
+
+	indices.resize(_count);
+	axes.resize(_count);
+
+	for (size_t i = 0; i < _count; ++i)
+		indices[i] = static_cast<uint32_t>(i);
+
+	unsigned int thread_depth = 0;
+	if (_multithreaded)
+	{
+		// Split the top levels until every hardware thread has a subtree.
+		while ((1u << thread_depth) < Math::GetThreadCount())
+			++thread_depth;
+	}
+
+	BuildRange(_points, indices.data(), axes.data(), 0, _count, 0, thread_depth);
+
+	points.resize(_count);
+	for (size_t i = 0; i < _count; ++i)
+		points[i] = _points[indices[i]];
+}
+
+void KDTree::Clear() noexcept
+{
+	points.clear();
+	indices.clear();
+	axes.clear();
+}
+
+//Accessors
+
+bool KDTree::IsEmpty() const noexcept
+{
+	return points.empty();
+}
+
+size_t KDTree::GetPointCount() const noexcept
+{
+	return points.size();
+}
+
+//Queries
+
+size_t KDTree::KNearest(const Vec3& _point, size_t _k, uint32_t* _indices, float* _sqr_distances) const noexcept
+{
+	size_t found = 0;
+
+	StackEntry stack[StackSize];
+	uint32_t stack_size = 0;
+	stack[stack_size++] = { 0, static_cast<uint32_t>(points.size()), 0.f };
+
+	while (stack_size > 0)
+	{
+		const StackEntry entry = stack[--stack_size];
+
+		if (entry.begin >= entry.end || (found == _k && entry.bound > _sqr_distances[0]))
+			continue;
+
+		const uint32_t median = (entry.begin + entry.end) / 2;
+		const Vec3& node = points[median];
+		const float sqr_distance = (node - _point).SquaredLength();
+
+		if (found < _k)
+			PushHeap(_indices, _sqr_distances, found++, indices[median], sqr_distance);
+		else if (sqr_distance < _sqr_distances[0])
+		{
+			_indices[0] = indices[median];
+			_sqr_distances[0] = sqr_distance;
+			SiftDown(_indices, _sqr_distances, found);
+		}
+
+		const unsigned int axis = axes[median];
+		const float difference = GetAxis(_point, axis) - GetAxis(node, axis);
+		const float far_bound = std::max(entry.bound, difference * difference);
+
+		// Push the far side first so the near side is visited first and tightens the heap.
+		if (difference < 0.f)
+		{
+			stack[stack_size++] = { median + 1, entry.end, far_bound };
+			stack[stack_size++] = { entry.begin, median, entry.bound };
+		}
+		else
+		{
+			stack[stack_size++] = { entry.begin, median, far_bound };
+			stack[stack_size++] = { median + 1, entry.end, entry.bound };
+		}
+	}
+
+	// Heap sort in place, leaving neighbors closest first.
+	for (size_t size = found; size > 1; --size)
+	{
+		std::swap(_indices[0], _indices[size - 1]);
+		std::swap(_sqr_distances[0], _sqr_distances[size - 1]);
+		SiftDown(_indices, _sqr_distances, size - 1);
+	}
+
+	return found;
+}
+
+size_t KDTree::QueryKNearest(const Vec3& _point, size_t _k, uint32_t* _results, float* _sqr_distances) const
+{
+	if (points.empty() || _k == 0)
+		return 0;
+
+	const size_t k = std::min(_k, points.size());
+
+	if (_sqr_distances)
+		return KNearest(_point, k, _results, _sqr_distances);
+
+	std::vector<float> sqr_distances(k);
+	return KNearest(_point, k, _results, sqr_distances.data());
+}
+
+size_t KDTree::QueryRadius(const Vec3& _center, float _radius, uint32_t* _results, size_t _capacity) const noexcept
+{
+	if (points.empty() || _radius < 0.f)
+		return 0;
+
+	const float sqr_radius = _radius * _radius;
+	size_t count = 0;
+
+	StackEntry stack[StackSize];
+	uint32_t stack_size = 0;
+	stack[stack_size++] = { 0, static_cast<uint32_t>(points.size()), 0.f };
+
+	while (stack_size > 0)
+	{
+		const StackEntry entry = stack[--stack_size];
+
+		if (entry.begin >= entry.end || entry.bound > sqr_radius)
+			continue;
+
+		const uint32_t median = (entry.begin + entry.end) / 2;
+		const Vec3& node = points[median];
+
+		if ((node - _center).SquaredLength() <= sqr_radius)
+		{
+			if (count < _capacity)
+				_results[count] = indices[median];
+			++count;
+		}
+
+		const unsigned int axis = axes[median];
+		const float difference = GetAxis(_center, axis) - GetAxis(node, axis);
+		const float far_bound = std::max(entry.bound, difference * difference);
+
+		if (difference < 0.f)
+		{
+			stack[stack_size++] = { median + 1, entry.end, far_bound };
+			stack[stack_size++] = { entry.begin, median, entry.bound };
+		}
+		else
+		{
+			stack[stack_size++] = { entry.begin, median, far_bound };
+			stack[stack_size++] = { median + 1, entry.end, entry.bound };
+		}
+	}
+
+	return count;
+}
+
+void KDTree::QueryKNearestBatch(const Vec3* _queries, size_t _query_count, size_t _k, uint32_t* _results, float* _sqr_distances,
+	bool _multithreaded) const
+{
+	if (_k == 0)
+		return;
+
+	const size_t k = std::min(_k, points.size());
+
+	auto process = [&](size_t _begin, size_t _end)
+	{
+		for (size_t query = _begin; query < _end; ++query)
+		{
+			uint32_t* results = _results + query * _k;
+			float* sqr_distances = _sqr_distances + query * _k;
+
+			size_t found = k > 0 ? KNearest(_queries[query], k, results, sqr_distances) : 0;
+
+			std::fill(results + found, results + _k, InvalidIndex);
+			std::fill(sqr_distances + found, sqr_distances + _k, std::numeric_limits<float>::max());
+		}
+	};
+
+	Math::ParallelFor(0, _query_count, ParallelQueryBatch, _multithreaded, process);
+}
+
+void KDTree::QueryRadiusBatch(const Vec3* _queries, size_t _query_count, float _radius, uint32_t* _results, size_t _capacity, size_t* _counts,
+	bool _multithreaded) const
+{
+	auto process = [&](size_t _begin, size_t _end)
+	{
+		for (size_t query = _begin; query < _end; ++query)
+			_counts[query] = QueryRadius(_queries[query], _radius, _results + query * _capacity, _capacity);
+	};
+
+	Math::ParallelFor(0, _query_count, ParallelQueryBatch, _multithreaded, process);
+}
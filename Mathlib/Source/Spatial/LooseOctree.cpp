@@ -0,0 +1,362 @@
+#include <algorithm>
+#include <cmath>
+
+#include <Spatial/LooseOctree.hpp>
+#include <Geometry/Frustum.hpp>
+#include <Geometry/Sphere.hpp>
+#include <Geometry/Ray.hpp>
+#include <Geometry/Intersection.hpp>
+#include <Misc/Callback.hpp>
+
+using namespace Mathlib;
+
+#define CLASS_NAME "LooseOctree"
+
+namespace
+{
+	/// Traversal stack size, enough for 7 pending siblings per level plus the last children.
+	constexpr uint32_t StackSize = 8 * (LooseOctree::MaxDepthLimit + 1);
+}
+
+//Constructors
+
+LooseOctree::LooseOctree() :
+	LooseOctree(AABB(Vec3(-512.f, -512.f, -512.f), Vec3(512.f, 512.f, 512.f)))
+{
+}
+
+LooseOctree::LooseOctree(const AABB& _world_bounds, uint32_t _max_depth) :
+	maxDepth{ std::min(_max_depth, MaxDepthLimit) }
+{
+	Node root;
+	std::fill(std::begin(root.children), std::end(root.children), InvalidHandle);
+
+	if (_world_bounds.IsValid())
+	{
+		Vec3 extents = _world_bounds.GetExtents();
+		root.center = _world_bounds.GetCenter();
+		root.halfSize = std::max(std::max(extents.X, extents.Y), extents.Z);
+	}
+	else
+		Callback::CallErrorCallback(CLASS_NAME, "LooseOctree", "Invalid world bounds.");
+
+	nodes.push_back(root);
+	nodeCount = 1;
+}
+
+//Private Methods
+
+uint32_t LooseOctree::FindNode(const AABB& _bounds)
+{
+	const Vec3 center = _bounds.GetCenter();
+	const Vec3 extents = _bounds.GetExtents();
+	const float extent = std::max(std::max(extents.X, extents.Y), extents.Z);
+
+	const Node& root = nodes[0];
+
+	if (std::abs(center.X - root.center.X) > root.halfSize ||
+		std::abs(center.Y - root.center.Y) > root.halfSize ||
+		std::abs(center.Z - root.center.Z) > root.halfSize)
+		return 0;
+
+	// Deepest level whose cell size still covers the object extents, loose bounds then contain it.
+	uint32_t depth = 0;
+	float half_size = root.halfSize;
+	while (depth < maxDepth && extent <= half_size * 0.5f)
+	{
+		half_size *= 0.5f;
+		++depth;
+	}
+
+	uint32_t node = 0;
+	for (uint32_t level = 0; level < depth; ++level)
+	{
+		const Vec3 node_center = nodes[node].center;
+		const float child_half_size = nodes[node].halfSize * 0.5f;
+
+		uint32_t slot = (center.X >= node_center.X ? 1u : 0u) | (center.Y >= node_center.Y ? 2u : 0u) | (center.Z >= node_center.Z ? 4u : 0u);
+		uint32_t child = nodes[node].children[slot];
+
+		if (child == InvalidHandle)
+		{
+			if (freeNode != InvalidHandle)
+			{
+				child = freeNode;
+				freeNode = nodes[child].parent;
+			}
+			else
+			{
+				child = static_cast<uint32_t>(nodes.size());
+				nodes.emplace_back();
+			}
+
+			Node& child_node = nodes[child];
+			child_node.center = node_center + Vec3(slot & 1u ? child_half_size : -child_half_size,
+				slot & 2u ? child_half_size : -child_half_size,
+				slot & 4u ? child_half_size : -child_half_size);
+			child_node.halfSize = child_half_size;
+			child_node.parent = node;
+			child_node.firstObject = InvalidHandle;
+			child_node.objectCount = 0;
+			child_node.childCount = 0;
+			child_node.childSlot = slot;
+			std::fill(std::begin(child_node.children), std::end(child_node.children), InvalidHandle);
+
+			nodes[node].children[slot] = child;
+			++nodes[node].childCount;
+			++nodeCount;
+		}
+
+		node = child;
+	}
+
+	return node;
+}
+
+AABB LooseOctree::GetLooseBounds(const Node& _node) const noexcept
+{
+	float loose_size = _node.halfSize * 2.f;
+	return AABB::FromCenterExtents(_node.center, Vec3(loose_size, loose_size, loose_size));
+}
+
+void LooseOctree::Link(uint32_t _handle, uint32_t _node) noexcept
+{
+	Object& object = objects[_handle];
+	Node& node = nodes[_node];
+
+	object.node = _node;
+	object.previous = InvalidHandle;
+	object.next = node.firstObject;
+
+	if (node.firstObject != InvalidHandle)
+		objects[node.firstObject].previous = _handle;
+
+	node.firstObject = _handle;
+	++node.objectCount;
+}
+
+void LooseOctree::Unlink(uint32_t _handle) noexcept
+{
+	Object& object = objects[_handle];
+	uint32_t node = object.node;
+
+	if (object.previous != InvalidHandle)
+		objects[object.previous].next = object.next;
+	else
+		nodes[node].firstObject = object.next;
+
+	if (object.next != InvalidHandle)
+		objects[object.next].previous = object.previous;
+
+	--nodes[node].objectCount;
+
+	object.node = InvalidHandle;
+	object.previous = InvalidHandle;
+	object.next = InvalidHandle;
+}
+
+void LooseOctree::ReleaseEmptyNodes(uint32_t _node) noexcept
+{
+	uint32_t node = _node;
+
+	// Release emptied nodes up to the first one still in use, the root is never released.
+	while (node != 0 && nodes[node].objectCount == 0 && nodes[node].childCount == 0)
+	{
+		uint32_t parent = nodes[node].parent;
+
+		nodes[parent].children[nodes[node].childSlot] = InvalidHandle;
+		--nodes[parent].childCount;
+
+		nodes[node].parent = freeNode;
+		freeNode = node;
+		--nodeCount;
+
+		node = parent;
+	}
+}
+
+bool LooseOctree::IsValidHandle(uint32_t _handle) const noexcept
+{
+	return _handle < objects.size() && objects[_handle].node != InvalidHandle;
+}
+
+template<typename NodeTest, typename ObjectTest>
+size_t LooseOctree::Query(const NodeTest& _node_test, const ObjectTest& _object_test, uint32_t* _results, size_t _capacity) const noexcept
+{
+	size_t count = 0;
+
+	uint32_t stack[StackSize];
+	uint32_t stack_size = 0;
+	stack[stack_size++] = 0;
+
+	while (stack_size > 0)
+	{
+		const uint32_t node_index = stack[--stack_size];
+		const Node& node = nodes[node_index];
+
+		// The root also holds objects centered outside the world, always visit it.
+		if (node_index != 0 && !_node_test(GetLooseBounds(node)))
+			continue;
+
+		for (uint32_t handle = node.firstObject; handle != InvalidHandle; handle = objects[handle].next)
+		{
+			if (_object_test(objects[handle].bounds))
+			{
+				if (count < _capacity)
+					_results[count] = handle;
+				++count;
+			}
+		}
+
+		if (node.childCount == 0)
+			continue;
+
+		for (uint32_t child : node.children)
+		{
+			if (child != InvalidHandle)
+				stack[stack_size++] = child;
+		}
+	}
+
+	return count;
+}
+
+//Objects
+
+uint32_t LooseOctree::Insert(const AABB& _bounds)
+{
+	uint32_t handle;
+
+	if (freeObject != InvalidHandle)
+	{
+		handle = freeObject;
+		freeObject = objects[handle].next;
+	}
+	else
+	{
+		handle = static_cast<uint32_t>(objects.size());
+		objects.emplace_back();
+	}
+
+	objects[handle].bounds = _bounds;
+	Link(handle, FindNode(_bounds));
+	++objectCount;
+
+	return handle;
+}
+
+void LooseOctree::Move(uint32_t _handle, const AABB& _bounds)
+{
+	if (!IsValidHandle(_handle))
+	{
+		Callback::CallErrorCallback(CLASS_NAME, "Move", "Invalid object handle.");
+		return;
+	}
+
+	objects[_handle].bounds = _bounds;
+
+	uint32_t node = FindNode(_bounds);
+
+	if (node == objects[_handle].node)
+		return;
+
+	// Release after linking, the new node can be an ancestor left empty by the unlink.
+	uint32_t previous_node = objects[_handle].node;
+	Unlink(_handle);
+	Link(_handle, node);
+	ReleaseEmptyNodes(previous_node);
+}
+
+void LooseOctree::Remove(uint32_t _handle) noexcept
+{
+	if (!IsValidHandle(_handle))
+	{
+		Callback::CallErrorCallback(CLASS_NAME, "Remove", "Invalid object handle.");
+		return;
+	}
+
+	uint32_t node = objects[_handle].node;
+	Unlink(_handle);
+	ReleaseEmptyNodes(node);
+
+	objects[_handle].next = freeObject;
+	freeObject = _handle;
+	--objectCount;
+}
+
+void LooseOctree::Clear() noexcept
+{
+	Node root = nodes[0];
+	root.firstObject = InvalidHandle;
+	root.objectCount = 0;
+	root.childCount = 0;
+	std::fill(std::begin(root.children), std::end(root.children), InvalidHandle);
+
+	nodes.clear();
+	nodes.push_back(root);
+	objects.clear();
+
+	freeNode = InvalidHandle;
+	freeObject = InvalidHandle;
+	objectCount = 0;
+	nodeCount = 1;
+}
+
+//Accessors
+
+const AABB& LooseOctree::GetBounds(uint32_t _handle) const noexcept
+{
+	if (!IsValidHandle(_handle))
+	{
+		Callback::CallErrorCallback(CLASS_NAME, "GetBounds", "Invalid object handle.");
+		return AABB::Empty;
+	}
+
+	return objects[_handle].bounds;
+}
+
+AABB LooseOctree::GetWorldBounds() const noexcept
+{
+	const Node& root = nodes[0];
+	return AABB::FromCenterExtents(root.center, Vec3(root.halfSize, root.halfSize, root.halfSize));
+}
+
+size_t LooseOctree::GetObjectCount() const noexcept
+{
+	return objectCount;
+}
+
+size_t LooseOctree::GetNodeCount() const noexcept
+{
+	return nodeCount;
+}
+
+//Queries
+
+size_t LooseOctree::QueryAABB(const AABB& _aabb, uint32_t* _results, size_t _capacity) const noexcept
+{
+	auto test = [&_aabb](const AABB& _bounds) { return _aabb.Intersects(_bounds); };
+	return Query(test, test, _results, _capacity);
+}
+
+size_t LooseOctree::QuerySphere(const Sphere& _sphere, uint32_t* _results, size_t _capacity) const noexcept
+{
+	auto test = [&_sphere](const AABB& _bounds) { return _sphere.Intersects(_bounds); };
+	return Query(test, test, _results, _capacity);
+}
+
+size_t LooseOctree::QueryFrustum(const Frustum& _frustum, uint32_t* _results, size_t _capacity) const noexcept
+{
+	auto test = [&_frustum](const AABB& _bounds) { return _frustum.Intersects(_bounds); };
+	return Query(test, test, _results, _capacity);
+}
+
+size_t LooseOctree::QueryRay(const Ray& _ray, float _max_distance, uint32_t* _results, size_t _capacity) const noexcept
+{
+	auto test = [&_ray, _max_distance](const AABB& _bounds)
+	{
+		float distance = 0.f;
+		return Intersection::RayAABB(_ray, _bounds, distance) && distance <= _max_distance;
+	};
+	return Query(test, test, _results, _capacity);
+}
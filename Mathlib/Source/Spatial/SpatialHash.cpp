@@ -0,0 +1,431 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+#include <Spatial/SpatialHash.hpp>
+#include <Misc/Parallel.hpp>
+#include <Misc/Callback.hpp>
+
+using namespace Mathlib;
+
+#define CLASS_NAME "SpatialHash"
+
+namespace
+{
+	/// Minimum number of points processed by one build chunk.
+	constexpr size_t ParallelBuildBatch = 8192;
+
+	/// Minimum number of buckets of a non empty grid.
+	constexpr uint32_t MinBucketCount = 64;
+
+	/**
+	*	\brief Return the cell coordinate of a position on one axis, clamped to the int32_t range.
+	*/
+	inline int32_t GetCell(float _position, float _inverse_cell_size) noexcept
+	{
+		const float cell = std::floor(_position * _inverse_cell_size);
+
+		// 2^31 is the first float above the int32_t range, NaN goes to the lowest cell.
+		if (cell >= 2147483648.f)
+			return std::numeric_limits<int32_t>::max();
+		if (!(cell >= -2147483648.f))
+			return std::numeric_limits<int32_t>::min();
+
+		return static_cast<int32_t>(cell);
+	}
+
+	/**
+	*	\brief Return the smallest power of two greater or equal to _value.
+	*/
+	inline uint32_t NextPowerOfTwo(size_t _value) noexcept
+	{
+		uint32_t result = 1u;
+		while (result < _value && result < (1u << 31))
+			result <<= 1;
+		return result;
+	}
+}
+
+//Constructors
+
+SpatialHash::SpatialHash(float _cell_size) noexcept
+{
+	SetCellSize(_cell_size);
+}
+
+uint32_t SpatialHash::GetBucket(int32_t _x, int32_t _y, int32_t _z) const noexcept
+{
+	uint32_t hash = (static_cast<uint32_t>(_x) * 73856093u) ^ (static_cast<uint32_t>(_y) * 19349663u) ^ (static_cast<uint32_t>(_z) * 83492791u);
+	return hash & bucketMask;
+}
+
+//Build
+
+void SpatialHash::Build(const Vec3* _points, size_t _count, bool _multithreaded)
+{
+	Clear();
+
+	if (_count == 0)
+		return;
+
+	if (_count > std::numeric_limits<uint32_t>::max())
+	{
+		Callback::CallErrorCallback(CLASS_NAME, "Build", "Point count exceeds 32 bits indices.");
+		return;
+	}
+
+	const uint32_t bucket_count = std::max(MinBucketCount, NextPowerOfTwo(_count * 2));
+	bucketMask = bucket_count - 1;
+
+	const size_t chunk_count = _multithreaded ? Math::GetChunkCount(_count, ParallelBuildBatch) : 1;
+	const size_t chunk_size = (_count + chunk_count - 1) / chunk_count;
+
+	std::vector<uint32_t> point_buckets(_count);
+	std::vector<uint32_t> histograms(chunk_count * bucket_count, 0u);
+	std::vector<int32_t> chunk_bounds(chunk_count * 6);
+
+	// Hash every point and count each chunk's bucket sizes.
+	Math::ParallelFor(0, chunk_count, 1, [&](size_t _first_chunk, size_t _last_chunk)
+	{
+		for (size_t chunk = _first_chunk; chunk < _last_chunk; ++chunk)
+		{
+			const size_t begin = chunk * chunk_size;
+			const size_t end = std::min(begin + chunk_size, _count);
+
+			uint32_t* histogram = &histograms[chunk * bucket_count];
+			int32_t* bounds = &chunk_bounds[chunk * 6];
+
+			bounds[0] = bounds[1] = bounds[2] = std::numeric_limits<int32_t>::max();
+			bounds[3] = bounds[4] = bounds[5] = std::numeric_limits<int32_t>::min();
+
+			for (size_t i = begin; i < end; ++i)
+			{
+				int32_t x = GetCell(_points[i].X, inverseCellSize);
+				int32_t y = GetCell(_points[i].Y, inverseCellSize);
+				int32_t z = GetCell(_points[i].Z, inverseCellSize);
+
+				bounds[0] = std::min(bounds[0], x);
+				bounds[1] = std::min(bounds[1], y);
+				bounds[2] = std::min(bounds[2], z);
+				bounds[3] = std::max(bounds[3], x);
+				bounds[4] = std::max(bounds[4], y);
+				bounds[5] = std::max(bounds[5], z);
+
+				uint32_t bucket = GetBucket(x, y, z);
+				point_buckets[i] = bucket;
+				++histogram[bucket];
+			}
+		}
+	});
+
+	for (unsigned int axis = 0; axis < 3; ++axis)
+	{
+		minCell[axis] = std::numeric_limits<int32_t>::max();
+		maxCell[axis] = std::numeric_limits<int32_t>::min();
+
+		for (size_t chunk = 0; chunk < chunk_count; ++chunk)
+		{
+			minCell[axis] = std::min(minCell[axis], chunk_bounds[chunk * 6 + axis]);
+			maxCell[axis] = std::max(maxCell[axis], chunk_bounds[chunk * 6 + 3 + axis]);
+		}
+	}
+
+	// Exclusive prefix sum, bucket major so each chunk writes after the previous chunks of the same bucket.
+	bucketStart.resize(bucket_count + 1);
+
+	uint32_t offset = 0;
+	for (uint32_t bucket = 0; bucket < bucket_count; ++bucket)
+	{
+		bucketStart[bucket] = offset;
+
+		for (size_t chunk = 0; chunk < chunk_count; ++chunk)
+		{
+			uint32_t& entry = histograms[chunk * bucket_count + bucket];
+			uint32_t size = entry;
+			entry = offset;
+			offset += size;
+		}
+	}
+	bucketStart[bucket_count] = offset;
+
+	// Stable scatter, each chunk owns disjoint output ranges.
+	sortedIndices.resize(_count);
+	sortedPoints.resize(_count);
+
+	Math::ParallelFor(0, chunk_count, 1, [&](size_t _first_chunk, size_t _last_chunk)
+	{
+		for (size_t chunk = _first_chunk; chunk < _last_chunk; ++chunk)
+		{
+			const size_t begin = chunk * chunk_size;
+			const size_t end = std::min(begin + chunk_size, _count);
+
+			uint32_t* offsets = &histograms[chunk * bucket_count];
+
+			for (size_t i = begin; i < end; ++i)
+			{
+				uint32_t destination = offsets[point_buckets[i]]++;
+				sortedIndices[destination] = static_cast<uint32_t>(i);
+				sortedPoints[destination] = _points[i];
+			}
+		}
+	});
+}
+
+void SpatialHash::Clear() noexcept
+{
+	bucketMask = 0;
+	bucketStart.clear();
+	sortedIndices.clear();
+	sortedPoints.clear();
+
+	for (unsigned int axis = 0; axis < 3; ++axis)
+	{
+		minCell[axis] = 0;
+		maxCell[axis] = 0;
+	}
+}
+
+//Accessors
+
+float SpatialHash::GetCellSize() const noexcept
+{
+	return cellSize;
+}
+
+void SpatialHash::SetCellSize(float _cell_size) noexcept
+{
+	if (!(_cell_size > 0.f))
+	{
+		Callback::CallErrorCallback(CLASS_NAME, "SetCellSize", "Cell size must be strictly positive.");
+		return;
+	}
+
+	cellSize = _cell_size;
+	inverseCellSize = 1.f / _cell_size;
+}
+
+size_t SpatialHash::GetPointCount() const noexcept
+{
+	return sortedIndices.size();
+}
+
+//Queries
+
+size_t SpatialHash::QueryRadius(const Vec3& _center, float _radius, uint32_t* _results, size_t _capacity) const noexcept
+{
+	if (sortedIndices.empty() || _radius < 0.f)
+		return 0;
+
+	const float sqr_radius = _radius * _radius;
+	size_t count = 0;
+
+	int32_t min_x = std::max(GetCell(_center.X - _radius, inverseCellSize), minCell[0]);
+	int32_t min_y = std::max(GetCell(_center.Y - _radius, inverseCellSize), minCell[1]);
+	int32_t min_z = std::max(GetCell(_center.Z - _radius, inverseCellSize), minCell[2]);
+	int32_t max_x = std::min(GetCell(_center.X + _radius, inverseCellSize), maxCell[0]);
+	int32_t max_y = std::min(GetCell(_center.Y + _radius, inverseCellSize), maxCell[1]);
+	int32_t max_z = std::min(GetCell(_center.Z + _radius, inverseCellSize), maxCell[2]);
+
+	if (min_x > max_x || min_y > max_y || min_z > max_z)
+		return 0;
+
+	double cell_count = double(max_x - min_x + 1) * double(max_y - min_y + 1) * double(max_z - min_z + 1);
+
+	// Covering more cells than there are points: a linear scan is cheaper than visiting cells.
+	if (cell_count >= double(sortedIndices.size()))
+	{
+		for (size_t i = 0; i < sortedPoints.size(); ++i)
+		{
+			if ((sortedPoints[i] - _center).SquaredLength() <= sqr_radius)
+			{
+				if (count < _capacity)
+					_results[count] = sortedIndices[i];
+				++count;
+			}
+		}
+
+		return count;
+	}
+
+	for (int32_t z = min_z; z <= max_z; ++z)
+	{
+		for (int32_t y = min_y; y <= max_y; ++y)
+		{
+			for (int32_t x = min_x; x <= max_x; ++x)
+			{
+				uint32_t bucket = GetBucket(x, y, z);
+
+				for (uint32_t i = bucketStart[bucket]; i < bucketStart[bucket + 1]; ++i)
+				{
+					const Vec3& point = sortedPoints[i];
+
+					if ((point - _center).SquaredLength() > sqr_radius)
+						continue;
+
+					// Skip points of other cells sharing this bucket, they are reported by their own cell.
+					if (GetCell(point.X, inverseCellSize) != x || GetCell(point.Y, inverseCellSize) != y || GetCell(point.Z, inverseCellSize) != z)
+						continue;
+
+					if (count < _capacity)
+						_results[count] = sortedIndices[i];
+					++count;
+				}
+			}
+		}
+	}
+
+	return count;
+}
+
+size_t SpatialHash::QueryKNearest(const Vec3& _point, size_t _k, uint32_t* _results, float* _sqr_distances) const
+{
+	if (sortedIndices.empty() || _k == 0)
+		return 0;
+
+	const size_t k = std::min(_k, sortedIndices.size());
+
+	const int32_t cell[3] = { GetCell(_point.X, inverseCellSize), GetCell(_point.Y, inverseCellSize), GetCell(_point.Z, inverseCellSize) };
+	const float position[3] = { _point.X, _point.Y, _point.Z };
+
+	// Max heap on squared distance holding the k best candidates.
+	std::vector<std::pair<float, uint32_t>> heap;
+	heap.reserve(k + 1);
+
+	auto push = [&](float _sqr_distance, uint32_t _index)
+	{
+		heap.emplace_back(_sqr_distance, _index);
+		std::push_heap(heap.begin(), heap.end());
+
+		if (heap.size() > k)
+		{
+			std::pop_heap(heap.begin(), heap.end());
+			heap.pop_back();
+		}
+	};
+
+	auto visit_cell = [&](int32_t _x, int32_t _y, int32_t _z)
+	{
+		uint32_t bucket = GetBucket(_x, _y, _z);
+
+		for (uint32_t i = bucketStart[bucket]; i < bucketStart[bucket + 1]; ++i)
+		{
+			const Vec3& point = sortedPoints[i];
+			float sqr_distance = (point - _point).SquaredLength();
+
+			if (heap.size() == k && sqr_distance >= heap.front().first)
+				continue;
+
+			if (GetCell(point.X, inverseCellSize) != _x || GetCell(point.Y, inverseCellSize) != _y || GetCell(point.Z, inverseCellSize) != _z)
+				continue;
+
+			push(sqr_distance, sortedIndices[i]);
+		}
+	};
+
+	// Number of cells of the cube of Chebyshev radius _ring around the query cell, within the grid bounds.
+	auto cube_cell_count = [&](int64_t _ring)
+	{
+		double count = 1.0;
+		for (unsigned int axis = 0; axis < 3; ++axis)
+		{
+			int64_t low = std::max<int64_t>(int64_t(cell[axis]) - _ring, minCell[axis]);
+			int64_t high = std::min<int64_t>(int64_t(cell[axis]) + _ring, maxCell[axis]);
+			count *= double(std::max<int64_t>(high - low + 1, 0));
+		}
+		return count;
+	};
+
+	// Rings closer than the grid bounds hold no point, start at the first one touching them.
+	int64_t ring = 0;
+	int64_t last_ring = 0;
+	for (unsigned int axis = 0; axis < 3; ++axis)
+	{
+		ring = std::max<int64_t>(ring, std::max<int64_t>(int64_t(minCell[axis]) - cell[axis], int64_t(cell[axis]) - maxCell[axis]));
+		last_ring = std::max<int64_t>(last_ring, std::max<int64_t>(int64_t(cell[axis]) - minCell[axis], int64_t(maxCell[axis]) - cell[axis]));
+	}
+
+	double visited_cells = 0.0;
+
+	for (; ring <= last_ring; ++ring)
+	{
+		// Visiting more cells than there are points: finish with a linear scan, cheaper on sparse grids.
+		const double ring_cells = cube_cell_count(ring) - (ring > 0 ? cube_cell_count(ring - 1) : 0.0);
+		visited_cells += ring_cells;
+
+		if (visited_cells > double(sortedIndices.size()))
+		{
+			heap.clear();
+
+			for (size_t i = 0; i < sortedPoints.size(); ++i)
+			{
+				float sqr_distance = (sortedPoints[i] - _point).SquaredLength();
+
+				if (heap.size() < k || sqr_distance < heap.front().first)
+					push(sqr_distance, sortedIndices[i]);
+			}
+
+			break;
+		}
+
+		int64_t low[3];
+		int64_t high[3];
+		for (unsigned int axis = 0; axis < 3; ++axis)
+		{
+			low[axis] = std::max<int64_t>(cell[axis] - ring, minCell[axis]);
+			high[axis] = std::min<int64_t>(cell[axis] + ring, maxCell[axis]);
+		}
+
+		// Visit cells at Chebyshev distance ring from the query cell, within the grid bounds.
+		for (int64_t x = low[0]; x <= high[0]; ++x)
+		{
+			bool x_border = (x == cell[0] - ring || x == cell[0] + ring);
+
+			for (int64_t y = low[1]; y <= high[1]; ++y)
+			{
+				bool y_border = x_border || (y == cell[1] - ring || y == cell[1] + ring);
+
+				if (y_border)
+				{
+					for (int64_t z = low[2]; z <= high[2]; ++z)
+						visit_cell(int32_t(x), int32_t(y), int32_t(z));
+				}
+				else
+				{
+					if (cell[2] - ring >= low[2] && cell[2] - ring <= high[2])
+						visit_cell(int32_t(x), int32_t(y), int32_t(cell[2] - ring));
+					if (ring != 0 && cell[2] + ring >= low[2] && cell[2] + ring <= high[2])
+						visit_cell(int32_t(x), int32_t(y), int32_t(cell[2] + ring));
+				}
+			}
+		}
+
+		if (heap.size() == k)
+		{
+			// Any point left lies outside the visited cube of cells.
+			float bound = std::numeric_limits<float>::max();
+			for (unsigned int axis = 0; axis < 3; ++axis)
+			{
+				float lower_face = float(cell[axis] - ring) * cellSize;
+				float upper_face = float(cell[axis] + ring + 1) * cellSize;
+				bound = std::min(bound, std::min(position[axis] - lower_face, upper_face - position[axis]));
+			}
+
+			bound = std::max(bound, 0.f);
+			if (heap.front().first <= bound * bound)
+				break;
+		}
+	}
+
+	std::sort_heap(heap.begin(), heap.end());
+
+	for (size_t i = 0; i < heap.size(); ++i)
+	{
+		_results[i] = heap[i].second;
+
+		if (_sqr_distances)
+			_sqr_distances[i] = heap[i].first;
+	}
+
+	return heap.size();
+}
@@ -0,0 +1,230 @@
+#include <algorithm>
+
+#include <Spatial/SweepAndPrune.hpp>
+#include <Misc/Callback.hpp>
+
+using namespace Mathlib;
+
+#define CLASS_NAME "SweepAndPrune"
+
+namespace
+{
+	/**
+	*	\brief Order endpoints by value, min bounds first on ties so touching boxes overlap.
+	*/
+	template<typename Endpoint>
+	inline bool IsLess(const Endpoint& _lhs, const Endpoint& _rhs) noexcept
+	{
+		return _lhs.value < _rhs.value || (_lhs.value == _rhs.value && (_lhs.data & 1u) < (_rhs.data & 1u));
+	}
+}
+
+bool SweepAndPrune::IsValidHandle(uint32_t _handle) const noexcept
+{
+	return _handle < alive.size() && alive[_handle];
+}
+
+//Proxies
+
+uint32_t SweepAndPrune::Insert(const AABB& _bounds)
+{
+	uint32_t handle;
+
+	if (!freeHandles.empty())
+	{
+		handle = freeHandles.back();
+		freeHandles.pop_back();
+		bounds[handle] = _bounds;
+		alive[handle] = 1;
+	}
+	else
+	{
+		handle = static_cast<uint32_t>(bounds.size());
+		bounds.push_back(_bounds);
+		alive.push_back(1);
+		activeSlots.push_back(0);
+	}
+
+	endpoints.push_back({ _bounds.min.X, handle << 1 });
+	endpoints.push_back({ _bounds.max.X, (handle << 1) | 1u });
+
+	++insertedCount;
+	++proxyCount;
+
+	return handle;
+}
+
+void SweepAndPrune::SetBounds(uint32_t _handle, const AABB& _bounds) noexcept
+{
+	if (!IsValidHandle(_handle))
+	{
+		Callback::CallErrorCallback(CLASS_NAME, "SetBounds", "Invalid proxy handle.");
+		return;
+	}
+
+	bounds[_handle] = _bounds;
+}
+
+void SweepAndPrune::Remove(uint32_t _handle) noexcept
+{
+	if (!IsValidHandle(_handle))
+	{
+		Callback::CallErrorCallback(CLASS_NAME, "Remove", "Invalid proxy handle.");
+		return;
+	}
+
+	// The handle is only recycled once its endpoints left the sorted array.
+	alive[_handle] = 0;
+	removedHandles.push_back(_handle);
+	--proxyCount;
+}
+
+void SweepAndPrune::Clear() noexcept
+{
+	endpoints.clear();
+	bounds.clear();
+	alive.clear();
+	freeHandles.clear();
+	removedHandles.clear();
+	pairs.clear();
+	activeSlots.clear();
+	insertedCount = 0;
+	proxyCount = 0;
+}
+
+void SweepAndPrune::Update()
+{
+	// Drop endpoints of removed proxies, keeping the others sorted.
+	if (!removedHandles.empty())
+	{
+		endpoints.erase(std::remove_if(endpoints.begin(), endpoints.end(),
+			[this](const Endpoint& _endpoint) { return !alive[_endpoint.data >> 1]; }), endpoints.end());
+
+		freeHandles.insert(freeHandles.end(), removedHandles.begin(), removedHandles.end());
+		removedHandles.clear();
+	}
+
+	for (Endpoint& endpoint : endpoints)
+	{
+		const AABB& box = bounds[endpoint.data >> 1];
+		endpoint.value = (endpoint.data & 1u) ? box.max.X : box.min.X;
+	}
+
+	if (insertedCount * 8 > proxyCount)
+	{
+		// Many unsorted new endpoints, a full sort beats insertion sort.
+		std::sort(endpoints.begin(), endpoints.end(), IsLess<Endpoint>);
+	}
+	else
+	{
+		// Endpoints barely moved since the last update, insertion sort runs in near linear time.
+		for (size_t i = 1; i < endpoints.size(); ++i)
+		{
+			Endpoint endpoint = endpoints[i];
+			size_t j = i;
+
+			while (j > 0 && IsLess(endpoint, endpoints[j - 1]))
+			{
+				endpoints[j] = endpoints[j - 1];
+				--j;
+			}
+
+			endpoints[j] = endpoint;
+		}
+	}
+
+	insertedCount = 0;
+
+	pairs.clear();
+	activeHandles.clear();
+	activeMinY.clear();
+	activeMaxY.clear();
+	activeMinZ.clear();
+	activeMaxZ.clear();
+
+	for (const Endpoint& endpoint : endpoints)
+	{
+		const uint32_t handle = endpoint.data >> 1;
+		const AABB& box = bounds[handle];
+
+		// Invalid boxes, such as AABB::Empty, may sort their max before their min: they never enter the active set.
+		if (!box.IsValid())
+			continue;
+
+		if (endpoint.data & 1u)
+		{
+			// Swap remove from the active set.
+			uint32_t slot = activeSlots[handle];
+			uint32_t last = static_cast<uint32_t>(activeHandles.size() - 1);
+
+			activeHandles[slot] = activeHandles[last];
+			activeMinY[slot] = activeMinY[last];
+			activeMaxY[slot] = activeMaxY[last];
+			activeMinZ[slot] = activeMinZ[last];
+			activeMaxZ[slot] = activeMaxZ[last];
+			activeSlots[activeHandles[slot]] = slot;
+
+			activeHandles.pop_back();
+			activeMinY.pop_back();
+			activeMaxY.pop_back();
+			activeMinZ.pop_back();
+			activeMaxZ.pop_back();
+			continue;
+		}
+
+		const float min_y = box.min.Y;
+		const float max_y = box.max.Y;
+		const float min_z = box.min.Z;
+		const float max_z = box.max.Z;
+
+		// Every active box overlaps on X, filter on Y and Z with a branch free compaction.
+		const size_t active_count = activeHandles.size();
+		candidates.resize(active_count);
+
+		size_t candidate_count = 0;
+		for (size_t slot = 0; slot < active_count; ++slot)
+		{
+			uint32_t overlap = uint32_t(activeMinY[slot] <= max_y) & uint32_t(activeMaxY[slot] >= min_y) &
+				uint32_t(activeMinZ[slot] <= max_z) & uint32_t(activeMaxZ[slot] >= min_z);
+
+			candidates[candidate_count] = static_cast<uint32_t>(slot);
+			candidate_count += overlap;
+		}
+
+		for (size_t i = 0; i < candidate_count; ++i)
+		{
+			uint32_t other = activeHandles[candidates[i]];
+			pairs.push_back({ std::min(handle, other), std::max(handle, other) });
+		}
+
+		activeSlots[handle] = static_cast<uint32_t>(active_count);
+		activeHandles.push_back(handle);
+		activeMinY.push_back(min_y);
+		activeMaxY.push_back(max_y);
+		activeMinZ.push_back(min_z);
+		activeMaxZ.push_back(max_z);
+	}
+}
+
+//Accessors
+
+const AABB& SweepAndPrune::GetBounds(uint32_t _handle) const noexcept
+{
+	if (!IsValidHandle(_handle))
+	{
+		Callback::CallErrorCallback(CLASS_NAME, "GetBounds", "Invalid proxy handle.");
+		return AABB::Empty;
+	}
+
+	return bounds[_handle];
+}
+
+size_t SweepAndPrune::GetProxyCount() const noexcept
+{
+	return proxyCount;
+}
+
+const std::vector<BroadphasePair>& SweepAndPrune::GetPairs() const noexcept
+{
+	return pairs;
+}
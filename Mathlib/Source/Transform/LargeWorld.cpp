@@ -0,0 +1,173 @@
+#include <cmath>
+
+#include <Transform/LargeWorld.hpp>
+#include <Misc/Parallel.hpp>
+
+namespace Mathlib
+{
+	namespace LargeWorld
+	{
+		namespace
+		{
+			/// Minimum number of elements converted by one thread.
+			constexpr size_t MinBatch = 4096;
+
+			/**
+			*	\brief Write the rotation and scale part of a transform matrix, translation is set by the caller.
+			*/
+			inline void WriteRotationScale(const Quat& _rotation, const Vec3& _scale, Mat4& _result) noexcept
+			{
+				const float x = _rotation.X, y = _rotation.Y, z = _rotation.Z, w = _rotation.W;
+
+				_result.e00 = (1.f - 2.f * y * y - 2.f * z * z) * _scale.X;
+				_result.e01 = (2.f * x * y - 2.f * z * w) * _scale.Y;
+				_result.e02 = (2.f * x * z + 2.f * y * w) * _scale.Z;
+
+				_result.e10 = (2.f * x * y + 2.f * z * w) * _scale.X;
+				_result.e11 = (1.f - 2.f * x * x - 2.f * z * z) * _scale.Y;
+				_result.e12 = (2.f * y * z - 2.f * x * w) * _scale.Z;
+
+				_result.e20 = (2.f * x * z - 2.f * y * w) * _scale.X;
+				_result.e21 = (2.f * y * z + 2.f * x * w) * _scale.Y;
+				_result.e22 = (1.f - 2.f * x * x - 2.f * y * y) * _scale.Z;
+
+				_result.e30 = 0.f;
+				_result.e31 = 0.f;
+				_result.e32 = 0.f;
+				_result.e33 = 1.f;
+			}
+		}
+
+		void ToCameraRelative(const Vec3d* _positions, size_t _count, const Vec3d& _camera, Vec3* _results, bool _multithreaded)
+		{
+			const double cx = _camera.X, cy = _camera.Y, cz = _camera.Z;
+
+			Math::ParallelFor(0, _count, MinBatch, _multithreaded, [_positions, _results, cx, cy, cz](size_t _begin, size_t _end)
+			{
+				for (size_t i = _begin; i < _end; ++i)
+				{
+					_results[i].X = static_cast<float>(_positions[i].X - cx);
+					_results[i].Y = static_cast<float>(_positions[i].Y - cy);
+					_results[i].Z = static_cast<float>(_positions[i].Z - cz);
+				}
+			});
+		}
+
+		void ToCameraRelative(const Transformd* _transforms, size_t _count, const Vec3d& _camera, Mat4* _results, bool _multithreaded)
+		{
+			const double cx = _camera.X, cy = _camera.Y, cz = _camera.Z;
+
+			Math::ParallelFor(0, _count, MinBatch, _multithreaded, [_transforms, _results, cx, cy, cz](size_t _begin, size_t _end)
+			{
+				for (size_t i = _begin; i < _end; ++i)
+				{
+					const Transformd& transform = _transforms[i];
+					Mat4& result = _results[i];
+
+					WriteRotationScale(transform.rotation, transform.scale, result);
+
+					result.e03 = static_cast<float>(transform.position.X - cx);
+					result.e13 = static_cast<float>(transform.position.Y - cy);
+					result.e23 = static_cast<float>(transform.position.Z - cz);
+				}
+			});
+		}
+
+		void ToCameraRelative(const Mat4d* _matrices, size_t _count, const Vec3d& _camera, Mat4* _results, bool _multithreaded)
+		{
+			const double cx = _camera.X, cy = _camera.Y, cz = _camera.Z;
+
+			Math::ParallelFor(0, _count, MinBatch, _multithreaded, [_matrices, _results, cx, cy, cz](size_t _begin, size_t _end)
+			{
+				for (size_t i = _begin; i < _end; ++i)
+				{
+					const double* matrix = _matrices[i].Data();
+
+					// Remove the camera from the translation before narrowing to float.
+					double relative[16];
+					for (unsigned int j = 0; j < 16; ++j)
+						relative[j] = matrix[j];
+
+					relative[3] -= cx * matrix[15];
+					relative[7] -= cy * matrix[15];
+					relative[11] -= cz * matrix[15];
+
+					float* result = const_cast<float*>(_results[i].Data());
+					for (unsigned int j = 0; j < 16; ++j)
+						result[j] = static_cast<float>(relative[j]);
+				}
+			});
+		}
+
+		void Rebase(Vec3d* _positions, size_t _count, const Vec3d& _shift, bool _multithreaded)
+		{
+			const double sx = _shift.X, sy = _shift.Y, sz = _shift.Z;
+
+			Math::ParallelFor(0, _count, MinBatch, _multithreaded, [_positions, sx, sy, sz](size_t _begin, size_t _end)
+			{
+				for (size_t i = _begin; i < _end; ++i)
+				{
+					_positions[i].X -= sx;
+					_positions[i].Y -= sy;
+					_positions[i].Z -= sz;
+				}
+			});
+		}
+
+		void Rebase(Transformd* _transforms, size_t _count, const Vec3d& _shift, bool _multithreaded)
+		{
+			const double sx = _shift.X, sy = _shift.Y, sz = _shift.Z;
+
+			Math::ParallelFor(0, _count, MinBatch, _multithreaded, [_transforms, sx, sy, sz](size_t _begin, size_t _end)
+			{
+				for (size_t i = _begin; i < _end; ++i)
+				{
+					_transforms[i].position.X -= sx;
+					_transforms[i].position.Y -= sy;
+					_transforms[i].position.Z -= sz;
+				}
+			});
+		}
+
+		void Rebase(Vec3* _positions, size_t _count, const Vec3d& _shift, bool _multithreaded)
+		{
+			const double sx = _shift.X, sy = _shift.Y, sz = _shift.Z;
+
+			Math::ParallelFor(0, _count, MinBatch, _multithreaded, [_positions, sx, sy, sz](size_t _begin, size_t _end)
+			{
+				for (size_t i = _begin; i < _end; ++i)
+				{
+					_positions[i].X = static_cast<float>(_positions[i].X - sx);
+					_positions[i].Y = static_cast<float>(_positions[i].Y - sy);
+					_positions[i].Z = static_cast<float>(_positions[i].Z - sz);
+				}
+			});
+		}
+
+		void Rebase(Transform* _transforms, size_t _count, const Vec3d& _shift, bool _multithreaded)
+		{
+			const double sx = _shift.X, sy = _shift.Y, sz = _shift.Z;
+
+			Math::ParallelFor(0, _count, MinBatch, _multithreaded, [_transforms, sx, sy, sz](size_t _begin, size_t _end)
+			{
+				for (size_t i = _begin; i < _end; ++i)
+				{
+					Vec3& position = _transforms[i].position;
+					position.X = static_cast<float>(position.X - sx);
+					position.Y = static_cast<float>(position.Y - sy);
+					position.Z = static_cast<float>(position.Z - sz);
+				}
+			});
+		}
+
+		Vec3d ComputeOrigin(const Vec3d& _focus, double _cell_size) noexcept
+		{
+			if (_cell_size <= 0.0)
+				return _focus;
+
+			return Vec3d(std::round(_focus.X / _cell_size) * _cell_size,
+				std::round(_focus.Y / _cell_size) * _cell_size,
+				std::round(_focus.Z / _cell_size) * _cell_size);
+		}
+	}
+}
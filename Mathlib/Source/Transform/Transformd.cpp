@@ -0,0 +1,81 @@
+#include <Transform/Transformd.hpp>
+#include <Matrix/Mat4.hpp>
+
+using namespace Mathlib;
+
+//Constructor
+
+Transformd::Transformd(const Quat& _rotation, const Vec3d& _position, const Vec3& _scale) noexcept :
+	rotation{ _rotation }, position{ _position }, scale{ _scale }
+{
+}
+
+Transformd::Transformd(const Transform& _transform) noexcept :
+	rotation{ _transform.rotation }, position{ _transform.position }, scale{ _transform.scale }
+{
+}
+
+//Equality
+
+bool Transformd::Equals(const Transformd& _other, float _epsilon) const noexcept
+{
+	return rotation.Equals(_other.rotation, _epsilon) &&
+		position.Equals(_other.position, _epsilon) &&
+		scale.Equals(_other.scale, _epsilon);
+}
+
+bool Transformd::operator==(const Transformd& _rhs) const noexcept
+{
+	return rotation == _rhs.rotation &&
+		position == _rhs.position &&
+		scale == _rhs.scale;
+}
+
+bool Transformd::operator!=(const Transformd& _rhs) const noexcept
+{
+	return !(*this == _rhs);
+}
+
+//ToMatrix
+
+Mat4d Transformd::ToMatrixWithScale() const
+{
+	Mat4d transform(Transform(rotation, Vec3::Zero, scale).ToMatrixWithScale());
+
+	transform(0, 3) = position.X;
+	transform(1, 3) = position.Y;
+	transform(2, 3) = position.Z;
+
+	return transform;
+}
+
+Mat4d Transformd::ToMatrixNoScale() const
+{
+	Mat4d transform(Mat4::RotationMatrix(rotation));
+
+	transform(0, 3) = position.X;
+	transform(1, 3) = position.Y;
+	transform(2, 3) = position.Z;
+
+	return transform;
+}
+
+Transform Transformd::ToTransform(const Vec3d& _origin) const noexcept
+{
+	return Transform(rotation, static_cast<Vec3>(position - _origin), scale);
+}
+
+Transformd Transformd::GetWorldTransfrom(const Transformd& _parent) const
+{
+	// Rotate in double so large local offsets keep their precision: v + 2w (u x v) + 2u x (u x v).
+	const Vec3d axis(_parent.rotation.X, _parent.rotation.Y, _parent.rotation.Z);
+	const Vec3d uv = Vec3d::CrossProduct(axis, position);
+	const Vec3d uuv = Vec3d::CrossProduct(axis, uv);
+
+	Transformd result;
+	result.rotation = rotation;
+	result.position = position + (uv * static_cast<double>(_parent.rotation.W) + uuv) * 2.0 + _parent.position;
+	result.scale = _parent.scale * scale;
+
+	return result;
+}
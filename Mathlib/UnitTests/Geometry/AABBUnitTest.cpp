@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <Collections/Mathlib.hpp>
+
+using namespace Mathlib;
+
+/**
+*	\brief Unit test for constructors
+*/
+TEST(AABBUnitTest, Constructor)
+{
+	AABB box_1;
+	EXPECT_EQ(box_1.min, Vec3::Zero);
+	EXPECT_EQ(box_1.max, Vec3::Zero);
+
+	AABB box_2(Vec3(-1.f, -2.f, -3.f), Vec3(1.f, 2.f, 3.f));
+	EXPECT_EQ(box_2.min, Vec3(-1.f, -2.f, -3.f));
+	EXPECT_EQ(box_2.max, Vec3(1.f, 2.f, 3.f));
+
+	EXPECT_EQ(AABB::FromCenterExtents(Vec3::Zero, Vec3(1.f, 2.f, 3.f)), box_2);
+
+	Vec3 points[3] = { Vec3(1.f, -4.f, 2.f), Vec3(-3.f, 2.f, 0.f), Vec3(0.f, 1.f, 5.f) };
+	EXPECT_EQ(AABB::FromPoints(points, 3), AABB(Vec3(-3.f, -4.f, 0.f), Vec3(1.f, 2.f, 5.f)));
+	EXPECT_FALSE(AABB::FromPoints(points, 0).IsValid());
+}
+
+/**
+*	\brief Unit test for box accessors
+*/
+TEST(AABBUnitTest, Accessors)
+{
+	AABB box(Vec3(0.f, 0.f, 0.f), Vec3(2.f, 4.f, 6.f));
+
+	EXPECT_EQ(box.GetCenter(), Vec3(1.f, 2.f, 3.f));
+	EXPECT_EQ(box.GetExtents(), Vec3(1.f, 2.f, 3.f));
+	EXPECT_EQ(box.GetSize(), Vec3(2.f, 4.f, 6.f));
+	EXPECT_FLOAT_EQ(box.GetVolume(), 48.f);
+	EXPECT_FLOAT_EQ(box.GetSurfaceArea(), 88.f);
+	EXPECT_TRUE(box.IsValid());
+}
+
+/**
+*	\brief Unit test for union, intersection and containment
+*/
+TEST(AABBUnitTest, Operations)
+{
+	AABB box_1(Vec3(0.f, 0.f, 0.f), Vec3(2.f, 2.f, 2.f));
+	AABB box_2(Vec3(1.f, 1.f, 1.f), Vec3(3.f, 3.f, 3.f));
+	AABB box_3(Vec3(5.f, 5.f, 5.f), Vec3(6.f, 6.f, 6.f));
+
+	EXPECT_EQ(AABB::Union(box_1, box_2), AABB(Vec3::Zero, Vec3(3.f, 3.f, 3.f)));
+	EXPECT_EQ(AABB::Union(box_1, AABB::Empty), box_1);
+	EXPECT_EQ(AABB::Intersection(box_1, box_2), AABB(Vec3::One, Vec3(2.f, 2.f, 2.f)));
+	EXPECT_FALSE(AABB::Intersection(box_1, box_3).IsValid());
+
+	EXPECT_TRUE(box_1.Intersects(box_2));
+	EXPECT_FALSE(box_1.Intersects(box_3));
+
+	EXPECT_TRUE(box_1.Contains(Vec3::One));
+	EXPECT_FALSE(box_1.Contains(Vec3(3.f, 1.f, 1.f)));
+	EXPECT_TRUE(AABB::Union(box_1, box_2).Contains(box_2));
+	EXPECT_FALSE(box_1.Contains(box_2));
+
+	EXPECT_EQ(box_1.ClosestPoint(Vec3(-1.f, 1.f, 5.f)), Vec3(0.f, 1.f, 2.f));
+
+	AABB box_4 = box_1;
+	box_4.Encapsulate(Vec3(-1.f, 4.f, 1.f));
+	EXPECT_EQ(box_4, AABB(Vec3(-1.f, 0.f, 0.f), Vec3(2.f, 4.f, 2.f)));
+	box_4.Encapsulate(box_3);
+	EXPECT_EQ(box_4, AABB(Vec3(-1.f, 0.f, 0.f), Vec3(6.f, 6.f, 6.f)));
+}
+
+/**
+*	\brief Unit test for box transformation
+*/
+TEST(AABBUnitTest, Transform)
+{
+	AABB box(Vec3(-1.f, -2.f, -3.f), Vec3(1.f, 2.f, 3.f));
+
+	Mat4 translation = Mat4::TranslationMatrix(Vec3(10.f, 0.f, -5.f));
+	EXPECT_EQ(box.GetTransformed(translation), AABB(Vec3(9.f, -2.f, -8.f), Vec3(11.f, 2.f, -2.f)));
+
+	// 90 degrees around Y axis swaps X and Z extents.
+	Transform transform(Quat(90.f, Vec3::Up), Vec3(1.f, 1.f, 1.f), Vec3(2.f, 2.f, 2.f));
+	AABB transformed = box.GetTransformed(transform);
+	EXPECT_TRUE(transformed.Equals(AABB(Vec3(-5.f, -3.f, -1.f), Vec3(7.f, 5.f, 3.f)), 0.0001f));
+
+	// Transformed box must enclose every transformed corner.
+	Mat4 matrix = transform.ToMatrixWithScale();
+	for (int corner = 0; corner < 8; ++corner)
+	{
+		Vec4 point((corner & 1) ? box.max.X : box.min.X,
+					(corner & 2) ? box.max.Y : box.min.Y,
+					(corner & 4) ? box.max.Z : box.min.Z, 1.f);
+		Vec3 transformed_point = Vec3(matrix * point);
+		EXPECT_TRUE(AABB(transformed.min - 0.0001f, transformed.max + 0.0001f).Contains(transformed_point));
+	}
+
+	// Empty has infinite extents, matrix zeros must not turn it into NaN.
+	EXPECT_EQ(AABB::Empty.GetTransformed(translation), AABB::Empty);
+	EXPECT_EQ(AABB::Empty.GetTransformed(transform), AABB::Empty);
+	EXPECT_EQ(AABB::Union(AABB::Empty.GetTransformed(matrix), box), box);
+
+	AABB boxes[2] = { AABB::Empty, box };
+	AABB::TransformBatch(boxes, translation, boxes, 2);
+	EXPECT_EQ(boxes[0], AABB::Empty);
+	EXPECT_EQ(boxes[1], box.GetTransformed(translation));
+}
+
+/**
+*	\brief Unit test for batch functions
+*/
+TEST(AABBUnitTest, Batch)
+{
+	const size_t count = 37;
+	std::vector<AABB> boxes(count);
+	std::vector<Mat4> matrices(count);
+	std::vector<Transform> transforms(count);
+
+	AABB expected_union = AABB::Empty;
+	for (size_t i = 0; i < count; ++i)
+	{
+		Vec3 center(static_cast<float>(Math::Random(-100, 100)), static_cast<float>(Math::Random(-100, 100)), static_cast<float>(Math::Random(-100, 100)));
+		Vec3 extents(static_cast<float>(Math::Random(1, 10)), static_cast<float>(Math::Random(1, 10)), static_cast<float>(Math::Random(1, 10)));
+		boxes[i] = AABB::FromCenterExtents(center, extents);
+		expected_union.Encapsulate(boxes[i]);
+
+		transforms[i] = Transform(Vec3(static_cast<float>(i * 10), 45.f, 0.f), center, Vec3::One);
+		matrices[i] = transforms[i].ToMatrixWithScale();
+	}
+
+	EXPECT_EQ(AABB::UnionBatch(boxes.data(), count), expected_union);
+	EXPECT_EQ(AABB::UnionBatch(boxes.data(), 0), AABB::Empty);
+
+	std::vector<AABB> result(count);
+
+	AABB::TransformBatch(boxes.data(), matrices.data(), result.data(), count);
+	for (size_t i = 0; i < count; ++i)
+		EXPECT_EQ(result[i], boxes[i].GetTransformed(matrices[i]));
+
+	AABB::TransformBatch(boxes.data(), transforms.data(), result.data(), count);
+	for (size_t i = 0; i < count; ++i)
+		EXPECT_EQ(result[i], boxes[i].GetTransformed(transforms[i]));
+
+	AABB::TransformBatch(boxes.data(), matrices[0], result.data(), count);
+	for (size_t i = 0; i < count; ++i)
+		EXPECT_EQ(result[i], boxes[i].GetTransformed(matrices[0]));
+}
@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include <Collections/Mathlib.hpp>
+
+using namespace Mathlib;
+
+namespace
+{
+	/**
+	*	\brief Return a deterministic value in [-1, 1].
+	*/
+	float Random(uint32_t& _state)
+	{
+		_state = _state * 1664525u + 1013904223u;
+		return static_cast<float>(_state >> 8) / static_cast<float>(1 << 23) - 1.f;
+	}
+}
+
+/**
+*	\brief Unit test for plane fitting
+*/
+TEST(FitUnitTest, Plane)
+{
+	uint32_t state = 7u;
+	const Vec3 normal = Vec3(1.f, -2.f, 0.5f).Normalize();
+	const Vec3 tangent = Vec3::CrossProduct(normal, Vec3::Up).Normalize();
+	const Vec3 bitangent = Vec3::CrossProduct(normal, tangent);
+	const Vec3 center(1000.f, -200.f, 50.f);
+
+	// Far from the origin with noise along the normal, more points than one block.
+	std::vector<Vec3> points(20000);
+	for (Vec3& point : points)
+		point = center + tangent * (Random(state) * 10.f) + bitangent * (Random(state) * 5.f) + normal * (Random(state) * 0.01f);
+
+	Plane plane, threaded;
+	ASSERT_TRUE(Fit::BestPlane(points.data(), points.size(), plane));
+	ASSERT_TRUE(Fit::BestPlane(points.data(), points.size(), threaded, true));
+
+	EXPECT_EQ(plane.normal, threaded.normal);
+	EXPECT_EQ(plane.distance, threaded.distance);
+	EXPECT_NEAR(std::abs(Vec3::DotProduct(plane.normal, normal)), 1.f, 1e-5f);
+	EXPECT_NEAR(plane.GetSignedDistance(center), 0.f, 1e-2f);
+
+	// Too few and collinear points.
+	EXPECT_FALSE(Fit::BestPlane(points.data(), 2, plane));
+
+	const Vec3 line[4] = { Vec3(0.f), Vec3(1.f), Vec3(2.f), Vec3(3.f) };
+	EXPECT_FALSE(Fit::BestPlane(line, 4, plane));
+}
+
+/**
+*	\brief Unit test for sphere fitting
+*/
+TEST(FitUnitTest, Sphere)
+{
+	uint32_t state = 13u;
+	const Vec3 center(10.f, -5.f, 2.f);
+
+	std::vector<Vec3> points(5000);
+	for (Vec3& point : points)
+		point = center + Vec3(Random(state), Random(state), Random(state)).Normalize() * 3.f;
+
+	Sphere sphere;
+	ASSERT_TRUE(Fit::BestSphere(points.data(), points.size(), sphere, true));
+	EXPECT_TRUE(sphere.center.Equals(center, 1e-4f));
+	EXPECT_NEAR(sphere.radius, 3.f, 1e-4f);
+
+	// Points on a circle do not define a sphere.
+	std::vector<Vec3> circle(100);
+	for (size_t i = 0; i < circle.size(); ++i)
+		circle[i] = Vec3(std::cos(0.1f * i), std::sin(0.1f * i), 0.f);
+
+	EXPECT_FALSE(Fit::BestSphere(circle.data(), circle.size(), sphere));
+}
+
+/**
+*	\brief Unit test for line fitting
+*/
+TEST(FitUnitTest, Line)
+{
+	uint32_t state = 19u;
+	const Vec3 direction = Vec3(2.f, 1.f, -1.f).Normalize();
+
+	std::vector<Vec3> points(1000);
+	for (Vec3& point : points)
+		point = Vec3(5.f, 5.f, 5.f) + direction * (Random(state) * 20.f) + Vec3(Random(state), Random(state), Random(state)) * 0.01f;
+
+	Ray ray;
+	ASSERT_TRUE(Fit::BestLine(points.data(), points.size(), ray));
+	EXPECT_NEAR(std::abs(Vec3::DotProduct(ray.direction, direction)), 1.f, 1e-6f);
+	EXPECT_NEAR(Vec3::CrossProduct(ray.origin - Vec3(5.f, 5.f, 5.f), direction).Length(), 0.f, 1e-2f);
+
+	const Vec3 same[3] = { Vec3(1.f), Vec3(1.f), Vec3(1.f) };
+	EXPECT_FALSE(Fit::BestLine(same, 3, ray));
+
+	const Vec2 points2[4] = { Vec2(0.f, 1.f), Vec2(1.f, 3.f), Vec2(2.f, 5.f), Vec2(3.f, 7.f) };
+	Vec2 point, direction2;
+	ASSERT_TRUE(Fit::BestLine(points2, 4, point, direction2));
+	EXPECT_TRUE(point.Equals(Vec2(1.5f, 4.f), 1e-5f));
+	EXPECT_NEAR(std::abs(direction2.X * 2.f - direction2.Y), 0.f, 1e-5f);
+	EXPECT_NEAR(direction2.Length(), 1.f, 1e-6f);
+}
+
+/**
+*	\brief Unit test for polynomial fitting
+*/
+TEST(FitUnitTest, Polynomial)
+{
+	std::vector<Vec2> points(10000);
+	for (size_t i = 0; i < points.size(); ++i)
+	{
+		const float x = -3.f + 8.f * static_cast<float>(i) / static_cast<float>(points.size() - 1);
+		points[i] = Vec2(x, 1.f - 2.f * x + 0.5f * x * x * x);
+	}
+
+	float coefficients[4];
+	ASSERT_TRUE(Fit::BestPolynomial(points.data(), points.size(), 3, coefficients, true));
+	EXPECT_NEAR(coefficients[0], 1.f, 1e-4f);
+	EXPECT_NEAR(coefficients[1], -2.f, 1e-4f);
+	EXPECT_NEAR(coefficients[2], 0.f, 1e-4f);
+	EXPECT_NEAR(coefficients[3], 0.5f, 1e-5f);
+
+	// Less distinct abscissas than coefficients.
+	const Vec2 vertical[5] = { Vec2(1.f, 0.f), Vec2(1.f, 1.f), Vec2(1.f, 2.f), Vec2(1.f, 3.f), Vec2(1.f, 4.f) };
+	EXPECT_FALSE(Fit::BestPolynomial(vertical, 5, 1, coefficients));
+	EXPECT_TRUE(Fit::BestPolynomial(vertical, 5, 0, coefficients));
+	EXPECT_FLOAT_EQ(coefficients[0], 2.f);
+	EXPECT_FALSE(Fit::BestPolynomial(vertical, 1, 1, coefficients));
+}
@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <Collections/Mathlib.hpp>
+
+using namespace Mathlib;
+
+/**
+*	\brief Unit test for plane extraction
+*/
+TEST(FrustumUnitTest, Constructor)
+{
+	Frustum frustum = Frustum::FromCamera(COORDINATE_SYSTEM::LEFT_HAND, Vec3::Zero, Vec3::Forward, Vec3::Up,
+		90.f * Math::DegToRad, 1.f, 1.f, 100.f);
+
+	EXPECT_TRUE(frustum.GetPlane(FRUSTUM_PLANE::NEAR_CLIP).Equals(Plane(Vec3::Forward, -1.f), 0.0001f));
+	EXPECT_TRUE(frustum.GetPlane(FRUSTUM_PLANE::FAR_CLIP).Equals(Plane(Vec3::Backward, 100.f), 0.001f));
+
+	float half_sqrt2 = Math::Sqrt(2.f) * 0.5f;
+	EXPECT_TRUE(frustum.GetPlane(FRUSTUM_PLANE::LEFT).Equals(Plane(Vec3(half_sqrt2, 0.f, half_sqrt2), 0.f), 0.0001f));
+	EXPECT_TRUE(frustum.GetPlane(FRUSTUM_PLANE::RIGHT).Equals(Plane(Vec3(-half_sqrt2, 0.f, half_sqrt2), 0.f), 0.0001f));
+	EXPECT_TRUE(frustum.GetPlane(FRUSTUM_PLANE::BOTTOM).Equals(Plane(Vec3(0.f, half_sqrt2, half_sqrt2), 0.f), 0.0001f));
+	EXPECT_TRUE(frustum.GetPlane(FRUSTUM_PLANE::TOP).Equals(Plane(Vec3(0.f, -half_sqrt2, half_sqrt2), 0.f), 0.0001f));
+}
+
+/**
+*	\brief Unit test for single object tests in both coordinate systems
+*/
+TEST(FrustumUnitTest, Intersection)
+{
+	Vec3 eye(5.f, 2.f, -3.f);
+
+	Frustum frustums[2] = {
+		Frustum::FromCamera(COORDINATE_SYSTEM::LEFT_HAND, eye, Vec3::Forward, Vec3::Up, 90.f * Math::DegToRad, 1.f, 1.f, 100.f),
+		Frustum::FromCamera(COORDINATE_SYSTEM::RIGHT_HAND, eye, Vec3::Forward, Vec3::Up, 90.f * Math::DegToRad, 1.f, 1.f, 100.f)
+	};
+
+	for (const Frustum& frustum : frustums)
+	{
+		EXPECT_TRUE(frustum.Contains(eye + Vec3(0.f, 0.f, 10.f)));
+		EXPECT_TRUE(frustum.Contains(eye + Vec3(8.f, -8.f, 10.f)));
+		EXPECT_FALSE(frustum.Contains(eye + Vec3(0.f, 0.f, 0.5f)));
+		EXPECT_FALSE(frustum.Contains(eye + Vec3(0.f, 0.f, 150.f)));
+		EXPECT_FALSE(frustum.Contains(eye + Vec3(12.f, 0.f, 10.f)));
+		EXPECT_FALSE(frustum.Contains(eye + Vec3(0.f, 0.f, -10.f)));
+
+		EXPECT_TRUE(frustum.Intersects(Sphere(eye + Vec3(12.f, 0.f, 10.f), 2.f)));
+		EXPECT_FALSE(frustum.Intersects(Sphere(eye + Vec3(12.f, 0.f, 10.f), 1.f)));
+		EXPECT_TRUE(frustum.Intersects(Sphere(eye + Vec3(0.f, 0.f, -1.f), 3.f)));
+
+		EXPECT_TRUE(frustum.Intersects(AABB::FromCenterExtents(eye + Vec3(12.f, 0.f, 10.f), Vec3(2.5f))));
+		EXPECT_FALSE(frustum.Intersects(AABB::FromCenterExtents(eye + Vec3(12.f, 0.f, 10.f), Vec3(0.5f))));
+		EXPECT_FALSE(frustum.Intersects(AABB::FromCenterExtents(eye + Vec3(0.f, 0.f, 200.f), Vec3(50.f))));
+	}
+}
+
+/**
+*	\brief Unit test for batched culling, compared with single object tests
+*/
+TEST(FrustumUnitTest, Batch)
+{
+	Frustum frustum = Frustum::FromCamera(COORDINATE_SYSTEM::RIGHT_HAND, Vec3(0.f, 10.f, 0.f), Vec3(1.f, -0.2f, 0.3f), Vec3::Up,
+		60.f * Math::DegToRad, 16.f / 9.f, 0.1f, 500.f);
+
+	const size_t count = 1000;
+	std::vector<Sphere> spheres(count);
+	std::vector<AABB> boxes(count);
+	std::vector<float> x(count), y(count), z(count), radius(count);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		Vec3 center(static_cast<float>(Math::Random(-300, 300)), static_cast<float>(Math::Random(-300, 300)), static_cast<float>(Math::Random(-300, 300)));
+		float size = static_cast<float>(Math::Random(1, 20));
+
+		spheres[i] = Sphere(center, size);
+		boxes[i] = AABB::FromCenterExtents(center, Vec3(size, size * 0.5f, size * 2.f));
+		x[i] = center.X;
+		y[i] = center.Y;
+		z[i] = center.Z;
+		radius[i] = size;
+	}
+
+	const size_t word_count = (count + 31) / 32;
+	std::vector<uint32_t> sphere_mask(word_count, 0xDEADBEEF);
+	std::vector<uint32_t> stream_mask(word_count, 0xDEADBEEF);
+	std::vector<uint32_t> box_mask(word_count, 0xDEADBEEF);
+
+	frustum.CullSpheres(spheres.data(), count, sphere_mask.data());
+	frustum.CullSpheres(x.data(), y.data(), z.data(), radius.data(), count, stream_mask.data());
+	frustum.CullAABBs(boxes.data(), count, box_mask.data());
+
+	size_t visible_count = 0;
+	for (size_t i = 0; i < count; ++i)
+	{
+		bool sphere_visible = (sphere_mask[i / 32] >> (i % 32)) & 1u;
+		bool stream_visible = (stream_mask[i / 32] >> (i % 32)) & 1u;
+		bool box_visible = (box_mask[i / 32] >> (i % 32)) & 1u;
+
+		EXPECT_EQ(sphere_visible, frustum.Intersects(spheres[i]));
+		EXPECT_EQ(stream_visible, sphere_visible);
+		EXPECT_EQ(box_visible, frustum.Intersects(boxes[i]));
+
+		visible_count += sphere_visible ? 1 : 0;
+	}
+
+	EXPECT_GT(visible_count, 0u);
+	EXPECT_LT(visible_count, count);
+
+	// Bits past _count are cleared.
+	EXPECT_EQ(sphere_mask.back() >> (count % 32), 0u);
+	EXPECT_EQ(stream_mask.back() >> (count % 32), 0u);
+	EXPECT_EQ(box_mask.back() >> (count % 32), 0u);
+}
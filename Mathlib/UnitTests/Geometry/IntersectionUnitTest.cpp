@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <type_traits>
+
+#include <Collections/Mathlib.hpp>
+
+using namespace Mathlib;
+
+/**
+*	\brief Unit test for single ray intersections
+*/
+TEST(IntersectionUnitTest, Ray)
+{
+	float distance = -1.f;
+
+	Ray ray(Vec3(0.f, 0.f, -10.f), Vec3::Forward);
+
+	// Plane
+	EXPECT_TRUE(Intersection::RayPlane(ray, Plane(Vec3::Backward, 2.f), distance));
+	EXPECT_FLOAT_EQ(distance, 12.f);
+	EXPECT_FALSE(Intersection::RayPlane(ray, Plane(Vec3::Forward, 20.f), distance));
+	EXPECT_FALSE(Intersection::RayPlane(ray, Plane(Vec3::Up, 0.f), distance));
+
+	// Sphere
+	EXPECT_TRUE(Intersection::RaySphere(ray, Sphere(Vec3::Zero, 2.f), distance));
+	EXPECT_FLOAT_EQ(distance, 8.f);
+	EXPECT_TRUE(Intersection::RaySphere(ray, Sphere(Vec3(0.f, 0.f, -10.f), 1.f), distance));
+	EXPECT_FLOAT_EQ(distance, 0.f);
+	EXPECT_FALSE(Intersection::RaySphere(ray, Sphere(Vec3(3.f, 0.f, 0.f), 2.f), distance));
+	EXPECT_FALSE(Intersection::RaySphere(ray, Sphere(Vec3(0.f, 0.f, -20.f), 2.f), distance));
+
+	// AABB
+	EXPECT_TRUE(Intersection::RayAABB(ray, AABB(Vec3(-1.f), Vec3(1.f)), distance));
+	EXPECT_FLOAT_EQ(distance, 9.f);
+	EXPECT_TRUE(Intersection::RayAABB(ray, AABB(Vec3(-1.f, -1.f, -11.f), Vec3(1.f)), distance));
+	EXPECT_FLOAT_EQ(distance, 0.f);
+	EXPECT_FALSE(Intersection::RayAABB(ray, AABB(Vec3(2.f, -1.f, -1.f), Vec3(3.f, 1.f, 1.f)), distance));
+	EXPECT_FALSE(Intersection::RayAABB(ray, AABB(Vec3(-1.f, -1.f, -30.f), Vec3(1.f, 1.f, -20.f)), distance));
+
+	// Triangle
+	Triangle triangle(Vec3(-1.f, -1.f, 5.f), Vec3(1.f, -1.f, 5.f), Vec3(0.f, 1.f, 5.f));
+	float u = -1.f;
+	float v = -1.f;
+	EXPECT_TRUE(Intersection::RayTriangle(ray, triangle, distance, u, v));
+	EXPECT_FLOAT_EQ(distance, 15.f);
+	EXPECT_FLOAT_EQ(u, 0.25f);
+	EXPECT_FLOAT_EQ(v, 0.5f);
+	EXPECT_FALSE(Intersection::RayTriangle(Ray(Vec3(2.f, 0.f, 0.f), Vec3::Forward), triangle, distance));
+	EXPECT_FALSE(Intersection::RayTriangle(Ray(Vec3(0.f, 0.f, 10.f), Vec3::Forward), triangle, distance));
+	EXPECT_FALSE(Intersection::RayTriangle(Ray(Vec3::Zero, Vec3::Right), triangle, distance));
+}
+
+/**
+*	\brief Check every lane of a packet against the single ray function.
+*/
+template<unsigned int N, typename Primitive, typename SingleFunction>
+void CheckPacket(const Ray* _rays, const Primitive& _primitive, SingleFunction _single)
+{
+	RayPacket<N> packet(_rays);
+
+	float distances[N];
+	for (unsigned int lane = 0; lane < N; ++lane)
+		distances[lane] = (lane % 5 == 0) ? 1.f : std::numeric_limits<float>::max();
+
+	uint32_t mask = 0u;
+	if constexpr (std::is_same_v<Primitive, Plane>)
+		mask = Intersection::RayPlane(packet, _primitive, distances);
+	else if constexpr (std::is_same_v<Primitive, Sphere>)
+		mask = Intersection::RaySphere(packet, _primitive, distances);
+	else if constexpr (std::is_same_v<Primitive, AABB>)
+		mask = Intersection::RayAABB(packet, _primitive, distances);
+	else
+		mask = Intersection::RayTriangle(packet, _primitive, distances);
+
+	for (unsigned int lane = 0; lane < N; ++lane)
+	{
+		float max_distance = (lane % 5 == 0) ? 1.f : std::numeric_limits<float>::max();
+		float distance = 0.f;
+		bool expected = _single(_rays[lane], _primitive, distance) && distance <= max_distance;
+
+		EXPECT_EQ(((mask >> lane) & 1u) != 0u, expected);
+		if (expected)
+			EXPECT_NEAR(distances[lane], distance, 0.0001f);
+		else
+			EXPECT_EQ(distances[lane], max_distance);
+	}
+}
+
+/**
+*	\brief Unit test for ray packet intersections
+*/
+TEST(IntersectionUnitTest, Packet)
+{
+	Ray rays[16];
+	for (unsigned int i = 0; i < 16; ++i)
+	{
+		Vec3 target(static_cast<float>(Math::Random(-3, 4)), static_cast<float>(Math::Random(-3, 4)), static_cast<float>(Math::Random(-3, 4)));
+		rays[i] = Ray::FromPoints(Vec3(0.f, 0.f, -10.f + static_cast<float>(i % 3)), target);
+	}
+	rays[15] = Ray(Vec3(0.f, 0.f, -10.f), Vec3::Right);
+
+	Plane plane(Vec3(0.2f, 0.1f, -1.f), 1.f);
+	Sphere sphere(Vec3(0.5f, -0.5f, 0.f), 2.f);
+	AABB aabb(Vec3(-1.f, -2.f, -1.f), Vec3(2.f, 1.f, 1.f));
+	Triangle triangle(Vec3(-2.f, -2.f, 0.f), Vec3(3.f, -1.f, 0.5f), Vec3(0.f, 3.f, 0.f));
+
+	auto plane_function = [](const Ray& _ray, const Plane& _plane, float& _distance) { return Intersection::RayPlane(_ray, _plane, _distance); };
+	auto sphere_function = [](const Ray& _ray, const Sphere& _sphere, float& _distance) { return Intersection::RaySphere(_ray, _sphere, _distance); };
+	auto aabb_function = [](const Ray& _ray, const AABB& _aabb, float& _distance) { return Intersection::RayAABB(_ray, _aabb, _distance); };
+	auto triangle_function = [](const Ray& _ray, const Triangle& _triangle, float& _distance) { return Intersection::RayTriangle(_ray, _triangle, _distance); };
+
+	CheckPacket<4>(rays, plane, plane_function);
+	CheckPacket<8>(rays, plane, plane_function);
+	CheckPacket<16>(rays, plane, plane_function);
+
+	CheckPacket<4>(rays, sphere, sphere_function);
+	CheckPacket<8>(rays, sphere, sphere_function);
+	CheckPacket<16>(rays, sphere, sphere_function);
+
+	CheckPacket<4>(rays, aabb, aabb_function);
+	CheckPacket<8>(rays, aabb, aabb_function);
+	CheckPacket<16>(rays, aabb, aabb_function);
+
+	CheckPacket<4>(rays, triangle, triangle_function);
+	CheckPacket<8>(rays, triangle, triangle_function);
+	CheckPacket<16>(rays, triangle, triangle_function);
+}
@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <Collections/Mathlib.hpp>
+
+using namespace Mathlib;
+
+namespace
+{
+	float RandomFloat(int _min, int _max)
+	{
+		return static_cast<float>(Math::Random(_min * 100, _max * 100)) / 100.f;
+	}
+
+	OBB RandomBox(int _extent)
+	{
+		Vec3 center(RandomFloat(-_extent, _extent), RandomFloat(-_extent, _extent), RandomFloat(-_extent, _extent));
+		Vec3 axis(RandomFloat(-1, 1), RandomFloat(-1, 1), RandomFloat(-1, 1));
+		Quat rotation = axis.SquaredLength() > 0.01f ? Quat(RandomFloat(0, 360), axis.GetNormalized()) : Quat::Identity;
+
+		return OBB(center, rotation, Vec3(RandomFloat(0, 3), RandomFloat(0, 3), RandomFloat(0, 3)));
+	}
+}
+
+/**
+*	\brief Unit test for constructors
+*/
+TEST(OBBUnitTest, Constructor)
+{
+	OBB box_1;
+	EXPECT_EQ(box_1.center, Vec3::Zero);
+	EXPECT_EQ(box_1.orientation, Mat3::Identity);
+	EXPECT_EQ(box_1.halfExtents, Vec3::Zero);
+
+	Quat rotation(90.f, Vec3::Up);
+	OBB box_2(Vec3(1.f, 2.f, 3.f), rotation, Vec3(1.f, 2.f, 3.f));
+	EXPECT_TRUE(box_2.orientation.Equals(Mat3(Mat4::RotationMatrix(rotation)), 0.00001f));
+	EXPECT_TRUE(box_2.GetAxis(0).Equals(rotation.Rotate(Vec3(1.f, 0.f, 0.f)), 0.00001f));
+	EXPECT_TRUE(box_2.GetAxis(2).Equals(rotation.Rotate(Vec3(0.f, 0.f, 1.f)), 0.00001f));
+
+	OBB box_3 = OBB::FromAABB(AABB(Vec3(-1.f, 0.f, 1.f), Vec3(1.f, 4.f, 2.f)));
+	EXPECT_EQ(box_3, OBB(Vec3(0.f, 2.f, 1.5f), Mat3::Identity, Vec3(1.f, 2.f, 0.5f)));
+
+	Transform transform(rotation, Vec3(0.f, 10.f, 0.f), Vec3(2.f, 1.f, -3.f));
+	OBB box_4 = OBB::FromTransform(AABB(Vec3(0.f, -1.f, -1.f), Vec3(2.f, 1.f, 1.f)), transform);
+	EXPECT_TRUE(box_4.center.Equals(Vec3(0.f, 10.f, -2.f), 0.00001f));
+	EXPECT_TRUE(box_4.halfExtents.Equals(Vec3(2.f, 1.f, 3.f), 0.00001f));
+
+	Vec3 corners[8];
+	box_4.GetCorners(corners);
+	AABB world = AABB::Empty;
+	for (const Vec3& corner : corners)
+		world.Encapsulate(corner);
+	EXPECT_TRUE(world.Equals(AABB(Vec3(-3.f, 9.f, -4.f), Vec3(3.f, 11.f, 0.f)), 0.00001f));
+	EXPECT_TRUE(box_4.GetAABB().Equals(world, 0.00001f));
+	EXPECT_FLOAT_EQ(box_4.GetVolume(), 48.f);
+}
+
+/**
+*	\brief Unit test for OBB methods
+*/
+TEST(OBBUnitTest, Methods)
+{
+	OBB box(Vec3::Zero, Mat3::Identity, Vec3::One);
+	OBB rotated(Vec3(2.3f, 2.3f, 0.f), Quat(45.f, Vec3(0.f, 0.f, 1.f)), Vec3::One);
+
+	EXPECT_TRUE(rotated.Contains(Vec3(2.3f, 2.3f + 1.4f, 0.f)));
+	EXPECT_FALSE(rotated.Contains(Vec3(2.3f + 1.f, 2.3f + 1.f, 0.f)));
+	EXPECT_TRUE(box.ClosestPoint(Vec3(3.f, 0.5f, -2.f)).Equals(Vec3(1.f, 0.5f, -1.f)));
+	EXPECT_TRUE(rotated.ClosestPoint(Vec3::Zero).Equals(Vec3(2.3f - 0.70710678f, 2.3f - 0.70710678f, 0.f), 0.0001f));
+
+	// Bounding boxes overlap but a face axis of the rotated box separates them.
+	EXPECT_TRUE(box.GetAABB().Intersects(rotated.GetAABB()));
+	EXPECT_FALSE(box.Intersects(rotated));
+	EXPECT_FALSE(rotated.Intersects(box));
+
+	rotated.center = Vec3(1.7f, 1.7f, 0.f);
+	EXPECT_TRUE(box.Intersects(rotated));
+	EXPECT_TRUE(rotated.Intersects(box));
+
+	// Edge against edge, only a cross product axis separates them.
+	OBB edge_1(Vec3::Zero, Quat(45.f, Vec3(1.f, 0.f, 0.f)), Vec3(2.f, 1.f, 1.f));
+	OBB edge_2(Vec3(0.f, 2.9f, 0.f), Quat(45.f, Vec3(0.f, 0.f, 1.f)), Vec3(1.f, 1.f, 2.f));
+	EXPECT_FALSE(edge_1.Intersects(edge_2));
+	edge_2.center.Y = 2.7f;
+	EXPECT_TRUE(edge_1.Intersects(edge_2));
+
+	EXPECT_TRUE(box.Intersects(AABB(Vec3(1.f, 1.f, 1.f), Vec3(2.f, 2.f, 2.f))));
+	EXPECT_FALSE(box.Intersects(AABB(Vec3(1.1f, 0.f, 0.f), Vec3(2.f, 2.f, 2.f))));
+
+	EXPECT_TRUE(rotated.Intersects(Sphere(Vec3::Zero, 1.5f)));
+	EXPECT_FALSE(rotated.Intersects(Sphere(Vec3::Zero, 1.3f)));
+}
+
+/**
+*	\brief Unit test for batched overlap tests
+*/
+TEST(OBBUnitTest, Batch)
+{
+	const size_t count = 1000;
+	std::vector<OBB> boxes(count);
+	for (OBB& box : boxes)
+		box = RandomBox(10);
+
+	std::vector<uint32_t> overlaps((count + 31) / 32, 0xFFFFFFFFu);
+
+	for (int test = 0; test < 10; ++test)
+	{
+		OBB query = RandomBox(5);
+		query.IntersectsBatch(boxes.data(), count, overlaps.data());
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			bool overlap = (overlaps[i / 32] >> (i % 32)) & 1u;
+			EXPECT_EQ(overlap, query.Intersects(boxes[i]));
+		}
+
+		// Bits past the end are cleared.
+		EXPECT_EQ(overlaps.back() >> (count % 32), 0u);
+	}
+}
@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+
+#include <Collections/Mathlib.hpp>
+
+using namespace Mathlib;
+
+/**
+*	\brief Unit test for constructors
+*/
+TEST(PlaneUnitTest, Constructor)
+{
+	Plane plane_1;
+	EXPECT_EQ(plane_1.normal, Vec3::Up);
+	EXPECT_FLOAT_EQ(plane_1.distance, 0.f);
+
+	Plane plane_2(Vec3::Up, -5.f);
+	EXPECT_EQ(plane_2.normal, Vec3::Up);
+	EXPECT_FLOAT_EQ(plane_2.distance, -5.f);
+
+	EXPECT_EQ(Plane(Vec3::Up, Vec3(3.f, 5.f, -2.f)), plane_2);
+	EXPECT_EQ(Plane(Vec4(0.f, 1.f, 0.f, -5.f)), plane_2);
+
+	Plane plane_3 = Plane::FromPoints(Vec3(0.f, 5.f, 0.f), Vec3(0.f, 5.f, 1.f), Vec3(1.f, 5.f, 0.f));
+	EXPECT_TRUE(plane_3.Equals(plane_2, 0.00001f));
+}
+
+/**
+*	\brief Unit test for equality and comparison between Plane
+*/
+TEST(PlaneUnitTest, Equality)
+{
+	Plane plane_1(Vec3::Up, 2.f);
+	Plane plane_2(Vec3::Right, 2.f);
+
+	EXPECT_TRUE(plane_1.Equals(plane_1));
+	EXPECT_FALSE(plane_1.Equals(plane_2));
+	EXPECT_TRUE(plane_1 == plane_1);
+	EXPECT_FALSE(plane_1 == plane_2);
+	EXPECT_TRUE(plane_1 != plane_2);
+	EXPECT_FALSE(plane_1 != plane_1);
+}
+
+/**
+*	\brief Unit test for Plane methods
+*/
+TEST(PlaneUnitTest, Methods)
+{
+	Plane plane(Vec3(0.f, 2.f, 0.f), -4.f);
+	plane.Normalize();
+	EXPECT_EQ(plane, Plane(Vec3::Up, -2.f));
+	EXPECT_EQ(Plane(Vec3(0.f, 0.f, 3.f), 6.f).GetNormalized(), Plane(Vec3::Forward, 2.f));
+
+	EXPECT_FLOAT_EQ(plane.GetSignedDistance(Vec3(4.f, 5.f, 1.f)), 3.f);
+	EXPECT_FLOAT_EQ(plane.GetSignedDistance(Vec3(4.f, -1.f, 1.f)), -3.f);
+	EXPECT_EQ(plane.ClosestPoint(Vec3(4.f, 5.f, 1.f)), Vec3(4.f, 2.f, 1.f));
+
+	Plane flipped = -plane;
+	EXPECT_EQ(flipped, Plane(Vec3::Down, 2.f));
+	EXPECT_FLOAT_EQ(flipped.GetSignedDistance(Vec3(4.f, 5.f, 1.f)), -3.f);
+}
@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include <Collections/Mathlib.hpp>
+
+using namespace Mathlib;
+
+/**
+*	\brief Unit test for constructors
+*/
+TEST(RayUnitTest, Constructor)
+{
+	Ray ray_1;
+	EXPECT_EQ(ray_1.origin, Vec3::Zero);
+	EXPECT_EQ(ray_1.direction, Vec3::Forward);
+
+	Ray ray_2(Vec3(1.f, 2.f, 3.f), Vec3::Up);
+	EXPECT_EQ(ray_2.origin, Vec3(1.f, 2.f, 3.f));
+	EXPECT_EQ(ray_2.direction, Vec3::Up);
+
+	Ray ray_3 = Ray::FromPoints(Vec3(1.f, 2.f, 3.f), Vec3(1.f, 12.f, 3.f));
+	EXPECT_TRUE(ray_3.Equals(ray_2));
+}
+
+/**
+*	\brief Unit test for equality and comparison between Ray
+*/
+TEST(RayUnitTest, Equality)
+{
+	Ray ray_1(Vec3::One, Vec3::Up);
+	Ray ray_2(Vec3::One, Vec3::Right);
+
+	EXPECT_TRUE(ray_1.Equals(ray_1));
+	EXPECT_FALSE(ray_1.Equals(ray_2));
+	EXPECT_TRUE(ray_1 == ray_1);
+	EXPECT_FALSE(ray_1 == ray_2);
+	EXPECT_TRUE(ray_1 != ray_2);
+	EXPECT_FALSE(ray_1 != ray_1);
+}
+
+/**
+*	\brief Unit test for Ray methods and packets
+*/
+TEST(RayUnitTest, Methods)
+{
+	Ray ray(Vec3(1.f, 0.f, 0.f), Vec3(0.f, 2.f, 0.f));
+	EXPECT_EQ(ray.GetPoint(0.f), ray.origin);
+	EXPECT_EQ(ray.GetPoint(1.5f), Vec3(1.f, 3.f, 0.f));
+
+	Ray rays[8];
+	for (unsigned int i = 0; i < 8; ++i)
+		rays[i] = Ray(Vec3(static_cast<float>(i), 0.f, 0.f), Vec3(1.f, 2.f, 4.f));
+
+	RayPacket8 packet(rays);
+	for (unsigned int i = 0; i < 8; ++i)
+	{
+		EXPECT_EQ(packet.Get(i), rays[i]);
+		EXPECT_FLOAT_EQ(packet.inverseDirectionY[i], 0.5f);
+		EXPECT_FLOAT_EQ(packet.inverseDirectionZ[i], 0.25f);
+	}
+
+	packet.Set(3, ray);
+	EXPECT_EQ(packet.Get(3), ray);
+	EXPECT_EQ(RayPacket16::Size, 16u);
+}
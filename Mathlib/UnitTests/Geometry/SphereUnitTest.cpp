@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <Collections/Mathlib.hpp>
+
+using namespace Mathlib;
+
+/**
+*	\brief Unit test for constructors
+*/
+TEST(SphereUnitTest, Constructor)
+{
+	Sphere sphere_1;
+	EXPECT_EQ(sphere_1.center, Vec3::Zero);
+	EXPECT_FLOAT_EQ(sphere_1.radius, 0.f);
+
+	Sphere sphere_2(Vec3(1.f, 2.f, 3.f), 4.f);
+	EXPECT_EQ(sphere_2.center, Vec3(1.f, 2.f, 3.f));
+	EXPECT_FLOAT_EQ(sphere_2.radius, 4.f);
+
+	Sphere sphere_3 = Sphere::FromAABB(AABB(Vec3(-1.f, -2.f, -2.f), Vec3(1.f, 2.f, 2.f)));
+	EXPECT_EQ(sphere_3, Sphere(Vec3::Zero, 3.f));
+
+	std::vector<Vec3> points;
+	for (int i = 0; i < 100; ++i)
+		points.push_back(Vec3(static_cast<float>(Math::Random(-50, 50)), static_cast<float>(Math::Random(-50, 50)), static_cast<float>(Math::Random(-50, 50))));
+
+	Sphere bounding = Sphere::FromPoints(points.data(), points.size());
+	bounding.radius += 0.001f;
+	for (const Vec3& point : points)
+		EXPECT_TRUE(bounding.Contains(point));
+}
+
+/**
+*	\brief Unit test for equality and comparison between Sphere
+*/
+TEST(SphereUnitTest, Equality)
+{
+	Sphere sphere_1(Vec3::One, 2.f);
+	Sphere sphere_2(Vec3::One, 3.f);
+
+	EXPECT_TRUE(sphere_1.Equals(sphere_1));
+	EXPECT_FALSE(sphere_1.Equals(sphere_2));
+	EXPECT_TRUE(sphere_1.Equals(sphere_2, 1.f));
+	EXPECT_TRUE(sphere_1 == sphere_1);
+	EXPECT_FALSE(sphere_1 == sphere_2);
+	EXPECT_TRUE(sphere_1 != sphere_2);
+	EXPECT_FALSE(sphere_1 != sphere_1);
+}
+
+/**
+*	\brief Unit test for Sphere methods
+*/
+TEST(SphereUnitTest, Methods)
+{
+	Sphere sphere(Vec3::Zero, 2.f);
+
+	EXPECT_TRUE(sphere.Contains(Vec3(0.f, 2.f, 0.f)));
+	EXPECT_FALSE(sphere.Contains(Vec3(1.5f, 1.5f, 0.f)));
+
+	EXPECT_TRUE(sphere.Intersects(Sphere(Vec3(3.f, 0.f, 0.f), 1.f)));
+	EXPECT_FALSE(sphere.Intersects(Sphere(Vec3(3.f, 0.f, 0.f), 0.5f)));
+
+	EXPECT_TRUE(sphere.Intersects(AABB(Vec3(1.f, 1.f, -1.f), Vec3(3.f, 3.f, 1.f))));
+	EXPECT_FALSE(sphere.Intersects(AABB(Vec3(1.5f, 1.5f, -1.f), Vec3(3.f, 3.f, 1.f))));
+
+	EXPECT_EQ(sphere.GetAABB(), AABB(Vec3(-2.f), Vec3(2.f)));
+
+	EXPECT_EQ(Sphere::Union(sphere, Sphere(Vec3(0.5f, 0.f, 0.f), 1.f)), sphere);
+	EXPECT_TRUE(Sphere::Union(sphere, Sphere(Vec3(6.f, 0.f, 0.f), 2.f)).Equals(Sphere(Vec3(3.f, 0.f, 0.f), 5.f)));
+
+	Transform transform(Quat(90.f, Vec3::Up), Vec3(0.f, 10.f, 0.f), Vec3(1.f, 3.f, 2.f));
+	Sphere transformed = Sphere(Vec3(1.f, 0.f, 0.f), 1.f).GetTransformed(transform);
+	EXPECT_TRUE(transformed.Equals(Sphere(Vec3(0.f, 10.f, -1.f), 3.f), 0.00001f));
+}
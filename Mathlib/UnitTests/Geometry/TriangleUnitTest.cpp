@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+
+#include <Collections/Mathlib.hpp>
+
+using namespace Mathlib;
+
+/**
+*	\brief Unit test for constructors
+*/
+TEST(TriangleUnitTest, Constructor)
+{
+	Triangle triangle_1;
+	EXPECT_EQ(triangle_1.a, Vec3::Zero);
+	EXPECT_EQ(triangle_1.b, Vec3::Zero);
+	EXPECT_EQ(triangle_1.c, Vec3::Zero);
+
+	Triangle triangle_2(Vec3::Zero, Vec3::Right, Vec3::Up);
+	EXPECT_EQ(triangle_2.a, Vec3::Zero);
+	EXPECT_EQ(triangle_2.b, Vec3::Right);
+	EXPECT_EQ(triangle_2.c, Vec3::Up);
+}
+
+/**
+*	\brief Unit test for equality and comparison between Triangle
+*/
+TEST(TriangleUnitTest, Equality)
+{
+	Triangle triangle_1(Vec3::Zero, Vec3::Right, Vec3::Up);
+	Triangle triangle_2(Vec3::Zero, Vec3::Up, Vec3::Right);
+
+	EXPECT_TRUE(triangle_1.Equals(triangle_1));
+	EXPECT_FALSE(triangle_1.Equals(triangle_2));
+	EXPECT_TRUE(triangle_1 == triangle_1);
+	EXPECT_FALSE(triangle_1 == triangle_2);
+	EXPECT_TRUE(triangle_1 != triangle_2);
+	EXPECT_FALSE(triangle_1 != triangle_1);
+}
+
+/**
+*	\brief Unit test for Triangle accessors and methods
+*/
+TEST(TriangleUnitTest, Methods)
+{
+	Triangle triangle(Vec3::Zero, Vec3(2.f, 0.f, 0.f), Vec3(0.f, 2.f, 0.f));
+
+	EXPECT_EQ(triangle.GetNormal(), Vec3::Forward);
+	EXPECT_FLOAT_EQ(triangle.GetArea(), 2.f);
+	EXPECT_TRUE(triangle.GetCentroid().Equals(Vec3(2.f / 3.f, 2.f / 3.f, 0.f)));
+	EXPECT_EQ(triangle.GetAABB(), AABB(Vec3::Zero, Vec3(2.f, 2.f, 0.f)));
+	EXPECT_TRUE(triangle.GetPlane().Equals(Plane(Vec3::Forward, 0.f)));
+
+	EXPECT_TRUE(triangle.GetBarycentric(Vec3(1.f, 0.5f, 3.f)).Equals(Vec3(0.25f, 0.5f, 0.25f)));
+
+	// Face, vertex and edge regions.
+	EXPECT_EQ(triangle.ClosestPoint(Vec3(0.5f, 0.5f, 4.f)), Vec3(0.5f, 0.5f, 0.f));
+	EXPECT_EQ(triangle.ClosestPoint(Vec3(-1.f, -1.f, 0.f)), Vec3::Zero);
+	EXPECT_EQ(triangle.ClosestPoint(Vec3(3.f, -1.f, 0.f)), Vec3(2.f, 0.f, 0.f));
+	EXPECT_EQ(triangle.ClosestPoint(Vec3(1.f, -1.f, 1.f)), Vec3(1.f, 0.f, 0.f));
+	EXPECT_EQ(triangle.ClosestPoint(Vec3(-1.f, 1.f, 0.f)), Vec3(0.f, 1.f, 0.f));
+	EXPECT_TRUE(triangle.ClosestPoint(Vec3(2.f, 2.f, 0.f)).Equals(Vec3(1.f, 1.f, 0.f)));
+}
@@ -0,0 +1,267 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <Collections/Mathlib.hpp>
+
+using namespace Mathlib;
+
+namespace
+{
+	float RandomFloat(int _min, int _max)
+	{
+		return static_cast<float>(Math::Random(_min * 100, _max * 100)) / 100.f;
+	}
+
+	Mat3 RandomSymmetric(int _range)
+	{
+		float a = RandomFloat(-_range, _range);
+		float b = RandomFloat(-_range, _range);
+		float c = RandomFloat(-_range, _range);
+
+		return Mat3(RandomFloat(-_range, _range), a, b,
+			a, RandomFloat(-_range, _range), c,
+			b, c, RandomFloat(-_range, _range));
+	}
+
+	Mat3 Diagonal(const Vec3& _values)
+	{
+		return Mat3(_values.X, 0.f, 0.f,
+			0.f, _values.Y, 0.f,
+			0.f, 0.f, _values.Z);
+	}
+
+	void CheckEigen(const Mat3& _matrix, const SymmetricEigen& _eigen, float _epsilon)
+	{
+		EXPECT_GE(_eigen.values.X, _eigen.values.Y);
+		EXPECT_GE(_eigen.values.Y, _eigen.values.Z);
+
+		EXPECT_TRUE((_eigen.vectors * _eigen.vectors.GetTranspose()).Equals(Mat3::Identity, 0.0001f));
+		EXPECT_NEAR(_eigen.vectors.Determinant(), 1.f, 0.0001f);
+
+		Mat3 rebuilt = _eigen.vectors * Diagonal(_eigen.values) * _eigen.vectors.GetTranspose();
+		EXPECT_TRUE(rebuilt.Equals(_matrix, _epsilon));
+	}
+
+	Mat3 RandomMatrix(int _range)
+	{
+		return Mat3(RandomFloat(-_range, _range), RandomFloat(-_range, _range), RandomFloat(-_range, _range),
+			RandomFloat(-_range, _range), RandomFloat(-_range, _range), RandomFloat(-_range, _range),
+			RandomFloat(-_range, _range), RandomFloat(-_range, _range), RandomFloat(-_range, _range));
+	}
+
+	void CheckRotation(const Mat3& _rotation)
+	{
+		EXPECT_TRUE((_rotation * _rotation.GetTranspose()).Equals(Mat3::Identity, 0.0001f));
+		EXPECT_NEAR(_rotation.Determinant(), 1.f, 0.0001f);
+	}
+
+	void CheckSVD(const Mat3& _matrix, const SVD& _svd, float _epsilon)
+	{
+		EXPECT_GE(_svd.values.X, Math::Abs(_svd.values.Y));
+		EXPECT_GE(_svd.values.Y, Math::Abs(_svd.values.Z));
+
+		CheckRotation(_svd.u);
+		CheckRotation(_svd.v);
+
+		Mat3 rebuilt = _svd.u * Diagonal(_svd.values) * _svd.v.GetTranspose();
+		EXPECT_TRUE(rebuilt.Equals(_matrix, _epsilon));
+	}
+}
+
+/**
+*	\brief Unit test for symmetric eigen decomposition
+*/
+TEST(DecompositionUnitTest, SymmetricEigen)
+{
+	SymmetricEigen zero = Decomposition::ComputeSymmetricEigen(Mat3::Zero);
+	EXPECT_EQ(zero.values, Vec3::Zero);
+	EXPECT_EQ(zero.vectors, Mat3::Identity);
+
+	SymmetricEigen diagonal = Decomposition::ComputeSymmetricEigen(Diagonal(Vec3(1.f, 3.f, 2.f)));
+	EXPECT_EQ(diagonal.values, Vec3(3.f, 2.f, 1.f));
+	CheckEigen(Diagonal(Vec3(1.f, 3.f, 2.f)), diagonal, 0.00001f);
+
+	// Inertia tensor of a rotated box, eigenvectors are the box axes.
+	Quat rotation(35.f, Vec3(1.f, 2.f, -1.f));
+	Mat3 box_rotation = Mat3::RotationMatrix(rotation);
+	Mat3 inertia = box_rotation * Diagonal(Vec3(5.f, 2.f, 9.f)) * box_rotation.GetTranspose();
+
+	Vec3 values;
+	Quat eigen_rotation;
+	Decomposition::ComputeSymmetricEigen(inertia, values, eigen_rotation);
+	EXPECT_TRUE(values.Equals(Vec3(9.f, 5.f, 2.f), 0.0001f));
+
+	Vec3 largest_axis = eigen_rotation.Rotate(Vec3(1.f, 0.f, 0.f));
+	Vec3 box_z_axis = rotation.Rotate(Vec3(0.f, 0.f, 1.f));
+	EXPECT_NEAR(Math::Abs(Vec3::DotProduct(largest_axis, box_z_axis)), 1.f, 0.0001f);
+
+	// Repeated eigenvalues.
+	Mat3 repeated = box_rotation * Diagonal(Vec3(4.f, 4.f, -1.f)) * box_rotation.GetTranspose();
+	CheckEigen(repeated, Decomposition::ComputeSymmetricEigen(repeated), 0.0001f);
+
+	for (int i = 0; i < 100; ++i)
+	{
+		Mat3 matrix = RandomSymmetric(10);
+		CheckEigen(matrix, Decomposition::ComputeSymmetricEigen(matrix), 0.001f);
+	}
+
+	Mat3 large = RandomSymmetric(10) * 1e12f;
+	SymmetricEigen large_eigen = Decomposition::ComputeSymmetricEigen(large);
+	CheckEigen(large * 1e-12f, SymmetricEigen{ large_eigen.values * 1e-12f, large_eigen.vectors }, 0.001f);
+}
+
+/**
+*	\brief Unit test for batched symmetric eigen decomposition
+*/
+TEST(DecompositionUnitTest, SymmetricEigenBatch)
+{
+	// Blocks of 16 lanes, at least 64 blocks per thread: past 2 * 16 * 64 matrices the threaded batch really splits.
+	const size_t count = 4 * 16 * 64 + 7;
+
+	std::vector<Mat3> matrices(count);
+	for (Mat3& matrix : matrices)
+		matrix = RandomSymmetric(10);
+
+	std::vector<SymmetricEigen> results(count);
+	std::vector<SymmetricEigen> threaded_results(count);
+
+	Decomposition::ComputeSymmetricEigenBatch(matrices.data(), count, results.data());
+	Decomposition::ComputeSymmetricEigenBatch(matrices.data(), count, threaded_results.data(), true);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		SymmetricEigen single = Decomposition::ComputeSymmetricEigen(matrices[i]);
+
+		EXPECT_TRUE(results[i].values.Equals(single.values, 0.00001f));
+		EXPECT_TRUE(results[i].vectors.Equals(single.vectors, 0.00001f));
+		EXPECT_EQ(results[i].values, threaded_results[i].values);
+		EXPECT_EQ(results[i].vectors, threaded_results[i].vectors);
+	}
+}
+
+/**
+*	\brief Unit test for singular value decomposition
+*/
+TEST(DecompositionUnitTest, SVD)
+{
+	SVD zero = Decomposition::ComputeSVD(Mat3::Zero);
+	EXPECT_EQ(zero.values, Vec3::Zero);
+	CheckRotation(zero.u);
+	CheckRotation(zero.v);
+
+	SVD identity = Decomposition::ComputeSVD(Mat3::Identity);
+	EXPECT_TRUE(identity.values.Equals(Vec3::One, 0.00001f));
+	CheckSVD(Mat3::Identity, identity, 0.00001f);
+
+	Mat3 rotation_u = Mat3::RotationMatrix(Quat(40.f, Vec3(1.f, -1.f, 2.f).GetNormalized()));
+	Mat3 rotation_v = Mat3::RotationMatrix(Quat(-75.f, Vec3(0.f, 3.f, 1.f).GetNormalized()));
+	Mat3 matrix = rotation_u * Diagonal(Vec3(2.f, 7.f, 0.5f)) * rotation_v.GetTranspose();
+
+	SVD svd = Decomposition::ComputeSVD(matrix);
+	EXPECT_TRUE(svd.values.Equals(Vec3(7.f, 2.f, 0.5f), 0.0001f));
+	CheckSVD(matrix, svd, 0.0001f);
+
+	// Reflections keep rotation bases, the sign goes to the smallest singular value.
+	Mat3 reflection = rotation_u * Diagonal(Vec3(3.f, -1.f, 2.f)) * rotation_v.GetTranspose();
+	SVD reflection_svd = Decomposition::ComputeSVD(reflection);
+	EXPECT_TRUE(reflection_svd.values.Equals(Vec3(3.f, 2.f, -1.f), 0.0001f));
+	CheckSVD(reflection, reflection_svd, 0.0001f);
+
+	// Rank deficient matrices.
+	Mat3 flat = rotation_u * Diagonal(Vec3(4.f, 0.f, 1.f)) * rotation_v.GetTranspose();
+	SVD flat_svd = Decomposition::ComputeSVD(flat);
+	EXPECT_NEAR(flat_svd.values.Z, 0.f, 0.001f);
+	CheckSVD(flat, flat_svd, 0.0001f);
+
+	Mat3 line = rotation_u * Diagonal(Vec3(0.f, 5.f, 0.f)) * rotation_v.GetTranspose();
+	CheckSVD(line, Decomposition::ComputeSVD(line), 0.0001f);
+
+	for (int i = 0; i < 100; ++i)
+	{
+		Mat3 random = RandomMatrix(10);
+		CheckSVD(random, Decomposition::ComputeSVD(random), 0.001f);
+	}
+
+	// m^T * m of extreme magnitudes would overflow or lose the small singular values without scaling.
+	const Mat3 base(2.f, 0.1f, 0.f, 0.f, 3.f, 0.f, 0.2f, 0.f, 0.5f);
+	const SVD base_svd = Decomposition::ComputeSVD(base);
+	EXPECT_TRUE(base_svd.values.Equals(Vec3(3.f, 2.f, 0.5f), 0.05f));
+	const PolarDecomposition base_polar = Decomposition::ComputePolar(base);
+
+	for (float scale : { 1e-30f, 1e-16f, 1e19f, 1e30f })
+	{
+		SVD scaled_svd = Decomposition::ComputeSVD(base * scale);
+		EXPECT_TRUE((scaled_svd.values / scale).Equals(base_svd.values, 0.0001f));
+		EXPECT_TRUE(scaled_svd.u.Equals(base_svd.u, 0.0001f));
+		EXPECT_TRUE(scaled_svd.v.Equals(base_svd.v, 0.0001f));
+
+		PolarDecomposition scaled_polar = Decomposition::ComputePolar(base * scale);
+		EXPECT_TRUE(scaled_polar.rotation.Equals(base_polar.rotation, 0.0001f));
+		EXPECT_TRUE((scaled_polar.stretch / scale).Equals(base_polar.stretch, 0.0001f));
+	}
+}
+
+/**
+*	\brief Unit test for polar decomposition
+*/
+TEST(DecompositionUnitTest, Polar)
+{
+	PolarDecomposition identity = Decomposition::ComputePolar(Mat3::Identity);
+	EXPECT_TRUE(identity.rotation.Equals(Mat3::Identity, 0.00001f));
+	EXPECT_TRUE(identity.stretch.Equals(Mat3::Identity, 0.00001f));
+
+	// Rotation of a symmetric positive stretch is recovered.
+	Mat3 rotation = Mat3::RotationMatrix(Quat(60.f, Vec3(2.f, 1.f, -1.f).GetNormalized()));
+	Mat3 axes = Mat3::RotationMatrix(Quat(20.f, Vec3(0.f, 1.f, 1.f).GetNormalized()));
+	Mat3 stretch = axes * Diagonal(Vec3(1.5f, 0.5f, 3.f)) * axes.GetTranspose();
+
+	PolarDecomposition polar = Decomposition::ComputePolar(rotation * stretch);
+	EXPECT_TRUE(polar.rotation.Equals(rotation, 0.0001f));
+	EXPECT_TRUE(polar.stretch.Equals(stretch, 0.0001f));
+
+	for (int i = 0; i < 100; ++i)
+	{
+		Mat3 matrix = RandomMatrix(10);
+		PolarDecomposition random = Decomposition::ComputePolar(matrix);
+
+		CheckRotation(random.rotation);
+		EXPECT_TRUE(random.stretch.Equals(random.stretch.GetTranspose(), 0.001f));
+		EXPECT_TRUE((random.rotation * random.stretch).Equals(matrix, 0.001f));
+	}
+}
+
+/**
+*	\brief Unit test for batched singular value and polar decompositions
+*/
+TEST(DecompositionUnitTest, SVDBatch)
+{
+	// Several threads worth of blocks, with a partial last block.
+	const size_t count = 4 * 16 * 64 + 11;
+
+	std::vector<Mat3> matrices(count);
+	for (Mat3& matrix : matrices)
+		matrix = RandomMatrix(10);
+
+	std::vector<SVD> results(count);
+	std::vector<SVD> threaded_results(count);
+	std::vector<PolarDecomposition> polar_results(count);
+
+	Decomposition::ComputeSVDBatch(matrices.data(), count, results.data());
+	Decomposition::ComputeSVDBatch(matrices.data(), count, threaded_results.data(), true);
+	Decomposition::ComputePolarBatch(matrices.data(), count, polar_results.data(), true);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		SVD single = Decomposition::ComputeSVD(matrices[i]);
+		PolarDecomposition polar = Decomposition::ComputePolar(matrices[i]);
+
+		EXPECT_TRUE(results[i].values.Equals(single.values, 0.00001f));
+		EXPECT_TRUE(results[i].u.Equals(single.u, 0.00001f));
+		EXPECT_TRUE(results[i].v.Equals(single.v, 0.00001f));
+		EXPECT_EQ(results[i].values, threaded_results[i].values);
+		EXPECT_EQ(results[i].u, threaded_results[i].u);
+		EXPECT_TRUE(polar_results[i].rotation.Equals(polar.rotation, 0.00001f));
+		EXPECT_TRUE(polar_results[i].stretch.Equals(polar.stretch, 0.0001f));
+	}
+}
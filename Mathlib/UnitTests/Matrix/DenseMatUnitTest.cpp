@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include <Collections/Mathlib.hpp>
+
+using namespace Mathlib;
+
+namespace
+{
+	/**
+	*	\brief Return a matrix filled with deterministic values in [-1, 1].
+	*/
+	template<typename T>
+	DenseMat<T> RandomMatrix(size_t _rows, size_t _columns, uint32_t _seed)
+	{
+		DenseMat<T> result(_rows, _columns);
+		uint32_t state = _seed;
+
+		for (size_t i = 0; i < _rows * _columns; ++i)
+		{
+			state = state * 1664525u + 1013904223u;
+			result.Data()[i] = static_cast<T>(state >> 8) / static_cast<T>(1 << 23) - T(1);
+		}
+
+		return result;
+	}
+
+	/**
+	*	\brief Return _lhs * _rhs computed with the naive triple loop in double.
+	*/
+	template<typename T>
+	DenseMat<T> NaiveProduct(const DenseMat<T>& _lhs, const DenseMat<T>& _rhs)
+	{
+		DenseMat<T> result(_lhs.GetRows(), _rhs.GetColumns());
+
+		for (size_t i = 0; i < _lhs.GetRows(); ++i)
+		{
+			for (size_t j = 0; j < _rhs.GetColumns(); ++j)
+			{
+				double sum = 0.0;
+				for (size_t k = 0; k < _lhs.GetColumns(); ++k)
+					sum += static_cast<double>(_lhs(i, k)) * static_cast<double>(_rhs(k, j));
+
+				result(i, j) = static_cast<T>(sum);
+			}
+		}
+
+		return result;
+	}
+}
+
+/**
+*	\brief Unit test for dense matrix construction and term by term operations
+*/
+TEST(DenseMatUnitTest, Basics)
+{
+	MatXf empty;
+	EXPECT_EQ(empty.GetRows(), 0u);
+	EXPECT_TRUE(empty.IsZero());
+
+	const float values[] = { 1.f, 2.f, 3.f, 4.f, 5.f, 6.f };
+	MatXf mat(2, 3, values);
+	EXPECT_EQ(mat.GetRows(), 2u);
+	EXPECT_EQ(mat.GetColumns(), 3u);
+	EXPECT_EQ(mat(1, 0), 4.f);
+	EXPECT_EQ(reinterpret_cast<uintptr_t>(mat.Data()) % 64, 0u);
+
+	MatXf transpose = mat.GetTranspose();
+	EXPECT_EQ(transpose.GetRows(), 3u);
+	EXPECT_EQ(transpose(2, 1), 6.f);
+	EXPECT_EQ(transpose.GetTranspose(), mat);
+
+	EXPECT_EQ(mat + mat, mat * 2.f);
+	EXPECT_TRUE((mat - mat).IsZero());
+	EXPECT_EQ(-mat, mat * -1.f);
+	EXPECT_EQ((mat * 4.f) / 2.f, mat + mat);
+	EXPECT_TRUE(MatXd::Identity(5).IsIdentity());
+	EXPECT_FALSE(MatXf(2, 3, 1.f).IsIdentity());
+
+	MatXf product = mat * transpose;
+	const float expected[] = { 14.f, 32.f, 32.f, 77.f };
+	EXPECT_EQ(product, MatXf(2, 2, expected));
+	EXPECT_EQ(MatXf::Identity(2) * mat, mat);
+
+	// Mismatching sizes report an error and give an empty product.
+	MatXf wrong = mat * mat;
+	EXPECT_EQ(wrong.GetRows(), 0u);
+
+	mat.Resize(4, 4);
+	EXPECT_TRUE(mat.IsZero());
+}
+
+/**
+*	\brief Unit test for blocked dense matrix products
+*/
+TEST(DenseMatUnitTest, Multiply)
+{
+	const size_t sizes[][3] = { { 1, 1, 1 }, { 3, 5, 2 }, { 17, 33, 19 }, { 70, 300, 45 }, { 129, 64, 130 } };
+
+	for (const auto& size : sizes)
+	{
+		MatXf lhs = RandomMatrix<float>(size[0], size[1], 7u);
+		MatXf rhs = RandomMatrix<float>(size[1], size[2], 11u);
+
+		MatXf result;
+		MatXf::Multiply(lhs, rhs, result);
+		EXPECT_TRUE(result.Equals(NaiveProduct(lhs, rhs), 1e-4f * static_cast<float>(size[1])));
+
+		// Every element is accumulated in the same order whatever the thread split.
+		MatXf threaded;
+		MatXf::Multiply(lhs, rhs, threaded, true);
+		EXPECT_EQ(threaded, result);
+
+		MatXd lhs_double = RandomMatrix<double>(size[0], size[1], 3u);
+		MatXd rhs_double = RandomMatrix<double>(size[1], size[2], 5u);
+
+		MatXd result_double;
+		MatXd::Multiply(lhs_double, rhs_double, result_double, true);
+		EXPECT_TRUE(result_double.Equals(NaiveProduct(lhs_double, rhs_double), 1e-12));
+	}
+
+	MatXd large = RandomMatrix<double>(300, 280, 13u);
+	std::vector<double> vector(280);
+	for (size_t i = 0; i < vector.size(); ++i)
+		vector[i] = std::sin(static_cast<double>(i));
+
+	std::vector<double> result(300);
+	MatXd::Multiply(large, vector.data(), result.data(), true);
+
+	MatXd column(280, 1, vector.data());
+	MatXd expected = NaiveProduct(large, column);
+	for (size_t i = 0; i < result.size(); ++i)
+		EXPECT_NEAR(result[i], expected(i, 0), 1e-12);
+}
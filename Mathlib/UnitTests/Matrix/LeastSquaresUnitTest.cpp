@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include <Collections/Mathlib.hpp>
+
+using namespace Mathlib;
+
+namespace
+{
+	/**
+	*	\brief Return a deterministic value in [-1, 1].
+	*/
+	double Random(uint32_t& _state)
+	{
+		_state = _state * 1664525u + 1013904223u;
+		return static_cast<double>(_state >> 8) / static_cast<double>(1 << 23) - 1.0;
+	}
+
+	DenseMat<double> RandomMat(size_t _rows, size_t _columns, uint32_t& _state)
+	{
+		DenseMat<double> result(_rows, _columns);
+
+		for (size_t i = 0; i < _rows * _columns; ++i)
+			result.Data()[i] = Random(_state);
+
+		return result;
+	}
+}
+
+/**
+*	\brief Unit test for Householder QR factorization
+*/
+TEST(LeastSquaresUnitTest, QR)
+{
+	uint32_t state = 5u;
+	const DenseMat<double> matrix = RandomMat(40, 6, state);
+
+	const QRDecomposition<double> qr = Decomposition::ComputeQR(matrix);
+	ASSERT_EQ(qr.q.GetRows(), 40u);
+	ASSERT_EQ(qr.q.GetColumns(), 6u);
+	ASSERT_EQ(qr.r.GetRows(), 6u);
+
+	EXPECT_TRUE((qr.q.GetTranspose() * qr.q).Equals(DenseMat<double>::Identity(6), 1e-12));
+	EXPECT_TRUE((qr.q * qr.r).Equals(matrix, 1e-12));
+
+	for (size_t i = 0; i < 6; ++i)
+	{
+		for (size_t j = 0; j < i; ++j)
+			EXPECT_EQ(qr.r(i, j), 0.0);
+	}
+
+	const QRDecomposition<float> qrf = Decomposition::ComputeQR(DenseMat<float>(3, 2, 1.f));
+	EXPECT_TRUE((qrf.q * qrf.r).Equals(DenseMat<float>(3, 2, 1.f), 1e-6f));
+	EXPECT_NEAR(std::abs(qrf.r(1, 1)), 0.f, 1e-6f);
+
+	EXPECT_EQ(Decomposition::ComputeQR(DenseMat<double>(2, 3)).q.GetRows(), 0u);
+}
+
+/**
+*	\brief Unit test for dense least squares solve
+*/
+TEST(LeastSquaresUnitTest, Dense)
+{
+	uint32_t state = 11u;
+	const DenseMat<double> matrix = RandomMat(50, 4, state);
+	const double expected[4] = { 1.0, -2.0, 0.5, 3.0 };
+
+	std::vector<double> rhs(50);
+	DenseMat<double>::Multiply(matrix, expected, rhs.data());
+
+	double result[4];
+	EXPECT_TRUE(Solver::SolveLeastSquares(matrix, rhs.data(), result));
+
+	for (size_t i = 0; i < 4; ++i)
+		EXPECT_NEAR(result[i], expected[i], 1e-12);
+
+	// Mean of values is the least squares solution of a column of ones.
+	const float values[4] = { 1.f, 2.f, 4.f, 9.f };
+	float mean = 0.f;
+	EXPECT_TRUE(Solver::SolveLeastSquares(DenseMat<float>(4, 1, 1.f), values, &mean));
+	EXPECT_FLOAT_EQ(mean, 4.f);
+
+	// Rank deficient and underdetermined.
+	DenseMat<double> deficient = matrix;
+	for (size_t i = 0; i < 50; ++i)
+		deficient(i, 3) = deficient(i, 1) * 2.0;
+
+	EXPECT_FALSE(Solver::SolveLeastSquares(deficient, rhs.data(), result));
+	EXPECT_EQ(result[0], 0.0);
+	EXPECT_FALSE(Solver::SolveLeastSquares(DenseMat<double>(2, 3, 1.0), rhs.data(), result));
+}
+
+/**
+*	\brief Unit test for least squares accumulated row by row
+*/
+TEST(LeastSquaresUnitTest, Streaming)
+{
+	uint32_t state = 23u;
+	const DenseMat<double> matrix = RandomMat(200, 5, state);
+
+	std::vector<double> rhs(200);
+	for (double& value : rhs)
+		value = Random(state);
+
+	double dense[5];
+	EXPECT_TRUE(Solver::SolveLeastSquares(matrix, rhs.data(), dense));
+
+	StreamingLeastSquares full(5), first(5), second(5);
+	for (size_t i = 0; i < 200; ++i)
+	{
+		full.AddRow(matrix.Data() + i * 5, rhs[i]);
+		(i < 120 ? first : second).AddRow(matrix.Data() + i * 5, rhs[i]);
+	}
+
+	first.Merge(second);
+	EXPECT_EQ(first.GetRowCount(), 200u);
+
+	double streamed[5], merged[5];
+	EXPECT_TRUE(full.Solve(streamed));
+	EXPECT_TRUE(first.Solve(merged));
+
+	std::vector<double> fitted(200);
+	DenseMat<double>::Multiply(matrix, dense, fitted.data());
+
+	double squared_residual = 0.0;
+	for (size_t i = 0; i < 200; ++i)
+		squared_residual += (fitted[i] - rhs[i]) * (fitted[i] - rhs[i]);
+
+	for (size_t i = 0; i < 5; ++i)
+	{
+		EXPECT_NEAR(streamed[i], dense[i], 1e-12);
+		EXPECT_NEAR(merged[i], dense[i], 1e-12);
+	}
+
+	EXPECT_NEAR(full.GetSquaredResidual(), squared_residual, 1e-10);
+	EXPECT_NEAR(first.GetSquaredResidual(), squared_residual, 1e-10);
+
+	// A weight of 2 is the same row added twice.
+	StreamingLeastSquares weighted(2), repeated(2);
+	const double rows[3][2] = { { 1.0, 0.0 }, { 1.0, 1.0 }, { 1.0, 2.0 } };
+	const double values[3] = { 0.0, 2.0, 1.0 };
+
+	for (size_t i = 0; i < 3; ++i)
+	{
+		weighted.AddRow(rows[i], values[i], i == 1 ? 2.0 : 1.0);
+		repeated.AddRow(rows[i], values[i]);
+		if (i == 1)
+			repeated.AddRow(rows[i], values[i]);
+	}
+
+	double weighted_result[2], repeated_result[2];
+	EXPECT_TRUE(weighted.Solve(weighted_result));
+	EXPECT_TRUE(repeated.Solve(repeated_result));
+	EXPECT_NEAR(weighted_result[0], repeated_result[0], 1e-14);
+	EXPECT_NEAR(weighted_result[1], repeated_result[1], 1e-14);
+	EXPECT_NEAR(weighted.GetSquaredResidual(), repeated.GetSquaredResidual(), 1e-14);
+
+	weighted.Clear();
+	EXPECT_EQ(weighted.GetRowCount(), 0u);
+	EXPECT_FALSE(weighted.Solve(weighted_result));
+}
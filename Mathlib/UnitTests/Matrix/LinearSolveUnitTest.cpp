@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <Collections/Mathlib.hpp>
+
+using namespace Mathlib;
+
+namespace
+{
+	using Mat6 = Mat<float, 6, 6>;
+	using Vec6 = Vec<float, 6>;
+
+	/**
+	*	\brief Return a deterministic value in [-1, 1].
+	*/
+	float Random(uint32_t& _state)
+	{
+		_state = _state * 1664525u + 1013904223u;
+		return static_cast<float>(_state >> 8) / static_cast<float>(1 << 23) - 1.f;
+	}
+
+	Mat4 RandomMat4(uint32_t& _state)
+	{
+		Mat4 result;
+		float* components = const_cast<float*>(result.Data());
+
+		for (size_t i = 0; i < 16; ++i)
+			components[i] = Random(_state);
+
+		return result;
+	}
+}
+
+/**
+*	\brief Unit test for single small system solves
+*/
+TEST(LinearSolveUnitTest, Single)
+{
+	Vec2 result2;
+	EXPECT_TRUE(Solver::SolveLU(Mat2(0.f, 2.f, 3.f, 0.f), Vec2(4.f, 9.f), result2));
+	EXPECT_EQ(result2, Vec2(3.f, 2.f));
+
+	const Mat3 matrix(2.f, -1.f, 0.f, -1.f, 2.f, -1.f, 0.f, -1.f, 2.f);
+	const Vec3 rhs(1.f, 0.f, 1.f);
+
+	Vec3 lu, cholesky;
+	EXPECT_TRUE(Solver::SolveLU(matrix, rhs, lu));
+	EXPECT_TRUE(Solver::SolveCholesky(matrix, rhs, cholesky));
+	EXPECT_TRUE(lu.Equals(Vec3(1.f, 1.f, 1.f), 1e-6f));
+	EXPECT_TRUE(cholesky.Equals(Vec3(1.f, 1.f, 1.f), 1e-6f));
+
+	// Singular and indefinite systems are reported and give 0.
+	Vec3 singular(5.f);
+	EXPECT_FALSE(Solver::SolveLU(Mat3(1.f, 2.f, 3.f, 2.f, 4.f, 6.f, 0.f, 1.f, 1.f), rhs, singular));
+	EXPECT_EQ(singular, Vec3(0.f, 0.f, 0.f));
+	EXPECT_FALSE(Solver::SolveLU(Mat3(0.f), rhs, singular));
+	EXPECT_FALSE(Solver::SolveCholesky(Mat3(1.f, 0.f, 0.f, 0.f, -1.f, 0.f, 0.f, 0.f, 1.f), rhs, singular));
+	EXPECT_TRUE(Solver::SolveLU(Mat3(1.f, 0.f, 0.f, 0.f, -1.f, 0.f, 0.f, 0.f, 1.f), rhs, singular));
+
+	uint32_t state = 3u;
+	Mat4 random = RandomMat4(state);
+	Vec4 rhs4(1.f, -2.f, 0.5f, 3.f);
+	Vec4 result4;
+	EXPECT_TRUE(Solver::SolveLU(random, rhs4, result4));
+	EXPECT_TRUE((random * result4).Equals(rhs4, 1e-4f));
+
+	// Generic sizes, symmetric positive definite A^T A + I.
+	Mat6 a;
+	for (float& value : a.values)
+		value = Random(state);
+
+	Mat6 spd = a.GetTranspose() * a + Mat6::Identity();
+	Vec6 rhs6(1.f, 2.f, 3.f, 4.f, 5.f, 6.f);
+
+	Vec6 lu6, cholesky6;
+	EXPECT_TRUE(Solver::SolveLU(spd, rhs6, lu6));
+	EXPECT_TRUE(Solver::SolveCholesky(spd, rhs6, cholesky6));
+	EXPECT_TRUE((spd * lu6).Equals(rhs6, 1e-4f));
+	EXPECT_TRUE(lu6.Equals(cholesky6, 1e-4f));
+}
+
+/**
+*	\brief Unit test for batched small system solves
+*/
+TEST(LinearSolveUnitTest, Batch)
+{
+	// 16 systems per block and 64 blocks per thread at least: above 2048 systems the threaded solves really split.
+	const size_t count = 4 * 16 * 64 + 1;
+	uint32_t state = 17u;
+
+	std::vector<Mat4> matrices(count);
+	std::vector<Mat4> spd(count);
+	std::vector<Vec4> rhs(count);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		matrices[i] = RandomMat4(state);
+		spd[i] = matrices[i].GetTranspose() * matrices[i] + Mat4::Identity;
+		rhs[i] = Vec4(Random(state), Random(state), Random(state), Random(state));
+	}
+
+	// A singular system in the middle of a block.
+	matrices[37] = Mat4(1.f);
+
+	std::vector<Vec4> results(count);
+	std::vector<Vec4> threaded(count);
+	std::unique_ptr<bool[]> solved(new bool[count]);
+
+	Solver::SolveLUBatch(matrices.data(), rhs.data(), count, results.data(), solved.get());
+	Solver::SolveLUBatch(matrices.data(), rhs.data(), count, threaded.data(), nullptr, true);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		Vec4 single;
+		EXPECT_EQ(Solver::SolveLU(matrices[i], rhs[i], single), solved[i]);
+		EXPECT_TRUE(results[i].Equals(single, 1e-5f * (1.f + single.Length())));
+		EXPECT_EQ(threaded[i], results[i]);
+	}
+
+	EXPECT_FALSE(solved[37]);
+	EXPECT_EQ(results[37], Vec4(0.f, 0.f, 0.f, 0.f));
+	EXPECT_TRUE(solved[36]);
+
+	Solver::SolveCholeskyBatch(spd.data(), rhs.data(), count, results.data(), solved.get(), true);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		EXPECT_TRUE(solved[i]);
+		EXPECT_TRUE((spd[i] * results[i]).Equals(rhs[i], 1e-4f));
+	}
+
+	std::vector<Mat6> generic(40, Mat6::Identity() * 2.f);
+	std::vector<Vec6> generic_rhs(40, Vec6(2.f));
+	std::vector<Vec6> generic_results(40);
+	Solver::SolveCholeskyBatch(generic.data(), generic_rhs.data(), 40, generic_results.data());
+	EXPECT_TRUE(generic_results[39].Equals(Vec6(1.f), 1e-6f));
+}
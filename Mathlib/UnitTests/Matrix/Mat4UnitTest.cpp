@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <memory>
+#include <vector>
+
 #include <Collections/Mathlib.hpp>
 
 using namespace Mathlib;
@@ -273,6 +276,81 @@ TEST(Mat4UnitTest, Inverse)
 	EXPECT_TRUE(Mat4::Identity.Equals(mat_1 * tmp, 0.0001f));
 }
 
+/**
+*	\brief Unit test for batched inverse of general, affine and rigid matrices
+*/
+TEST(Mat4UnitTest, Inverse_batch)
+{
+	// Threads get at least 64 blocks of 16 matrices, so the threaded inverses only split above 2048 matrices.
+	const size_t count = 4 * 16 * 64 + 3;
+
+	std::vector<Mat4> general(count);
+	std::vector<Mat4> affine(count);
+	std::vector<Mat4> rigid(count);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		const float t = static_cast<float>(i);
+		const Mat4 rotation = Mat4::RotationMatrix(Quat(t * 7.f, Vec3(1.f, t, 2.f).Normalize()));
+		const Mat4 translation = Mat4::TranslationMatrix(Vec3(t, -2.f * t, 0.5f));
+
+		general[i] = Mat4(6.f, 1.f, 1.f, 5.8f,
+			4.f, -2.f, 5.f, 5.2f,
+			2.f, 8.f, 7.f, 9.3f,
+			9.4f, 3.5f, 8.2f, 6.7f) + Mat4::Identity * (0.01f * t);
+		affine[i] = translation * rotation * Mat4::ScaleMatrix(Vec3(1.f + 0.001f * t, 2.f, 0.5f));
+		rigid[i] = translation * rotation;
+	}
+
+	// Singular matrices in the middle of a block and as last matrix.
+	general[37] = Mat4::Zero;
+	affine[37] = Mat4::ScaleMatrix(Vec3(1.f, 0.f, 1.f));
+	general[count - 1] = Mat4(1.f);
+
+	std::vector<Mat4> result(count);
+	std::vector<Mat4> threaded(count);
+	std::unique_ptr<bool[]> invertible(new bool[count]);
+
+	Mat4::InverseBatch(general.data(), count, result.data(), invertible.get());
+	Mat4::InverseBatch(general.data(), count, threaded.data(), nullptr, true);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		EXPECT_EQ(invertible[i], general[i].Determinant() != 0.f);
+		EXPECT_EQ(result[i], threaded[i]);
+
+		if (invertible[i])
+			EXPECT_TRUE(Mat4::Identity.Equals(general[i] * result[i], 1e-3f));
+		else
+			EXPECT_EQ(result[i], general[i]);
+	}
+
+	EXPECT_FALSE(invertible[37]);
+	EXPECT_FALSE(invertible[count - 1]);
+	EXPECT_TRUE(result[0].Equals(general[0].GetInverse(), 1e-4f));
+
+	Mat4::InverseAffineBatch(affine.data(), count, result.data(), invertible.get(), true);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		if (i == 37)
+			continue;
+
+		EXPECT_TRUE(invertible[i]);
+		EXPECT_TRUE(Mat4::Identity.Equals(result[i] * affine[i], 1e-3f));
+	}
+
+	EXPECT_FALSE(invertible[37]);
+	EXPECT_EQ(result[37], affine[37]);
+
+	// In place.
+	std::vector<Mat4> inverted = rigid;
+	Mat4::InverseRigidBatch(inverted.data(), count, inverted.data());
+
+	for (size_t i = 0; i < count; ++i)
+		EXPECT_TRUE(Mat4::Identity.Equals(inverted[i] * rigid[i], 1e-3f));
+}
+
 /**
 *	\brief Unit test matrix mat4 & scalar operators
 */
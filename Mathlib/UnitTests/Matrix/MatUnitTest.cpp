@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+
+#include <Collections/Mathlib.hpp>
+
+using namespace Mathlib;
+
+/**
+*	\brief Unit test for generic matrix constructors and conversions
+*/
+TEST(MatUnitTest, Constructors)
+{
+	Mat<float, 2, 3> zero;
+	for (size_t i = 0; i < 6; ++i)
+		EXPECT_EQ(zero.Data()[i], 0.f);
+
+	Mat<double, 2, 3> values(1.0, 2.0, 3.0,
+		4.0, 5.0, 6.0);
+	EXPECT_EQ(values(1, 0), 4.0);
+	EXPECT_EQ(values(0, 2), 3.0);
+	EXPECT_EQ(values.GetRow(1), (Vec<double, 3>(4.0, 5.0, 6.0)));
+	EXPECT_EQ(values.GetColumn(2), (Vec<double, 2>(3.0, 6.0)));
+
+	EXPECT_EQ((Mat<float, 3, 3>::Identity()), (Mat<float, 3, 3>(Mat3::Identity)));
+	EXPECT_EQ(static_cast<Mat4>(Mat<double, 4, 4>::Identity()), Mat4::Identity);
+
+	Mat3 mat3(1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 10.f);
+	Mat<double, 3, 3> from_mat3(mat3);
+	EXPECT_EQ(from_mat3(2, 2), 10.0);
+	EXPECT_EQ(static_cast<Mat3>(from_mat3), mat3);
+	EXPECT_EQ((Mat<int, 3, 3>(from_mat3))(1, 2), 6);
+}
+
+/**
+*	\brief Unit test for generic matrix methods and operators
+*/
+TEST(MatUnitTest, Operations)
+{
+	Mat4 mat4(1.f, 2.f, 0.f, 1.f,
+		0.f, 3.f, 1.f, 2.f,
+		4.f, 0.f, 1.f, 0.f,
+		2.f, 1.f, 0.f, 5.f);
+	Mat<float, 4, 4> generic(mat4);
+
+	// Same results as the hand written float types.
+	EXPECT_FLOAT_EQ(generic.Determinant(), mat4.Determinant());
+	EXPECT_EQ(static_cast<Mat4>(generic.GetTranspose()), mat4.GetTranspose());
+	EXPECT_EQ(static_cast<Mat4>(generic * generic), mat4 * mat4);
+	EXPECT_EQ(static_cast<Vec4>(generic * Vec<float, 4>(1.f, -1.f, 2.f, 0.5f)), mat4 * Vec4(1.f, -1.f, 2.f, 0.5f));
+
+	Mat3 mat3(2.f, 1.f, 0.f, -1.f, 3.f, 2.f, 0.f, 1.f, 4.f);
+	EXPECT_FLOAT_EQ((Mat<float, 3, 3>(mat3)).Determinant(), mat3.Determinant());
+
+	// Non square products.
+	Mat<int, 2, 3> lhs(1, 2, 3,
+		4, 5, 6);
+	Mat<int, 3, 2> rhs(7, 8,
+		9, 10,
+		11, 12);
+	EXPECT_EQ(lhs * rhs, (Mat<int, 2, 2>(58, 64, 139, 154)));
+	EXPECT_EQ(lhs.GetTranspose(), (Mat<int, 3, 2>(1, 4, 2, 5, 3, 6)));
+	EXPECT_EQ((lhs * Vec<int, 3>(1, 0, -1)), (Vec<int, 2>(-2, -2)));
+	EXPECT_EQ(lhs.GetMinor(0, 1), (Mat<int, 1, 2>(4, 6)));
+
+	EXPECT_EQ(lhs + lhs, lhs * 2);
+	EXPECT_EQ(lhs - lhs, (Mat<int, 2, 3>()));
+	EXPECT_EQ(-lhs, lhs * -1);
+	EXPECT_EQ((lhs * 4) / 2, lhs * 2);
+	EXPECT_TRUE((Mat<float, 2, 2>(1.f, 2.f, 3.f, 4.f)).Equals(Mat<float, 2, 2>(1.f, 2.f, 3.f, 4.0001f), 0.001f));
+
+	EXPECT_EQ((Mat<int, 2, 2>(1, 2, 3, 4)).ToString(), "1, 2\n3, 4");
+}
@@ -0,0 +1,195 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include <Collections/Mathlib.hpp>
+
+using namespace Mathlib;
+
+namespace
+{
+	/**
+	*	\brief Return the 5 points laplacian of a _size x _size grid plus _shift on the diagonal, symmetric positive definite.
+	*/
+	template<typename T>
+	SparseMat<T> Laplacian(size_t _size, T _shift)
+	{
+		std::vector<SparseEntry<T>> entries;
+
+		for (size_t y = 0; y < _size; ++y)
+		{
+			for (size_t x = 0; x < _size; ++x)
+			{
+				const size_t i = y * _size + x;
+				entries.push_back({ i, i, T(4) + _shift });
+
+				if (x > 0)
+					entries.push_back({ i, i - 1, T(-1) });
+				if (x + 1 < _size)
+					entries.push_back({ i, i + 1, T(-1) });
+				if (y > 0)
+					entries.push_back({ i, i - _size, T(-1) });
+				if (y + 1 < _size)
+					entries.push_back({ i, i + _size, T(-1) });
+			}
+		}
+
+		return SparseMat<T>(_size * _size, _size * _size, entries.data(), entries.size());
+	}
+
+	/**
+	*	\brief Return the stiffness matrix of a chain of springs plus a mass term, symmetric positive definite.
+	*	Masses cycle between _mass and 401 * _mass.
+	*/
+	BlockSparseMat3 SpringChain(const std::vector<Vec3>& _positions, float _stiffness, float _mass)
+	{
+		std::vector<BlockSparseEntry3> entries;
+
+		for (size_t i = 0; i < _positions.size(); ++i)
+			entries.push_back({ i, i, Mat3::Identity * (_mass * static_cast<float>(1 + 100 * (i % 5))) });
+
+		for (size_t i = 0; i + 1 < _positions.size(); ++i)
+		{
+			const Vec3 d = (_positions[i + 1] - _positions[i]).GetNormalized();
+			const Mat3 block = Mat3(d * d.X, d * d.Y, d * d.Z) * _stiffness;
+
+			entries.push_back({ i, i, block });
+			entries.push_back({ i + 1, i + 1, block });
+			entries.push_back({ i, i + 1, block * -1.f });
+			entries.push_back({ i + 1, i, block * -1.f });
+		}
+
+		return BlockSparseMat3(_positions.size(), _positions.size(), entries.data(), entries.size());
+	}
+}
+
+/**
+*	\brief Unit test for compressed sparse rows construction and products
+*/
+TEST(SparseMatUnitTest, SparseMat)
+{
+	const SparseEntry<float> entries[] = { { 1, 2, 3.f }, { 0, 0, 1.f }, { 1, 0, -2.f }, { 1, 2, 1.f }, { 2, 1, 5.f }, { 3, 0, 9.f } };
+	SparseMatf mat(3, 3, entries, 6);
+
+	EXPECT_EQ(mat.GetRows(), 3u);
+	EXPECT_EQ(mat.GetNonZeroCount(), 4u);
+	EXPECT_EQ(mat.Get(1, 2), 4.f);
+	EXPECT_EQ(mat.Get(1, 0), -2.f);
+	EXPECT_EQ(mat.Get(2, 2), 0.f);
+	EXPECT_EQ(mat.GetColumnIndices()[1], 0u);
+	EXPECT_EQ(mat.GetRowStarts()[3], 4u);
+
+	const float dense_values[] = { 1.f, 0.f, 0.f, -2.f, 0.f, 4.f, 0.f, 5.f, 0.f };
+	EXPECT_EQ(mat.ToDense(), MatXf(3, 3, dense_values));
+	EXPECT_EQ(SparseMatf::FromDense(mat.ToDense()).GetNonZeroCount(), 4u);
+
+	const float vector[] = { 1.f, 2.f, 3.f };
+	float result[3];
+	SparseMatf::Multiply(mat, vector, result);
+	EXPECT_EQ(result[0], 1.f);
+	EXPECT_EQ(result[1], 10.f);
+	EXPECT_EQ(result[2], 10.f);
+
+	SparseMatd laplacian = Laplacian<double>(40, 0.0);
+	std::vector<double> input(1600), output(1600), threaded(1600), expected(1600);
+	for (size_t i = 0; i < input.size(); ++i)
+		input[i] = std::sin(static_cast<double>(i));
+
+	SparseMatd::Multiply(laplacian, input.data(), output.data());
+	SparseMatd::Multiply(laplacian, input.data(), threaded.data(), true);
+	MatXd::Multiply(laplacian.ToDense(), input.data(), expected.data());
+
+	for (size_t i = 0; i < input.size(); ++i)
+	{
+		EXPECT_NEAR(output[i], expected[i], 1e-12);
+		EXPECT_EQ(threaded[i], output[i]);
+	}
+}
+
+/**
+*	\brief Unit test for block sparse matrices
+*/
+TEST(SparseMatUnitTest, BlockSparseMat3)
+{
+	const Mat3 block(1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f);
+	const BlockSparseEntry3 entries[] = { { 0, 1, block }, { 1, 1, Mat3::Identity }, { 0, 1, Mat3::Identity } };
+	BlockSparseMat3 mat(2, 2, entries, 3);
+
+	EXPECT_EQ(mat.GetNonZeroCount(), 2u);
+	EXPECT_EQ(mat.Get(0, 1), block + Mat3::Identity);
+	EXPECT_EQ(mat.Get(0, 0), Mat3::Zero);
+
+	const Vec3 vector[] = { Vec3(1.f, 1.f, 1.f), Vec3(1.f, 0.f, -1.f) };
+	Vec3 result[2];
+	BlockSparseMat3::Multiply(mat, vector, result);
+	EXPECT_EQ(result[0], (block + Mat3::Identity) * vector[1]);
+	EXPECT_EQ(result[1], vector[1]);
+}
+
+/**
+*	\brief Unit test for the preconditioned conjugate gradient solvers
+*/
+TEST(SparseMatUnitTest, ConjugateGradient)
+{
+	SparseMatd laplacian = Laplacian<double>(30, 0.01);
+	std::vector<double> rhs(900), solution(900, 0.0), check(900);
+	for (size_t i = 0; i < rhs.size(); ++i)
+		rhs[i] = std::cos(static_cast<double>(i) * 0.1);
+
+	ConjugateGradientSettings settings;
+	settings.tolerance = 1e-10;
+	settings.maxIterations = 500;
+
+	ConjugateGradientResult result = Solver::ConjugateGradient(laplacian, rhs.data(), solution.data(), settings);
+	EXPECT_TRUE(result.converged);
+	EXPECT_LE(result.residual, 1e-10);
+
+	SparseMatd::Multiply(laplacian, solution.data(), check.data());
+	for (size_t i = 0; i < rhs.size(); ++i)
+		EXPECT_NEAR(check[i], rhs[i], 1e-8);
+
+	// Results do not depend on threads.
+	std::vector<double> threaded(900, 0.0);
+	settings.multithreaded = true;
+	ConjugateGradientResult threaded_result = Solver::ConjugateGradient(laplacian, rhs.data(), threaded.data(), settings);
+	EXPECT_EQ(threaded_result.iterations, result.iterations);
+	EXPECT_EQ(threaded, solution);
+
+	// Float systems and a zero right hand side.
+	SparseMatf laplacian_float = Laplacian<float>(10, 0.5f);
+	std::vector<float> rhs_float(100, 1.f), solution_float(100, 0.f);
+	EXPECT_TRUE(Solver::ConjugateGradient(laplacian_float, rhs_float.data(), solution_float.data()).converged);
+
+	std::vector<float> zero(100, 0.f), guess(100, 3.f);
+	EXPECT_TRUE(Solver::ConjugateGradient(laplacian_float, zero.data(), guess.data()).converged);
+	EXPECT_EQ(guess[50], 0.f);
+
+	// Block system of a spring chain.
+	std::vector<Vec3> positions(200);
+	for (size_t i = 0; i < positions.size(); ++i)
+		positions[i] = Vec3(static_cast<float>(i), std::sin(static_cast<float>(i) * 0.5f), 0.1f * static_cast<float>(i % 3));
+
+	BlockSparseMat3 chain = SpringChain(positions, 100.f, 1.f);
+	std::vector<Vec3> forces(200), velocities(200), block_check(200);
+	for (size_t i = 0; i < forces.size(); ++i)
+		forces[i] = Vec3(0.f, -9.81f, std::cos(static_cast<float>(i)));
+
+	ConjugateGradientSettings block_settings;
+	block_settings.tolerance = 1e-5;
+	block_settings.maxIterations = 1000;
+
+	ConjugateGradientResult block_result = Solver::ConjugateGradient(chain, forces.data(), velocities.data(), block_settings);
+	EXPECT_TRUE(block_result.converged);
+
+	BlockSparseMat3::Multiply(chain, velocities.data(), block_check.data());
+	for (size_t i = 0; i < forces.size(); ++i)
+		EXPECT_TRUE(block_check[i].Equals(forces[i], 1e-3f));
+
+	// Block Jacobi preconditioning needs fewer iterations with uneven masses.
+	std::vector<Vec3> plain(200);
+	block_settings.preconditioned = false;
+	ConjugateGradientResult plain_result = Solver::ConjugateGradient(chain, forces.data(), plain.data(), block_settings);
+	EXPECT_TRUE(plain_result.converged);
+	EXPECT_LT(block_result.iterations, plain_result.iterations);
+}
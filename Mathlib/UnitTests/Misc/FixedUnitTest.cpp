@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#include <Collections/Mathlib.hpp>
+
+using namespace Mathlib;
+
+/**
+*	\brief Unit test for fixed point arithmetic
+*/
+TEST(FixedUnitTest, Arithmetic)
+{
+	EXPECT_EQ(Q16_16(1).raw, 65536);
+	EXPECT_EQ(Q16_16(-2.5f).raw, -163840);
+	EXPECT_EQ(Q32_32(1).raw, int64_t(1) << 32);
+	EXPECT_EQ(Q16_16(0.75).ToFloat(), 0.75f);
+	EXPECT_EQ(Q16_16(-2.25).ToInt(), -3);
+	EXPECT_EQ(Q16_16::Floor(Q16_16(-2.25)), Q16_16(-3));
+	EXPECT_EQ(Q32_32::Floor(Q32_32(7.5)), Q32_32(7));
+
+	EXPECT_EQ(Q16_16(1.5) + Q16_16(2.25), Q16_16(3.75));
+	EXPECT_EQ(Q16_16(1.5) - Q16_16(2.25), Q16_16(-0.75));
+	EXPECT_EQ(Q16_16(1.5) * Q16_16(-2.25), Q16_16(-3.375));
+	EXPECT_EQ(Q16_16(-3.375) / Q16_16(1.5), Q16_16(-2.25));
+	EXPECT_EQ(Q32_32(1.5) * Q32_32(-2.25), Q32_32(-3.375));
+	EXPECT_EQ(Q32_32(-3.375) / Q32_32(1.5), Q32_32(-2.25));
+	EXPECT_EQ(Q32_32(30000) * Q32_32(60000), Q32_32(1800000000));
+	EXPECT_EQ(Q32_32(1800000000) / Q32_32(-60000), Q32_32(-30000));
+	EXPECT_EQ(Q16_16(1) / Q16_16(0), Q16_16(0));
+
+	// Products round to nearest, divisions truncate toward 0.
+	EXPECT_EQ(Q16_16::FromRaw(3) * Q16_16(0.5), Q16_16::FromRaw(2));
+	EXPECT_EQ(Q16_16(1) / Q16_16(3), Q16_16::FromRaw(21845));
+	EXPECT_EQ(Q16_16(-1) / Q16_16(3), Q16_16::FromRaw(-21845));
+
+	for (int i = -500; i <= 500; ++i)
+	{
+		double lhs = i * 0.37;
+		double rhs = i * -0.011 + 0.5;
+
+		EXPECT_NEAR((Q32_32(lhs) * Q32_32(rhs)).ToDouble(), lhs * rhs, 1e-7);
+		EXPECT_NEAR((Q32_32(lhs) / Q32_32(rhs)).ToDouble(), lhs / rhs, std::abs(lhs / rhs) * 1e-7 + 1e-9);
+		EXPECT_NEAR((Q16_16(lhs) * Q16_16(rhs)).ToDouble(), lhs * rhs, 0.01);
+	}
+}
+
+/**
+*	\brief Unit test for fixed point square root and trigonometry
+*/
+TEST(FixedUnitTest, Functions)
+{
+	EXPECT_EQ(Q16_16::Sqrt(Q16_16(4)), Q16_16(2));
+	EXPECT_EQ(Q16_16::Sqrt(Q16_16(0)), Q16_16(0));
+	EXPECT_EQ(Q16_16::Sqrt(Q16_16(-1)), Q16_16(0));
+	EXPECT_EQ(Q32_32::Sqrt(Q32_32(2.25)), Q32_32(1.5));
+	EXPECT_EQ(Q32_32::Sqrt(Q32_32(1000000)), Q32_32(1000));
+
+	for (int i = 0; i < 1000; ++i)
+	{
+		double value = i * 31.7 + 0.001;
+		EXPECT_NEAR(Q16_16::Sqrt(Q16_16(value)).ToDouble(), std::sqrt(Q16_16(value).ToDouble()), 1.0 / 65536.0);
+		EXPECT_NEAR(Q32_32::Sqrt(Q32_32(value)).ToDouble(), std::sqrt(Q32_32(value).ToDouble()), 1e-9);
+	}
+
+	// Sqrt is correctly rounded: compare with the nearest raw value of a long double root, including the top of the range.
+	const int32_t raws16[] = { 1, 2, 3, 65535, 65537, 1909855415, 2147483646, 2147483647 };
+	for (int32_t raw : raws16)
+		EXPECT_EQ(Q16_16::Sqrt(Q16_16::FromRaw(raw)).raw, std::llround(std::sqrt(static_cast<long double>(raw) * 65536.L)));
+
+	for (int64_t raw = 1; raw <= INT32_MAX; raw += 104729)
+		EXPECT_EQ(Q16_16::Sqrt(Q16_16::FromRaw(static_cast<int32_t>(raw))).raw, std::llround(std::sqrt(static_cast<long double>(raw) * 65536.L)));
+
+	if (std::numeric_limits<long double>::digits >= 64)
+	{
+		const int64_t raws32[] = { 1, 3, int64_t(1) << 40, int64_t(8202585405127453963), INT64_MAX - 1, INT64_MAX };
+		for (int64_t raw : raws32)
+		{
+			const long double root = std::sqrt(static_cast<long double>(raw) * 4294967296.L);
+			EXPECT_EQ(Q32_32::Sqrt(Q32_32::FromRaw(raw)).raw, std::llround(root));
+		}
+	}
+
+	for (int i = -1000; i <= 1000; ++i)
+	{
+		double angle = i * 0.0123;
+
+		EXPECT_NEAR(Q16_16::Sin(Q16_16(angle)).ToDouble(), std::sin(angle), 0.0002);
+		EXPECT_NEAR(Q16_16::Cos(Q16_16(angle)).ToDouble(), std::cos(angle), 0.0002);
+		EXPECT_NEAR(Q32_32::Sin(Q32_32(angle)).ToDouble(), std::sin(angle), 1e-8);
+		EXPECT_NEAR(Q32_32::Cos(Q32_32(angle)).ToDouble(), std::cos(angle), 1e-8);
+	}
+
+	// Raw results are the same on every platform and compiler.
+	EXPECT_EQ(Q16_16::Sqrt(Q16_16(2)).raw, 92682);
+	EXPECT_EQ(Q32_32::Sqrt(Q32_32(2)).raw, int64_t(6074001000));
+	EXPECT_EQ(Q16_16::Sin(Q16_16(1)).raw, 55146);
+	EXPECT_EQ(Q32_32::Sin(Q32_32(1)).raw, int64_t(3614090360));
+	EXPECT_EQ(Q32_32::Cos(Q32_32(100)).raw, int64_t(3703631347));
+}
+
+/**
+*	\brief Unit test for fixed point vector, quaternion and transform
+*/
+TEST(FixedUnitTest, Space)
+{
+	Vec3Q32 vec(Q32_32(3), Q32_32(0), Q32_32(4));
+	EXPECT_EQ(vec.Length(), Q32_32(5));
+	EXPECT_TRUE(vec.GetNormalized().Equals(Vec3Q32(Q32_32(0.6), Q32_32(0), Q32_32(0.8)), Q32_32(1e-9)));
+	EXPECT_EQ(Vec3Q16::CrossProduct(Vec3Q16(1, 0, 0), Vec3Q16(0, 1, 0)), Vec3Q16(0, 0, 1));
+
+	QuatQ32 rotation(Q32_32::Pi() / Q32_32(2), Vec3Q32(0, 1, 0));
+	EXPECT_TRUE(rotation.ToQuat().Equals(Quat(90.f, Vec3::Up), 0.000001f));
+	EXPECT_TRUE(rotation.Rotate(Vec3Q32(1, 0, 0)).Equals(Vec3Q32(0, 0, -1), Q32_32(1e-8)));
+
+	QuatQ16 half(Q16_16::Pi() / Q16_16(4), Vec3Q16(0, 0, 1));
+	QuatQ16 full = (half * half).Normalize();
+	EXPECT_TRUE(full.ToQuat().Equals(Quat(90.f, Vec3::Forward), 0.0002f));
+	EXPECT_TRUE((half * half.GetConjugate()).Equals(QuatQ16(), Q16_16(0.0001)));
+
+	TransformQ32 parent(rotation, Vec3Q32(10, 0, 0), Vec3Q32(2, 2, 2));
+	EXPECT_TRUE(parent.TransformPoint(Vec3Q32(1, 0, 0)).Equals(Vec3Q32(10, 0, -2), Q32_32(1e-8)));
+
+	TransformQ32 child(QuatQ32(), Vec3Q32(0, 0, 1));
+	TransformQ32 world = child.GetWorldTransfrom(parent);
+	EXPECT_TRUE(world.position.Equals(Vec3Q32(11, 0, 0), Q32_32(1e-8)));
+	EXPECT_EQ(world.scale, Vec3Q32(2, 2, 2));
+
+	Transform float_transform(Quat(45.f, Vec3::Up), Vec3(1.f, 2.f, 3.f), Vec3(1.f, 1.f, 2.f));
+	EXPECT_TRUE(TransformQ32(float_transform).ToTransform().Equals(float_transform, 0.000001f));
+}
@@ -0,0 +1,182 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <Collections/Mathlib.hpp>
+
+using namespace Mathlib;
+
+/**
+*	\brief Unit test for half scalar conversions
+*/
+TEST(HalfUnitTest, Scalar)
+{
+	EXPECT_EQ(Half(1.f).bits, 0x3C00);
+	EXPECT_EQ(Half(-2.f).bits, 0xC000);
+	EXPECT_EQ(Half(0.1f).bits, 0x2E66);
+	EXPECT_EQ(Half(-0.f).bits, 0x8000);
+	EXPECT_EQ(Half(65504.f).bits, 0x7BFF);
+	EXPECT_EQ(Half(65519.f).bits, 0x7BFF);
+	EXPECT_EQ(Half(65520.f).bits, 0x7C00);
+	EXPECT_EQ(Half(std::ldexp(1.f, -24)).bits, 0x0001);
+	EXPECT_EQ(Half(std::ldexp(1.f, -25)).bits, 0x0000);
+	EXPECT_EQ(Half(std::ldexp(1.5f, -25)).bits, 0x0001);
+	EXPECT_TRUE(Half(-std::numeric_limits<float>::infinity()).IsInfinity());
+	EXPECT_TRUE(Half(std::numeric_limits<float>::quiet_NaN()).IsNaN());
+	EXPECT_FALSE(Half(65504.f).IsInfinity());
+
+	// Ties round to even: 1 + 2^-11 is halfway between 1 and the next half.
+	EXPECT_EQ(Half(1.f + std::ldexp(1.f, -11)).bits, 0x3C00);
+	EXPECT_EQ(Half(1.f + 3.f * std::ldexp(1.f, -11)).bits, 0x3C02);
+
+	// Every finite half converts to float and back unchanged.
+	for (uint32_t bits = 0; bits <= 0xFFFF; ++bits)
+	{
+		Half half = Half::FromBits(static_cast<uint16_t>(bits));
+
+		if (half.IsNaN())
+			EXPECT_TRUE(std::isnan(half.ToFloat()));
+		else
+			EXPECT_EQ(Half(half.ToFloat()), half);
+	}
+}
+
+/**
+*	\brief Unit test for half bulk conversions
+*/
+TEST(HalfUnitTest, Bulk)
+{
+	const size_t count = 100003;
+
+	std::vector<float> values(count);
+	for (size_t i = 0; i < count; ++i)
+		values[i] = std::ldexp(std::sin(static_cast<float>(i) * 0.37f), static_cast<int>(i % 40) - 26);
+
+	std::vector<Half> halves(count);
+	Half::FromFloat(values.data(), count, halves.data());
+
+	std::vector<Half> threaded_halves(count);
+	Half::FromFloat(values.data(), count, threaded_halves.data(), true);
+
+	std::vector<float> results(count);
+	Half::ToFloat(halves.data(), count, results.data(), true);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		ASSERT_EQ(halves[i], Half(values[i]));
+		ASSERT_EQ(threaded_halves[i], halves[i]);
+		ASSERT_EQ(results[i], halves[i].ToFloat());
+	}
+}
+
+/**
+*	\brief Unit test for bulk conversions, F16C when the CPU has it, giving the bits of the scalar software conversions
+*/
+TEST(HalfUnitTest, BulkMatchesScalar)
+{
+	RecordProperty("HardwareConversion", Half::HasHardwareConversion() ? "F16C" : "software");
+
+	auto float_bits = [](float _value)
+	{
+		uint32_t bits;
+		std::memcpy(&bits, &_value, sizeof(bits));
+		return bits;
+	};
+
+	// Every half, NaNs included.
+	std::vector<Half> halves(0x10000);
+	for (uint32_t bits = 0; bits <= 0xFFFF; ++bits)
+		halves[bits] = Half::FromBits(static_cast<uint16_t>(bits));
+
+	std::vector<float> floats(halves.size());
+	Half::ToFloat(halves.data(), halves.size(), floats.data());
+
+	for (size_t i = 0; i < halves.size(); ++i)
+		ASSERT_EQ(float_bits(floats[i]), float_bits(halves[i].ToFloat())) << i;
+
+	// Ties between consecutive halves, then a sweep over float bit patterns: subnormals, overflow, infinities and NaNs.
+	std::vector<float> values;
+	for (uint32_t bits = 0; bits < 0x7BFF; ++bits)
+	{
+		const float tie = 0.5f * (Half::FromBits(static_cast<uint16_t>(bits)).ToFloat() + Half::FromBits(static_cast<uint16_t>(bits + 1)).ToFloat());
+		values.push_back(tie);
+		values.push_back(-tie);
+	}
+
+	for (uint64_t bits = 0; bits <= 0xFFFFFFFFu; bits += 4093)
+	{
+		const uint32_t pattern = static_cast<uint32_t>(bits);
+		float value;
+		std::memcpy(&value, &pattern, sizeof(value));
+		values.push_back(value);
+	}
+
+	std::vector<Half> results(values.size());
+	Half::FromFloat(values.data(), values.size(), results.data());
+
+	for (size_t i = 0; i < values.size(); ++i)
+		ASSERT_EQ(results[i], Half(values[i])) << float_bits(values[i]);
+}
+
+/**
+*	\brief Unit test for half vectors and quaternions
+*/
+TEST(HalfUnitTest, Space)
+{
+	EXPECT_EQ(sizeof(Vec2h), 4u);
+	EXPECT_EQ(sizeof(Vec3h), 6u);
+	EXPECT_EQ(sizeof(Vec4h), 8u);
+	EXPECT_EQ(sizeof(Quath), 8u);
+
+	Vec3 normal = Vec3(0.2f, -0.5f, 0.7f).GetNormalized();
+	EXPECT_TRUE(Vec3(Vec3h(normal)).Equals(normal, 1e-3f));
+	EXPECT_EQ(Vec2(Vec2h(Vec2(1.f, -2.f))), Vec2(1.f, -2.f));
+	EXPECT_EQ(Vec4(Vec4h(Vec4(0.5f, 0.25f, 1.f, 0.f))), Vec4(0.5f, 0.25f, 1.f, 0.f));
+	EXPECT_EQ(Vec3h(Vec3(1.f, 2.f, 3.f)), Vec3h(Half(1.f), Half(2.f), Half(3.f)));
+	EXPECT_NE(Vec3h(Vec3(1.f, 2.f, 3.f)), Vec3h(Vec3(1.f, 2.f, 4.f)));
+
+	Quat rotation = Quat(0.8f, Vec3(1.f, 2.f, -1.f).GetNormalized());
+	Quat stored = ToQuat(ToHalf(rotation));
+
+	// Quath components hold what they are named after, and it is not a Vec4h.
+	static_assert(!std::is_same<Quath, Vec4h>::value, "Quath must be a distinct type");
+	Quath probe = ToHalf(Quat(0.5f, 0.1f, 0.2f, 0.3f));
+	EXPECT_EQ(probe, Quath(Half(0.5f), Half(0.1f), Half(0.2f), Half(0.3f)));
+	EXPECT_EQ(probe.W, Half(0.5f));
+	EXPECT_EQ(probe.X, Half(0.1f));
+	EXPECT_EQ(probe.Z, Half(0.3f));
+	EXPECT_EQ(stored.W, Half(rotation.W).ToFloat());
+	EXPECT_NEAR(stored.X, rotation.X, 1e-3f);
+	EXPECT_NEAR(stored.Z, rotation.Z, 1e-3f);
+
+	const size_t count = 1000;
+	std::vector<Vec3> normals(count);
+	for (size_t i = 0; i < count; ++i)
+		normals[i] = Vec3(std::cos(static_cast<float>(i)), std::sin(static_cast<float>(i)), 0.5f).GetNormalized();
+
+	std::vector<Vec3h> halves(count);
+	ToHalf(normals.data(), count, halves.data());
+
+	std::vector<Vec3> results(count);
+	ToFloat(halves.data(), count, results.data());
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		EXPECT_EQ(halves[i], Vec3h(normals[i]));
+		EXPECT_EQ(results[i], Vec3(halves[i]));
+	}
+
+	std::vector<Quat> rotations(count, rotation);
+	std::vector<Quath> half_rotations(count);
+	ToHalf(rotations.data(), count, half_rotations.data(), true);
+
+	std::vector<Quat> rotation_results(count);
+	ToQuat(half_rotations.data(), count, rotation_results.data(), true);
+	EXPECT_EQ(half_rotations[count - 1], ToHalf(rotation));
+	EXPECT_EQ(rotation_results[count - 1].Y, stored.Y);
+}
@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <vector>
+
 #include <Collections/Mathlib.hpp>
 
 
@@ -85,6 +88,50 @@ TEST(MathUnitTest, Pow_Sqrt)
 	EXPECT_FLOAT_EQ(Math::Sqrt(72.25f), 8.5f);
 }
 
+/**
+*	\brief Unit test for approximate inverse square root
+*/
+TEST(MathUnitTest, FastInverseSqrt)
+{
+	std::vector<float> values;
+	for (float value = 1e-30f; value < 1e30f; value *= 1.0001f)
+		values.push_back(value);
+
+	std::vector<float> results(values.size());
+	Math::FastInverseSqrt(values.data(), values.size(), results.data());
+
+	for (size_t i = 0; i < values.size(); ++i)
+	{
+		const double expected = 1.0 / std::sqrt(static_cast<double>(values[i]));
+
+		ASSERT_LT(std::abs(Math::FastInverseSqrt(values[i]) - expected) / expected, 1e-6);
+		ASSERT_LT(std::abs(results[i] - expected) / expected, 1e-6);
+	}
+
+	// Null vectors stay null, bad dimensions are rejected.
+	float vectors[8] = { 3.f, 4.f, 0.f, 0.f, 0.f, 0.f, 0.f, 2.f };
+	Math::NormalizeFast(vectors, 4, 2, vectors);
+
+	EXPECT_NEAR(vectors[0], 0.6f, 1e-6f);
+	EXPECT_NEAR(vectors[1], 0.8f, 1e-6f);
+	EXPECT_EQ(vectors[2], 0.f);
+	EXPECT_EQ(vectors[3], 0.f);
+	EXPECT_NEAR(vectors[7], 1.f, 1e-6f);
+
+	// Tiny vectors are rescaled before the inverse square root.
+	float tiny[6] = { 1e-20f, 0.f, 0.f, 0.f, 3e-30f, -4e-30f };
+	Math::NormalizeFast(tiny, 2, 3, tiny);
+
+	EXPECT_NEAR(tiny[0], 1.f, 1e-6f);
+	EXPECT_EQ(tiny[1], 0.f);
+	EXPECT_NEAR(tiny[4], 0.6f, 1e-6f);
+	EXPECT_NEAR(tiny[5], -0.8f, 1e-6f);
+
+	float unchanged[5] = { 5.f, 0.f, 0.f, 0.f, 0.f };
+	Math::NormalizeFast(unchanged, 1, 5, unchanged);
+	EXPECT_EQ(unchanged[0], 5.f);
+}
+
 /**
 *	\brief Unit test for Trigonometry functions
 */
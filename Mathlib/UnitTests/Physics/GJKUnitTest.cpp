@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <Collections/Mathlib.hpp>
+
+using namespace Mathlib;
+
+namespace
+{
+	const Vec3 CubePoints[8] =
+	{
+		Vec3(-1.f, -1.f, -1.f), Vec3(1.f, -1.f, -1.f), Vec3(-1.f, 1.f, -1.f), Vec3(1.f, 1.f, -1.f),
+		Vec3(-1.f, -1.f, 1.f), Vec3(1.f, -1.f, 1.f), Vec3(-1.f, 1.f, 1.f), Vec3(1.f, 1.f, 1.f)
+	};
+
+	Vec3 UnitSphereSupport(const Vec3& _direction, const void* _user_data)
+	{
+		float radius = *static_cast<const float*>(_user_data);
+		return _direction.GetNormalized() * radius;
+	}
+}
+
+/**
+*	\brief Unit test for ConvexShape support functions
+*/
+TEST(GJKUnitTest, Support)
+{
+	ConvexShape box = ConvexShape::CreateBox(Vec3(1.f, 2.f, 3.f), Transform(Vec3(10.f, 0.f, 0.f)));
+	EXPECT_EQ(box.GetSupport(Vec3(1.f, -1.f, 1.f)), Vec3(11.f, -2.f, 3.f));
+	EXPECT_FLOAT_EQ(box.GetMargin(), 0.f);
+
+	ConvexShape sphere = ConvexShape::CreateSphere(2.f, Transform(Quat::Identity, Vec3(0.f, 1.f, 0.f), Vec3(1.f, 1.f, 1.5f)));
+	EXPECT_FLOAT_EQ(sphere.GetMargin(), 3.f);
+	EXPECT_EQ(sphere.GetSupport(Vec3(0.f, 0.f, 5.f)), Vec3(0.f, 1.f, 3.f));
+	EXPECT_EQ(sphere.GetCoreSupport(Vec3(0.f, 0.f, 5.f)), Vec3(0.f, 1.f, 0.f));
+
+	ConvexShape capsule = ConvexShape::CreateCapsule(1.f, 0.5f, Transform(Quat(90.f, Vec3(0.f, 0.f, 1.f))));
+	EXPECT_TRUE(capsule.GetSupport(Vec3(-1.f, 0.f, 0.f)).Equals(Vec3(-1.5f, 0.f, 0.f), 1e-5f));
+
+	ConvexShape hull = ConvexShape::CreateHull(CubePoints, 8, Transform(Quat::Identity, Vec3::Zero, Vec3(2.f, 1.f, 1.f)));
+	EXPECT_EQ(hull.GetSupport(Vec3(1.f, 1.f, -1.f)), Vec3(2.f, 1.f, -1.f));
+}
+
+/**
+*	\brief Unit test for GJK distance between separated shapes
+*/
+TEST(GJKUnitTest, Distance)
+{
+	GJKResult result;
+
+	ConvexShape sphere_a = ConvexShape::CreateSphere(1.f, Transform(Vec3(0.f, 0.f, 0.f)));
+	ConvexShape sphere_b = ConvexShape::CreateSphere(0.5f, Transform(Vec3(3.f, 4.f, 0.f)));
+
+	EXPECT_FALSE(GJK::Collide(sphere_a, sphere_b, result));
+	EXPECT_FALSE(result.intersecting);
+	EXPECT_NEAR(result.distance, 3.5f, 1e-5f);
+	EXPECT_TRUE(result.normal.Equals(Vec3(0.6f, 0.8f, 0.f), 1e-5f));
+	EXPECT_TRUE(result.pointA.Equals(Vec3(0.6f, 0.8f, 0.f), 1e-5f));
+	EXPECT_TRUE(result.pointB.Equals(Vec3(2.7f, 3.6f, 0.f), 1e-5f));
+	EXPECT_FALSE(GJK::Intersects(sphere_a, sphere_b));
+
+	// Box rotated 45 degrees around Y reaches sqrt(2) on X.
+	ConvexShape box = ConvexShape::CreateBox(Vec3(1.f, 1.f, 1.f), Transform(Quat(45.f, Vec3(0.f, 1.f, 0.f))));
+	ConvexShape sphere = ConvexShape::CreateSphere(0.5f, Transform(Vec3(3.f, 0.f, 0.f)));
+
+	EXPECT_FALSE(GJK::Collide(box, sphere, result));
+	EXPECT_NEAR(result.distance, 3.f - Math::Sqrt(2.f) - 0.5f, 1e-4f);
+	EXPECT_TRUE(result.normal.Equals(Vec3(1.f, 0.f, 0.f), 1e-4f));
+
+	ConvexShape box_a = ConvexShape::CreateBox(Vec3(1.f, 1.f, 1.f), Transform(Vec3::Zero));
+	ConvexShape hull_b = ConvexShape::CreateHull(CubePoints, 8, Transform(Vec3(2.5f, 0.5f, 0.3f)));
+
+	EXPECT_FALSE(GJK::Collide(box_a, hull_b, result));
+	EXPECT_NEAR(result.distance, 0.5f, 1e-5f);
+	EXPECT_TRUE(result.normal.Equals(Vec3(1.f, 0.f, 0.f), 1e-5f));
+	EXPECT_NEAR(result.pointA.X, 1.f, 1e-5f);
+	EXPECT_NEAR(result.pointB.X, 1.5f, 1e-5f);
+
+	// Capsules lying along X, parallel and one above the other.
+	ConvexShape capsule_a = ConvexShape::CreateCapsule(2.f, 0.5f, Transform(Quat(90.f, Vec3(0.f, 0.f, 1.f))));
+	ConvexShape capsule_b = ConvexShape::CreateCapsule(2.f, 0.25f, Transform(Quat(90.f, Vec3(0.f, 0.f, 1.f)), Vec3(1.f, 2.f, 0.f), Vec3::One));
+
+	EXPECT_FALSE(GJK::Collide(capsule_a, capsule_b, result));
+	EXPECT_NEAR(result.distance, 1.25f, 1e-4f);
+	EXPECT_TRUE(result.normal.Equals(Vec3(0.f, 1.f, 0.f), 1e-4f));
+}
+
+/**
+*	\brief Unit test for GJK/EPA penetration of overlapping shapes
+*/
+TEST(GJKUnitTest, Penetration)
+{
+	GJKResult result;
+
+	// Shallow sphere overlap is resolved from the cores.
+	ConvexShape sphere_a = ConvexShape::CreateSphere(1.f, Transform(Vec3::Zero));
+	ConvexShape sphere_b = ConvexShape::CreateSphere(1.f, Transform(Vec3(0.f, 1.5f, 0.f)));
+
+	EXPECT_TRUE(GJK::Collide(sphere_a, sphere_b, result));
+	EXPECT_TRUE(result.intersecting);
+	EXPECT_NEAR(result.distance, -0.5f, 1e-5f);
+	EXPECT_TRUE(result.normal.Equals(Vec3(0.f, 1.f, 0.f), 1e-5f));
+	EXPECT_TRUE(GJK::Intersects(sphere_a, sphere_b));
+
+	// Overlapping boxes go through EPA.
+	ConvexShape box_a = ConvexShape::CreateBox(Vec3(1.f, 1.f, 1.f), Transform(Vec3::Zero));
+	ConvexShape box_b = ConvexShape::CreateBox(Vec3(1.f, 1.f, 1.f), Transform(Vec3(1.7f, 0.2f, -0.1f)));
+
+	EXPECT_TRUE(GJK::Collide(box_a, box_b, result));
+	EXPECT_NEAR(result.distance, -0.3f, 1e-3f);
+	EXPECT_TRUE(result.normal.Equals(Vec3(1.f, 0.f, 0.f), 1e-3f));
+	EXPECT_NEAR(result.pointA.X, 1.f, 1e-3f);
+	EXPECT_NEAR(result.pointB.X, 0.7f, 1e-3f);
+	EXPECT_TRUE(GJK::Intersects(box_a, box_b));
+
+	// Concentric spheres: cores coincide, EPA runs on the full shapes.
+	ConvexShape inner = ConvexShape::CreateSphere(0.5f, Transform(Vec3::Zero));
+	EXPECT_TRUE(GJK::Collide(sphere_a, inner, result));
+	EXPECT_NEAR(result.distance, -1.5f, 2e-2f);
+
+	// Custom support function.
+	float radius = 1.f;
+	ConvexShape custom = ConvexShape::CreateCustom(UnitSphereSupport, &radius, Transform(Vec3(0.f, 0.f, 1.8f)));
+	EXPECT_TRUE(GJK::Collide(box_a, custom, result));
+	EXPECT_NEAR(result.distance, -0.2f, 1e-2f);
+	EXPECT_TRUE(result.normal.Equals(Vec3(0.f, 0.f, 1.f), 1e-2f));
+}
+
+/**
+*	\brief Unit test for GJK warm start and batches
+*/
+TEST(GJKUnitTest, Batch)
+{
+	std::vector<ConvexShape> shapes_a;
+	std::vector<ConvexShape> shapes_b;
+
+	for (int i = 0; i < 300; ++i)
+	{
+		float offset = 0.5f + 0.01f * static_cast<float>(i);
+		shapes_a.push_back(ConvexShape::CreateBox(Vec3(1.f, 1.f, 1.f), Transform(Vec3::Zero)));
+		shapes_b.push_back(ConvexShape::CreateSphere(0.5f, Transform(Vec3(offset + 1.f, 0.f, 0.f))));
+	}
+
+	std::vector<GJKResult> results(shapes_a.size());
+	std::vector<GJKCache> caches(shapes_a.size());
+
+	size_t intersecting = GJK::CollideBatch(shapes_a.data(), shapes_b.data(), shapes_a.size(), results.data(), caches.data(), true);
+	EXPECT_EQ(intersecting, 1u);
+
+	for (size_t i = 0; i < results.size(); ++i)
+	{
+		EXPECT_NEAR(results[i].distance, 0.01f * static_cast<float>(i), 1e-4f);
+		EXPECT_TRUE(caches[i].valid);
+	}
+
+	// Second frame reuses the caches.
+	GJKResult warm;
+	shapes_b[10].SetTransform(Transform(Vec3(1.6f, 0.1f, 0.f)));
+	EXPECT_FALSE(GJK::Collide(shapes_a[10], shapes_b[10], warm, &caches[10]));
+	EXPECT_NEAR(warm.distance, 0.1f, 1e-4f);
+	EXPECT_FALSE(GJK::Intersects(shapes_a[10], shapes_b[10], &caches[10]));
+}
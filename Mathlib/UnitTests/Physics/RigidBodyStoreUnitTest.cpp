@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <Collections/Mathlib.hpp>
+
+using namespace Mathlib;
+
+namespace
+{
+	float RandomFloat(int _min, int _max)
+	{
+		return static_cast<float>(Math::Random(_min * 100, _max * 100)) / 100.f;
+	}
+}
+
+/**
+*	\brief Unit test for adding, removing and accessing bodies
+*/
+TEST(RigidBodyStoreUnitTest, Bodies)
+{
+	RigidBodyStore store;
+	EXPECT_EQ(store.GetBodyCount(), 0u);
+
+	uint32_t body_1 = store.Add(Vec3(1.f, 2.f, 3.f), Quat::Identity, 2.f, Vec3::One);
+	uint32_t body_2 = store.Add(Vec3(4.f, 5.f, 6.f), Quat(90.f, Vec3::Up), 0.f, Vec3::One);
+	uint32_t body_3 = store.Add(Vec3(7.f, 8.f, 9.f), Quat::Identity, 4.f, Vec3::One);
+	EXPECT_EQ(store.GetBodyCount(), 3u);
+
+	EXPECT_EQ(store.GetPosition(body_1), Vec3(1.f, 2.f, 3.f));
+	EXPECT_TRUE(store.GetRotation(body_2).Equals(Quat(90.f, Vec3::Up)));
+	EXPECT_FLOAT_EQ(store.GetInverseMass(body_1), 0.5f);
+	EXPECT_FLOAT_EQ(store.GetInverseMass(body_2), 0.f);
+	EXPECT_EQ(store.GetLinearVelocity(body_3), Vec3::Zero);
+
+	store.SetLinearVelocity(body_3, Vec3(1.f, 0.f, 0.f));
+	store.SetAngularVelocity(body_3, Vec3(0.f, 1.f, 0.f));
+	EXPECT_EQ(store.GetLinearVelocity(body_3), Vec3(1.f, 0.f, 0.f));
+	EXPECT_EQ(store.GetAngularVelocity(body_3), Vec3(0.f, 1.f, 0.f));
+
+	// The last body takes the removed index.
+	store.Remove(body_1);
+	EXPECT_EQ(store.GetBodyCount(), 2u);
+	EXPECT_EQ(store.GetPosition(body_1), Vec3(7.f, 8.f, 9.f));
+	EXPECT_EQ(store.GetLinearVelocity(body_1), Vec3(1.f, 0.f, 0.f));
+	EXPECT_FLOAT_EQ(store.GetInverseMass(body_1), 0.25f);
+
+	Transform transform = store.GetTransform(body_2);
+	EXPECT_EQ(transform.position, Vec3(4.f, 5.f, 6.f));
+	EXPECT_TRUE(transform.rotation.Equals(Quat(90.f, Vec3::Up)));
+	EXPECT_EQ(transform.scale, Vec3::One);
+
+	store.Clear();
+	EXPECT_EQ(store.GetBodyCount(), 0u);
+}
+
+/**
+*	\brief Unit test for linear and angular integration
+*/
+TEST(RigidBodyStoreUnitTest, Integrate)
+{
+	RigidBodyStore store;
+	uint32_t falling = store.Add(Vec3::Zero, Quat::Identity, 1.f, Vec3::One);
+	uint32_t fixed = store.Add(Vec3::One, Quat::Identity, 0.f, Vec3::One);
+	uint32_t spinning = store.Add(Vec3::Zero, Quat::Identity, 1.f, Vec3(1.f, 4.f, 9.f));
+
+	store.SetAngularVelocity(spinning, Vec3(0.f, Math::Pi, 0.f));
+
+	// Semi implicit Euler: velocity is updated before position.
+	for (int step = 0; step < 10; ++step)
+		store.Integrate(0.1f, Vec3(0.f, -10.f, 0.f));
+
+	EXPECT_TRUE(store.GetLinearVelocity(falling).Equals(Vec3(0.f, -10.f, 0.f), 0.0001f));
+	EXPECT_TRUE(store.GetPosition(falling).Equals(Vec3(0.f, -5.5f, 0.f), 0.0001f));
+	EXPECT_EQ(store.GetPosition(fixed), Vec3::One);
+	EXPECT_EQ(store.GetLinearVelocity(fixed), Vec3::Zero);
+
+	store.SetPosition(spinning, Vec3::Zero);
+	store.SetLinearVelocity(spinning, Vec3::Zero);
+	store.SetRotation(spinning, Quat::Identity);
+
+	for (int step = 0; step < 1000; ++step)
+		store.Integrate(0.001f, Vec3::Zero);
+
+	Quat rotation = store.GetRotation(spinning);
+	EXPECT_NEAR(rotation.Length(), 1.f, 0.00001f);
+	EXPECT_TRUE(rotation.Rotate(Vec3(1.f, 0.f, 0.f)).Equals(Vec3(-1.f, 0.f, 0.f), 0.001f));
+
+	// Local X is world Y once rotated around Z, its inverse inertia is 1.
+	store.SetRotation(spinning, Quat(90.f, Vec3(0.f, 0.f, 1.f)));
+	store.SetAngularVelocity(spinning, Vec3::Zero);
+	store.ApplyTorque(spinning, Vec3(0.f, 2.f, 0.f));
+	store.Integrate(0.5f, Vec3::Zero);
+	EXPECT_TRUE(store.GetAngularVelocity(spinning).Equals(Vec3(0.f, 1.f, 0.f), 0.0001f));
+
+	// Forces are cleared by integration.
+	store.Integrate(0.5f, Vec3::Zero);
+	EXPECT_TRUE(store.GetAngularVelocity(spinning).Equals(Vec3(0.f, 1.f, 0.f), 0.0001f));
+
+	store.SetRotation(spinning, Quat::Identity);
+	store.SetAngularVelocity(spinning, Vec3::Zero);
+	store.SetLinearVelocity(spinning, Vec3::Zero);
+	store.ApplyImpulse(spinning, Vec3(0.f, 0.f, 2.f), store.GetPosition(spinning) + Vec3(1.f, 0.f, 0.f));
+	EXPECT_TRUE(store.GetLinearVelocity(spinning).Equals(Vec3(0.f, 0.f, 2.f), 0.0001f));
+	EXPECT_TRUE(store.GetAngularVelocity(spinning).Equals(Vec3(0.f, -0.5f, 0.f), 0.0001f));
+}
+
+/**
+*	\brief Unit test for multithreaded integration
+*/
+TEST(RigidBodyStoreUnitTest, Multithreaded)
+{
+	RigidBodyStore single;
+	single.Reserve(10000);
+
+	for (int i = 0; i < 10000; ++i)
+	{
+		uint32_t body = single.Add(Vec3(RandomFloat(-100, 100), RandomFloat(-100, 100), RandomFloat(-100, 100)),
+			Quat(RandomFloat(0, 360), Vec3(RandomFloat(1, 2), RandomFloat(-1, 1), RandomFloat(-1, 1)).GetNormalized()),
+			RandomFloat(0, 10), Vec3(RandomFloat(1, 5), RandomFloat(1, 5), RandomFloat(1, 5)));
+
+		single.SetLinearVelocity(body, Vec3(RandomFloat(-5, 5), RandomFloat(-5, 5), RandomFloat(-5, 5)));
+		single.SetAngularVelocity(body, Vec3(RandomFloat(-5, 5), RandomFloat(-5, 5), RandomFloat(-5, 5)));
+	}
+
+	RigidBodyStore multi = single;
+
+	for (int step = 0; step < 10; ++step)
+	{
+		for (uint32_t body = 0; body < 10000; body += 7)
+		{
+			single.ApplyForce(body, Vec3(1.f, 2.f, 3.f), single.GetPosition(body) + Vec3::One);
+			multi.ApplyForce(body, Vec3(1.f, 2.f, 3.f), multi.GetPosition(body) + Vec3::One);
+		}
+
+		single.Integrate(1.f / 60.f, Vec3(0.f, -9.81f, 0.f));
+		multi.Integrate(1.f / 60.f, Vec3(0.f, -9.81f, 0.f), true);
+	}
+
+	std::vector<Transform> transforms(multi.GetBodyCount());
+	multi.GetTransforms(transforms.data());
+
+	for (uint32_t body = 0; body < 10000; ++body)
+	{
+		EXPECT_EQ(single.GetPosition(body), transforms[body].position);
+		EXPECT_EQ(single.GetRotation(body), transforms[body].rotation);
+		EXPECT_NEAR(transforms[body].rotation.Length(), 1.f, 0.00001f);
+	}
+}
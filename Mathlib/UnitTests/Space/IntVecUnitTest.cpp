@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <Collections/Mathlib.hpp>
+
+using namespace Mathlib;
+
+/**
+*	\brief Unit test for integer vector arithmetic and hashing
+*/
+TEST(IntVecUnitTest, Arithmetic)
+{
+	Vec3i a(1, -2, 3);
+	Vec3i b(4, 5, -6);
+
+	EXPECT_EQ(a + b, Vec3i(5, 3, -3));
+	EXPECT_EQ(a - b, Vec3i(-3, -7, 9));
+	EXPECT_EQ(a * 2, Vec3i(2, -4, 6));
+	EXPECT_EQ(b / 2, Vec3i(2, 2, -3));
+	EXPECT_EQ(Vec3i::Min(a, b), Vec3i(1, -2, -6));
+	EXPECT_EQ(Vec3i::Max(a, b), Vec3i(4, 5, 3));
+	EXPECT_EQ(Vec3i::DotProduct(a, b), -24);
+	EXPECT_EQ(Vec2i(3, 4).SquaredLength(), 25);
+	EXPECT_EQ(Vec4i(1, 2, 3, 4).MaxComponent(), 4);
+
+	EXPECT_EQ(a.GetHash(), Vec3i(1, -2, 3).GetHash());
+	EXPECT_NE(a.GetHash(), Vec3i(-2, 1, 3).GetHash());
+
+	// Every cell of a small grid gets its own hash and works as a container key.
+	std::unordered_set<size_t> hashes;
+	std::unordered_map<Vec3i, int> cells;
+	for (int x = -8; x < 8; ++x)
+		for (int y = -8; y < 8; ++y)
+			for (int z = -8; z < 8; ++z)
+			{
+				hashes.insert(Vec3i(x, y, z).GetHash());
+				cells[Vec3i(x, y, z)] = x + y + z;
+			}
+
+	EXPECT_EQ(hashes.size(), 16u * 16u * 16u);
+	EXPECT_EQ(cells[Vec3i(-3, 2, 7)], 6);
+	EXPECT_EQ(std::hash<Vec2i>()(Vec2i(5, 6)), Vec2i(5, 6).GetHash());
+}
+
+/**
+*	\brief Unit test for float to integer vector conversions
+*/
+TEST(IntVecUnitTest, Conversions)
+{
+	EXPECT_EQ(Math::FloorToInt(Vec3(1.5f, -0.5f, -2.f)), Vec3i(1, -1, -2));
+	EXPECT_EQ(Math::FloorToInt(Vec2(5.f, -5.f), 0.25f), Vec2i(1, -2));
+	EXPECT_EQ(Math::FloorToInt(Vec4(-0.f, 0.99f, -1.01f, 7.f)), Vec4i(0, 0, -2, 7));
+	EXPECT_EQ(Math::ToFloat(Vec3i(1, -2, 3), 0.5f), Vec3(0.5f, -1.f, 1.5f));
+	EXPECT_EQ(Math::ToFloat(Vec2i(2, 3)), Vec2(2.f, 3.f));
+
+	const size_t count = 50001;
+	const float cell_size = 0.75f;
+
+	std::vector<Vec3> positions(count);
+	for (size_t i = 0; i < count; ++i)
+	{
+		float t = static_cast<float>(i);
+		positions[i] = Vec3(std::sin(t) * 100.f, std::cos(t * 0.3f) * 100.f, t * 0.01f - 250.f);
+	}
+
+	std::vector<Vec3i> cells(count);
+	Math::FloorToInt(positions.data(), count, 1.f / cell_size, cells.data());
+
+	std::vector<Vec3i> threaded_cells(count);
+	Math::FloorToInt(positions.data(), count, 1.f / cell_size, threaded_cells.data(), true);
+
+	std::vector<Vec3> corners(count);
+	Math::ToFloat(cells.data(), count, cell_size, corners.data(), true);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		Vec3 scaled = positions[i] * (1.f / cell_size);
+		ASSERT_EQ(cells[i], Vec3i(static_cast<int>(std::floor(scaled.X)), static_cast<int>(std::floor(scaled.Y)),
+			static_cast<int>(std::floor(scaled.Z))));
+		ASSERT_EQ(threaded_cells[i], cells[i]);
+		ASSERT_EQ(corners[i], Vec3(static_cast<float>(cells[i].X) * cell_size, static_cast<float>(cells[i].Y) * cell_size,
+			static_cast<float>(cells[i].Z) * cell_size));
+	}
+}
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include <Collections/Mathlib.hpp>
 
 using namespace Mathlib;
@@ -513,4 +515,53 @@ TEST(QuaternionUnitTest, quaternions_operator)
 	EXPECT_TRUE(Math::Equals(rotation.X, expected_result.X));
 	EXPECT_TRUE(Math::Equals(rotation.Y, expected_result.Y));
 	EXPECT_TRUE(Math::Equals(rotation.Z, expected_result.Z));
-}
\ No newline at end of file
+}
+
+/**
+*	\brief Unit test for conversion from rotation matrix
+*/
+TEST(QuaternionUnitTest, From_Matrix)
+{
+	Quat rotations[] = { Quat::Identity, Quat(30.f, Vec3::Up), Quat(180.f, Vec3(1.f, 0.f, 0.f)), Quat(180.f, Vec3::Up),
+		Quat(180.f, Vec3(0.f, 0.f, 1.f)), Quat(170.f, Vec3(1.f, 2.f, 3.f)), Quat(-75.f, Vec3(-3.f, 1.f, 0.5f)) };
+
+	for (const Quat& rotation : rotations)
+	{
+		Quat result = Quat::FromMatrix(Mat3::RotationMatrix(rotation));
+
+		// q and -q are the same rotation.
+		EXPECT_NEAR(Math::Abs(Quat::DotProduct(result, rotation)), 1.f, 0.00001f);
+		EXPECT_TRUE(result.IsNormalized());
+	}
+}
+
+/**
+*	\brief Unit test for fast normalization
+*/
+TEST(QuaternionUnitTest, NormalizeFast)
+{
+	Quat value = Quat(3.8f, -5.2f, 7.2f, 1.5f);
+	const Quat expected = value.GetNormalized();
+
+	EXPECT_TRUE(value.GetNormalizedFast().Equals(expected, 1e-6f));
+	EXPECT_TRUE(value.NormalizeFast().Equals(expected, 1e-6f));
+	EXPECT_NEAR(value.Length(), 1.f, 1e-6f);
+	EXPECT_EQ(Quat::Zero.GetNormalizedFast(), Quat::Zero);
+
+	// Squared length of tiny quaternions is denormal or 0.
+	EXPECT_TRUE(Quat(1e-20f, 0.f, 0.f, 0.f).GetNormalizedFast().Equals(Quat::Identity, 1e-6f));
+	EXPECT_TRUE(Quat(0.f, 3e-30f, 0.f, -4e-30f).GetNormalizedFast().Equals(Quat(0.f, 0.6f, 0.f, -0.8f), 1e-6f));
+
+	std::vector<Quat> values(1000);
+	for (size_t i = 0; i < values.size(); ++i)
+		values[i] = Quat(1.f, static_cast<float>(i) - 500.f, 2.f, 0.001f * i);
+
+	std::vector<Quat> results(values.size());
+	Quat::NormalizeFast(values.data(), values.size(), results.data(), true);
+
+	for (size_t i = 0; i < values.size(); ++i)
+		EXPECT_TRUE(results[i].Equals(values[i].GetNormalizedFast(), 1e-6f));
+
+	Quat::NormalizeFast(values.data(), values.size(), values.data());
+	EXPECT_EQ(values, results);
+}
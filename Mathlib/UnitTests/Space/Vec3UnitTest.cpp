@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include <Collections/Mathlib.hpp>
 
 using namespace Mathlib;
@@ -362,4 +364,36 @@ TEST(Vec3UnitTest, Operator_float)
 	vec_1 /= scale;
 
 	EXPECT_EQ(vec_1, vec_2 / scale);
-}
\ No newline at end of file
+}
+
+/**
+*	\brief Unit test for fast normalization
+*/
+TEST(Vec3UnitTest, NormalizeFast)
+{
+	Vec3 value = Vec3(3.8f, -5.2f, 7.2f);
+	const Vec3 expected = value.GetNormalized();
+
+	EXPECT_TRUE(value.GetNormalizedFast().Equals(expected, 1e-6f));
+	EXPECT_TRUE(value.NormalizeFast().Equals(expected, 1e-6f));
+	EXPECT_NEAR(value.Length(), 1.f, 1e-6f);
+	EXPECT_EQ(Vec3::Zero.GetNormalizedFast(), Vec3::Zero);
+
+	// Squared length of tiny vectors is denormal or 0.
+	EXPECT_TRUE(Vec3(1e-20f, 0.f, 0.f).GetNormalizedFast().Equals(Vec3(1.f, 0.f, 0.f), 1e-6f));
+	EXPECT_TRUE(Vec3(0.f, -3e-30f, 4e-30f).GetNormalizedFast().Equals(Vec3(0.f, -0.6f, 0.8f), 1e-6f));
+	EXPECT_TRUE(Vec3(1e-45f, 0.f, 0.f).GetNormalizedFast().Equals(Vec3(1.f, 0.f, 0.f), 1e-6f));
+
+	std::vector<Vec3> values(1000);
+	for (size_t i = 0; i < values.size(); ++i)
+		values[i] = Vec3(static_cast<float>(i) - 500.f, 2.f, 0.001f * i);
+
+	std::vector<Vec3> results(values.size());
+	Vec3::NormalizeFast(values.data(), values.size(), results.data(), true);
+
+	for (size_t i = 0; i < values.size(); ++i)
+		EXPECT_TRUE(results[i].Equals(values[i].GetNormalizedFast(), 1e-6f));
+
+	Vec3::NormalizeFast(values.data(), values.size(), values.data());
+	EXPECT_EQ(values, results);
+}
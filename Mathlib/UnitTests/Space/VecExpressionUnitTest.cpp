@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <Collections/Mathlib.hpp>
+
+using namespace Mathlib;
+
+/**
+*	\brief Unit test for vector expressions
+*/
+TEST(VecExpressionUnitTest, Vector)
+{
+	const Vec3 a(1.f, 2.f, 3.f);
+	const Vec3 b(-4.f, 0.5f, 2.f);
+	const Vec3 c(0.25f, -1.f, 8.f);
+
+	const Vec3 fused = Expression::Lazy(a) + (Expression::Lazy(b) * 3.f + c) * 2.f;
+	EXPECT_TRUE(fused.Equals(a + (b * 3.f + c) * 2.f, 1e-6f));
+
+	const Vec3 mixed = (a - Expression::Lazy(b)) / 2.f - c * Expression::Lazy(a);
+	EXPECT_TRUE(mixed.Equals((a - b) / 2.f - c * a, 1e-6f));
+
+	const Vec3 negated = -(Expression::Lazy(a) * 2);
+	EXPECT_EQ(negated, Vec3(-2.f, -4.f, -6.f));
+
+	const Vec2 vec2 = Expression::Lazy(Vec2(1.f, 2.f)) * Vec2(3.f, 4.f) - 1.0;
+	EXPECT_EQ(vec2, Vec2(2.f, 7.f));
+
+	const Vec4 vec4 = 1.f + Expression::Lazy(Vec4(1.f, 2.f, 3.f, 4.f)) * 0.5f;
+	EXPECT_EQ(vec4, Vec4(1.5f, 2.f, 2.5f, 3.f));
+
+	// Scalar expressions evaluate to float.
+	const float scalar = Expression::Lazy(2.f) * 3.f + 1.f;
+	EXPECT_FLOAT_EQ(scalar, 7.f);
+
+	EXPECT_FLOAT_EQ(Expression::Dot(Expression::Lazy(a) * 2.f, b), 2.f * Vec3::DotProduct(a, b));
+
+	// Rotation through expressions matches the matrix rotation.
+	const Quat quat(30.f, Vec3(1.f, 2.f, -1.f).Normalize());
+	EXPECT_TRUE(quat.Rotate(a).Equals(Mat3::RotationMatrix(quat) * a, 1e-5f));
+}
+
+/**
+*	\brief Unit test for component stream expressions
+*/
+TEST(VecExpressionUnitTest, Stream)
+{
+	const size_t count = 40000;
+
+	std::vector<float> px(count), py(count), pz(count);
+	std::vector<float> vx(count), vy(count), vz(count);
+	std::vector<float> mass(count);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		px[i] = static_cast<float>(i);
+		py[i] = -static_cast<float>(i);
+		pz[i] = 1.f;
+		vx[i] = 1.f;
+		vy[i] = 2.f;
+		vz[i] = static_cast<float>(i % 7);
+		mass[i] = 1.f + static_cast<float>(i % 3);
+	}
+
+	// Separate outputs, single and multithreaded.
+	std::vector<float> rx(count), ry(count), rz(count);
+	std::vector<float> tx(count), ty(count), tz(count);
+
+	auto expression = Expression::Stream(px.data(), py.data(), pz.data()) +
+		Expression::Stream(vx.data(), vy.data(), vz.data()) * Expression::Stream(mass.data()) * 0.5f;
+
+	Expression::Store(expression, count, { rx.data(), ry.data(), rz.data() });
+	Expression::Store(expression, count, { tx.data(), ty.data(), tz.data() }, true);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		const Vec3 expected = Vec3(px[i], py[i], pz[i]) + Vec3(vx[i], vy[i], vz[i]) * mass[i] * 0.5f;
+		ASSERT_TRUE(Vec3(rx[i], ry[i], rz[i]).Equals(expected, 1e-6f * (1.f + expected.Length())));
+		ASSERT_EQ(rx[i], tx[i]);
+		ASSERT_EQ(ry[i], ty[i]);
+		ASSERT_EQ(rz[i], tz[i]);
+	}
+
+	// In place update and scalar streams.
+	Expression::Store(Expression::Stream(px.data(), py.data(), pz.data()) - Expression::Stream(vx.data(), vy.data(), vz.data()),
+		count, { px.data(), py.data(), pz.data() }, true);
+	Expression::Store(Expression::Stream(mass.data()) * 2.f, count, mass.data());
+
+	EXPECT_EQ(Vec3(px[10], py[10], pz[10]), Vec3(9.f, -12.f, -2.f));
+	EXPECT_EQ(mass[10], 4.f);
+
+	// Permuted in place outputs: components of an element are all read before any is written.
+	Expression::Store(Expression::Stream(py.data(), px.data()), count, { px.data(), py.data() });
+	EXPECT_EQ(px[10], -12.f);
+	EXPECT_EQ(py[10], 9.f);
+}
@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+
+#include <Collections/Mathlib.hpp>
+
+using namespace Mathlib;
+
+namespace
+{
+	using Int2 = Vec<int, 2>;
+	using Int3 = Vec<int, 3>;
+	using Int4 = Vec<int, 4>;
+	using Float3 = Vec<float, 3>;
+	using Float4 = Vec<float, 4>;
+	using Float6 = Vec<float, 6>;
+	using Double3 = Vec<double, 3>;
+}
+
+/**
+*	\brief Unit test for generic vector constructors and conversions
+*/
+TEST(VecUnitTest, Constructors)
+{
+	Float3 zero;
+	EXPECT_TRUE(zero.IsZero());
+
+	Double3 values(1.0, 2.0, 3.0);
+	EXPECT_EQ(values.X, 1.0);
+	EXPECT_EQ(values.Y, 2.0);
+	EXPECT_EQ(values.Z, 3.0);
+	EXPECT_EQ(values[2], 3.0);
+
+	Int4 all(7);
+	EXPECT_EQ(all, Int4(7, 7, 7, 7));
+
+	Float6 large(1.f, 2.f, 3.f, 4.f, 5.f, 6.f);
+	EXPECT_EQ(large[5], 6.f);
+	EXPECT_EQ(Float6::Size, 6u);
+
+	// Conversions between component types truncate like static_cast.
+	Int3 truncated(Float3(1.7f, -2.5f, 3.f));
+	EXPECT_EQ(truncated, Int3(1, -2, 3));
+
+	// Conversions with the float library types.
+	Double3 from_vec3(Vec3(1.f, 2.f, 3.f));
+	EXPECT_EQ(from_vec3, Double3(1.0, 2.0, 3.0));
+	EXPECT_EQ(static_cast<Vec3>(from_vec3), Vec3(1.f, 2.f, 3.f));
+	EXPECT_EQ(static_cast<Vec2>(Int2(4, 5)), Vec2(4.f, 5.f));
+	EXPECT_EQ(static_cast<Vec4>(Float4(Vec4(1.f, 2.f, 3.f, 4.f))), Vec4(1.f, 2.f, 3.f, 4.f));
+}
+
+/**
+*	\brief Unit test for generic vector methods and operators
+*/
+TEST(VecUnitTest, Operations)
+{
+	Float3 lhs(1.f, 2.f, 3.f);
+	Float3 rhs(-4.f, 5.f, 0.5f);
+
+	// Same results as the hand written float types.
+	EXPECT_FLOAT_EQ(Float3::DotProduct(lhs, rhs), Vec3::DotProduct(Vec3(1.f, 2.f, 3.f), Vec3(-4.f, 5.f, 0.5f)));
+	EXPECT_EQ(static_cast<Vec3>(Float3::CrossProduct(lhs, rhs)), Vec3::CrossProduct(Vec3(1.f, 2.f, 3.f), Vec3(-4.f, 5.f, 0.5f)));
+	EXPECT_FLOAT_EQ(lhs.Length(), Vec3(1.f, 2.f, 3.f).Length());
+	EXPECT_TRUE(static_cast<Vec3>(lhs.GetNormalized()).Equals(Vec3(1.f, 2.f, 3.f).GetNormalized()));
+
+	EXPECT_EQ(lhs + rhs, Float3(-3.f, 7.f, 3.5f));
+	EXPECT_EQ(lhs - rhs, Float3(5.f, -3.f, 2.5f));
+	EXPECT_EQ(lhs * rhs, Float3(-4.f, 10.f, 1.5f));
+	EXPECT_EQ(lhs / Float3(2.f), Float3(0.5f, 1.f, 1.5f));
+	EXPECT_EQ(lhs * 2.f, 2.f * lhs);
+	EXPECT_EQ(-lhs, Float3(-1.f, -2.f, -3.f));
+
+	EXPECT_EQ(Float3::Min(lhs, rhs), Float3(-4.f, 2.f, 0.5f));
+	EXPECT_EQ(Float3::Max(lhs, rhs), Float3(1.f, 5.f, 3.f));
+	EXPECT_EQ(rhs.GetAbs(), Float3(4.f, 5.f, 0.5f));
+	EXPECT_EQ(rhs.MinComponent(), -4.f);
+	EXPECT_EQ(rhs.MaxComponent(), 5.f);
+	EXPECT_EQ(Float3::Lerp(lhs, rhs, 0.5f), Float3(-1.5f, 3.5f, 1.75f));
+	EXPECT_TRUE(lhs.Equals(lhs + 0.0001f, 0.001f));
+	EXPECT_FALSE(lhs.Equals(lhs + 0.01f, 0.001f));
+
+	// Integral vectors.
+	Int3 cell(7, -3, 10);
+	EXPECT_EQ(cell / 2, Int3(3, -1, 5));
+	EXPECT_EQ(Int3::DotProduct(cell, Int3(1, 2, 3)), 31);
+	EXPECT_EQ(cell.SquaredLength(), 158);
+	EXPECT_EQ(cell / Int3(1, 0, 2), Int3(7, 0, 5));
+
+	// Double precision keeps small offsets far from the origin.
+	Double3 far(1e8, 0.0, 0.0);
+	Double3 offset = (far + Double3(0.001, 0.0, 0.0)) - far;
+	EXPECT_NEAR(offset.X, 0.001, 1e-7);
+
+	EXPECT_EQ(Int2(1, 2).ToString(), "1, 2");
+}
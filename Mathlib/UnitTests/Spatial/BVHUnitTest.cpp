@@ -0,0 +1,249 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include <Collections/Mathlib.hpp>
+
+using namespace Mathlib;
+
+namespace
+{
+	float RandomFloat(int _min, int _max)
+	{
+		return static_cast<float>(Math::Random(_min * 100, _max * 100)) / 100.f;
+	}
+
+	std::vector<Triangle> RandomTriangles(size_t _count)
+	{
+		std::vector<Triangle> triangles(_count);
+
+		for (Triangle& triangle : triangles)
+		{
+			Vec3 center(RandomFloat(-50, 50), RandomFloat(-50, 50), RandomFloat(-50, 50));
+			triangle = Triangle(center + Vec3(RandomFloat(-2, 2), RandomFloat(-2, 2), RandomFloat(-2, 2)),
+				center + Vec3(RandomFloat(-2, 2), RandomFloat(-2, 2), RandomFloat(-2, 2)),
+				center + Vec3(RandomFloat(-2, 2), RandomFloat(-2, 2), RandomFloat(-2, 2)));
+		}
+
+		return triangles;
+	}
+
+	bool BruteForceRaycast(const Ray& _ray, const std::vector<Triangle>& _triangles, float& _distance)
+	{
+		bool hit = false;
+		for (const Triangle& triangle : _triangles)
+		{
+			float distance = 0.f;
+			if (Intersection::RayTriangle(_ray, triangle, distance) && distance < _distance)
+			{
+				_distance = distance;
+				hit = true;
+			}
+		}
+
+		return hit;
+	}
+
+	/**
+	*	\brief Check every node encloses its children and primitives.
+	*/
+	void CheckHierarchy(const BVH& _bvh, const std::vector<Triangle>& _triangles)
+	{
+		const std::vector<BVHNode>& nodes = _bvh.GetNodes();
+		const std::vector<uint32_t>& indices = _bvh.GetPrimitiveIndices();
+
+		size_t primitive_count = 0;
+		for (size_t i = 0; i < nodes.size(); ++i)
+		{
+			if (nodes[i].IsLeaf())
+			{
+				primitive_count += nodes[i].count;
+				for (uint32_t j = 0; j < nodes[i].count; ++j)
+					EXPECT_TRUE(nodes[i].bounds.Contains(_triangles[indices[nodes[i].offset + j]].GetAABB()));
+			}
+			else
+			{
+				EXPECT_TRUE(nodes[i].bounds.Contains(nodes[i + 1].bounds));
+				EXPECT_TRUE(nodes[i].bounds.Contains(nodes[nodes[i].offset].bounds));
+			}
+		}
+
+		EXPECT_EQ(primitive_count, _triangles.size());
+	}
+}
+
+/**
+*	\brief Unit test for hierarchy build
+*/
+TEST(BVHUnitTest, Build)
+{
+	BVH bvh;
+	EXPECT_TRUE(bvh.IsEmpty());
+	EXPECT_EQ(bvh.GetBounds(), AABB::Empty);
+
+	std::vector<Triangle> triangles = RandomTriangles(1000);
+	bvh.Build(triangles.data(), triangles.size());
+
+	EXPECT_FALSE(bvh.IsEmpty());
+	EXPECT_LE(bvh.GetNodes().size(), 2 * triangles.size() - 1);
+	CheckHierarchy(bvh, triangles);
+
+	AABB bounds = AABB::Empty;
+	for (const Triangle& triangle : triangles)
+		bounds.Encapsulate(triangle.GetAABB());
+	EXPECT_EQ(bvh.GetBounds(), bounds);
+
+	std::vector<uint32_t> indices = bvh.GetPrimitiveIndices();
+	std::sort(indices.begin(), indices.end());
+	for (uint32_t i = 0; i < indices.size(); ++i)
+		EXPECT_EQ(indices[i], i);
+
+	// Multithreaded build produces the same tree.
+	std::vector<Triangle> large_triangles = RandomTriangles(20000);
+	BVH single_thread;
+	BVH multi_thread;
+	single_thread.Build(large_triangles.data(), large_triangles.size(), false);
+	multi_thread.Build(large_triangles.data(), large_triangles.size(), true);
+
+	ASSERT_EQ(single_thread.GetNodes().size(), multi_thread.GetNodes().size());
+	EXPECT_EQ(single_thread.GetPrimitiveIndices(), multi_thread.GetPrimitiveIndices());
+	for (size_t i = 0; i < single_thread.GetNodes().size(); ++i)
+	{
+		EXPECT_EQ(single_thread.GetNodes()[i].bounds, multi_thread.GetNodes()[i].bounds);
+		EXPECT_EQ(single_thread.GetNodes()[i].offset, multi_thread.GetNodes()[i].offset);
+	}
+
+	// Thin overlapping triangles make every SAH split worse than a leaf, the median split still separates centroids.
+	std::vector<Triangle> overlapping(64);
+	for (size_t i = 0; i < overlapping.size(); ++i)
+	{
+		const float x = static_cast<float>((i * 37) % overlapping.size()) * 0.1f;
+		overlapping[i] = Triangle(Vec3(x, -500.f, -500.f), Vec3(x, 500.f, -500.f), Vec3(x, 0.f, 500.f));
+	}
+
+	bvh.Build(overlapping.data(), overlapping.size());
+	ASSERT_FALSE(bvh.GetNodes()[0].IsLeaf());
+	CheckHierarchy(bvh, overlapping);
+
+	const std::vector<uint32_t>& split_indices = bvh.GetPrimitiveIndices();
+	float left_max = -std::numeric_limits<float>::max();
+	float right_min = std::numeric_limits<float>::max();
+	for (size_t i = 0; i < split_indices.size(); ++i)
+	{
+		const float x = overlapping[split_indices[i]].GetAABB().GetCenter().X;
+		if (i < split_indices.size() / 2)
+			left_max = std::max(left_max, x);
+		else
+			right_min = std::min(right_min, x);
+	}
+	EXPECT_LE(left_max, right_min);
+
+	bvh.Clear();
+	EXPECT_TRUE(bvh.IsEmpty());
+}
+
+/**
+*	\brief Unit test for hierarchy queries, compared with brute force
+*/
+TEST(BVHUnitTest, Queries)
+{
+	std::vector<Triangle> triangles = RandomTriangles(2000);
+
+	BVH bvh;
+	bvh.Build(triangles.data(), triangles.size());
+
+	for (int i = 0; i < 200; ++i)
+	{
+		Ray ray = Ray::FromPoints(Vec3(RandomFloat(-80, 80), RandomFloat(-80, 80), RandomFloat(-80, 80)),
+			Vec3(RandomFloat(-20, 20), RandomFloat(-20, 20), RandomFloat(-20, 20)));
+
+		float expected_distance = std::numeric_limits<float>::max();
+		bool expected_hit = BruteForceRaycast(ray, triangles, expected_distance);
+
+		float distance = std::numeric_limits<float>::max();
+		uint32_t primitive = 0;
+		EXPECT_EQ(bvh.Raycast(ray, triangles.data(), distance, primitive), expected_hit);
+		if (expected_hit)
+		{
+			EXPECT_FLOAT_EQ(distance, expected_distance);
+			float primitive_distance = 0.f;
+			EXPECT_TRUE(Intersection::RayTriangle(ray, triangles[primitive], primitive_distance));
+			EXPECT_FLOAT_EQ(primitive_distance, expected_distance);
+		}
+	}
+
+	std::vector<uint32_t> results(triangles.size());
+	for (int i = 0; i < 50; ++i)
+	{
+		AABB query = AABB::FromCenterExtents(Vec3(RandomFloat(-50, 50), RandomFloat(-50, 50), RandomFloat(-50, 50)), Vec3(RandomFloat(1, 15)));
+
+		std::vector<uint32_t> expected;
+		for (uint32_t j = 0; j < triangles.size(); ++j)
+		{
+			if (triangles[j].GetAABB().Intersects(query))
+				expected.push_back(j);
+		}
+
+		size_t count = bvh.QueryAABB(query, results.data(), results.size());
+		ASSERT_EQ(count, expected.size());
+
+		std::vector<uint32_t> found(results.begin(), results.begin() + count);
+		std::sort(found.begin(), found.end());
+		EXPECT_EQ(found, expected);
+
+		EXPECT_EQ(bvh.QueryAABB(query, results.data(), 0), expected.size());
+	}
+
+	for (int i = 0; i < 50; ++i)
+	{
+		Vec3 point(RandomFloat(-60, 60), RandomFloat(-60, 60), RandomFloat(-60, 60));
+
+		float expected_distance = std::numeric_limits<float>::max();
+		for (const Triangle& triangle : triangles)
+			expected_distance = std::min(expected_distance, Vec3::Distance(point, triangle.ClosestPoint(point)));
+
+		float distance = std::numeric_limits<float>::max();
+		Vec3 closest;
+		uint32_t primitive = 0;
+		EXPECT_TRUE(bvh.ClosestPoint(point, triangles.data(), distance, closest, primitive));
+		EXPECT_FLOAT_EQ(distance, expected_distance);
+		EXPECT_TRUE(closest.Equals(triangles[primitive].ClosestPoint(point)));
+	}
+}
+
+/**
+*	\brief Unit test for hierarchy refit
+*/
+TEST(BVHUnitTest, Refit)
+{
+	std::vector<Triangle> triangles = RandomTriangles(500);
+
+	BVH bvh;
+	bvh.Build(triangles.data(), triangles.size());
+
+	for (size_t i = 0; i < triangles.size(); ++i)
+	{
+		Vec3 offset(Math::Sin(static_cast<float>(i)) * 5.f, 3.f, Math::Cos(static_cast<float>(i)) * 5.f);
+		triangles[i] = Triangle(triangles[i].a + offset, triangles[i].b + offset, triangles[i].c + offset);
+	}
+
+	bvh.Refit(triangles.data());
+	CheckHierarchy(bvh, triangles);
+
+	std::vector<AABB> bounds(triangles.size());
+	for (size_t i = 0; i < triangles.size(); ++i)
+		bounds[i] = triangles[i].GetAABB().GetTransformed(Mat4::TranslationMatrix(Vec3(0.f, -10.f, 0.f)));
+
+	bvh.Refit(bounds.data());
+	EXPECT_EQ(bvh.GetBounds(), AABB::UnionBatch(bounds.data(), bounds.size()));
+
+	Ray ray(Vec3(0.f, 100.f, 0.f), Vec3::Down);
+	float expected_distance = std::numeric_limits<float>::max();
+	bool expected_hit = BruteForceRaycast(ray, triangles, expected_distance);
+	float distance = std::numeric_limits<float>::max();
+	uint32_t primitive = 0;
+	bvh.Refit(triangles.data());
+	EXPECT_EQ(bvh.Raycast(ray, triangles.data(), distance, primitive), expected_hit);
+}
@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include <Collections/Mathlib.hpp>
+
+using namespace Mathlib;
+
+namespace
+{
+	float RandomFloat(int _min, int _max)
+	{
+		return static_cast<float>(Math::Random(_min * 100, _max * 100)) / 100.f;
+	}
+
+	std::vector<Vec3> RandomPoints(size_t _count, int _extent)
+	{
+		std::vector<Vec3> points(_count);
+
+		for (Vec3& point : points)
+			point = Vec3(RandomFloat(-_extent, _extent), RandomFloat(-_extent, _extent), RandomFloat(-_extent, _extent));
+
+		return points;
+	}
+
+	std::vector<float> BruteForceKNearest(const std::vector<Vec3>& _points, const Vec3& _point, size_t _k)
+	{
+		std::vector<float> distances;
+
+		for (const Vec3& point : _points)
+			distances.push_back(Vec3::SqrDistance(point, _point));
+
+		std::sort(distances.begin(), distances.end());
+		distances.resize(std::min(_k, distances.size()));
+
+		return distances;
+	}
+
+	std::vector<uint32_t> BruteForceRadius(const std::vector<Vec3>& _points, const Vec3& _center, float _radius)
+	{
+		std::vector<uint32_t> results;
+
+		for (size_t i = 0; i < _points.size(); ++i)
+		{
+			if (Vec3::SqrDistance(_points[i], _center) <= _radius * _radius)
+				results.push_back(static_cast<uint32_t>(i));
+		}
+
+		return results;
+	}
+}
+
+/**
+*	\brief Unit test for KDTree construction
+*/
+TEST(KDTreeUnitTest, Construction)
+{
+	KDTree tree;
+	EXPECT_TRUE(tree.IsEmpty());
+
+	uint32_t result = 0;
+	EXPECT_EQ(tree.QueryKNearest(Vec3::Zero, 1, &result), 0u);
+	EXPECT_EQ(tree.QueryRadius(Vec3::Zero, 10.f, &result, 1), 0u);
+
+	Vec3 point(1.f, 2.f, 3.f);
+	tree.Build(&point, 1);
+	EXPECT_FALSE(tree.IsEmpty());
+	EXPECT_EQ(tree.GetPointCount(), 1u);
+
+	float sqr_distance = 0.f;
+	EXPECT_EQ(tree.QueryKNearest(Vec3::Zero, 3, &result, &sqr_distance), 1u);
+	EXPECT_EQ(result, 0u);
+	EXPECT_FLOAT_EQ(sqr_distance, 14.f);
+
+	tree.Clear();
+	EXPECT_TRUE(tree.IsEmpty());
+}
+
+/**
+*	\brief Unit test for KDTree k nearest and radius queries against brute force
+*/
+TEST(KDTreeUnitTest, Queries)
+{
+	std::vector<Vec3> points = RandomPoints(3000, 30);
+
+	KDTree tree;
+	tree.Build(points.data(), points.size());
+	EXPECT_EQ(tree.GetPointCount(), points.size());
+
+	const size_t k = 10;
+	uint32_t indices[k];
+	float sqr_distances[k];
+	std::vector<uint32_t> results(points.size());
+
+	for (int query = 0; query < 50; ++query)
+	{
+		Vec3 point(RandomFloat(-40, 40), RandomFloat(-40, 40), RandomFloat(-40, 40));
+
+		std::vector<float> expected = BruteForceKNearest(points, point, k);
+		ASSERT_EQ(tree.QueryKNearest(point, k, indices, sqr_distances), k);
+
+		for (size_t i = 0; i < k; ++i)
+		{
+			EXPECT_FLOAT_EQ(sqr_distances[i], expected[i]);
+			EXPECT_FLOAT_EQ(Vec3::SqrDistance(points[indices[i]], point), sqr_distances[i]);
+		}
+
+		float radius = RandomFloat(0, 8);
+		std::vector<uint32_t> expected_radius = BruteForceRadius(points, point, radius);
+
+		size_t count = tree.QueryRadius(point, radius, results.data(), results.size());
+		ASSERT_EQ(count, expected_radius.size());
+
+		std::vector<uint32_t> found(results.begin(), results.begin() + count);
+		std::sort(found.begin(), found.end());
+		EXPECT_EQ(found, expected_radius);
+	}
+}
+
+/**
+*	\brief Unit test for KDTree multithreaded build and batched queries
+*/
+TEST(KDTreeUnitTest, Batch)
+{
+	std::vector<Vec3> points = RandomPoints(60000, 100);
+
+	KDTree tree;
+	tree.Build(points.data(), points.size(), true);
+
+	std::vector<Vec3> queries = RandomPoints(500, 110);
+
+	const size_t k = 4;
+	std::vector<uint32_t> indices(queries.size() * k);
+	std::vector<float> sqr_distances(queries.size() * k);
+	tree.QueryKNearestBatch(queries.data(), queries.size(), k, indices.data(), sqr_distances.data(), true);
+
+	const size_t capacity = 64;
+	std::vector<uint32_t> results(queries.size() * capacity);
+	std::vector<size_t> counts(queries.size());
+	tree.QueryRadiusBatch(queries.data(), queries.size(), 4.f, results.data(), capacity, counts.data(), true);
+
+	for (size_t query = 0; query < queries.size(); query += 25)
+	{
+		std::vector<float> expected = BruteForceKNearest(points, queries[query], k);
+		for (size_t i = 0; i < k; ++i)
+			EXPECT_FLOAT_EQ(sqr_distances[query * k + i], expected[i]);
+
+		EXPECT_EQ(counts[query], BruteForceRadius(points, queries[query], 4.f).size());
+	}
+
+	// Missing neighbors are filled with invalid entries.
+	KDTree small_tree;
+	small_tree.Build(points.data(), 2);
+
+	uint32_t small_indices[3];
+	float small_distances[3];
+	small_tree.QueryKNearestBatch(queries.data(), 1, 3, small_indices, small_distances);
+	EXPECT_NE(small_indices[0], KDTree::InvalidIndex);
+	EXPECT_NE(small_indices[1], KDTree::InvalidIndex);
+	EXPECT_EQ(small_indices[2], KDTree::InvalidIndex);
+	EXPECT_EQ(small_distances[2], std::numeric_limits<float>::max());
+}
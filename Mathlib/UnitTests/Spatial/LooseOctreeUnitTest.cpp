@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include <Collections/Mathlib.hpp>
+
+using namespace Mathlib;
+
+namespace
+{
+	float RandomFloat(int _min, int _max)
+	{
+		return static_cast<float>(Math::Random(_min * 100, _max * 100)) / 100.f;
+	}
+
+	AABB RandomBox(int _extent)
+	{
+		Vec3 center(RandomFloat(-_extent, _extent), RandomFloat(-_extent, _extent), RandomFloat(-_extent, _extent));
+		Vec3 extents(RandomFloat(0, 4), RandomFloat(0, 4), RandomFloat(0, 4));
+		return AABB::FromCenterExtents(center, extents);
+	}
+
+	template<typename Test>
+	std::vector<uint32_t> BruteForce(const std::vector<AABB>& _boxes, const std::vector<uint32_t>& _handles, Test _test)
+	{
+		std::vector<uint32_t> results;
+
+		for (size_t i = 0; i < _boxes.size(); ++i)
+		{
+			if (_test(_boxes[i]))
+				results.push_back(_handles[i]);
+		}
+
+		std::sort(results.begin(), results.end());
+		return results;
+	}
+
+	std::vector<uint32_t> Sorted(const std::vector<uint32_t>& _results, size_t _count)
+	{
+		std::vector<uint32_t> sorted(_results.begin(), _results.begin() + std::min(_count, _results.size()));
+		std::sort(sorted.begin(), sorted.end());
+		return sorted;
+	}
+}
+
+/**
+*	\brief Unit test for LooseOctree insertion, removal and node pooling
+*/
+TEST(LooseOctreeUnitTest, InsertRemove)
+{
+	LooseOctree octree(AABB(Vec3(-100.f, -100.f, -100.f), Vec3(100.f, 100.f, 100.f)), 6);
+
+	EXPECT_EQ(octree.GetObjectCount(), 0u);
+	EXPECT_EQ(octree.GetNodeCount(), 1u);
+	EXPECT_EQ(octree.GetWorldBounds(), AABB(Vec3(-100.f, -100.f, -100.f), Vec3(100.f, 100.f, 100.f)));
+
+	AABB small = AABB::FromCenterExtents(Vec3(50.f, 50.f, 50.f), Vec3(0.5f, 0.5f, 0.5f));
+	uint32_t handle = octree.Insert(small);
+
+	EXPECT_EQ(octree.GetObjectCount(), 1u);
+	EXPECT_EQ(octree.GetBounds(handle), small);
+	EXPECT_EQ(octree.GetNodeCount(), 7u);
+
+	// Large objects stay near the root.
+	uint32_t large = octree.Insert(AABB::FromCenterExtents(Vec3::Zero, Vec3(80.f, 80.f, 80.f)));
+	EXPECT_EQ(octree.GetNodeCount(), 7u);
+
+	octree.Remove(handle);
+	EXPECT_EQ(octree.GetObjectCount(), 1u);
+	EXPECT_EQ(octree.GetNodeCount(), 1u);
+
+	// Removed handles are recycled.
+	EXPECT_EQ(octree.Insert(small), handle);
+
+	octree.Remove(large);
+	octree.Clear();
+	EXPECT_EQ(octree.GetObjectCount(), 0u);
+	EXPECT_EQ(octree.GetNodeCount(), 1u);
+}
+
+/**
+*	\brief Unit test for LooseOctree queries against brute force, before and after moving objects
+*/
+TEST(LooseOctreeUnitTest, Queries)
+{
+	LooseOctree octree(AABB(Vec3(-100.f, -100.f, -100.f), Vec3(100.f, 100.f, 100.f)));
+
+	std::vector<AABB> boxes;
+	std::vector<uint32_t> handles;
+
+	// Some objects are centered outside the world.
+	for (int i = 0; i < 1000; ++i)
+	{
+		boxes.push_back(RandomBox(110));
+		handles.push_back(octree.Insert(boxes.back()));
+	}
+
+	std::vector<uint32_t> results(boxes.size());
+
+	Frustum frustum = Frustum::FromCamera(COORDINATE_SYSTEM::RIGHT_HAND, Vec3(0.f, 10.f, 0.f), Vec3(1.f, -0.2f, 0.3f), Vec3::Up,
+		60.f * Math::DegToRad, 1.5f, 0.5f, 80.f);
+
+	for (int pass = 0; pass < 2; ++pass)
+	{
+		for (int query = 0; query < 10; ++query)
+		{
+			AABB box = RandomBox(100);
+			box.Encapsulate(box.max + Vec3(10.f, 10.f, 10.f));
+			size_t count = octree.QueryAABB(box, results.data(), results.size());
+			EXPECT_EQ(Sorted(results, count), BruteForce(boxes, handles, [&box](const AABB& _other) { return box.Intersects(_other); }));
+
+			Sphere sphere(Vec3(RandomFloat(-100, 100), RandomFloat(-100, 100), RandomFloat(-100, 100)), RandomFloat(1, 30));
+			count = octree.QuerySphere(sphere, results.data(), results.size());
+			EXPECT_EQ(Sorted(results, count), BruteForce(boxes, handles, [&sphere](const AABB& _other) { return sphere.Intersects(_other); }));
+
+			Ray ray(Vec3(RandomFloat(-100, 100), RandomFloat(-100, 100), RandomFloat(-100, 100)),
+				Vec3(RandomFloat(-1, 1), RandomFloat(-1, 1), RandomFloat(-1, 1) + 0.01f).GetNormalized());
+			count = octree.QueryRay(ray, 150.f, results.data(), results.size());
+			EXPECT_EQ(Sorted(results, count), BruteForce(boxes, handles, [&ray](const AABB& _other)
+			{
+				float distance = 0.f;
+				return Intersection::RayAABB(ray, _other, distance) && distance <= 150.f;
+			}));
+		}
+
+		size_t count = octree.QueryFrustum(frustum, results.data(), results.size());
+		EXPECT_EQ(Sorted(results, count), BruteForce(boxes, handles, [&frustum](const AABB& _other) { return frustum.Intersects(_other); }));
+
+		// Move every object then query again.
+		for (size_t i = 0; i < boxes.size(); ++i)
+		{
+			boxes[i] = i % 2 ? RandomBox(110) : AABB(boxes[i].min + Vec3(0.3f, -0.2f, 0.1f), boxes[i].max + Vec3(0.3f, -0.2f, 0.1f));
+			octree.Move(handles[i], boxes[i]);
+		}
+	}
+
+	EXPECT_EQ(octree.GetObjectCount(), boxes.size());
+
+	// Capacity is honored while the total is still reported.
+	uint32_t small_buffer[2];
+	EXPECT_EQ(octree.QueryAABB(octree.GetWorldBounds(), small_buffer, 2),
+		BruteForce(boxes, handles, [&octree](const AABB& _other) { return octree.GetWorldBounds().Intersects(_other); }).size());
+}
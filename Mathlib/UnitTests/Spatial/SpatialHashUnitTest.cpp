@@ -0,0 +1,189 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include <Collections/Mathlib.hpp>
+
+using namespace Mathlib;
+
+namespace
+{
+	float RandomFloat(int _min, int _max)
+	{
+		return static_cast<float>(Math::Random(_min * 100, _max * 100)) / 100.f;
+	}
+
+	std::vector<Vec3> RandomPoints(size_t _count, int _extent)
+	{
+		std::vector<Vec3> points(_count);
+
+		for (Vec3& point : points)
+			point = Vec3(RandomFloat(-_extent, _extent), RandomFloat(-_extent, _extent), RandomFloat(-_extent, _extent));
+
+		return points;
+	}
+
+	std::vector<uint32_t> BruteForceRadius(const std::vector<Vec3>& _points, const Vec3& _center, float _radius)
+	{
+		std::vector<uint32_t> results;
+
+		for (size_t i = 0; i < _points.size(); ++i)
+		{
+			if ((_points[i] - _center).SquaredLength() <= _radius * _radius)
+				results.push_back(static_cast<uint32_t>(i));
+		}
+
+		return results;
+	}
+
+	std::vector<float> BruteForceKNearest(const std::vector<Vec3>& _points, const Vec3& _point, size_t _k)
+	{
+		std::vector<float> distances;
+
+		for (const Vec3& point : _points)
+			distances.push_back((point - _point).SquaredLength());
+
+		std::sort(distances.begin(), distances.end());
+		distances.resize(std::min(_k, distances.size()));
+
+		return distances;
+	}
+}
+
+/**
+*	\brief Unit test for SpatialHash construction and cell size
+*/
+TEST(SpatialHashUnitTest, Construction)
+{
+	SpatialHash grid(2.5f);
+
+	EXPECT_FLOAT_EQ(grid.GetCellSize(), 2.5f);
+	EXPECT_EQ(grid.GetPointCount(), 0u);
+
+	std::vector<Vec3> points = RandomPoints(100, 10);
+	grid.Build(points.data(), points.size());
+	EXPECT_EQ(grid.GetPointCount(), 100u);
+
+	grid.Clear();
+	EXPECT_EQ(grid.GetPointCount(), 0u);
+
+	uint32_t result = 0;
+	EXPECT_EQ(grid.QueryRadius(Vec3::Zero, 100.f, &result, 1), 0u);
+	EXPECT_EQ(grid.QueryKNearest(Vec3::Zero, 1, &result), 0u);
+}
+
+/**
+*	\brief Unit test for SpatialHash radius query against brute force
+*/
+TEST(SpatialHashUnitTest, QueryRadius)
+{
+	std::vector<Vec3> points = RandomPoints(2000, 20);
+
+	SpatialHash grid(2.f);
+	grid.Build(points.data(), points.size());
+
+	std::vector<uint32_t> results(points.size());
+
+	for (int query = 0; query < 50; ++query)
+	{
+		Vec3 center(RandomFloat(-25, 25), RandomFloat(-25, 25), RandomFloat(-25, 25));
+		float radius = RandomFloat(0, 6);
+
+		std::vector<uint32_t> expected = BruteForceRadius(points, center, radius);
+
+		size_t count = grid.QueryRadius(center, radius, results.data(), results.size());
+		ASSERT_EQ(count, expected.size());
+
+		std::vector<uint32_t> found(results.begin(), results.begin() + count);
+		std::sort(found.begin(), found.end());
+		EXPECT_EQ(found, expected);
+	}
+
+	// Large radius falls back to a scan and still honors capacity.
+	uint32_t small_buffer[4];
+	EXPECT_EQ(grid.QueryRadius(Vec3::Zero, 1000.f, small_buffer, 4), points.size());
+
+	// Radii and positions beyond the cell coordinate range.
+	EXPECT_EQ(grid.QueryRadius(Vec3::Zero, std::numeric_limits<float>::max(), small_buffer, 4), points.size());
+	EXPECT_EQ(grid.QueryRadius(Vec3(1e30f, 0.f, 0.f), 1.f, small_buffer, 4), 0u);
+}
+
+/**
+*	\brief Unit test for SpatialHash k nearest query against brute force
+*/
+TEST(SpatialHashUnitTest, QueryKNearest)
+{
+	std::vector<Vec3> points = RandomPoints(2000, 20);
+
+	SpatialHash grid(1.5f);
+	grid.Build(points.data(), points.size());
+
+	const size_t k = 8;
+	uint32_t indices[k];
+	float sqr_distances[k];
+
+	for (int query = 0; query < 50; ++query)
+	{
+		// Some queries lie outside the point bounds.
+		Vec3 point(RandomFloat(-40, 40), RandomFloat(-40, 40), RandomFloat(-40, 40));
+
+		std::vector<float> expected = BruteForceKNearest(points, point, k);
+
+		ASSERT_EQ(grid.QueryKNearest(point, k, indices, sqr_distances), k);
+
+		for (size_t i = 0; i < k; ++i)
+		{
+			EXPECT_FLOAT_EQ(sqr_distances[i], expected[i]);
+			EXPECT_FLOAT_EQ((points[indices[i]] - point).SquaredLength(), sqr_distances[i]);
+		}
+	}
+
+	// Asking for more neighbors than stored points returns every point.
+	std::vector<uint32_t> all(points.size() + 10);
+	EXPECT_EQ(grid.QueryKNearest(Vec3::Zero, all.size(), all.data()), points.size());
+
+	// Few points far apart: the ring walk gives up for a linear scan instead of visiting the whole grid.
+	const Vec3 sparse_points[3] = { Vec3(-5000.f, 0.f, 0.f), Vec3(5000.f, 5000.f, 5000.f), Vec3(10.f, 0.f, 0.f) };
+	SpatialHash sparse(1.f);
+	sparse.Build(sparse_points, 3);
+
+	ASSERT_EQ(sparse.QueryKNearest(Vec3::Zero, 2, indices, sqr_distances), 2u);
+	EXPECT_EQ(indices[0], 2u);
+	EXPECT_EQ(indices[1], 0u);
+	EXPECT_FLOAT_EQ(sqr_distances[0], 100.f);
+	EXPECT_FLOAT_EQ(sqr_distances[1], 25000000.f);
+}
+
+/**
+*	\brief Unit test for SpatialHash multithreaded build matching the single threaded one
+*/
+TEST(SpatialHashUnitTest, MultithreadedBuild)
+{
+	std::vector<Vec3> points = RandomPoints(50000, 50);
+
+	SpatialHash single(3.f);
+	single.Build(points.data(), points.size());
+
+	SpatialHash multi(3.f);
+	multi.Build(points.data(), points.size(), true);
+
+	EXPECT_EQ(multi.GetPointCount(), points.size());
+
+	std::vector<uint32_t> single_results(points.size());
+	std::vector<uint32_t> multi_results(points.size());
+
+	for (int query = 0; query < 20; ++query)
+	{
+		Vec3 center(RandomFloat(-50, 50), RandomFloat(-50, 50), RandomFloat(-50, 50));
+
+		size_t single_count = single.QueryRadius(center, 5.f, single_results.data(), single_results.size());
+		size_t multi_count = multi.QueryRadius(center, 5.f, multi_results.data(), multi_results.size());
+
+		// Stable counting sort: identical output order.
+		ASSERT_EQ(single_count, multi_count);
+		for (size_t i = 0; i < single_count; ++i)
+			EXPECT_EQ(single_results[i], multi_results[i]);
+	}
+}
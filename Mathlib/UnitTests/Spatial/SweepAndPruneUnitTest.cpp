@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <Collections/Mathlib.hpp>
+
+using namespace Mathlib;
+
+namespace
+{
+	float RandomFloat(int _min, int _max)
+	{
+		return static_cast<float>(Math::Random(_min * 100, _max * 100)) / 100.f;
+	}
+
+	AABB RandomBox(int _extent)
+	{
+		Vec3 center(RandomFloat(-_extent, _extent), RandomFloat(-_extent, _extent), RandomFloat(-_extent, _extent));
+		Vec3 extents(RandomFloat(0, 3), RandomFloat(0, 3), RandomFloat(0, 3));
+		return AABB::FromCenterExtents(center, extents);
+	}
+
+	std::vector<std::pair<uint32_t, uint32_t>> SortedPairs(const std::vector<BroadphasePair>& _pairs)
+	{
+		std::vector<std::pair<uint32_t, uint32_t>> result;
+
+		for (const BroadphasePair& pair : _pairs)
+			result.emplace_back(pair.first, pair.second);
+
+		std::sort(result.begin(), result.end());
+		return result;
+	}
+
+	std::vector<std::pair<uint32_t, uint32_t>> BruteForcePairs(const std::vector<AABB>& _boxes, const std::vector<uint32_t>& _handles)
+	{
+		std::vector<std::pair<uint32_t, uint32_t>> result;
+
+		for (size_t i = 0; i < _boxes.size(); ++i)
+		{
+			for (size_t j = i + 1; j < _boxes.size(); ++j)
+			{
+				if (_boxes[i].Intersects(_boxes[j]))
+					result.emplace_back(std::min(_handles[i], _handles[j]), std::max(_handles[i], _handles[j]));
+			}
+		}
+
+		std::sort(result.begin(), result.end());
+		return result;
+	}
+}
+
+/**
+*	\brief Unit test for SweepAndPrune proxies and touching boxes
+*/
+TEST(SweepAndPruneUnitTest, Proxies)
+{
+	SweepAndPrune broadphase;
+
+	uint32_t a = broadphase.Insert(AABB(Vec3(0.f, 0.f, 0.f), Vec3(1.f, 1.f, 1.f)));
+	uint32_t b = broadphase.Insert(AABB(Vec3(1.f, 0.f, 0.f), Vec3(2.f, 1.f, 1.f)));
+	uint32_t c = broadphase.Insert(AABB(Vec3(0.f, 5.f, 0.f), Vec3(2.f, 6.f, 1.f)));
+
+	EXPECT_EQ(broadphase.GetProxyCount(), 3u);
+	EXPECT_EQ(broadphase.GetBounds(c), AABB(Vec3(0.f, 5.f, 0.f), Vec3(2.f, 6.f, 1.f)));
+
+	// Touching on X counts as overlap, c is filtered on Y.
+	broadphase.Update();
+	ASSERT_EQ(broadphase.GetPairs().size(), 1u);
+	EXPECT_EQ(broadphase.GetPairs()[0].first, a);
+	EXPECT_EQ(broadphase.GetPairs()[0].second, b);
+
+	broadphase.SetBounds(c, AABB(Vec3(0.5f, 0.5f, 0.5f), Vec3(0.6f, 0.6f, 0.6f)));
+	broadphase.Update();
+	EXPECT_EQ(broadphase.GetPairs().size(), 2u);
+
+	broadphase.Remove(b);
+	broadphase.Update();
+	EXPECT_EQ(broadphase.GetProxyCount(), 2u);
+	ASSERT_EQ(broadphase.GetPairs().size(), 1u);
+	EXPECT_EQ(broadphase.GetPairs()[0].first, std::min(a, c));
+	EXPECT_EQ(broadphase.GetPairs()[0].second, std::max(a, c));
+
+	// Removed handles are recycled after an update.
+	EXPECT_EQ(broadphase.Insert(AABB(Vec3::Zero, Vec3::One)), b);
+
+	// Inverted boxes overlap nothing, alone or among other boxes.
+	SweepAndPrune inverted;
+	inverted.Insert(AABB(Vec3(1.f, 0.f, 0.f), Vec3(0.f, 1.f, 1.f)));
+	inverted.Update();
+	EXPECT_TRUE(inverted.GetPairs().empty());
+
+	uint32_t empty = broadphase.Insert(AABB::Empty);
+	uint32_t flat = broadphase.Insert(AABB(Vec3(0.f, 2.f, 0.f), Vec3(1.f, -2.f, 1.f)));
+	broadphase.Update();
+	EXPECT_EQ(broadphase.GetPairs().size(), 3u);
+	for (const BroadphasePair& pair : broadphase.GetPairs())
+	{
+		EXPECT_NE(pair.second, empty);
+		EXPECT_NE(pair.second, flat);
+	}
+
+	broadphase.Clear();
+	broadphase.Update();
+	EXPECT_EQ(broadphase.GetProxyCount(), 0u);
+	EXPECT_TRUE(broadphase.GetPairs().empty());
+}
+
+/**
+*	\brief Unit test for SweepAndPrune pairs against brute force over moving, inserted and removed boxes
+*/
+TEST(SweepAndPruneUnitTest, Frames)
+{
+	SweepAndPrune broadphase;
+
+	std::vector<AABB> boxes;
+	std::vector<uint32_t> handles;
+
+	for (int i = 0; i < 500; ++i)
+	{
+		boxes.push_back(RandomBox(40));
+		handles.push_back(broadphase.Insert(boxes.back()));
+	}
+
+	for (int frame = 0; frame < 10; ++frame)
+	{
+		broadphase.Update();
+		EXPECT_EQ(SortedPairs(broadphase.GetPairs()), BruteForcePairs(boxes, handles));
+
+		for (size_t i = 0; i < boxes.size(); ++i)
+		{
+			Vec3 offset(RandomFloat(-1, 1) * 0.5f, RandomFloat(-1, 1) * 0.5f, RandomFloat(-1, 1) * 0.5f);
+			boxes[i] = AABB(boxes[i].min + offset, boxes[i].max + offset);
+			broadphase.SetBounds(handles[i], boxes[i]);
+		}
+
+		for (int change = 0; change < 5; ++change)
+		{
+			size_t index = static_cast<size_t>(Math::Random(0, static_cast<int>(boxes.size()) - 1));
+			broadphase.Remove(handles[index]);
+			boxes.erase(boxes.begin() + index);
+			handles.erase(handles.begin() + index);
+
+			boxes.push_back(RandomBox(40));
+			handles.push_back(broadphase.Insert(boxes.back()));
+		}
+	}
+
+	broadphase.Update();
+	EXPECT_EQ(broadphase.GetProxyCount(), boxes.size());
+	EXPECT_EQ(SortedPairs(broadphase.GetPairs()), BruteForcePairs(boxes, handles));
+}
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <Collections/Mathlib.hpp>
+
+using namespace Mathlib;
+
+/**
+*	\brief Unit test for double precision transform
+*/
+TEST(LargeWorldUnitTest, Transformd)
+{
+	Quat rotation(90.f, Vec3::Up);
+	Transformd transform(rotation, Vec3d(1e7, 2.0, -3e7), Vec3(2.f, 1.f, 1.f));
+
+	// Same matrix as the float transform, with the translation in double.
+	Mat4 float_matrix = Transform(rotation, Vec3::Zero, Vec3(2.f, 1.f, 1.f)).ToMatrixWithScale();
+	Mat4d matrix = transform.ToMatrixWithScale();
+	EXPECT_EQ(matrix(0, 3), 1e7);
+	EXPECT_EQ(matrix(2, 3), -3e7);
+	EXPECT_FLOAT_EQ(static_cast<float>(matrix(0, 2)), float_matrix.e02);
+	EXPECT_FLOAT_EQ(static_cast<float>(matrix(2, 0)), float_matrix.e20);
+	EXPECT_EQ(transform.ToMatrixNoScale()(3, 3), 1.0);
+
+	Transform local = transform.ToTransform(Vec3d(1e7 - 0.25, 0.0, -3e7));
+	EXPECT_EQ(local.position, Vec3(0.25f, 2.f, 0.f));
+	EXPECT_TRUE(local.rotation.Equals(rotation));
+	EXPECT_EQ(local.scale, Vec3(2.f, 1.f, 1.f));
+
+	// A millimeter offset under a parent far from the origin.
+	Transformd child(Quat::Identity, Vec3d(0.001, 0.0, 0.0));
+	Transformd world = child.GetWorldTransfrom(Transformd(Quat::Identity, Vec3d(1e8, 0.0, 0.0)));
+	EXPECT_NEAR(world.position.X - 1e8, 0.001, 1e-7);
+
+	Transformd rotated = child.GetWorldTransfrom(transform);
+	EXPECT_TRUE(rotated.position.Equals(Vec3d(1e7, 2.0, -3e7 - 0.001), 1e-6));
+
+	EXPECT_EQ(Transformd(Transform(Vec3(1.f, 2.f, 3.f))), Transformd(Quat::Identity, Vec3d(1.0, 2.0, 3.0)));
+}
+
+/**
+*	\brief Unit test for camera relative conversions
+*/
+TEST(LargeWorldUnitTest, CameraRelative)
+{
+	const size_t count = 10000;
+	const Vec3d camera(1.5e8, -2e7, 3.25e6);
+
+	std::vector<Vec3d> positions(count);
+	std::vector<Transformd> transforms(count);
+	std::vector<Mat4d> matrices(count);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		positions[i] = camera + Vec3d(0.001 * i, -0.5 * i, 3.0);
+		transforms[i] = Transformd(Quat(static_cast<float>(i % 360), Vec3::Forward), positions[i], Vec3(1.f, 2.f, 3.f));
+		matrices[i] = transforms[i].ToMatrixWithScale();
+	}
+
+	std::vector<Vec3> relative(count);
+	std::vector<Vec3> threaded_relative(count);
+	LargeWorld::ToCameraRelative(positions.data(), count, camera, relative.data());
+	LargeWorld::ToCameraRelative(positions.data(), count, camera, threaded_relative.data(), true);
+
+	std::vector<Mat4> transform_matrices(count);
+	std::vector<Mat4> matrix_matrices(count);
+	LargeWorld::ToCameraRelative(transforms.data(), count, camera, transform_matrices.data(), true);
+	LargeWorld::ToCameraRelative(matrices.data(), count, camera, matrix_matrices.data());
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		// Float positions far from the origin would be off by meters.
+		Vec3 expected(static_cast<float>(0.001 * i), static_cast<float>(-0.5 * i), 3.f);
+		EXPECT_TRUE(relative[i].Equals(expected, 0.000001f));
+		EXPECT_EQ(threaded_relative[i], relative[i]);
+
+		Mat4 expected_matrix = transforms[i].ToTransform(camera).ToMatrixWithScale();
+		EXPECT_TRUE(transform_matrices[i].Equals(expected_matrix, 0.00001f));
+		EXPECT_TRUE(matrix_matrices[i].Equals(expected_matrix, 0.00001f));
+	}
+}
+
+/**
+*	\brief Unit test for floating origin rebasing
+*/
+TEST(LargeWorldUnitTest, Rebase)
+{
+	Vec3d origin = LargeWorld::ComputeOrigin(Vec3d(1000.3, -1500.7, 12.0), 1024.0);
+	EXPECT_EQ(origin, Vec3d(1024.0, -1024.0, 0.0));
+	EXPECT_EQ(LargeWorld::ComputeOrigin(Vec3d(1.5, 2.5, 3.5), 0.0), Vec3d(1.5, 2.5, 3.5));
+
+	std::vector<Vec3d> positions(5000, Vec3d(1e9 + 0.5, 2.0, -1e9));
+	std::vector<Transformd> transforms(5000, Transformd(Quat::Identity, Vec3d(1e9 + 0.5, 2.0, -1e9)));
+	std::vector<Vec3> float_positions(5000, Vec3(1024.5f, 2.f, -2048.f));
+	std::vector<Transform> float_transforms(5000, Transform(Vec3(1024.5f, 2.f, -2048.f)));
+
+	LargeWorld::Rebase(positions.data(), positions.size(), Vec3d(1e9, 0.0, -1e9), true);
+	LargeWorld::Rebase(transforms.data(), transforms.size(), Vec3d(1e9, 0.0, -1e9));
+	LargeWorld::Rebase(float_positions.data(), float_positions.size(), Vec3d(1024.0, 0.0, -2048.0));
+	LargeWorld::Rebase(float_transforms.data(), float_transforms.size(), Vec3d(1024.0, 0.0, -2048.0), true);
+
+	for (size_t i = 0; i < 5000; ++i)
+	{
+		EXPECT_EQ(positions[i], Vec3d(0.5, 2.0, 0.0));
+		EXPECT_EQ(transforms[i].position, Vec3d(0.5, 2.0, 0.0));
+		EXPECT_EQ(float_positions[i], Vec3(0.5f, 2.f, 0.f));
+		EXPECT_EQ(float_transforms[i].position, Vec3(0.5f, 2.f, 0.f));
+	}
+}